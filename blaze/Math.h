@@ -51,8 +51,11 @@
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DualCompressedMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/EllMatrix.h>
+#include <blaze/math/EncodedMatrix.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Functors.h>
@@ -67,6 +70,7 @@
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PatternMatrix.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
@@ -119,6 +119,7 @@
 //          <li> \ref cpp_threads_parallelization </li>
 //          <li> \ref boost_threads_parallelization </li>
 //          <li> \ref hpx_parallelization </li>
+//          <li> \ref tbb_parallelization </li>
 //          <li> \ref serial_execution </li>
 //       </ul>
 //    </li>
@@ -10402,12 +10403,13 @@
 // core. However, today's CPUs are not single core anymore, but provide several (homogeneous
 // or heterogeneous) compute cores. In order to fully exploit the performance potential of a
 // multicore CPU, computations have to be parallelized across all available cores of a CPU.
-// For this purpose, \b Blaze provides four different shared memory parallelization techniques:
+// For this purpose, \b Blaze provides five different shared memory parallelization techniques:
 //
 //  - \ref openmp_parallelization
 //  - \ref cpp_threads_parallelization
 //  - \ref boost_threads_parallelization
 //  - \ref hpx_parallelization
+//  - \ref tbb_parallelization
 //
 // When any of the shared memory parallelization techniques is activated, all arithmetic
 // operations on dense vectors and matrices (including additions, subtractions, multiplications,
@@ -10498,6 +10500,35 @@
 // performance for all possible situations and configurations. They merely provide a reasonable
 // standard for the current CPU generation.
 //
+// Alternatively, the thresholds can be adapted at runtime without recompilation. Every threshold
+// can be set individually via the \c setSMPThreshold() function. Additionally, the
+// \c calibrateSMPThresholds() function determines all thresholds for the current system and
+// the current number of threads by means of a short calibration run. The calibrated thresholds
+// can be written to a file via \c saveSMPThresholds() and can be restored in subsequent runs
+// via \c loadSMPThresholds(). Note that these three calibration functions are not part of the
+// <tt><blaze/Math.h></tt> header, but are provided by the <tt><blaze/math/smp/Calibration.h></tt>
+// header:
+
+   \code
+   #include <blaze/math/smp/Calibration.h>
+
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 50000UL );  // Adapting a single threshold
+
+   if( !blaze::loadSMPThresholds( "blaze_thresholds.txt" ) ) {  // Reusing a previous calibration
+      blaze::calibrateSMPThresholds();                          // Calibrating all thresholds
+      blaze::saveSMPThresholds( "blaze_thresholds.txt" );       // Persisting the calibration
+   }
+
+   blaze::resetSMPThresholds();  // Restoring the compile time defaults
+   \endcode
+
+// Note that the thresholds are not synchronized: They are stored as plain values that are read
+// by every operation without any locking or atomic access. Therefore the thresholds must not be
+// adapted (neither via \c setSMPThreshold(), \c resetSMPThresholds(), \c loadSMPThresholds()
+// nor \c calibrateSMPThresholds()) while any other thread executes a \b Blaze operation. The
+// recommended approach is to configure all thresholds once at the beginning of the program,
+// before the first parallel operation is started.
+//
 //
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
@@ -10722,6 +10753,105 @@
 // threads.
 //
 //
+// \n \section cpp_threads_affinity C++11 Thread Affinity
+// <hr>
+//
+// By default the C++11 threads of \b Blaze are not bound to any CPU and may be migrated by the
+// operating system, which destroys the contents of the caches. On Linux systems it is possible
+// to pin the threads to specific CPUs, either via the environment variable
+// \c BLAZE_THREAD_AFFINITY, which accepts the policies \c compact and \c scatter or an explicit
+// list of CPUs, and the optional environment variable \c BLAZE_NUMA_NODE, which restricts the
+// policies to the CPUs of a single NUMA node:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact  // Pinning the threads to neighboring cores
+   export BLAZE_THREAD_AFFINITY=0-3,8-11 // Pinning the threads to the given CPUs
+   export BLAZE_NUMA_NODE=1              // Restricting the policies to NUMA node 1
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   blaze::setThreadAffinity( blaze::scatterAffinity );     // Scattered placement
+   blaze::setThreadAffinity( blaze::compactAffinity, 1 );  // Compact placement on NUMA node 1
+   blaze::setThreadAffinity( { 0, 2, 4, 6 } );             // Explicit placement
+   blaze::setThreadAffinity( blaze::noAffinity );          // No placement
+   \endcode
+
+// Since every thread parallel operation distributes its work among the threads in the same
+// order, every pinned thread processes the same part of the operands in consecutive operations
+// and can reuse its cached data. Note that the function has no effect for the OpenMP-based
+// parallelization, whose thread placement is controlled via the \c OMP_PROC_BIND and
+// \c OMP_PLACES environment variables.
+//
+//
+// \n \section cpp_threads_spinning C++11 Thread Spin Waiting
+// <hr>
+//
+// For every parallel operation the threads of \b Blaze have to be woken up and the calling thread
+// has to wait until all threads have finished their part of the work. In case the threads block
+// on a condition variable in between two operations, the latency of this fork/join is comparable
+// to the work of operations running only a few microseconds (as for instance the addition of two
+// vectors of 100,000 elements). Therefore idle threads busy wait for new work for a certain time
+// before they block, and the calling thread busy waits for the completion of all threads. As long
+// as the threads are spinning, neither the dispatch nor the completion of an operation requires
+// any lock or system call. The spin time can be specified in microseconds (the default is 100)
+// either via the environment variable \c BLAZE_SPIN_TIME
+
+   \code
+   export BLAZE_SPIN_TIME=50  // Spinning for up to 50 microseconds
+   export BLAZE_SPIN_TIME=0   // No spinning
+   \endcode
+
+// or alternatively via the \c setThreadSpinTime() function:
+
+   \code
+   blaze::setThreadSpinTime( 500 );  // Spinning for up to 500 microseconds
+   \endcode
+
+// Since every thread parallel operation distributes its work among the threads in the same order
+// (see \ref cpp_threads_affinity), spinning and pinned threads in combination allow to efficiently
+// execute operations in parallel that run only for 10 to 20 microseconds. In this case it might
+// be beneficial to lower the according thresholds (see \ref cpp_threads_configuration). Note,
+// however, that spinning threads occupy their CPU. Therefore the threads don't spin at all as
+// long as the number of threads exceeds the number of CPUs available to the process. In case the
+// CPUs are shared with other applications, spinning should be disabled explicitly. The same
+// setting is also available for the Boost thread-based parallelization. For the OpenMP-based
+// parallelization the function has no effect, the waiting behavior of the OpenMP threads is
+// controlled via the \c OMP_WAIT_POLICY environment variable. For the HPX-based and TBB-based
+// parallelizations the function has no effect either, since the waiting behavior of the worker
+// threads is determined by the HPX runtime and the TBB task scheduler, respectively.
+//
+//
+// \n \section cpp_threads_async Asynchronous Assignments
+// <hr>
+//
+// By default every parallel operation blocks until all threads have finished their part of the
+// work. In order to overlap the evaluation of an expression with other work, it is possible to
+// start a dense vector or dense matrix assignment asynchronously via the \c asyncAssign()
+// function. The function schedules the parallel evaluation on the threads of \b Blaze and
+// returns a blaze::AsyncHandle, which can be used to wait for the completion of the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization of A and x
+
+   blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );  // Equivalent to y = A * x
+
+   // ... Work that doesn't depend on y and doesn't modify A, x, or y
+
+   handle.wait();  // Waiting for the completion of the assignment
+   \endcode
+
+// The operands and the target of the assignment must neither be destroyed nor modified before
+// the assignment is completed. Any exception thrown during the evaluation is rethrown by the
+// \c wait() function. Note that the destructor of the handle also waits for the completion of
+// the assignment. In case the assignment cannot be executed in parallel (e.g. due to aliasing,
+// within a serial section, for sparse or restricted targets, or for the OpenMP- and HPX-based
+// parallelization), it is performed synchronously and the returned handle is already completed.
+//
+//
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
 //
@@ -10740,7 +10870,8 @@
 // maximum performance for all possible situations and configurations. They merely provide a
 // reasonable standard for the current CPU generation. Also note that the provided defaults
 // have been determined using the OpenMP parallelization and require individual adaption for
-// the C++11 thread parallelization.
+// the C++11 thread parallelization. For that purpose the thresholds can also be calibrated at
+// runtime (see \ref openmp_configuration).
 //
 //
 // \n \section cpp_threads_known_issues Known Issues
@@ -10855,7 +10986,7 @@
 // \tableofcontents
 //
 //
-// The fourth and final shared memory parallelization provided with \b Blaze is based on
+// The fourth shared memory parallelization provided with \b Blaze is based on
 // <a href="http://stellar.cct.lsu.edu/projects/hpx/">HPX</a>.
 //
 //
@@ -10918,7 +11049,99 @@
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the HPX-based parallelization.
 //
-// \n Previous: \ref boost_threads_parallelization &nbsp; &nbsp; Next: \ref serial_execution
+// \n Previous: \ref boost_threads_parallelization &nbsp; &nbsp; Next: \ref tbb_parallelization
+*/
+//*************************************************************************************************
+
+
+//**TBB Parallelization****************************************************************************
+/*!\page tbb_parallelization TBB Parallelization
+//
+// \tableofcontents
+//
+//
+// The fifth and final shared memory parallelization provided with \b Blaze is based on the
+// <a href="https://github.com/oneapi-src/oneTBB">Intel Threading Building Blocks (TBB)</a>.
+// In contrast to the other parallelizations, \b Blaze does not create any threads of its own,
+// but executes all parallel operations as TBB tasks. This enables \b Blaze to cooperate with
+// the task scheduler of an application that is already based on TBB instead of competing with
+// it for the available cores.
+//
+//
+// \n \section tbb_setup TBB Setup
+// <hr>
+//
+// In order to enable the TBB-based parallelization, the \c BLAZE_USE_TBB_THREADS command line
+// argument has to be explicitly specified during compilation and the TBB library has to be
+// linked:
+
+   \code
+   ... -DBLAZE_USE_TBB_THREADS ... -ltbb ...
+   \endcode
+
+// Note that the OpenMP-based, C++11 thread-based, Boost thread-based, and HPX-based
+// parallelizations have priority, i.e. are preferred in case either is enabled in combination
+// with the TBB parallelization.
+//
+// By default, all parallel operations are executed within the task arena of the calling thread,
+// i.e. by default with all worker threads of TBB. Alternatively, it is possible to supply an
+// explicit task arena via the \c setTaskArena() function. All subsequent parallel operations are
+// executed by the worker threads of this task arena:
+
+   \code
+   tbb::task_arena arena( 8 );  // Task arena of the application
+
+   blaze::setTaskArena( arena );
+
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+   C = A * B;  // Executed within 'arena'
+
+   blaze::resetTaskArena();
+   \endcode
+
+// Please note that the task arena is not owned by \b Blaze and must not be destroyed before a
+// call to the \c resetTaskArena() function. In order to query the number of threads used for
+// the parallelization of operations, the \c getNumThreads() function can be used:
+
+   \code
+   const size_t threads = blaze::getNumThreads();
+   \endcode
+
+// In the context of TBB, the function returns the maximum concurrency of the supplied task arena
+// or, in case no task arena has been supplied, of the task arena of the calling thread. In case
+// the number of threads should be restricted without managing a task arena explicitly, the
+// \c setNumThreads() function can be used. It creates a task arena owned by \b Blaze with the
+// given maximum concurrency, which replaces any supplied task arena until the next call to the
+// \c setTaskArena() or \c resetTaskArena() function:
+
+   \code
+   blaze::setNumThreads( 4 );  // All subsequent parallel operations use up to 4 threads
+   // ...
+   blaze::resetTaskArena();    // Returning to the task arena of the calling thread
+   \endcode
+
+// Since the worker threads are owned by the TBB task scheduler, the \c setThreadAffinity() and
+// \c setThreadSpinTime() functions and the \c shutDownThreads() function have no effect for the
+// TBB-based parallelization.
+//
+// Since parallel operations are executed as regular TBB tasks, they can be started from within
+// the tasks of the application, for instance within the body of a \c tbb::parallel_for() loop.
+// Operations that are started from within a block of another parallel \b Blaze operation are
+// executed serially.
+//
+//
+// \n \section tbb_configuration TBB Configuration
+// <hr>
+//
+// As in case of the other shared memory parallelizations \b Blaze is not unconditionally running
+// an operation in parallel (see for instance \ref openmp_parallelization). Only in case a given
+// operation is large enough and exceeds a certain threshold the operation is executed in parallel.
+// All thresholds related to the TBB-based parallelization are contained within the configuration
+// file <tt><blaze/config/Thresholds.h></tt> and can be adapted at runtime (see
+// \ref openmp_configuration).
+//
+// \n Previous: \ref hpx_parallelization &nbsp; &nbsp; Next: \ref serial_execution
 */
 //*************************************************************************************************
 
@@ -11001,7 +11224,7 @@
 // In case the \c BLAZE_USE_SHARED_MEMORY_PARALLELIZATION switch is set to 0, the shared memory
 // parallelization is deactivated altogether.
 //
-// \n Previous: \ref hpx_parallelization &nbsp; &nbsp; Next: \ref serialization
+// \n Previous: \ref tbb_parallelization &nbsp; &nbsp; Next: \ref serialization
 */
 //*************************************************************************************************
 
@@ -11449,6 +11672,48 @@
 // streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section numa_placement NUMA Placement
+// <hr>
+//
+// On systems with several NUMA nodes the operating system places every memory page on the NUMA
+// node of the thread that touches it first. Since dense vectors and matrices are initialized by
+// the constructing thread, by default all their elements end up on a single NUMA node and all
+// threads running on other NUMA nodes are limited by the latency and bandwidth of remote memory
+// accesses. The configuration file <tt>./blaze/config/Optimizations.h</tt> provides a compile
+// time switch that can be used to select the placement of large dense vectors and matrices:
+
+   \code
+   #define BLAZE_NUMA_PLACEMENT 0
+   \endcode
+
+// Alternatively the NUMA placement can be selected via command line or by defining this symbol
+// manually before including any \b Blaze header file:
+
+   \code
+   #define BLAZE_NUMA_PLACEMENT 1
+   #include <blaze/Blaze.h>
+   \endcode
+
+// If \c BLAZE_NUMA_PLACEMENT is set to 0 the placement is left to the operating system. If it
+// is set to 1 large dense vectors and matrices (i.e. \ref matrix_types_dynamic_matrix and
+// \ref vector_types_dynamic_vector) of built-in data type are initialized in parallel, using the
+// same partitioning as the SMP assignments. This spreads the memory pages among the NUMA nodes
+// of all threads, but since the SMP backends assign blocks to threads dynamically, a block is
+// not guaranteed to be touched by the thread that later assigns it. This parallel first-touch
+// initialization is most effective in combination with pinned threads (see
+// \ref cpp_threads_affinity). If it is set to 2 all allocations of at
+// least 1 MiB are interleaved page by page among all available NUMA nodes. Additionally, the
+// \c interleaveMemory() and \c bindMemory() functions can be used to explicitly interleave an
+// existing vector or matrix or to bind it to a specific NUMA node:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   blaze::bindMemory( A.data(), A.capacity()*sizeof(double), 1UL );  // Binding A to NUMA node 1
+   \endcode
+
+// Note that NUMA placement is currently only supported on Linux systems.
+//
+//
 // \n Previous: \ref customization &nbsp; &nbsp; Next: \ref vector_and_matrix_customization \n
 */
 //*************************************************************************************************
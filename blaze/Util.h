@@ -71,6 +71,7 @@
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/Serialization.h>
 #include <blaze/util/Singleton.h>
 #include <blaze/util/SmallVector.h>
@@ -120,3 +120,71 @@
 #define BLAZE_USE_OPTIMIZED_KERNELS 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the NUMA placement of large dense vectors and matrices.
+// \ingroup config
+//
+// This configuration switch selects the placement of the memory of large dense vectors and
+// matrices on systems with several NUMA nodes. By default the operating system places every
+// memory page on the NUMA node of the thread that touches it first. Since dense vectors and
+// matrices are initialized by the constructing thread, all their elements end up on a single
+// NUMA node and the threads of all other nodes pay the latency and bandwidth penalty of remote
+// memory accesses during all SMP operations.
+//
+// Possible settings for the NUMA placement:
+//  - Default placement by the operating system: \b 0
+//  - Parallel first-touch initialization      : \b 1
+//  - Interleaved allocation                   : \b 2
+//
+// In case the parallel first-touch initialization is selected, the elements of large dense
+// vectors and matrices of built-in data type are initialized in parallel, using the same
+// partitioning as the SMP assignment. This distributes the memory pages among the NUMA nodes
+// of all participating threads. However, it is not guaranteed that a block is touched by the
+// same thread that later assigns it, since the SMP backends distribute the blocks dynamically
+// among their threads (for instance via the dynamic OpenMP schedule or via work stealing) and
+// since some SMP kernels use a weighted partitioning. The placement is most effective with
+// pinned threads (see \ref cpp_threads_affinity). In case interleaved allocation is selected,
+// all allocations of at least 1 MiB are distributed page by page among all available NUMA
+// nodes. Both settings are currently only supported on Linux systems.
+//
+// \note It is possible to select the NUMA placement via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_NUMA_PLACEMENT 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_NUMA_PLACEMENT
+#define BLAZE_NUMA_PLACEMENT 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the maximum capacity of the scratch arenas.
+// \ingroup config
+//
+// This setting specifies the maximum capacity in Byte of the scratch arena of every thread (see
+// the ScratchArena class), which provides the memory for the temporaries of expression templates.
+// Requests that would grow the arena beyond this size are served directly by the system
+// allocator and returned to the system on release. Since the arena never returns its chunks
+// while the thread is running, the setting bounds the memory that is kept alive per thread.
+//
+// The maximum capacity is specified in Byte. For instance, a maximum capacity of 32 MiByte must
+// therefore be specified as 33554432.
+//
+// \note It is possible to specify the maximum capacity via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SCRATCH_ARENA_LIMIT 33554432UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SCRATCH_ARENA_LIMIT
+#define BLAZE_SCRATCH_ARENA_LIMIT 33554432UL
+#endif
+//*************************************************************************************************
@@ -1966,3 +1966,101 @@
 #define BLAZE_SMP_TSMATTSMATMULT_THRESHOLD 22500UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion of a sparse matrix into the opposite storage
+// order (as for instance the assignment of a row-major sparse matrix to a column-major compressed
+// matrix or the in-place transpose of a compressed matrix) can be executed in parallel. In case
+// the number of non-zero elements of the sparse matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of non-zero elements is below this threshold
+// the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 100000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRANSPOSE_THRESHOLD
+#define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense/sparse matrix conversion threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion between a dense and a sparse matrix (as for
+// instance the construction of a compressed matrix from a dense matrix or the assignment of a
+// sparse matrix to a dynamic matrix) can be executed in parallel. In case the number of elements
+// of the dense matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATSMATCONVERT_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATSMATCONVERT_THRESHOLD
+#define BLAZE_SMP_DMATSMATCONVERT_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix reordering threshold.
+// \ingroup config
+//
+// This threshold specifies when the reordering of a sparse matrix (i.e. the symmetric permutation
+// of its rows and columns via the permute() function and the setup of its adjacency structure
+// for the computation of a fill-reducing ordering) can be executed in parallel. In case the
+// number of non-zero elements of the sparse matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of non-zero elements is below this threshold
+// the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATREORDER_THRESHOLD 100000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATREORDER_THRESHOLD
+#define BLAZE_SMP_SMATREORDER_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
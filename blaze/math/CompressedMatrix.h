@@ -43,6 +43,9 @@
 #include <cmath>
 #include <vector>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MaskedMult.h>
+#include <blaze/math/sparse/Reordering.h>
+#include <blaze/math/sparse/Semiring.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/IdentityMatrix.h>
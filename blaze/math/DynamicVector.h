@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/ScratchVector.h>
 #include <blaze/math/dense/StaticVector.h>
 #include <blaze/math/DenseVector.h>
 #include <blaze/math/DynamicMatrix.h>
@@ -62,28 +63,29 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of DynamicVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-class Rand< DynamicVector<Type,TF> >
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+class Rand< DynamicVector<Type,TF,Alloc> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const DynamicVector<Type,TF> generate( size_t n ) const;
+   inline const DynamicVector<Type,TF,Alloc> generate( size_t n ) const;
 
    template< typename Arg >
-   inline const DynamicVector<Type,TF> generate( size_t n, const Arg& min, const Arg& max ) const;
+   inline const DynamicVector<Type,TF,Alloc> generate( size_t n, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicVector<Type,TF>& vector ) const;
+   inline void randomize( DynamicVector<Type,TF,Alloc>& vector ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicVector<Type,TF>& vector, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicVector<Type,TF,Alloc>& vector, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -98,11 +100,12 @@ class Rand< DynamicVector<Type,TF> >
 // \param n The size of the random vector.
 // \return The generated random vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const DynamicVector<Type,TF> Rand< DynamicVector<Type,TF> >::generate( size_t n ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline const DynamicVector<Type,TF,Alloc> Rand< DynamicVector<Type,TF,Alloc> >::generate( size_t n ) const
 {
-   DynamicVector<Type,TF> vector( n );
+   DynamicVector<Type,TF,Alloc> vector( n );
    randomize( vector );
    return vector;
 }
@@ -119,13 +122,14 @@ inline const DynamicVector<Type,TF> Rand< DynamicVector<Type,TF> >::generate( si
 // \param max The largest possible value for a vector element.
 // \return The generated random vector.
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline const DynamicVector<Type,TF>
-   Rand< DynamicVector<Type,TF> >::generate( size_t n, const Arg& min, const Arg& max ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline const DynamicVector<Type,TF,Alloc>
+   Rand< DynamicVector<Type,TF,Alloc> >::generate( size_t n, const Arg& min, const Arg& max ) const
 {
-   DynamicVector<Type,TF> vector( n );
+   DynamicVector<Type,TF,Alloc> vector( n );
    randomize( vector, min, max );
    return vector;
 }
@@ -140,9 +144,10 @@ inline const DynamicVector<Type,TF>
 // \param vector The vector to be randomized.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& vector ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void Rand< DynamicVector<Type,TF,Alloc> >::randomize( DynamicVector<Type,TF,Alloc>& vector ) const
 {
    using blaze::randomize;
 
@@ -164,10 +169,11 @@ inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& v
 // \param max The largest possible value for a vector element.
 // \return void
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Arg >  // Min/max argument type
-inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& vector,
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Arg >    // Min/max argument type
+inline void Rand< DynamicVector<Type,TF,Alloc> >::randomize( DynamicVector<Type,TF,Alloc>& vector,
                                                        const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
@@ -43,6 +43,7 @@
 #include <blaze/math/functors/Abs.h>
 #include <blaze/math/functors/Acos.h>
 #include <blaze/math/functors/Acosh.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/AddAssign.h>
 #include <blaze/math/functors/Asin.h>
 #include <blaze/math/functors/Asinh.h>
@@ -79,8 +80,11 @@
 #include <blaze/math/functors/Log.h>
 #include <blaze/math/functors/Log2.h>
 #include <blaze/math/functors/Log10.h>
+#include <blaze/math/functors/LogicalAnd.h>
+#include <blaze/math/functors/LogicalOr.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/functors/MultAssign.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
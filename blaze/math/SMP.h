@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/AsyncAssign.h>
+#include <blaze/math/smp/AsyncHandle.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
 #include <blaze/math/smp/Functions.h>
@@ -43,6 +43,7 @@
 #include <blaze/math/typetraits/HasAdd.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasDiv.h>
+#include <blaze/math/typetraits/HasDualIndex.h>
 #include <blaze/math/typetraits/HasMax.h>
 #include <blaze/math/typetraits/HasMin.h>
 #include <blaze/math/typetraits/HasMult.h>
@@ -59,6 +60,7 @@
 #include <blaze/math/typetraits/HasSIMDCbrt.h>
 #include <blaze/math/typetraits/HasSIMDCeil.h>
 #include <blaze/math/typetraits/HasSIMDConj.h>
+#include <blaze/math/typetraits/HasSIMDCountNonZeros.h>
 #include <blaze/math/typetraits/HasSIMDCos.h>
 #include <blaze/math/typetraits/HasSIMDCosh.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
@@ -1407,14 +1407,14 @@ struct AddTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    using Type = AddTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = AddTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct AddTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
    using Type = AddTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1546,14 +1546,14 @@ struct SubTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    using Type = SubTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = SubTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct SubTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
    using Type = SubTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1685,14 +1685,14 @@ struct SchurTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    using Type = StrictlyLowerMatrix< SchurTrait_< HybridMatrix<T,M,N,SO1>, MT > >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SchurTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SchurTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = StrictlyLowerMatrix< SchurTrait_< MT, DynamicMatrix<T,SO2> > >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SchurTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct SchurTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
    using Type = StrictlyLowerMatrix< SchurTrait_< DynamicMatrix<T,SO1>, MT > >;
 };
@@ -1836,14 +1836,14 @@ struct MultTrait< HybridVector<T,N,true>, StrictlyLowerMatrix<MT,SO,DF> >
    using Type = MultTrait_< HybridVector<T,N,true>, MT >;
 };
 
-template< typename MT, bool SO, bool DF, typename T >
-struct MultTrait< StrictlyLowerMatrix<MT,SO,DF>, DynamicVector<T,false> >
+template< typename MT, bool SO, bool DF, typename T, typename A >
+struct MultTrait< StrictlyLowerMatrix<MT,SO,DF>, DynamicVector<T,false,A> >
 {
    using Type = MultTrait_< MT, DynamicVector<T,false> >;
 };
 
-template< typename T, typename MT, bool SO, bool DF >
-struct MultTrait< DynamicVector<T,true>, StrictlyLowerMatrix<MT,SO,DF> >
+template< typename T, typename A, typename MT, bool SO, bool DF >
+struct MultTrait< DynamicVector<T,true,A>, StrictlyLowerMatrix<MT,SO,DF> >
 {
    using Type = MultTrait_< DynamicVector<T,true>, MT >;
 };
@@ -1896,14 +1896,14 @@ struct MultTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    using Type = MultTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = MultTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct MultTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
    using Type = MultTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1408,14 +1408,14 @@ struct AddTrait< HybridMatrix<T,M,N,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
    using Type = AddTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct AddTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = AddTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< DynamicMatrix<T,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct AddTrait< DynamicMatrix<T,SO1,A>, StrictlyUpperMatrix<MT,SO2,DF> >
 {
    using Type = AddTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1583,14 +1583,14 @@ struct SubTrait< HybridMatrix<T,M,N,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
    using Type = SubTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SubTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = SubTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< DynamicMatrix<T,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct SubTrait< DynamicMatrix<T,SO1,A>, StrictlyUpperMatrix<MT,SO2,DF> >
 {
    using Type = SubTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1758,14 +1758,14 @@ struct SchurTrait< HybridMatrix<T,M,N,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
    using Type = StrictlyUpperMatrix< SchurTrait_< HybridMatrix<T,M,N,SO1>, MT > >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SchurTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SchurTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = StrictlyUpperMatrix< SchurTrait_< MT, DynamicMatrix<T,SO2> > >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SchurTrait< DynamicMatrix<T,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct SchurTrait< DynamicMatrix<T,SO1,A>, StrictlyUpperMatrix<MT,SO2,DF> >
 {
    using Type = StrictlyUpperMatrix< SchurTrait_< DynamicMatrix<T,SO1>, MT > >;
 };
@@ -1945,14 +1945,14 @@ struct MultTrait< HybridVector<T,N,true>, StrictlyUpperMatrix<MT,SO,DF> >
    using Type = MultTrait_< HybridVector<T,N,true>, MT >;
 };
 
-template< typename MT, bool SO, bool DF, typename T >
-struct MultTrait< StrictlyUpperMatrix<MT,SO,DF>, DynamicVector<T,false> >
+template< typename MT, bool SO, bool DF, typename T, typename A >
+struct MultTrait< StrictlyUpperMatrix<MT,SO,DF>, DynamicVector<T,false,A> >
 {
    using Type = MultTrait_< MT, DynamicVector<T,false> >;
 };
 
-template< typename T, typename MT, bool SO, bool DF >
-struct MultTrait< DynamicVector<T,true>, StrictlyUpperMatrix<MT,SO,DF> >
+template< typename T, typename A, typename MT, bool SO, bool DF >
+struct MultTrait< DynamicVector<T,true,A>, StrictlyUpperMatrix<MT,SO,DF> >
 {
    using Type = MultTrait_< DynamicVector<T,true>, MT >;
 };
@@ -2005,14 +2005,14 @@ struct MultTrait< HybridMatrix<T,M,N,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
    using Type = MultTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct MultTrait< StrictlyUpperMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = MultTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< DynamicMatrix<T,SO1>, StrictlyUpperMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF >
+struct MultTrait< DynamicMatrix<T,SO1,A>, StrictlyUpperMatrix<MT,SO2,DF> >
 {
    using Type = MultTrait_< DynamicMatrix<T,SO1>, MT >;
 };
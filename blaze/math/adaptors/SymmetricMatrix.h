@@ -751,14 +751,14 @@ struct AddTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    using Type = AddTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = AddTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct AddTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF, bool NF >
+struct AddTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
    using Type = AddTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -842,14 +842,14 @@ struct SubTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    using Type = SubTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = SubTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct SubTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF, bool NF >
+struct SubTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
    using Type = SubTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -933,14 +933,14 @@ struct SchurTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    using Type = SchurTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct SchurTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct SchurTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = SchurTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct SchurTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF, bool NF >
+struct SchurTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
    using Type = SchurTrait_< DynamicMatrix<T,SO1>, MT >;
 };
@@ -1036,14 +1036,14 @@ struct MultTrait< HybridVector<T,N,true>, SymmetricMatrix<MT,SO,DF,NF> >
    using Type = MultTrait_< HybridVector<T,N,true>, MT >;
 };
 
-template< typename MT, bool SO, bool DF, bool NF, typename T >
-struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, DynamicVector<T,false> >
+template< typename MT, bool SO, bool DF, bool NF, typename T, typename A >
+struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, DynamicVector<T,false,A> >
 {
    using Type = MultTrait_< MT, DynamicVector<T,false> >;
 };
 
-template< typename T, typename MT, bool SO, bool DF, bool NF >
-struct MultTrait< DynamicVector<T,true>, SymmetricMatrix<MT,SO,DF,NF> >
+template< typename T, typename A, typename MT, bool SO, bool DF, bool NF >
+struct MultTrait< DynamicVector<T,true,A>, SymmetricMatrix<MT,SO,DF,NF> >
 {
    using Type = MultTrait_< DynamicVector<T,true>, MT >;
 };
@@ -1096,14 +1096,14 @@ struct MultTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    using Type = MultTrait_< HybridMatrix<T,M,N,SO1>, MT >;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
    using Type = MultTrait_< MT, DynamicMatrix<T,SO2> >;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct MultTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename A, typename MT, bool SO2, bool DF, bool NF >
+struct MultTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
    using Type = MultTrait_< DynamicMatrix<T,SO1>, MT >;
 };
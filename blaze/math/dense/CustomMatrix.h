@@ -6387,26 +6387,26 @@ struct BinaryMapTrait< HybridMatrix<T1,M,N,SO1>, CustomMatrix<T2,AF,PF,SO2>, OP
    using Type = HybridMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, false >;
 };
 
-template< typename T1, bool AF, bool PF, bool SO, typename T2, typename OP >
-struct BinaryMapTrait< CustomMatrix<T1,AF,PF,SO>, DynamicMatrix<T2,SO>, OP >
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename A, typename OP >
+struct BinaryMapTrait< CustomMatrix<T1,AF,PF,SO>, DynamicMatrix<T2,SO,A>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, SO >;
 };
 
-template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename OP >
-struct BinaryMapTrait< CustomMatrix<T1,AF,PF,SO1>, DynamicMatrix<T2,SO2>, OP >
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2, typename A, typename OP >
+struct BinaryMapTrait< CustomMatrix<T1,AF,PF,SO1>, DynamicMatrix<T2,SO2,A>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, false >;
 };
 
-template< typename T1, bool SO, typename T2, bool AF, bool PF, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO>, CustomMatrix<T2,AF,PF,SO>, OP >
+template< typename T1, bool SO, typename A, typename T2, bool AF, bool PF, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO,A>, CustomMatrix<T2,AF,PF,SO>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2>, OP >
+template< typename T1, bool SO1, typename A, typename T2, bool AF, bool PF, bool SO2, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO1,A>, CustomMatrix<T2,AF,PF,SO2>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, false >;
 };
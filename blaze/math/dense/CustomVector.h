@@ -5138,14 +5138,14 @@ struct BinaryMapTrait< HybridVector<T1,N,TF>, CustomVector<T2,AF,PF,TF>, OP >
    using Type = HybridVector< BinaryMapTrait_<T1,T2,OP>, N, TF >;
 };
 
-template< typename T1, bool AF, bool PF, bool TF, typename T2, typename OP >
-struct BinaryMapTrait< CustomVector<T1,AF,PF,TF>, DynamicVector<T2,TF>, OP >
+template< typename T1, bool AF, bool PF, bool TF, typename T2, typename A, typename OP >
+struct BinaryMapTrait< CustomVector<T1,AF,PF,TF>, DynamicVector<T2,TF,A>, OP >
 {
    using Type = DynamicVector< BinaryMapTrait_<T1,T2,OP>, TF >;
 };
 
-template< typename T1, bool TF, typename T2, bool AF, bool PF, typename OP >
-struct BinaryMapTrait< DynamicVector<T1,TF>, CustomVector<T2,AF,PF,TF>, OP >
+template< typename T1, bool TF, typename A, typename T2, bool AF, bool PF, typename OP >
+struct BinaryMapTrait< DynamicVector<T1,TF,A>, CustomVector<T2,AF,PF,TF>, OP >
 {
    using Type = DynamicVector< BinaryMapTrait_<T1,T2,OP>, TF >;
 };
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
@@ -57,7 +58,9 @@
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/BinaryMapTrait.h>
@@ -119,6 +122,8 @@
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsAlignedAllocator.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -141,18 +146,25 @@ namespace blaze {
 // \ingroup dynamic_matrix
 //
 // The DynamicMatrix class template is the representation of an arbitrary sized matrix with
-// \f$ M \times N \f$ dynamically allocated elements of arbitrary type. The type of the elements
-// and the storage order of the matrix can be specified via the two template parameters:
+// \f$ M \times N \f$ dynamically allocated elements of arbitrary type. The type of the elements,
+// the storage order and the allocator of the matrix can be specified via the three template
+// parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename Alloc >
    class DynamicMatrix;
    \endcode
 
-//  - Type: specifies the type of the matrix elements. DynamicMatrix can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
-//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
-//          The default value is blaze::rowMajor.
+//  - Type : specifies the type of the matrix elements. DynamicMatrix can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - SO   : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//           The default value is blaze::rowMajor.
+//  - Alloc: specifies the type of the allocator for the matrix elements. The allocator has to
+//           satisfy the allocator requirements of the standard library. In case the allocator
+//           provides memory that is aligned according to the alignment restrictions of \a Type
+//           (see blaze::AlignmentOf and blaze::IsAlignedAllocator), aligned SIMD operations are
+//           used, else the matrix is treated as unaligned and unpadded and all operations fall
+//           back to unaligned SIMD operations. The default allocator is blaze::AlignedAllocator.
 //
 // Depending on the storage order, the matrix elements are either stored in a row-wise fashion
 // or in a column-wise fashion. Given the 2x3 matrix
@@ -213,29 +225,34 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename Alloc >                 // Type of the allocator (default: AlignedAllocator)
 class DynamicMatrix
-   : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
+   : public DenseMatrix< DynamicMatrix<Type,SO,Alloc>, SO >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicMatrix<Type,SO>;   //!< Type of this DynamicMatrix instance.
-   using BaseType      = DenseMatrix<This,SO>;     //!< Base type of this DynamicMatrix instance.
-   using ResultType    = This;                     //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                     //!< Type of the matrix elements.
-   using SIMDType      = SIMDTrait_<ElementType>;  //!< SIMD type of the matrix elements.
-   using ReturnType    = const Type&;              //!< Return type for expression template evaluations.
-   using CompositeType = const This&;              //!< Data type for composite expression templates.
+   using This          = DynamicMatrix<Type,SO,Alloc>;   //!< Type of this DynamicMatrix instance.
+   using BaseType      = DenseMatrix<This,SO>;           //!< Base type of this DynamicMatrix instance.
+   using ResultType    = This;                           //!< Result type for expression template evaluations.
+   using OppositeType  = DynamicMatrix<Type,!SO,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,!SO,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                           //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_<ElementType>;        //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                    //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                          //!< Type of the allocator.
 
    using Reference      = Type&;        //!< Reference to a non-constant matrix value.
    using ConstReference = const Type&;  //!< Reference to a constant matrix value.
    using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
    using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
 
-   using Iterator      = DenseIterator<Type,usePadding>;        //!< Iterator over non-constant elements.
-   using ConstIterator = DenseIterator<const Type,usePadding>;  //!< Iterator over constant elements.
+   //! Iterator over non-constant elements.
+   using Iterator = DenseIterator< Type, usePadding && IsAlignedAllocator<Alloc>::value >;
+
+   //! Iterator over constant elements.
+   using ConstIterator = DenseIterator< const Type, usePadding && IsAlignedAllocator<Alloc>::value >;
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -243,7 +260,9 @@ class DynamicMatrix
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = DynamicMatrix<NewType,SO>;  //!< The type of the other DynamicMatrix.
+      //! The type of the other DynamicMatrix.
+      using Other = DynamicMatrix< NewType, SO
+                                 , typename std::allocator_traits<Alloc>::template rebind_alloc<NewType> >;
    };
    //**********************************************************************************************
 
@@ -253,7 +272,7 @@ class DynamicMatrix
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = DynamicMatrix<Type,SO>;  //!< The type of the other DynamicMatrix.
+      using Other = DynamicMatrix<Type,SO,Alloc>;  //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -276,8 +295,9 @@ class DynamicMatrix
    /*!\name Constructors */
    //@{
    explicit inline DynamicMatrix() noexcept;
-   explicit inline DynamicMatrix( size_t m, size_t n );
-   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+   explicit inline DynamicMatrix( const Alloc& alloc ) noexcept;
+   explicit inline DynamicMatrix( size_t m, size_t n, const Alloc& alloc = Alloc() );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc = Alloc() );
    explicit inline DynamicMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other >
@@ -329,7 +349,8 @@ class DynamicMatrix
    inline DynamicMatrix& operator=( const Other (&array)[Rows][Cols] );
 
    inline DynamicMatrix& operator=( const DynamicMatrix& rhs );
-   inline DynamicMatrix& operator=( DynamicMatrix&& rhs ) noexcept;
+   inline DynamicMatrix& operator=( DynamicMatrix&& rhs )
+      noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value );
 
    template< typename MT, bool SO2 > inline DynamicMatrix& operator= ( const Matrix<MT,SO2>& rhs );
    template< typename MT, bool SO2 > inline DynamicMatrix& operator+=( const Matrix<MT,SO2>& rhs );
@@ -355,7 +376,9 @@ class DynamicMatrix
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
-   inline void   swap( DynamicMatrix& m ) noexcept;
+   inline void   swap( DynamicMatrix& m )
+      noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value );
+   inline Alloc  getAllocator() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -497,16 +520,22 @@ class DynamicMatrix
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+   using AllocTraits = std::allocator_traits<Alloc>;  //!< Traits of the allocator type.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+   inline void   initialize( const Type& init );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc  alloc_;            //!< The allocator of the matrix elements.
    size_t m_;                //!< The current number of rows of the matrix.
    size_t n_;                //!< The current number of columns of the matrix.
    size_t nn_;               //!< The alignment adjusted number of columns.
@@ -547,10 +576,31 @@ class DynamicMatrix
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
-   : m_       ( 0UL )      // The current number of rows of the matrix
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix() noexcept
+   : alloc_   ()           // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , nn_      ( 0UL )      // The alignment adjusted number of columns
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator for the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
    , n_       ( 0UL )      // The current number of columns of the matrix
    , nn_      ( 0UL )      // The alignment adjusted number of columns
    , capacity_( 0UL )      // The maximum capacity of the matrix
@@ -564,20 +614,28 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the matrix elements.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the parallel first-touch initialization is
+// selected (see BLAZE_NUMA_PLACEMENT), large matrices of built-in data type are initialized in
+// parallel in order to spread the memory among the NUMA nodes of the SMP threads.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
-{
-   if( IsVectorizable<Type>::value ) {
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                                // The allocator of the matrix elements
+   , m_       ( m )                                    // The current number of rows of the matrix
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                      // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, alloc_ ) )  // The matrix elements
+{
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() ) {
+      initialize( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -596,19 +654,17 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
+// \param alloc The allocator for the matrix elements.
 //
 // All matrix elements are initialized with the specified value.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
+   : DynamicMatrix( m, n, alloc )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
-      }
-   }
+   initialize( init );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -635,9 +691,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
 // initialized by the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
    : DynamicMatrix( list.size(), determineColumns( list ) )
 {
    size_t i( 0UL );
@@ -676,9 +733,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( initializer_list< initializer_list
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* array )
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( size_t m, size_t n, const Other* array )
    : DynamicMatrix( m, n )
 {
    for( size_t i=0UL; i<m; ++i ) {
@@ -713,12 +771,13 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* a
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Other  // Data type of the initialization array
-        , size_t Rows     // Number of rows of the initialization array
-        , size_t Cols >   // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Other (&array)[Rows][Cols] )
    : DynamicMatrix( Rows, Cols )
 {
    for( size_t i=0UL; i<Rows; ++i ) {
@@ -738,12 +797,15 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new matrix is
+// selected via std::allocator_traits::select_on_container_copy_construction().
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const DynamicMatrix& m )
+   : DynamicMatrix( m.m_, m.n_,
+                    std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
@@ -759,14 +821,16 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 //
 // \param m The matrix to be move into this instance.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( DynamicMatrix&& m ) noexcept
-   : m_       ( m.m_        )  // The current number of rows of the matrix
-   , n_       ( m.n_        )  // The current number of columns of the matrix
-   , nn_      ( m.nn_       )  // The alignment adjusted number of columns
-   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
-   , v_       ( m.v_        )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( DynamicMatrix&& m ) noexcept
+   : alloc_   ( std::move( m.alloc_ ) )  // The allocator of the matrix elements
+   , m_       ( m.m_        )            // The current number of rows of the matrix
+   , n_       ( m.n_        )            // The current number of columns of the matrix
+   , nn_      ( m.nn_       )            // The alignment adjusted number of columns
+   , capacity_( m.capacity_ )            // The maximum capacity of the matrix
+   , v_       ( m.v_        )            // The matrix elements
 {
    m.m_        = 0UL;
    m.n_        = 0UL;
@@ -782,19 +846,29 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( DynamicMatrix&& m ) noexcept
 //
 // \param m Matrix to be copied.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the foreign matrix
-        , bool SO2 >     // Storage order of the foreign matrix
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO2 >        // Storage order of the foreign matrix
+inline DynamicMatrix<Type,SO,Alloc>::DynamicMatrix( const Matrix<MT,SO2>& m )
    : DynamicMatrix( (~m).rows(), (~m).columns() )
 {
-   if( IsSparseMatrix<MT>::value ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         for( size_t j=0UL; j<n_; ++j ) {
-            v_[i*nn_+j] = Type();
+   if( IsSparseMatrix<MT>::value )
+   {
+      const auto kernel = [&]( size_t first, size_t last )
+      {
+         for( size_t i=first; i<last; ++i ) {
+            for( size_t j=0UL; j<n_; ++j ) {
+               v_[i*nn_+j] = Type();
+            }
          }
-      }
+      };
+
+      if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+         kernel( 0UL, m_ );
+      else
+         smpFor( 0UL, m_, kernel );
    }
 
    smpAssign( *this, ~m );
@@ -815,11 +889,12 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicMatrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::~DynamicMatrix()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( v_, capacity_, alloc_ );
 }
 //*************************************************************************************************
 
@@ -842,10 +917,11 @@ inline DynamicMatrix<Type,SO>::~DynamicMatrix()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Reference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Reference
+   DynamicMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -864,10 +940,11 @@ inline typename DynamicMatrix<Type,SO>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstReference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstReference
+   DynamicMatrix<Type,SO,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -887,10 +964,11 @@ inline typename DynamicMatrix<Type,SO>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Reference
-   DynamicMatrix<Type,SO>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Reference
+   DynamicMatrix<Type,SO,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -914,10 +992,11 @@ inline typename DynamicMatrix<Type,SO>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstReference
-   DynamicMatrix<Type,SO>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstReference
+   DynamicMatrix<Type,SO,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -942,10 +1021,11 @@ inline typename DynamicMatrix<Type,SO>::ConstReference
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer
-   DynamicMatrix<Type,SO>::data() noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Pointer
+   DynamicMatrix<Type,SO,Alloc>::data() noexcept
 {
    return v_;
 }
@@ -964,10 +1044,11 @@ inline typename DynamicMatrix<Type,SO>::Pointer
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer
-   DynamicMatrix<Type,SO>::data() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstPointer
+   DynamicMatrix<Type,SO,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -982,10 +1063,11 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer
-   DynamicMatrix<Type,SO>::data( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Pointer
+   DynamicMatrix<Type,SO,Alloc>::data( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return v_ + i*nn_;
@@ -1001,10 +1083,11 @@ inline typename DynamicMatrix<Type,SO>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer
-   DynamicMatrix<Type,SO>::data( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstPointer
+   DynamicMatrix<Type,SO,Alloc>::data( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return v_ + i*nn_;
@@ -1023,10 +1106,11 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::begin( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Iterator
+   DynamicMatrix<Type,SO,Alloc>::begin( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ );
@@ -1045,10 +1129,11 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::begin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::begin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -1067,10 +1152,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::cbegin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -1089,10 +1175,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::end( size_t i ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::Iterator
+   DynamicMatrix<Type,SO,Alloc>::end( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ + n_ );
@@ -1111,10 +1198,11 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::end( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::end( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -1133,10 +1221,11 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cend( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,Alloc>::ConstIterator
+   DynamicMatrix<Type,SO,Alloc>::cend( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -1158,9 +1247,10 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // \param rhs Scalar value to be assigned to all matrix elements.
 // \return Reference to the assigned matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Type& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Type& rhs )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1192,10 +1282,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Type& rh
 // assigned the values from the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>&
-   DynamicMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>&
+   DynamicMatrix<Type,SO,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
    resize( list.size(), determineColumns( list ), false );
 
@@ -1232,12 +1323,13 @@ inline DynamicMatrix<Type,SO>&
 // The matrix is resized according to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
-template< typename Other  // Data type of the initialization array
-        , size_t Rows     // Number of rows of the initialization array
-        , size_t Cols >   // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Other (&array)[Rows][Cols] )
 {
    resize( Rows, Cols, false );
 
@@ -1259,9 +1351,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -1280,12 +1373,31 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicM
 //
 // \param rhs The matrix to be moved into this instance.
 // \return Reference to the assigned matrix.
+//
+// In case the allocator propagates on move assignment (see std::allocator_traits), the allocator
+// of the given matrix is moved into this instance together with its elements. Otherwise the
+// elements are only taken over in case both allocators compare equal. If they differ, the
+// elements are moved one by one into memory acquired from the allocator of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( DynamicMatrix&& rhs ) noexcept
-{
-   deallocate( v_ );
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( DynamicMatrix&& rhs )
+   noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value )
+{
+   if( !AllocTraits::propagate_on_container_move_assignment::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != rhs.alloc_ ) {
+      resize( rhs.m_, rhs.n_, false );
+      for( size_t i=0UL; i<m_; ++i ) {
+         std::move( rhs.v_+i*rhs.nn_, rhs.v_+i*rhs.nn_+n_, v_+i*nn_ );
+      }
+      return *this;
+   }
+
+   deallocate( v_, capacity_, alloc_ );
+
+   if( AllocTraits::propagate_on_container_move_assignment::value )
+      alloc_ = std::move( rhs.alloc_ );
 
    m_        = rhs.m_;
    n_        = rhs.n_;
@@ -1313,11 +1425,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( DynamicMatrix&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator=( const Matrix<MT,SO2>& rhs )
 {
    using TT = TransExprTrait_<This>;
    using CT = CTransExprTrait_<This>;
@@ -1357,11 +1470,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<M
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1392,11 +1506,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1427,11 +1542,12 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT    // Type of the right-hand side matrix
-        , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::operator%=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1465,9 +1581,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator%=( const Matrix<
 //
 // \return The number of rows of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -1479,9 +1596,10 @@ inline size_t DynamicMatrix<Type,SO>::rows() const noexcept
 //
 // \return The number of columns of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -1498,9 +1616,10 @@ inline size_t DynamicMatrix<Type,SO>::columns() const noexcept
 // the function returns the spacing between two rows, in case the storage flag is set to
 // \a columnMajor the function returns the spacing between two columns.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::spacing() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::spacing() const noexcept
 {
    return nn_;
 }
@@ -1512,9 +1631,10 @@ inline size_t DynamicMatrix<Type,SO>::spacing() const noexcept
 //
 // \return The capacity of the matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1532,9 +1652,10 @@ inline size_t DynamicMatrix<Type,SO>::capacity() const noexcept
 // in case the storage flag is set to \a columnMajor the function returns the capacity
 // of column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::capacity( size_t i ) const noexcept
 {
    UNUSED_PARAMETER( i );
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
@@ -1548,9 +1669,10 @@ inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const noexcept
 //
 // \return The number of non-zero elements in the dense matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1575,9 +1697,10 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros() const
 // elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
 // the number of non-zero elements in column \a i.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1598,15 +1721,24 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
 //
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reset()
 {
    using blaze::clear;
 
-   for( size_t i=0UL; i<m_; ++i )
-      for( size_t j=0UL; j<n_; ++j )
-         clear( v_[i*nn_+j] );
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            clear( v_[i*nn_+j] );
+   };
+
+   if( m_*n_ < SMP_DMATASSIGN_THRESHOLD )
+      kernel( 0UL, m_ );
+   else
+      smpFor( 0UL, m_, kernel );
 }
 //*************************************************************************************************
 
@@ -1622,9 +1754,10 @@ inline void DynamicMatrix<Type,SO>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset( size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reset( size_t i )
 {
    using blaze::clear;
 
@@ -1642,9 +1775,10 @@ inline void DynamicMatrix<Type,SO>::reset( size_t i )
 //
 // After the clear() function, the size of the matrix is 0.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::clear()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -1685,9 +1819,10 @@ inline void DynamicMatrix<Type,SO>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+void DynamicMatrix<Type,SO,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
    using blaze::min;
@@ -1695,10 +1830,11 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    if( m == m_ && n == n_ ) return;
 
    const size_t nn( addPadding( n ) );
+   const bool firstTouch( useFirstTouch && IsBuiltin<Type>::value && !preserve && m*nn > capacity_ );
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn, alloc_ );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1707,25 +1843,28 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       }
 
       swap( v_, v );
-      deallocate( v );
+      deallocate( v, capacity_, alloc_ );
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn, alloc_ );
       swap( v_, v );
-      deallocate( v );
+      deallocate( v, capacity_, alloc_ );
       capacity_ = m*nn;
    }
 
-   if( IsVectorizable<Type>::value ) {
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+
+   if( firstTouch && canSMPAssign() ) {
+      initialize( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m; ++i )
          for( size_t j=n; j<nn; ++j )
             v_[i*nn+j] = Type();
    }
-
-   m_  = m;
-   n_  = n;
-   nn_ = nn;
 }
 //*************************************************************************************************
 
@@ -1744,9 +1883,10 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new matrix elements are not
 // initialized!
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -1762,16 +1902,17 @@ inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
 // This function increases the capacity of the dense matrix to at least \a elements elements.
 // The current values of the matrix elements are preserved.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements, alloc_ );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -1783,7 +1924,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( tmp, capacity_, alloc_ );
       capacity_ = elements;
    }
 }
@@ -1800,9 +1941,10 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this matrix are invalidated.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::shrinkToFit()
 {
    if( ( m_ * nn_ ) < capacity_ ) {
       DynamicMatrix( *this ).swap( *this );
@@ -1816,13 +1958,45 @@ inline void DynamicMatrix<Type,SO>::shrinkToFit()
 //
 // \param m The matrix to be swapped.
 // \return void
+//
+// In case the allocator propagates on swap (see std::allocator_traits), the allocators are
+// swapped together with the elements. Otherwise the elements are only exchanged in case both
+// allocators compare equal. If they differ, every matrix keeps its allocator and the elements
+// are moved one by one into memory acquired from the according allocator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::swap( DynamicMatrix& m )
+   noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value )
 {
    using std::swap;
 
+   if( !AllocTraits::propagate_on_container_swap::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != m.alloc_ )
+   {
+      DynamicMatrix tmp( m.m_, m.n_, alloc_ );
+      for( size_t i=0UL; i<m.m_; ++i ) {
+         std::move( m.v_+i*m.nn_, m.v_+i*m.nn_+m.n_, tmp.v_+i*tmp.nn_ );
+      }
+
+      m.resize( m_, n_, false );
+      for( size_t i=0UL; i<m_; ++i ) {
+         std::move( v_+i*nn_, v_+i*nn_+n_, m.v_+i*m.nn_ );
+      }
+
+      swap( m_ , tmp.m_  );
+      swap( n_ , tmp.n_  );
+      swap( nn_, tmp.nn_ );
+      swap( capacity_, tmp.capacity_ );
+      swap( v_ , tmp.v_  );
+
+      return;
+   }
+
+   if( AllocTraits::propagate_on_container_swap::value )
+      swap( alloc_, m.alloc_ );
+
    swap( m_ , m.m_  );
    swap( n_ , m.n_  );
    swap( nn_, m.nn_ );
@@ -1832,6 +2006,21 @@ inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns a copy of the allocator of the matrix.
+//
+// \return The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline Alloc DynamicMatrix<Type,SO,Alloc>::getAllocator() const noexcept
+{
+   return alloc_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Add the necessary amount of padding to the given value.
 //
@@ -1841,9 +2030,10 @@ inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,Alloc>::addPadding( size_t value ) const noexcept
 {
    if( usePadding && IsVectorizable<Type>::value )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -1852,6 +2042,43 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initialization of all matrix elements with the given value.
+//
+// \param init The initial value of the matrix elements.
+// \return void
+//
+// This function initializes all matrix elements with the given value and all padding elements
+// with the default value. In case the parallel first-touch initialization is selected (see
+// BLAZE_NUMA_PLACEMENT) and the matrix of built-in data type is large enough for an SMP
+// assignment, the elements are initialized in parallel, using the same partitioning as the
+// SMP assignments.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,Alloc>::initialize( const Type& init )
+{
+   const auto kernel = [this,&init]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t jend( ( column+n == n_ )?( nn_ ):( column+n ) );
+
+      for( size_t i=row; i<row+m; ++i ) {
+         for( size_t j=column; j<column+n; ++j )
+            v_[i*nn_+j] = init;
+         for( size_t j=column+n; j<jend; ++j )
+            v_[i*nn_+j] = Type();
+      }
+   };
+
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() )
+      smpFirstTouch( *this, kernel );
+   else
+      kernel( 0UL, 0UL, m_, n_ );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1865,9 +2092,10 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::transpose()
 {
    using std::swap;
 
@@ -1903,9 +2131,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::ctranspose()
 {
    constexpr size_t block( BLOCK_SIZE );
 
@@ -1958,9 +2187,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    \endcode
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scalar )
+inline DynamicMatrix<Type,SO,Alloc>& DynamicMatrix<Type,SO,Alloc>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1988,9 +2218,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scala
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::isIntact() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::isIntact() const noexcept
 {
    if( m_ * n_ > capacity_ )
       return false;
@@ -2028,9 +2259,10 @@ inline bool DynamicMatrix<Type,SO>::isIntact() const noexcept
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,SO,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2048,9 +2280,10 @@ inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const noexcep
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,SO,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2066,11 +2299,12 @@ inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const noexce
 // whether the beginning and the end of each row/column of the matrix are guaranteed to conform
 // to the alignment restrictions of the element type \a Type.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::isAligned() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::isAligned() const noexcept
 {
-   return ( usePadding || columns() % SIMDSIZE == 0UL );
+   return IsAlignedAllocator<Alloc>::value && ( usePadding || columns() % SIMDSIZE == 0UL );
 }
 //*************************************************************************************************
 
@@ -2085,9 +2319,10 @@ inline bool DynamicMatrix<Type,SO>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,Alloc>::canSMPAssign() const noexcept
 {
    return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
 }
@@ -2109,12 +2344,13 @@ inline bool DynamicMatrix<Type,SO>::canSMPAssign() const noexcept
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::load( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::load( size_t i, size_t j ) const noexcept
 {
-   if( usePadding )
+   if( usePadding && IsAlignedAllocator<Alloc>::value )
       return loada( i, j );
    else
       return loadu( i, j );
@@ -2137,10 +2373,11 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::loada( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::loada( size_t i, size_t j ) const noexcept
 {
    using blaze::loada;
 
@@ -2172,10 +2409,11 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
-   DynamicMatrix<Type,SO>::loadu( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,Alloc>::SIMDType
+   DynamicMatrix<Type,SO,Alloc>::loadu( size_t i, size_t j ) const noexcept
 {
    using blaze::loadu;
 
@@ -2206,12 +2444,13 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
 {
-   if( usePadding )
+   if( usePadding && IsAlignedAllocator<Alloc>::value )
       storea( i, j, value );
    else
       storeu( i, j, value );
@@ -2235,10 +2474,11 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -2271,10 +2511,11 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -2306,10 +2547,11 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,SO,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -2337,11 +2579,12 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >
-   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2373,11 +2616,12 @@ inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssi
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >
-   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2389,7 +2633,7 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
    const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
-   if( usePadding && useStreaming &&
+   if( usePadding && IsAlignedAllocator<Alloc>::value && useStreaming &&
        ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
    {
       for( size_t i=0UL; i<m_; ++i )
@@ -2443,10 +2687,11 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssig
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2481,17 +2726,28 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   for( size_t i=0UL; i<m_; ++i )
-      for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         v_[i*nn_+element->index()] = element->value();
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+         for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            v_[i*nn_+element->index()] = element->value();
+   };
+
+   BLAZE_INTERNAL_ASSERT( isFlushed( ~rhs ), "Pending buffered insertions detected" );
+
+   if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+      kernel( 0UL, m_ );
+   else
+      smpFor( 0UL, m_, kernel );
 }
 //*************************************************************************************************
 
@@ -2507,19 +2763,30 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   for( size_t j=0UL; j<n_; ++j )
-      for( ConstIterator_<MT> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         v_[element->index()*nn_+j] = element->value();
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j )
+         for( ConstIterator_<MT> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            v_[element->index()*nn_+j] = element->value();
+   };
+
+   BLAZE_INTERNAL_ASSERT( isFlushed( ~rhs ), "Pending buffered insertions detected" );
+
+   if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+      kernel( 0UL, n_ );
+   else
+      smpFor( 0UL, n_, kernel );
 }
 //*************************************************************************************************
 
@@ -2535,11 +2802,12 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
-   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2586,11 +2854,12 @@ inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
-   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
@@ -2645,10 +2914,11 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddAs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2695,10 +2965,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2721,10 +2992,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2749,11 +3021,12 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
-   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2800,11 +3073,12 @@ inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
-   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
@@ -2859,10 +3133,11 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubAs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2909,10 +3184,11 @@ inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2935,10 +3211,11 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2963,11 +3240,12 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
-   DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2999,11 +3277,12 @@ inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSchu
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
-   DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,SO,Alloc>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
+   DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -3049,10 +3328,11 @@ inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSchur
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -3087,10 +3367,11 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,!SO>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::reset;
 
@@ -3127,10 +3408,11 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,SO>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,!SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,SO,Alloc>::schurAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    using blaze::reset;
 
@@ -3178,29 +3460,34 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const SparseMatrix<MT,!SO>& rhs
 // This specialization of DynamicMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class DynamicMatrix<Type,true>
-   : public DenseMatrix< DynamicMatrix<Type,true>, true >
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+class DynamicMatrix<Type,true,Alloc>
+   : public DenseMatrix< DynamicMatrix<Type,true,Alloc>, true >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicMatrix<Type,true>;   //!< Type of this DynamicMatrix instance.
-   using BaseType      = DenseMatrix<This,true>;     //!< Base type of this DynamicMatrix instance.
-   using ResultType    = This;                       //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicMatrix<Type,false>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicMatrix<Type,false>;  //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                       //!< Type of the matrix elements.
-   using SIMDType      = SIMDTrait_<ElementType>;    //!< SIMD type of the matrix elements.
-   using ReturnType    = const Type&;                //!< Return type for expression template evaluations.
-   using CompositeType = const This&;                //!< Data type for composite expression templates.
+   using This          = DynamicMatrix<Type,true,Alloc>;   //!< Type of this DynamicMatrix instance.
+   using BaseType      = DenseMatrix<This,true>;           //!< Base type of this DynamicMatrix instance.
+   using ResultType    = This;                             //!< Result type for expression template evaluations.
+   using OppositeType  = DynamicMatrix<Type,false,Alloc>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicMatrix<Type,false,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                             //!< Type of the matrix elements.
+   using SIMDType      = SIMDTrait_<ElementType>;          //!< SIMD type of the matrix elements.
+   using ReturnType    = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                      //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                            //!< Type of the allocator.
 
    using Reference      = Type&;        //!< Reference to a non-constant matrix value.
    using ConstReference = const Type&;  //!< Reference to a constant matrix value.
    using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
    using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
 
-   using Iterator      = DenseIterator<Type,usePadding>;        //!< Iterator over non-constant elements.
-   using ConstIterator = DenseIterator<const Type,usePadding>;  //!< Iterator over constant elements.
+   //! Iterator over non-constant elements.
+   using Iterator = DenseIterator< Type, usePadding && IsAlignedAllocator<Alloc>::value >;
+
+   //! Iterator over constant elements.
+   using ConstIterator = DenseIterator< const Type, usePadding && IsAlignedAllocator<Alloc>::value >;
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -3208,7 +3495,9 @@ class DynamicMatrix<Type,true>
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = DynamicMatrix<NewType,true>;  //!< The type of the other DynamicMatrix.
+      //! The type of the other DynamicMatrix.
+      using Other = DynamicMatrix< NewType, true
+                                 , typename std::allocator_traits<Alloc>::template rebind_alloc<NewType> >;
    };
    //**********************************************************************************************
 
@@ -3218,7 +3507,7 @@ class DynamicMatrix<Type,true>
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = DynamicMatrix<Type,true>;  //!< The type of the other DynamicMatrix.
+      using Other = DynamicMatrix<Type,true,Alloc>;  //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -3241,8 +3530,9 @@ class DynamicMatrix<Type,true>
    /*!\name Constructors */
    //@{
    explicit inline DynamicMatrix() noexcept;
-   explicit inline DynamicMatrix( size_t m, size_t n );
-   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+   explicit inline DynamicMatrix( const Alloc& alloc ) noexcept;
+   explicit inline DynamicMatrix( size_t m, size_t n, const Alloc& alloc = Alloc() );
+   explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc = Alloc() );
    explicit inline DynamicMatrix( initializer_list< initializer_list<Type> > list );
 
    template< typename Other > explicit inline DynamicMatrix( size_t m, size_t n, const Other* array );
@@ -3293,7 +3583,8 @@ class DynamicMatrix<Type,true>
    inline DynamicMatrix& operator=( const Other (&array)[Rows][Cols] );
 
    inline DynamicMatrix& operator=( const DynamicMatrix& rhs );
-   inline DynamicMatrix& operator=( DynamicMatrix&& rhs );
+   inline DynamicMatrix& operator=( DynamicMatrix&& rhs )
+      noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value );
 
    template< typename MT, bool SO > inline DynamicMatrix& operator= ( const Matrix<MT,SO>& rhs );
    template< typename MT, bool SO > inline DynamicMatrix& operator+=( const Matrix<MT,SO>& rhs );
@@ -3319,7 +3610,9 @@ class DynamicMatrix<Type,true>
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
-   inline void   swap( DynamicMatrix& m ) noexcept;
+   inline void   swap( DynamicMatrix& m )
+      noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value );
+   inline Alloc  getAllocator() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -3453,16 +3746,22 @@ class DynamicMatrix<Type,true>
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+   using AllocTraits = std::allocator_traits<Alloc>;  //!< Traits of the allocator type.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t minRows ) const noexcept;
+   inline void   initialize( const Type& init );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc  alloc_;            //!< The allocator of the matrix elements.
    size_t m_;                //!< The current number of rows of the matrix.
    size_t mm_;               //!< The alignment adjusted number of rows.
    size_t n_;                //!< The current number of columns of the matrix.
@@ -3496,9 +3795,31 @@ class DynamicMatrix<Type,true>
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
-   : m_       ( 0UL )      // The current number of rows of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix() noexcept
+   : alloc_   ()           // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
+   , mm_      ( 0UL )      // The alignment adjusted number of rows
+   , n_       ( 0UL )      // The current number of columns of the matrix
+   , capacity_( 0UL )      // The maximum capacity of the matrix
+   , v_       ( nullptr )  // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix with the given allocator.
+//
+// \param alloc The allocator for the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the matrix elements
+   , m_       ( 0UL )      // The current number of rows of the matrix
    , mm_      ( 0UL )      // The alignment adjusted number of rows
    , n_       ( 0UL )      // The current number of columns of the matrix
    , capacity_( 0UL )      // The maximum capacity of the matrix
@@ -3514,19 +3835,27 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the matrix elements.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the parallel first-touch initialization is
+// selected (see BLAZE_NUMA_PLACEMENT), large matrices of built-in data type are initialized in
+// parallel in order to spread the memory among the NUMA nodes of the SMP threads.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
-{
-   if( IsVectorizable<Type>::value ) {
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                                // The allocator of the matrix elements
+   , m_       ( m )                                    // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                      // The alignment adjusted number of rows
+   , n_       ( n )                                    // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                               // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, alloc_ ) )  // The matrix elements
+{
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() ) {
+      initialize( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3547,18 +3876,16 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
+// \param alloc The allocator for the matrix elements.
 //
 // All matrix elements are initialized with the specified value.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
+   : DynamicMatrix( m, n, alloc )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
-      }
-   }
+   initialize( init );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -3587,8 +3914,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 // initialized by the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
    : DynamicMatrix( list.size(), determineColumns( list ) )
 {
    size_t i( 0UL );
@@ -3636,9 +3964,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_li
 // from the given array. Note that it is expected that the given \a array has at least \a m by
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other* array )
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( size_t m, size_t n, const Other* array )
    : DynamicMatrix( m, n )
 {
    for( size_t j=0UL; j<n; ++j ) {
@@ -3675,11 +4004,12 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other*
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type >  // Data type of the matrix
-template< typename Other   // Data type of the initialization array
-        , size_t Rows      // Number of rows of the initialization array
-        , size_t Cols >    // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Other (&array)[Rows][Cols] )
    : DynamicMatrix( Rows, Cols )
 {
    for( size_t j=0UL; j<Cols; ++j ) {
@@ -3701,11 +4031,14 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols]
 // \param m Matrix to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new matrix is
+// selected via std::allocator_traits::select_on_container_copy_construction().
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const DynamicMatrix& m )
+   : DynamicMatrix( m.m_, m.n_,
+                    std::allocator_traits<Alloc>::select_on_container_copy_construction( m.alloc_ ) )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
@@ -3723,13 +4056,15 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 //
 // \param m The matrix to be moved into this instance.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( DynamicMatrix&& m )
-   : m_       ( m.m_        )  // The current number of rows of the matrix
-   , mm_      ( m.mm_       )  // The alignment adjusted number of rows
-   , n_       ( m.n_        )  // The current number of columns of the matrix
-   , capacity_( m.capacity_ )  // The maximum capacity of the matrix
-   , v_       ( m.v_        )  // The matrix elements
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( DynamicMatrix&& m )
+   : alloc_   ( std::move( m.alloc_ ) )  // The allocator of the matrix elements
+   , m_       ( m.m_        )            // The current number of rows of the matrix
+   , mm_      ( m.mm_       )            // The alignment adjusted number of rows
+   , n_       ( m.n_        )            // The current number of columns of the matrix
+   , capacity_( m.capacity_ )            // The maximum capacity of the matrix
+   , v_       ( m.v_        )            // The matrix elements
 {
    m.m_        = 0UL;
    m.mm_       = 0UL;
@@ -3747,18 +4082,28 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( DynamicMatrix&& m )
 //
 // \param m Matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the foreign matrix
-        , bool SO >        // Storage order of the foreign matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the foreign matrix
+        , bool SO >         // Storage order of the foreign matrix
+inline DynamicMatrix<Type,true,Alloc>::DynamicMatrix( const Matrix<MT,SO>& m )
    : DynamicMatrix( (~m).rows(), (~m).columns() )
 {
-   if( IsSparseMatrix<MT>::value ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         for( size_t i=0UL; i<m_; ++i ) {
-            v_[i+j*mm_] = Type();
+   if( IsSparseMatrix<MT>::value )
+   {
+      const auto kernel = [&]( size_t first, size_t last )
+      {
+         for( size_t j=first; j<last; ++j ) {
+            for( size_t i=0UL; i<m_; ++i ) {
+               v_[i+j*mm_] = Type();
+            }
          }
-      }
+      };
+
+      if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+         kernel( 0UL, n_ );
+      else
+         smpFor( 0UL, n_, kernel );
    }
 
    smpAssign( *this, ~m );
@@ -3781,10 +4126,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::~DynamicMatrix()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( v_, capacity_, alloc_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3809,9 +4155,10 @@ inline DynamicMatrix<Type,true>::~DynamicMatrix()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Reference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Reference
+   DynamicMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -3832,9 +4179,10 @@ inline typename DynamicMatrix<Type,true>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstReference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstReference
+   DynamicMatrix<Type,true,Alloc>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -3856,9 +4204,10 @@ inline typename DynamicMatrix<Type,true>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Reference
-   DynamicMatrix<Type,true>::at( size_t i, size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Reference
+   DynamicMatrix<Type,true,Alloc>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3884,9 +4233,10 @@ inline typename DynamicMatrix<Type,true>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstReference
-   DynamicMatrix<Type,true>::at( size_t i, size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstReference
+   DynamicMatrix<Type,true,Alloc>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3912,9 +4262,10 @@ inline typename DynamicMatrix<Type,true>::ConstReference
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer
-   DynamicMatrix<Type,true>::data() noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Pointer
+   DynamicMatrix<Type,true,Alloc>::data() noexcept
 {
    return v_;
 }
@@ -3934,9 +4285,10 @@ inline typename DynamicMatrix<Type,true>::Pointer
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer
-   DynamicMatrix<Type,true>::data() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstPointer
+   DynamicMatrix<Type,true,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -3953,9 +4305,10 @@ inline typename DynamicMatrix<Type,true>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer
-   DynamicMatrix<Type,true>::data( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Pointer
+   DynamicMatrix<Type,true,Alloc>::data( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return v_ + j*mm_;
@@ -3973,9 +4326,10 @@ inline typename DynamicMatrix<Type,true>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer
-   DynamicMatrix<Type,true>::data( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstPointer
+   DynamicMatrix<Type,true,Alloc>::data( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return v_ + j*mm_;
@@ -3991,9 +4345,10 @@ inline typename DynamicMatrix<Type,true>::ConstPointer
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::begin( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Iterator
+   DynamicMatrix<Type,true,Alloc>::begin( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ );
@@ -4009,9 +4364,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::begin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::begin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -4027,9 +4383,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cbegin( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::cbegin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -4045,9 +4402,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::end( size_t j ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::Iterator
+   DynamicMatrix<Type,true,Alloc>::end( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ + m_ );
@@ -4063,9 +4421,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::end( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::end( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -4081,9 +4440,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cend( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicMatrix<Type,true,Alloc>::ConstIterator
+   DynamicMatrix<Type,true,Alloc>::cend( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -4107,8 +4467,9 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param rhs Scalar value to be assigned to all matrix elements.
 // \return Reference to the assigned matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Type& rhs )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -4142,9 +4503,10 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Type
 // assigned the values from the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>&
-   DynamicMatrix<Type,true>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>&
+   DynamicMatrix<Type,true,Alloc>::operator=( initializer_list< initializer_list<Type> > list )
 {
    resize( list.size(), determineColumns( list ), false );
 
@@ -4190,11 +4552,12 @@ inline DynamicMatrix<Type,true>&
 // The matrix is resized according to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
-template< typename Other   // Data type of the initialization array
-        , size_t Rows      // Number of rows of the initialization array
-        , size_t Cols >    // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Other (&array)[Rows][Cols] )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Rows       // Number of rows of the initialization array
+        , size_t Cols >     // Number of columns of the initialization array
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Other (&array)[Rows][Cols] )
 {
    resize( Rows, Cols, false );
 
@@ -4218,8 +4581,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Othe
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const DynamicMatrix& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -4240,11 +4604,30 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Dyna
 //
 // \param rhs The matrix to be moved into this instance.
 // \return Reference to the assigned matrix.
+//
+// In case the allocator propagates on move assignment (see std::allocator_traits), the allocator
+// of the given matrix is moved into this instance together with its elements. Otherwise the
+// elements are only taken over in case both allocators compare equal. If they differ, the
+// elements are moved one by one into memory acquired from the allocator of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( DynamicMatrix&& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( DynamicMatrix&& rhs )
+   noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value )
 {
-   deallocate( v_ );
+   if( !AllocTraits::propagate_on_container_move_assignment::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != rhs.alloc_ ) {
+      resize( rhs.m_, rhs.n_, false );
+      for( size_t j=0UL; j<n_; ++j ) {
+         std::move( rhs.v_+j*rhs.mm_, rhs.v_+j*rhs.mm_+m_, v_+j*mm_ );
+      }
+      return *this;
+   }
+
+   deallocate( v_, capacity_, alloc_ );
+
+   if( AllocTraits::propagate_on_container_move_assignment::value )
+      alloc_ = std::move( rhs.alloc_ );
 
    m_        = rhs.m_;
    mm_       = rhs.mm_;
@@ -4274,10 +4657,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( DynamicMat
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator=( const Matrix<MT,SO>& rhs )
 {
    using TT = TransExprTrait_<This>;
    using CT = CTransExprTrait_<This>;
@@ -4319,10 +4703,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matr
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator+=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4355,10 +4740,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Mat
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator-=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4391,10 +4777,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Mat
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT      // Type of the right-hand side matrix
-        , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator%=( const Matrix<MT,SO>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO >         // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::operator%=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4430,8 +4817,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator%=( const Mat
 //
 // \return The number of rows of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::rows() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -4445,8 +4833,9 @@ inline size_t DynamicMatrix<Type,true>::rows() const noexcept
 //
 // \return The number of columns of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::columns() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -4463,8 +4852,9 @@ inline size_t DynamicMatrix<Type,true>::columns() const noexcept
 // This function returns the spacing between the beginning of two column, i.e. the total number
 // of elements of a column.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::spacing() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::spacing() const noexcept
 {
    return mm_;
 }
@@ -4478,8 +4868,9 @@ inline size_t DynamicMatrix<Type,true>::spacing() const noexcept
 //
 // \return The capacity of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::capacity() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -4494,8 +4885,9 @@ inline size_t DynamicMatrix<Type,true>::capacity() const noexcept
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::capacity( size_t j ) const noexcept
 {
    UNUSED_PARAMETER( j );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4511,8 +4903,9 @@ inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const noexcept
 //
 // \return The number of non-zero elements in the dense matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros() const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -4534,8 +4927,9 @@ inline size_t DynamicMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -4558,14 +4952,23 @@ inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reset()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reset()
 {
    using blaze::clear;
 
-   for( size_t j=0UL; j<n_; ++j )
-      for( size_t i=0UL; i<m_; ++i )
-         clear( v_[i+j*mm_] );
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            clear( v_[i+j*mm_] );
+   };
+
+   if( m_*n_ < SMP_DMATASSIGN_THRESHOLD )
+      kernel( 0UL, n_ );
+   else
+      smpFor( 0UL, n_, kernel );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4581,8 +4984,9 @@ inline void DynamicMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reset( size_t j )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reset( size_t j )
 {
    using blaze::clear;
 
@@ -4602,8 +5006,9 @@ inline void DynamicMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::clear()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -4646,8 +5051,9 @@ inline void DynamicMatrix<Type,true>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type >  // Data type of the matrix
-void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+void DynamicMatrix<Type,true,Alloc>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
    using blaze::min;
@@ -4655,10 +5061,11 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    if( m == m_ && n == n_ ) return;
 
    const size_t mm( addPadding( m ) );
+   const bool firstTouch( useFirstTouch && IsBuiltin<Type>::value && !preserve && mm*n > capacity_ );
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n, alloc_ );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4667,25 +5074,28 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       }
 
       swap( v_, v );
-      deallocate( v );
+      deallocate( v, capacity_, alloc_ );
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n, alloc_ );
       swap( v_, v );
-      deallocate( v );
+      deallocate( v, capacity_, alloc_ );
       capacity_ = mm*n;
    }
 
-   if( IsVectorizable<Type>::value ) {
+   m_  = m;
+   mm_ = mm;
+   n_  = n;
+
+   if( firstTouch && canSMPAssign() ) {
+      initialize( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n; ++j )
          for( size_t i=m; i<mm; ++i )
             v_[i+j*mm] = Type();
    }
-
-   m_  = m;
-   mm_ = mm;
-   n_  = n;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4706,8 +5116,9 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new matrix elements are not
 // initialized!
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -4725,15 +5136,16 @@ inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve
 // This function increases the capacity of the dense matrix to at least \a elements elements.
 // The current values of the matrix elements are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reserve( size_t elements )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements, alloc_ );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -4745,7 +5157,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( tmp, capacity_, alloc_ );
       capacity_ = elements;
    }
 }
@@ -4764,8 +5176,9 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this matrix are invalidated.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::shrinkToFit()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::shrinkToFit()
 {
    if( ( mm_ * n_ ) < capacity_ ) {
       DynamicMatrix( *this ).swap( *this );
@@ -4781,12 +5194,44 @@ inline void DynamicMatrix<Type,true>::shrinkToFit()
 //
 // \param m The matrix to be swapped.
 // \return void
+//
+// In case the allocator propagates on swap (see std::allocator_traits), the allocators are
+// swapped together with the elements. Otherwise the elements are only exchanged in case both
+// allocators compare equal. If they differ, every matrix keeps its allocator and the elements
+// are moved one by one into memory acquired from the according allocator.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::swap( DynamicMatrix& m )
+   noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value )
 {
    using std::swap;
 
+   if( !AllocTraits::propagate_on_container_swap::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != m.alloc_ )
+   {
+      DynamicMatrix tmp( m.m_, m.n_, alloc_ );
+      for( size_t j=0UL; j<m.n_; ++j ) {
+         std::move( m.v_+j*m.mm_, m.v_+j*m.mm_+m.m_, tmp.v_+j*tmp.mm_ );
+      }
+
+      m.resize( m_, n_, false );
+      for( size_t j=0UL; j<n_; ++j ) {
+         std::move( v_+j*mm_, v_+j*mm_+m_, m.v_+j*m.mm_ );
+      }
+
+      swap( m_ , tmp.m_  );
+      swap( mm_, tmp.mm_ );
+      swap( n_ , tmp.n_  );
+      swap( capacity_, tmp.capacity_ );
+      swap( v_ , tmp.v_  );
+
+      return;
+   }
+
+   if( AllocTraits::propagate_on_container_swap::value )
+      swap( alloc_, m.alloc_ );
+
    swap( m_ , m.m_  );
    swap( mm_, m.mm_ );
    swap( n_ , m.n_  );
@@ -4797,6 +5242,22 @@ inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a copy of the allocator of the matrix.
+//
+// \return The allocator of the matrix elements.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline Alloc DynamicMatrix<Type,true,Alloc>::getAllocator() const noexcept
+{
+   return alloc_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Add the necessary amount of padding to the given value.
@@ -4807,8 +5268,9 @@ inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicMatrix<Type,true,Alloc>::addPadding( size_t values ) const noexcept
 {
    if( usePadding && IsVectorizable<Type>::value )
       return nextMultiple<size_t>( values, SIMDSIZE );
@@ -4818,6 +5280,44 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of all matrix elements with the given value.
+//
+// \param init The initial value of the matrix elements.
+// \return void
+//
+// This function initializes all matrix elements with the given value and all padding elements
+// with the default value. In case the parallel first-touch initialization is selected (see
+// BLAZE_NUMA_PLACEMENT) and the matrix of built-in data type is large enough for an SMP
+// assignment, the elements are initialized in parallel, using the same partitioning as the
+// SMP assignments.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline void DynamicMatrix<Type,true,Alloc>::initialize( const Type& init )
+{
+   const auto kernel = [this,&init]( size_t row, size_t column, size_t m, size_t n )
+   {
+      const size_t iend( ( row+m == m_ )?( mm_ ):( row+m ) );
+
+      for( size_t j=column; j<column+n; ++j ) {
+         for( size_t i=row; i<row+m; ++i )
+            v_[i+j*mm_] = init;
+         for( size_t i=row+m; i<iend; ++i )
+            v_[i+j*mm_] = Type();
+      }
+   };
+
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() )
+      smpFirstTouch( *this, kernel );
+   else
+      kernel( 0UL, 0UL, m_, n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4832,8 +5332,9 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::transpose()
 {
    using std::swap;
 
@@ -4871,8 +5372,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::ctranspose()
 {
    constexpr size_t block( BLOCK_SIZE );
 
@@ -4926,9 +5428,10 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& scalar )
+inline DynamicMatrix<Type,true,Alloc>& DynamicMatrix<Type,true,Alloc>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -4958,8 +5461,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& s
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::isIntact() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::isIntact() const noexcept
 {
    if( m_ * n_ > capacity_ )
       return false;
@@ -4998,9 +5502,10 @@ inline bool DynamicMatrix<Type,true>::isIntact() const noexcept
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,true,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5019,9 +5524,10 @@ inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const noexc
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicMatrix<Type,true,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5039,10 +5545,11 @@ inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const noex
 // whether the beginning and the end of each column of the matrix are guaranteed to conform to
 // the alignment restrictions of the element type \a Type.
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::isAligned() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::isAligned() const noexcept
 {
-   return ( usePadding || rows() % SIMDSIZE == 0UL );
+   return IsAlignedAllocator<Alloc>::value && ( usePadding || rows() % SIMDSIZE == 0UL );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5059,8 +5566,9 @@ inline bool DynamicMatrix<Type,true>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicMatrix<Type,true,Alloc>::canSMPAssign() const noexcept
 {
    return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
 }
@@ -5083,11 +5591,12 @@ inline bool DynamicMatrix<Type,true>::canSMPAssign() const noexcept
 // for the performance optimized evaluation of expression templates. Calling this function
 // explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::load( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::load( size_t i, size_t j ) const noexcept
 {
-   if( usePadding )
+   if( usePadding && IsAlignedAllocator<Alloc>::value )
       return loada( i, j );
    else
       return loadu( i, j );
@@ -5111,9 +5620,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::loada( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::loada( size_t i, size_t j ) const noexcept
 {
    using blaze::loada;
 
@@ -5146,9 +5656,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
-   DynamicMatrix<Type,true>::loadu( size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,Alloc>::SIMDType
+   DynamicMatrix<Type,true,Alloc>::loadu( size_t i, size_t j ) const noexcept
 {
    using blaze::loadu;
 
@@ -5180,11 +5691,12 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::store( size_t i, size_t j, const SIMDType& value ) noexcept
 {
-   if( usePadding )
+   if( usePadding && IsAlignedAllocator<Alloc>::value )
       storea( i, j, value );
    else
       storeu( i, j, value );
@@ -5209,9 +5721,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -5245,9 +5758,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -5280,9 +5794,10 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicMatrix<Type,true,Alloc>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -5312,10 +5827,11 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >
-   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5349,10 +5865,11 @@ inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >
-   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -5364,7 +5881,7 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
    const size_t ipos( ( remainder )?( m_ & size_t(-SIMDSIZE) ):( m_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
-   if( usePadding && useStreaming &&
+   if( usePadding && IsAlignedAllocator<Alloc>::value && useStreaming &&
        ( m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
    {
       for( size_t j=0UL; j<n_; ++j )
@@ -5420,9 +5937,10 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAss
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5459,16 +5977,27 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   for( size_t j=0UL; j<(~rhs).columns(); ++j )
-      for( ConstIterator_<MT> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         v_[element->index()+j*mm_] = element->value();
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j )
+         for( ConstIterator_<MT> element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            v_[element->index()+j*mm_] = element->value();
+   };
+
+   BLAZE_INTERNAL_ASSERT( isFlushed( ~rhs ), "Pending buffered insertions detected" );
+
+   if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+      kernel( 0UL, n_ );
+   else
+      smpFor( 0UL, n_, kernel );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5486,18 +6015,29 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   for( size_t i=0UL; i<(~rhs).rows(); ++i )
-      for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         v_[i+element->index()*mm_] = element->value();
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+         for( ConstIterator_<MT> element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            v_[i+element->index()*mm_] = element->value();
+   };
+
+   BLAZE_INTERNAL_ASSERT( isFlushed( ~rhs ), "Pending buffered insertions detected" );
+
+   if( m_*n_ < SMP_DMATSMATCONVERT_THRESHOLD )
+      kernel( 0UL, m_ );
+   else
+      smpFor( 0UL, m_, kernel );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5515,10 +6055,11 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
-   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5567,10 +6108,11 @@ inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAd
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
-   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
@@ -5627,9 +6169,10 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAdd
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5678,9 +6221,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5705,9 +6249,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::addAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5734,10 +6279,11 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
-   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5786,10 +6332,11 @@ inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSu
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
-   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
@@ -5846,9 +6393,10 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSub
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5897,9 +6445,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5924,9 +6473,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::subAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5953,10 +6503,11 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
-   DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline DisableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5990,10 +6541,11 @@ inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSc
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
-   DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline EnableIf_<typename DynamicMatrix<Type,true,Alloc>::BLAZE_TEMPLATE VectorizedSchurAssign<MT> >
+   DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -6041,9 +6593,10 @@ inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSch
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side dense matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -6080,9 +6633,10 @@ inline void DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,false>&
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,true>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const SparseMatrix<MT,true>& rhs )
 {
    using blaze::reset;
 
@@ -6121,9 +6675,10 @@ inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,true>&
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
-template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,false>& rhs )
+template< typename Type     // Data type of the matrix
+        , typename Alloc >  // Type of the allocator
+template< typename MT >     // Type of the right-hand side sparse matrix
+inline void DynamicMatrix<Type,true,Alloc>::schurAssign( const SparseMatrix<MT,false>& rhs )
 {
    using blaze::reset;
 
@@ -6167,23 +6722,24 @@ inline void DynamicMatrix<Type,true>::schurAssign( const SparseMatrix<MT,false>&
 //*************************************************************************************************
 /*!\name DynamicMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-inline void reset( DynamicMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename Alloc >
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename Alloc >
+inline void clear( DynamicMatrix<Type,SO,Alloc>& m );
 
-template< bool RF, typename Type, bool SO >
-inline bool isDefault( const DynamicMatrix<Type,SO>& m );
+template< bool RF, typename Type, bool SO, typename Alloc >
+inline bool isDefault( const DynamicMatrix<Type,SO,Alloc>& m );
 
-template< typename Type, bool SO >
-inline bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept;
+template< typename Type, bool SO, typename Alloc >
+inline bool isIntact( const DynamicMatrix<Type,SO,Alloc>& m ) noexcept;
 
-template< typename Type, bool SO >
-inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept;
+template< typename Type, bool SO, typename Alloc >
+inline void swap( DynamicMatrix<Type,SO,Alloc>& a, DynamicMatrix<Type,SO,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) );
 //@}
 //*************************************************************************************************
 
@@ -6195,9 +6751,10 @@ inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcep
 // \param m The matrix to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m )
 {
    m.reset();
 }
@@ -6217,9 +6774,10 @@ inline void reset( DynamicMatrix<Type,SO>& m )
 // values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,Alloc>& m, size_t i )
 {
    m.reset( i );
 }
@@ -6233,9 +6791,10 @@ inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
 // \param m The matrix to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( DynamicMatrix<Type,SO>& m )
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicMatrix<Type,SO,Alloc>& m )
 {
    m.clear();
 }
@@ -6267,10 +6826,11 @@ inline void clear( DynamicMatrix<Type,SO>& m )
    if( isDefault<relaxed>( A ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const DynamicMatrix<Type,SO>& m )
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const DynamicMatrix<Type,SO,Alloc>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -6295,9 +6855,10 @@ inline bool isDefault( const DynamicMatrix<Type,SO>& m )
    if( isIntact( A ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicMatrix<Type,SO,Alloc>& m ) noexcept
 {
    return m.isIntact();
 }
@@ -6312,9 +6873,11 @@ inline bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept
 // \param b The second matrix to be swapped.
 // \return void
 */
-template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicMatrix<Type,SO,Alloc>& a, DynamicMatrix<Type,SO,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) )
 {
    a.swap( b );
 }
@@ -6331,8 +6894,8 @@ inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcep
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasConstDataAccess< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct HasConstDataAccess< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6349,8 +6912,8 @@ struct HasConstDataAccess< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasMutableDataAccess< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct HasMutableDataAccess< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6367,9 +6930,9 @@ struct HasMutableDataAccess< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsAligned< DynamicMatrix<T,SO> >
-   : public BoolConstant<usePadding>
+template< typename T, bool SO, typename A >
+struct IsAligned< DynamicMatrix<T,SO,A> >
+   : public BoolConstant< usePadding && IsAlignedAllocator<A>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -6385,8 +6948,8 @@ struct IsAligned< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsContiguous< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsContiguous< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6403,9 +6966,9 @@ struct IsContiguous< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsPadded< DynamicMatrix<T,SO> >
-   : public BoolConstant<usePadding>
+template< typename T, bool SO, typename A >
+struct IsPadded< DynamicMatrix<T,SO,A> >
+   : public BoolConstant< usePadding && IsAlignedAllocator<A>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -6421,8 +6984,8 @@ struct IsPadded< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsResizable< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6439,8 +7002,8 @@ struct IsResizable< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsShrinkable< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct IsShrinkable< DynamicMatrix<T,SO,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6457,62 +7020,62 @@ struct IsShrinkable< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct AddTrait< DynamicMatrix<T1,SO,A>, StaticMatrix<T2,M,N,SO> >
 {
    using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A>, StaticMatrix<T2,M,N,SO2> >
 {
    using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct AddTrait< DynamicMatrix<T1,SO,A>, HybridMatrix<T2,M,N,SO> >
 {
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A>, HybridMatrix<T2,M,N,SO2> >
 {
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A1, typename T2, bool SO2, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, false >;
 };
@@ -6530,62 +7093,62 @@ struct AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct SubTrait< DynamicMatrix<T1,SO,A>, StaticMatrix<T2,M,N,SO> >
 {
    using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A>, StaticMatrix<T2,M,N,SO2> >
 {
    using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct SubTrait< DynamicMatrix<T1,SO,A>, HybridMatrix<T2,M,N,SO> >
 {
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A>, HybridMatrix<T2,M,N,SO2> >
 {
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A1, typename T2, bool SO2, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, false >;
 };
@@ -6603,62 +7166,62 @@ struct SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SchurTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct SchurTrait< DynamicMatrix<T1,SO,A>, StaticMatrix<T2,M,N,SO> >
 {
    using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SchurTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A>, StaticMatrix<T2,M,N,SO2> >
 {
    using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SchurTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct SchurTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct SchurTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SchurTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N >
+struct SchurTrait< DynamicMatrix<T1,SO,A>, HybridMatrix<T2,M,N,SO> >
 {
    using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SchurTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A>, HybridMatrix<T2,M,N,SO2> >
 {
    using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SchurTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct SchurTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct SchurTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SchurTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct SchurTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A1, typename T2, bool SO2, typename A2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
@@ -6676,104 +7239,104 @@ struct SchurTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, T2, EnableIf_<IsNumeric<T2> > >
+template< typename T1, bool SO, typename A, typename T2 >
+struct MultTrait< DynamicMatrix<T1,SO,A>, T2, EnableIf_<IsNumeric<T2> > >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, DynamicMatrix<T2,SO>, EnableIf_<IsNumeric<T1> > >
+template< typename T1, typename T2, bool SO, typename A >
+struct MultTrait< T1, DynamicMatrix<T2,SO,A>, EnableIf_<IsNumeric<T1> > >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< DynamicMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename A, typename T2, size_t N >
+struct MultTrait< DynamicMatrix<T1,SO,A>, StaticVector<T2,N,false> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A >
+struct MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< DynamicMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename A, typename T2, size_t N >
+struct MultTrait< DynamicMatrix<T1,SO,A>, HybridVector<T2,N,false> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A >
+struct MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, DynamicVector<T2,false,A2> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename A1, typename T2, bool SO, typename A2 >
+struct MultTrait< DynamicVector<T1,true,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO, typename T2, bool AF, bool PF >
-struct MultTrait< DynamicMatrix<T1,SO>, CustomVector<T2,AF,PF,false> >
+template< typename T1, bool SO, typename A, typename T2, bool AF, bool PF >
+struct MultTrait< DynamicMatrix<T1,SO,A>, CustomVector<T2,AF,PF,false> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, bool AF, bool PF, typename T2, bool SO >
-struct MultTrait< CustomVector<T1,AF,PF,true>, DynamicMatrix<T2,SO> >
+template< typename T1, bool AF, bool PF, typename T2, bool SO, typename A >
+struct MultTrait< CustomVector<T1,AF,PF,true>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename A, typename T2 >
+struct MultTrait< DynamicMatrix<T1,SO,A>, CompressedVector<T2,false> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A >
+struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A>, StaticMatrix<T2,M,N,SO2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A>, HybridMatrix<T2,M,N,SO2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A1, typename T2, bool SO2, typename A2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
@@ -6791,8 +7354,8 @@ struct MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< DynamicMatrix<T1,SO>, T2, EnableIf_<IsNumeric<T2> > >
+template< typename T1, bool SO, typename A, typename T2 >
+struct DivTrait< DynamicMatrix<T1,SO,A>, T2, EnableIf_<IsNumeric<T2> > >
 {
    using Type = DynamicMatrix< DivTrait_<T1,T2>, SO >;
 };
@@ -6810,8 +7373,8 @@ struct DivTrait< DynamicMatrix<T1,SO>, T2, EnableIf_<IsNumeric<T2> > >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, typename OP >
-struct UnaryMapTrait< DynamicMatrix<T,SO>, OP >
+template< typename T, bool SO, typename A, typename OP >
+struct UnaryMapTrait< DynamicMatrix<T,SO,A>, OP >
 {
    using Type = DynamicMatrix< UnaryMapTrait_<T,OP>, SO >;
 };
@@ -6829,62 +7392,62 @@ struct UnaryMapTrait< DynamicMatrix<T,SO>, OP >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO>, OP >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO,A>, StaticMatrix<T2,M,N,SO>, OP >
 {
    using Type = StaticMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2>, OP >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO1,A>, StaticMatrix<T2,M,N,SO2>, OP >
 {
    using Type = StaticMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2, typename OP >
-struct BinaryMapTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO>, OP >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A, typename OP >
+struct BinaryMapTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A>, OP >
 {
    using Type = StaticMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename OP >
-struct BinaryMapTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2>, OP >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A, typename OP >
+struct BinaryMapTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A>, OP >
 {
    using Type = StaticMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO>, OP >
+template< typename T1, bool SO, typename A, typename T2, size_t M, size_t N, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO,A>, HybridMatrix<T2,M,N,SO>, OP >
 {
    using Type = HybridMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2>, OP >
+template< typename T1, bool SO1, typename A, typename T2, size_t M, size_t N, bool SO2, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO1,A>, HybridMatrix<T2,M,N,SO2>, OP >
 {
    using Type = HybridMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, false >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2, typename OP >
-struct BinaryMapTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO>, OP >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A, typename OP >
+struct BinaryMapTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A>, OP >
 {
    using Type = HybridMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, SO >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename OP >
-struct BinaryMapTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2>, OP >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A, typename OP >
+struct BinaryMapTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A>, OP >
 {
    using Type = HybridMatrix< BinaryMapTrait_<T1,T2,OP>, M, N, false >;
 };
 
-template< typename T1, bool SO, typename T2, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO>, OP >
+template< typename T1, bool SO, typename A1, typename T2, typename A2, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2, typename OP >
-struct BinaryMapTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2>, OP >
+template< typename T1, bool SO1, typename A1, typename T2, bool SO2, typename A2, typename OP >
+struct BinaryMapTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2>, OP >
 {
    using Type = DynamicMatrix< BinaryMapTrait_<T1,T2,OP>, false >;
 };
@@ -6902,8 +7465,8 @@ struct BinaryMapTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2>, OP >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct HighType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct HighType< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicMatrix< typename HighType<T1,T2>::Type, SO >;
 };
@@ -6921,8 +7484,8 @@ struct HighType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct LowType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename A1, typename T2, typename A2 >
+struct LowType< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    using Type = DynamicMatrix< typename LowType<T1,T2>::Type, SO >;
 };
@@ -6940,14 +7503,14 @@ struct LowType< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, size_t I, size_t J, size_t M, size_t N >
-struct SubmatrixTrait< DynamicMatrix<T,SO>, I, J, M, N >
+template< typename T, bool SO, typename A, size_t I, size_t J, size_t M, size_t N >
+struct SubmatrixTrait< DynamicMatrix<T,SO,A>, I, J, M, N >
 {
    using Type = StaticMatrix<T,M,N,SO>;
 };
 
-template< typename T, bool SO >
-struct SubmatrixTrait< DynamicMatrix<T,SO> >
+template< typename T, bool SO, typename A >
+struct SubmatrixTrait< DynamicMatrix<T,SO,A> >
 {
    using Type = DynamicMatrix<T,SO>;
 };
@@ -6965,8 +7528,8 @@ struct SubmatrixTrait< DynamicMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, size_t... CRAs >
-struct RowTrait< DynamicMatrix<T,SO>, CRAs... >
+template< typename T, bool SO, typename A, size_t... CRAs >
+struct RowTrait< DynamicMatrix<T,SO,A>, CRAs... >
 {
    using Type = DynamicVector<T,true>;
 };
@@ -6984,8 +7547,8 @@ struct RowTrait< DynamicMatrix<T,SO>, CRAs... >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, size_t... CRAs >
-struct RowsTrait< DynamicMatrix<T,SO>, CRAs... >
+template< typename T, bool SO, typename A, size_t... CRAs >
+struct RowsTrait< DynamicMatrix<T,SO,A>, CRAs... >
 {
    using Type = DynamicMatrix<T,false>;
 };
@@ -7003,8 +7566,8 @@ struct RowsTrait< DynamicMatrix<T,SO>, CRAs... >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, size_t... CCAs >
-struct ColumnTrait< DynamicMatrix<T,SO>, CCAs... >
+template< typename T, bool SO, typename A, size_t... CCAs >
+struct ColumnTrait< DynamicMatrix<T,SO,A>, CCAs... >
 {
    using Type = DynamicVector<T,false>;
 };
@@ -7022,8 +7585,8 @@ struct ColumnTrait< DynamicMatrix<T,SO>, CCAs... >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, size_t... CCAs >
-struct ColumnsTrait< DynamicMatrix<T,SO>, CCAs... >
+template< typename T, bool SO, typename A, size_t... CCAs >
+struct ColumnsTrait< DynamicMatrix<T,SO,A>, CCAs... >
 {
    using Type = DynamicMatrix<T,true>;
 };
@@ -7041,8 +7604,8 @@ struct ColumnsTrait< DynamicMatrix<T,SO>, CCAs... >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO, ptrdiff_t... CBAs >
-struct BandTrait< DynamicMatrix<T,SO>, CBAs... >
+template< typename T, bool SO, typename A, ptrdiff_t... CBAs >
+struct BandTrait< DynamicMatrix<T,SO,A>, CBAs... >
 {
    using Type = DynamicVector<T,defaultTransposeFlag>;
 };
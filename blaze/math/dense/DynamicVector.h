@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
@@ -58,6 +59,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BinaryMapTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
@@ -104,6 +106,8 @@
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsAlignedAllocator.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 
@@ -124,18 +128,24 @@ namespace blaze {
 // \ingroup dynamic_vector
 //
 // The DynamicVector class template is the representation of an arbitrary sized vector with
-// dynamically allocated elements of arbitrary type. The type of the elements and the transpose
-// flag of the vector can be specified via the two template parameters:
+// dynamically allocated elements of arbitrary type. The type of the elements, the transpose
+// flag and the allocator of the vector can be specified via the three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename Alloc >
    class DynamicVector;
    \endcode
 
-//  - Type: specifies the type of the vector elements. DynamicVector can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
-//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
-//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Type : specifies the type of the vector elements. DynamicVector can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - TF   : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//           vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - Alloc: specifies the type of the allocator for the vector elements. The allocator has to
+//           satisfy the allocator requirements of the standard library. In case the allocator
+//           provides memory that is aligned according to the alignment restrictions of \a Type
+//           (see blaze::AlignmentOf and blaze::IsAlignedAllocator), aligned SIMD operations are
+//           used, else the vector is treated as unaligned and unpadded and all operations fall
+//           back to unaligned SIMD operations. The default allocator is blaze::AlignedAllocator.
 //
 // These contiguously stored elements can be directly accessed with the subscript operator. The
 // numbering of the vector elements is
@@ -181,28 +191,33 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename Alloc >                  // Type of the allocator (default: AlignedAllocator)
 class DynamicVector
-   : public DenseVector< DynamicVector<Type,TF>, TF >
+   : public DenseVector< DynamicVector<Type,TF,Alloc>, TF >
 {
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicVector<Type,TF>;   //!< Type of this DynamicVector instance.
-   using BaseType      = DenseVector<This,TF>;     //!< Base type of this DynamicVector instance.
-   using ResultType    = This;                     //!< Result type for expression template evaluations.
-   using TransposeType = DynamicVector<Type,!TF>;  //!< Transpose type for expression template evaluations.
-   using ElementType   = Type;                     //!< Type of the vector elements.
-   using SIMDType      = SIMDTrait_<ElementType>;  //!< SIMD type of the vector elements.
-   using ReturnType    = const Type&;              //!< Return type for expression template evaluations
-   using CompositeType = const DynamicVector&;     //!< Data type for composite expression templates.
+   using This          = DynamicVector<Type,TF,Alloc>;   //!< Type of this DynamicVector instance.
+   using BaseType      = DenseVector<This,TF>;           //!< Base type of this DynamicVector instance.
+   using ResultType    = This;                           //!< Result type for expression template evaluations.
+   using TransposeType = DynamicVector<Type,!TF,Alloc>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                           //!< Type of the vector elements.
+   using SIMDType      = SIMDTrait_<ElementType>;        //!< SIMD type of the vector elements.
+   using ReturnType    = const Type&;                    //!< Return type for expression template evaluations
+   using CompositeType = const DynamicVector&;           //!< Data type for composite expression templates.
+   using AllocatorType = Alloc;                          //!< Type of the allocator.
 
    using Reference      = Type&;        //!< Reference to a non-constant vector value.
    using ConstReference = const Type&;  //!< Reference to a constant vector value.
    using Pointer        = Type*;        //!< Pointer to a non-constant vector value.
    using ConstPointer   = const Type*;  //!< Pointer to a constant vector value.
 
-   using Iterator      = DenseIterator<Type,aligned>;        //!< Iterator over non-constant elements.
-   using ConstIterator = DenseIterator<const Type,aligned>;  //!< Iterator over constant elements.
+   //! Iterator over non-constant elements.
+   using Iterator = DenseIterator< Type, IsAlignedAllocator<Alloc>::value >;
+
+   //! Iterator over constant elements.
+   using ConstIterator = DenseIterator< const Type, IsAlignedAllocator<Alloc>::value >;
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -210,7 +225,9 @@ class DynamicVector
    */
    template< typename NewType >  // Data type of the other vector
    struct Rebind {
-      using Other = DynamicVector<NewType,TF>;  //!< The type of the other DynamicVector.
+      //! The type of the other DynamicVector.
+      using Other = DynamicVector< NewType, TF
+                                 , typename std::allocator_traits<Alloc>::template rebind_alloc<NewType> >;
    };
    //**********************************************************************************************
 
@@ -219,7 +236,7 @@ class DynamicVector
    */
    template< size_t NewN >  // Number of elements of the other vector
    struct Resize {
-      using Other = DynamicVector<Type,TF>;  //!< The type of the other DynamicVector.
+      using Other = DynamicVector<Type,TF,Alloc>;  //!< The type of the other DynamicVector.
    };
    //**********************************************************************************************
 
@@ -242,8 +259,9 @@ class DynamicVector
    /*!\name Constructors */
    //@{
    explicit inline DynamicVector() noexcept;
-   explicit inline DynamicVector( size_t n );
-   explicit inline DynamicVector( size_t n, const Type& init );
+   explicit inline DynamicVector( const Alloc& alloc ) noexcept;
+   explicit inline DynamicVector( size_t n, const Alloc& alloc = Alloc() );
+   explicit inline DynamicVector( size_t n, const Type& init, const Alloc& alloc = Alloc() );
    explicit inline DynamicVector( initializer_list<Type> list );
 
    template< typename Other >
@@ -293,7 +311,8 @@ class DynamicVector
    inline DynamicVector& operator=( const Other (&array)[Dim] );
 
    inline DynamicVector& operator=( const DynamicVector& rhs );
-   inline DynamicVector& operator=( DynamicVector&& rhs ) noexcept;
+   inline DynamicVector& operator=( DynamicVector&& rhs )
+      noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value );
 
    template< typename VT > inline DynamicVector& operator= ( const Vector<VT,TF>& rhs );
    template< typename VT > inline DynamicVector& operator+=( const Vector<VT,TF>& rhs );
@@ -317,7 +336,9 @@ class DynamicVector
    inline void   extend( size_t n, bool preserve=true );
    inline void   reserve( size_t n );
    inline void   shrinkToFit();
-   inline void   swap( DynamicVector& v ) noexcept;
+   inline void   swap( DynamicVector& v )
+      noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value );
+   inline Alloc  getAllocator() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -465,16 +486,22 @@ class DynamicVector
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+   using AllocTraits = std::allocator_traits<Alloc>;  //!< Traits of the allocator type.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+   inline void   initialize( const Type& init );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   Alloc  alloc_;            //!< The allocator of the vector elements.
    size_t size_;             //!< The current size/dimension of the vector.
    size_t capacity_;         //!< The maximum capacity of the vector.
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated vector elements.
@@ -509,10 +536,29 @@ class DynamicVector
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector() noexcept
-   : size_    ( 0UL )      // The current size/dimension of the vector
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector() noexcept
+   : alloc_   ()           // The allocator of the vector elements
+   , size_    ( 0UL )      // The current size/dimension of the vector
+   , capacity_( 0UL )      // The maximum capacity of the vector
+   , v_       ( nullptr )  // The vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty vector with the given allocator.
+//
+// \param alloc The allocator for the vector elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Alloc& alloc ) noexcept
+   : alloc_   ( alloc )    // The allocator of the vector elements
+   , size_    ( 0UL )      // The current size/dimension of the vector
    , capacity_( 0UL )      // The maximum capacity of the vector
    , v_       ( nullptr )  // The vector elements
 {}
@@ -523,18 +569,26 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 /*!\brief Constructor for a vector of size \a n. No element initialization is performed!
 //
 // \param n The size of the vector.
+// \param alloc The allocator for the vector elements.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! Only in case the parallel first-touch initialization is
+// selected (see BLAZE_NUMA_PLACEMENT), large vectors of built-in data type are initialized in
+// parallel in order to spread the memory among the NUMA nodes of the SMP threads.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
-{
-   if( IsVectorizable<Type>::value ) {
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Alloc& alloc )
+   : alloc_   ( alloc )                                // The allocator of the vector elements
+   , size_    ( n )                                    // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                      // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, alloc_ ) )  // The vector elements
+{
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() ) {
+      initialize( Type() );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -549,16 +603,17 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 //
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
+// \param alloc The allocator for the vector elements.
 //
 // All vector elements are initialized with the specified value.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : DynamicVector( n )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Type& init, const Alloc& alloc )
+   : DynamicVector( n, alloc )
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   initialize( init );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -580,9 +635,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
 // The vector is sized according to the size of the initializer list and all its elements are
 // initialized by the non-zero elements of the given initializer list.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( initializer_list<Type> list )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( initializer_list<Type> list )
    : DynamicVector( list.size() )
 {
    std::fill( std::copy( list.begin(), list.end(), begin() ), end(), Type() );
@@ -613,9 +669,10 @@ inline DynamicVector<Type,TF>::DynamicVector( initializer_list<Type> list )
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( size_t n, const Other* array )
    : DynamicVector( n )
 {
    for( size_t i=0UL; i<n; ++i )
@@ -643,11 +700,12 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
 // given array. Missing values are initialized with default values (as e.g. the fourth element in
 // the example).
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Other  // Data type of the initialization array
-        , size_t Dim >    // Dimension of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Other (&array)[Dim] )
    : DynamicVector( Dim )
 {
    for( size_t i=0UL; i<Dim; ++i )
@@ -664,12 +722,15 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
 // \param v Vector to be copied.
 //
 // The copy constructor is explicitly defined due to the required dynamic memory management
-// and in order to enable/facilitate NRV optimization.
+// and in order to enable/facilitate NRV optimization. The allocator of the new vector is
+// selected via std::allocator_traits::select_on_container_copy_construction().
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
-   : DynamicVector( v.size_ )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const DynamicVector& v )
+   : DynamicVector( v.size_,
+                    std::allocator_traits<Alloc>::select_on_container_copy_construction( v.alloc_ ) )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
@@ -684,13 +745,17 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 /*!\brief The move constructor for DynamicVector.
 //
 // \param v The vector to be moved into this instance.
+//
+// The allocator of the given vector is moved into this instance together with its elements.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( DynamicVector&& v ) noexcept
-   : size_    ( v.size_     )  // The current size/dimension of the vector
-   , capacity_( v.capacity_ )  // The maximum capacity of the vector
-   , v_       ( v.v_        )  // The vector elements
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( DynamicVector&& v ) noexcept
+   : alloc_   ( std::move( v.alloc_ ) )  // The allocator of the vector elements
+   , size_    ( v.size_     )            // The current size/dimension of the vector
+   , capacity_( v.capacity_ )            // The maximum capacity of the vector
+   , v_       ( v.v_        )            // The vector elements
 {
    v.size_     = 0UL;
    v.capacity_ = 0UL;
@@ -704,10 +769,11 @@ inline DynamicVector<Type,TF>::DynamicVector( DynamicVector&& v ) noexcept
 //
 // \param v Vector to be copied.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the foreign vector
-inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the foreign vector
+inline DynamicVector<Type,TF,Alloc>::DynamicVector( const Vector<VT,TF>& v )
    : DynamicVector( (~v).size() )
 {
    if( IsSparseVector<VT>::value ) {
@@ -734,11 +800,12 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicVector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::~DynamicVector()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>::~DynamicVector()
 {
-   deallocate( v_ );
+   deallocate( v_, capacity_, alloc_ );
 }
 //*************************************************************************************************
 
@@ -760,10 +827,11 @@ inline DynamicVector<Type,TF>::~DynamicVector()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Reference
-   DynamicVector<Type,TF>::operator[]( size_t index ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Reference
+   DynamicVector<Type,TF,Alloc>::operator[]( size_t index ) noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
    return v_[index];
@@ -780,10 +848,11 @@ inline typename DynamicVector<Type,TF>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstReference
-   DynamicVector<Type,TF>::operator[]( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstReference
+   DynamicVector<Type,TF,Alloc>::operator[]( size_t index ) const noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
    return v_[index];
@@ -801,10 +870,11 @@ inline typename DynamicVector<Type,TF>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Reference
-   DynamicVector<Type,TF>::at( size_t index )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Reference
+   DynamicVector<Type,TF,Alloc>::at( size_t index )
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
@@ -824,10 +894,11 @@ inline typename DynamicVector<Type,TF>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access index.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstReference
-   DynamicVector<Type,TF>::at( size_t index ) const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstReference
+   DynamicVector<Type,TF,Alloc>::at( size_t index ) const
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
@@ -844,9 +915,10 @@ inline typename DynamicVector<Type,TF>::ConstReference
 //
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Pointer DynamicVector<Type,TF,Alloc>::data() noexcept
 {
    return v_;
 }
@@ -860,9 +932,10 @@ inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data() n
 //
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::data() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstPointer DynamicVector<Type,TF,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -874,9 +947,10 @@ inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::dat
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Iterator DynamicVector<Type,TF,Alloc>::begin() noexcept
 {
    return Iterator( v_ );
 }
@@ -888,9 +962,10 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin()
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::begin() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::begin() const noexcept
 {
    return ConstIterator( v_ );
 }
@@ -902,9 +977,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::be
 //
 // \return Iterator to the first element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cbegin() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::cbegin() const noexcept
 {
    return ConstIterator( v_ );
 }
@@ -916,9 +992,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cb
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end() noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::Iterator DynamicVector<Type,TF,Alloc>::end() noexcept
 {
    return Iterator( v_ + size_ );
 }
@@ -930,9 +1007,10 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end() n
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::end() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::end() const noexcept
 {
    return ConstIterator( v_ + size_ );
 }
@@ -944,9 +1022,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::en
 //
 // \return Iterator just past the last element of the dynamic vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cend() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicVector<Type,TF,Alloc>::ConstIterator DynamicVector<Type,TF,Alloc>::cend() const noexcept
 {
    return ConstIterator( v_ + size_ );
 }
@@ -967,9 +1046,10 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::ce
 // \param rhs Scalar value to be assigned to all vector elements.
 // \return Reference to the assigned vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Type& rhs )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = rhs;
@@ -994,9 +1074,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rh
 // The vector is resized according to the size of the initializer list and all its elements are
 // assigned the values from the given initializer list.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( initializer_list<Type> list )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( initializer_list<Type> list )
 {
    resize( list.size(), false );
    std::copy( list.begin(), list.end(), v_ );
@@ -1024,11 +1105,12 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( initializer_li
 // array. Missing values are initialized with default values (as e.g. the fourth element in the
 // example).
 */
-template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
-template< typename Other  // Data type of the initialization array
-        , size_t Dim >    // Dimension of the initialization array
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&array)[Dim] )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename Other    // Data type of the initialization array
+        , size_t Dim >      // Dimension of the initialization array
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Other (&array)[Dim] )
 {
    resize( Dim, false );
 
@@ -1049,9 +1131,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&
 // The vector is resized according to the given N-dimensional vector and initialized as a
 // copy of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicVector& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const DynamicVector& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -1070,12 +1153,29 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicV
 //
 // \param rhs The vector to be moved into this instance.
 // \return Reference to the assigned vector.
+//
+// In case the allocator propagates on move assignment (see std::allocator_traits), the allocator
+// of the given vector is moved into this instance together with its elements. Otherwise the
+// elements are only taken over in case both allocators compare equal. If they differ, the
+// elements are moved one by one into memory acquired from the allocator of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( DynamicVector&& rhs ) noexcept
-{
-   deallocate( v_ );
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( DynamicVector&& rhs )
+   noexcept( AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value )
+{
+   if( !AllocTraits::propagate_on_container_move_assignment::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != rhs.alloc_ ) {
+      resize( rhs.size_, false );
+      std::move( rhs.v_, rhs.v_+rhs.size_, v_ );
+      return *this;
+   }
+
+   deallocate( v_, capacity_, alloc_ );
+
+   if( AllocTraits::propagate_on_container_move_assignment::value )
+      alloc_ = std::move( rhs.alloc_ );
 
    size_     = rhs.size_;
    capacity_ = rhs.capacity_;
@@ -1098,10 +1198,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( DynamicVector&
 //
 // The vector is resized according to the given vector and initialized as a copy of this vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
       DynamicVector tmp( ~rhs );
@@ -1131,10 +1232,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<V
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator+=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1166,10 +1268,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator-=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1201,17 +1304,18 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator*=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
    if( IsSparseVector<VT>::value || (~rhs).canAlias( this ) ) {
-      DynamicVector<Type,TF> tmp( *this * (~rhs) );
+      DynamicVector<Type,TF,Alloc> tmp( *this * (~rhs) );
       swap( tmp );
    }
    else {
@@ -1235,17 +1339,18 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<
 // In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator/=( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator/=( const DenseVector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
    if( (~rhs).canAlias( this ) ) {
-      DynamicVector<Type,TF> tmp( *this / (~rhs) );
+      DynamicVector<Type,TF,Alloc> tmp( *this / (~rhs) );
       swap( tmp );
    }
    else {
@@ -1270,10 +1375,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator/=( const DenseVe
 // In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
 // exception is thrown.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator%=( const Vector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side vector
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::operator%=( const Vector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1313,9 +1419,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator%=( const Vector<
 //
 // \return The size of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::size() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::size() const noexcept
 {
    return size_;
 }
@@ -1330,9 +1437,10 @@ inline size_t DynamicVector<Type,TF>::size() const noexcept
 // This function returns the minimum capacity of the vector, which corresponds to the current
 // size plus padding.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::spacing() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::spacing() const noexcept
 {
    return addPadding( size_ );
 }
@@ -1344,9 +1452,10 @@ inline size_t DynamicVector<Type,TF>::spacing() const noexcept
 //
 // \return The maximum capacity of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::capacity() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1361,9 +1470,10 @@ inline size_t DynamicVector<Type,TF>::capacity() const noexcept
 // Note that the number of non-zero elements is always less than or equal to the current size
 // of the vector.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::nonZeros() const
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0 );
 
@@ -1382,9 +1492,10 @@ inline size_t DynamicVector<Type,TF>::nonZeros() const
 //
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reset()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::reset()
 {
    using blaze::clear;
    for( size_t i=0UL; i<size_; ++i )
@@ -1400,9 +1511,10 @@ inline void DynamicVector<Type,TF>::reset()
 //
 // After the clear() function, the size of the vector is 0.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::clear()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::clear()
 {
    resize( 0UL, false );
 }
@@ -1438,9 +1550,10 @@ inline void DynamicVector<Type,TF>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::resize( size_t n, bool preserve )
 {
    using std::swap;
 
@@ -1448,7 +1561,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity, alloc_ );
 
       // Initializing the new array
       if( preserve ) {
@@ -1462,7 +1575,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 
       // Replacing the old array
       swap( v_, tmp );
-      deallocate( tmp );
+      deallocate( tmp, capacity_, alloc_ );
       capacity_ = newCapacity;
    }
    else if( IsVectorizable<Type>::value && n < size_ )
@@ -1488,9 +1601,10 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 // function potentially changes all vector elements. In order to preserve the old vector values,
 // the \a preserve flag can be set to \a true. However, new vector elements are not initialized!
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::extend( size_t n, bool preserve )
 {
    resize( size_+n, preserve );
 }
@@ -1506,9 +1620,10 @@ inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
 // This function increases the capacity of the vector to at least \a n elements. The current
 // values of the vector elements are preserved.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reserve( size_t n )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::reserve( size_t n )
 {
    using std::swap;
 
@@ -1516,7 +1631,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity, alloc_ );
 
       // Initializing the new array
       transfer( v_, v_+size_, tmp );
@@ -1528,7 +1643,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocate( tmp, capacity_, alloc_ );
       capacity_ = newCapacity;
    }
 }
@@ -1545,9 +1660,10 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this vector are invalidated.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::shrinkToFit()
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::shrinkToFit()
 {
    if( spacing() < capacity_ ) {
       DynamicVector( *this ).swap( *this );
@@ -1561,13 +1677,39 @@ inline void DynamicVector<Type,TF>::shrinkToFit()
 //
 // \param v The vector to be swapped.
 // \return void
+//
+// In case the allocator propagates on swap (see std::allocator_traits), the allocators are
+// swapped together with the elements. Otherwise the elements are only exchanged in case both
+// allocators compare equal. If they differ, every vector keeps its allocator and the elements
+// are moved one by one into memory acquired from the according allocator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::swap( DynamicVector& v )
+   noexcept( AllocTraits::propagate_on_container_swap::value || AllocTraits::is_always_equal::value )
 {
    using std::swap;
 
+   if( !AllocTraits::propagate_on_container_swap::value &&
+       !AllocTraits::is_always_equal::value && alloc_ != v.alloc_ )
+   {
+      DynamicVector tmp( v.size_, alloc_ );
+      std::move( v.v_, v.v_+v.size_, tmp.v_ );
+
+      v.resize( size_, false );
+      std::move( v_, v_+size_, v.v_ );
+
+      swap( size_, tmp.size_ );
+      swap( capacity_, tmp.capacity_ );
+      swap( v_, tmp.v_ );
+
+      return;
+   }
+
+   if( AllocTraits::propagate_on_container_swap::value )
+      swap( alloc_, v.alloc_ );
+
    swap( size_, v.size_ );
    swap( capacity_, v.capacity_ );
    swap( v_, v.v_ );
@@ -1575,6 +1717,21 @@ inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns a copy of the allocator of the vector.
+//
+// \return The allocator of the vector elements.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline Alloc DynamicVector<Type,TF,Alloc>::getAllocator() const noexcept
+{
+   return alloc_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Add the necessary amount of padding to the given value.
 //
@@ -1584,9 +1741,10 @@ inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,Alloc>::addPadding( size_t value ) const noexcept
 {
    if( usePadding && IsVectorizable<Type>::value )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -1595,6 +1753,42 @@ inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initialization of all vector elements with the given value.
+//
+// \param init The initial value of the vector elements.
+// \return void
+//
+// This function initializes all vector elements with the given value and all padding elements
+// with the default value. In case the parallel first-touch initialization is selected (see
+// BLAZE_NUMA_PLACEMENT) and the vector of built-in data type is large enough for an SMP
+// assignment, the elements are initialized in parallel, using the same partitioning as the
+// SMP assignments.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void DynamicVector<Type,TF,Alloc>::initialize( const Type& init )
+{
+   const auto kernel = [this,&init]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+         v_[i] = init;
+   };
+
+   if( useFirstTouch && IsBuiltin<Type>::value && canSMPAssign() )
+      smpFirstTouch( *this, kernel );
+   else
+      kernel( 0UL, size_ );
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1621,9 +1815,10 @@ inline size_t DynamicVector<Type,TF>::addPadding( size_t value ) const noexcept
    \endcode
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scalar )
+inline DynamicVector<Type,TF,Alloc>& DynamicVector<Type,TF,Alloc>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] *= scalar;
@@ -1649,9 +1844,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scala
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::isIntact() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::isIntact() const noexcept
 {
    if( size_ > capacity_ )
       return false;
@@ -1687,9 +1883,10 @@ inline bool DynamicVector<Type,TF>::isIntact() const noexcept
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicVector<Type,TF,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1707,9 +1904,10 @@ inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const noexcep
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicVector<Type,TF,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1725,11 +1923,12 @@ inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const noexce
 // whether the beginning and the end of the vector are guaranteed to conform to the alignment
 // restrictions of the element type \a Type.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::isAligned() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::isAligned() const noexcept
 {
-   return true;
+   return IsAlignedAllocator<Alloc>::value;
 }
 //*************************************************************************************************
 
@@ -1744,9 +1943,10 @@ inline bool DynamicVector<Type,TF>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current size of the
 // vector).
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicVector<Type,TF,Alloc>::canSMPAssign() const noexcept
 {
    return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
@@ -1765,12 +1965,16 @@ inline bool DynamicVector<Type,TF>::canSMPAssign() const noexcept
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::load( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::load( size_t index ) const noexcept
 {
-   return loada( index );
+   if( IsAlignedAllocator<Alloc>::value )
+      return loada( index );
+   else
+      return loadu( index );
 }
 //*************************************************************************************************
 
@@ -1788,10 +1992,11 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // Calling this function explicitly might result in erroneous results and/or in compilation
 // errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::loada( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::loada( size_t index ) const noexcept
 {
    using blaze::loada;
 
@@ -1820,10 +2025,11 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // Calling this function explicitly might result in erroneous results and/or in compilation
 // errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
-   DynamicVector<Type,TF>::loadu( size_t index ) const noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,Alloc>::SIMDType
+   DynamicVector<Type,TF,Alloc>::loadu( size_t index ) const noexcept
 {
    using blaze::loadu;
 
@@ -1850,12 +2056,16 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::SIMDType
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::store( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::store( size_t index, const SIMDType& value ) noexcept
 {
-   storea( index, value );
+   if( IsAlignedAllocator<Alloc>::value )
+      storea( index, value );
+   else
+      storeu( index, value );
 }
 //*************************************************************************************************
 
@@ -1873,10 +2083,11 @@ BLAZE_ALWAYS_INLINE void
 // is used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::storea( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::storea( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -1905,10 +2116,11 @@ BLAZE_ALWAYS_INLINE void
 // is used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::storeu( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::storeu( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -1936,10 +2148,11 @@ BLAZE_ALWAYS_INLINE void
 // expression templates. Calling this function explicitly might result in erroneous results
 // and/or in compilation errors.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicVector<Type,TF>::stream( size_t index, const SIMDType& value ) noexcept
+   DynamicVector<Type,TF,Alloc>::stream( size_t index, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -1966,11 +2179,12 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >
-   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline DisableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1998,11 +2212,12 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssi
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >
-   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2017,7 +2232,8 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssig
    Iterator left( begin() );
    ConstIterator_<VT> right( (~rhs).begin() );
 
-   if( useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( IsAlignedAllocator<Alloc>::value && useStreaming &&
+       size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
@@ -2056,10 +2272,11 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssig
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2080,11 +2297,12 @@ inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >
-   DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline DisableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2112,11 +2330,12 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >
-   DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2158,10 +2377,11 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2182,11 +2402,12 @@ inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >
-   DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline DisableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2214,11 +2435,12 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >
-   DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2260,10 +2482,11 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2284,11 +2507,12 @@ inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >
-   DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline DisableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2316,11 +2540,12 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMult
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >
-   DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2362,10 +2587,11 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMultA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side sparse vector
+inline void DynamicVector<Type,TF,Alloc>::multAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2390,11 +2616,12 @@ inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedDivAssign<VT> >
-   DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline DisableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedDivAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2422,11 +2649,12 @@ inline DisableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedDivA
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-template< typename VT >  // Type of the right-hand side dense vector
-inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedDivAssign<VT> >
-   DynamicVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+template< typename VT >     // Type of the right-hand side dense vector
+inline EnableIf_<typename DynamicVector<Type,TF,Alloc>::BLAZE_TEMPLATE VectorizedDivAssign<VT> >
+   DynamicVector<Type,TF,Alloc>::divAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2466,20 +2694,21 @@ inline EnableIf_<typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedDivAs
 //*************************************************************************************************
 /*!\name DynamicVector operators */
 //@{
-template< typename Type, bool TF >
-inline void reset( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename Alloc >
+inline void reset( DynamicVector<Type,TF,Alloc>& v );
 
-template< typename Type, bool TF >
-inline void clear( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename Alloc >
+inline void clear( DynamicVector<Type,TF,Alloc>& v );
 
-template< bool RF, typename Type, bool TF >
-inline bool isDefault( const DynamicVector<Type,TF>& v );
+template< bool RF, typename Type, bool TF, typename Alloc >
+inline bool isDefault( const DynamicVector<Type,TF,Alloc>& v );
 
-template< typename Type, bool TF >
-inline bool isIntact( const DynamicVector<Type,TF>& v ) noexcept;
+template< typename Type, bool TF, typename Alloc >
+inline bool isIntact( const DynamicVector<Type,TF,Alloc>& v ) noexcept;
 
-template< typename Type, bool TF >
-inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept;
+template< typename Type, bool TF, typename Alloc >
+inline void swap( DynamicVector<Type,TF,Alloc>& a, DynamicVector<Type,TF,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) );
 //@}
 //*************************************************************************************************
 
@@ -2491,9 +2720,10 @@ inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcep
 // \param v The dynamic vector to be resetted.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( DynamicVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicVector<Type,TF,Alloc>& v )
 {
    v.reset();
 }
@@ -2507,9 +2737,10 @@ inline void reset( DynamicVector<Type,TF>& v )
 // \param v The dynamic vector to be cleared.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( DynamicVector<Type,TF>& v )
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicVector<Type,TF,Alloc>& v )
 {
    v.clear();
 }
@@ -2540,10 +2771,11 @@ inline void clear( DynamicVector<Type,TF>& v )
    if( isDefault<relaxed>( a ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const DynamicVector<Type,TF>& v )
+template< bool RF           // Relaxation flag
+        , typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const DynamicVector<Type,TF,Alloc>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -2568,9 +2800,10 @@ inline bool isDefault( const DynamicVector<Type,TF>& v )
    if( isIntact( a ) ) { ... }
    \endcode
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isIntact( const DynamicVector<Type,TF>& v ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicVector<Type,TF,Alloc>& v ) noexcept
 {
    return v.isIntact();
 }
@@ -2585,9 +2818,11 @@ inline bool isIntact( const DynamicVector<Type,TF>& v ) noexcept
 // \param b The second vector to be swapped.
 // \return void
 */
-template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicVector<Type,TF,Alloc>& a, DynamicVector<Type,TF,Alloc>& b )
+   noexcept( noexcept( a.swap( b ) ) )
 {
    a.swap( b );
 }
@@ -2604,8 +2839,8 @@ inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcep
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasConstDataAccess< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct HasConstDataAccess< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2622,8 +2857,8 @@ struct HasConstDataAccess< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasMutableDataAccess< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct HasMutableDataAccess< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2640,9 +2875,9 @@ struct HasMutableDataAccess< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsAligned< DynamicVector<T,TF> >
-   : public TrueType
+template< typename T, bool TF, typename A >
+struct IsAligned< DynamicVector<T,TF,A> >
+   : public BoolConstant< IsAlignedAllocator<A>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -2658,8 +2893,8 @@ struct IsAligned< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsContiguous< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsContiguous< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2676,9 +2911,9 @@ struct IsContiguous< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsPadded< DynamicVector<T,TF> >
-   : public BoolConstant<usePadding>
+template< typename T, bool TF, typename A >
+struct IsPadded< DynamicVector<T,TF,A> >
+   : public BoolConstant< usePadding && IsAlignedAllocator<A>::value >
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -2694,8 +2929,8 @@ struct IsPadded< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsResizable< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2712,8 +2947,8 @@ struct IsResizable< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsShrinkable< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct IsShrinkable< DynamicVector<T,TF,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2730,32 +2965,32 @@ struct IsShrinkable< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct AddTrait< DynamicVector<T1,TF,A>, StaticVector<T2,N,TF> >
 {
    using Type = StaticVector< AddTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct AddTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = StaticVector< AddTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct AddTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF> >
 {
    using Type = HybridVector< AddTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct AddTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = HybridVector< AddTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct AddTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< AddTrait_<T1,T2>, TF >;
 };
@@ -2773,32 +3008,32 @@ struct AddTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct SubTrait< DynamicVector<T1,TF,A>, StaticVector<T2,N,TF> >
 {
    using Type = StaticVector< SubTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct SubTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = StaticVector< SubTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct SubTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF> >
 {
    using Type = HybridVector< SubTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct SubTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = HybridVector< SubTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct SubTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< SubTrait_<T1,T2>, TF >;
 };
@@ -2816,104 +3051,104 @@ struct SubTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, T2, EnableIf_<IsNumeric<T2> > >
+template< typename T1, bool TF, typename A, typename T2 >
+struct MultTrait< DynamicVector<T1,TF,A>, T2, EnableIf_<IsNumeric<T2> > >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, typename T2, bool TF >
-struct MultTrait< T1, DynamicVector<T2,TF>, EnableIf_<IsNumeric<T1> > >
+template< typename T1, typename T2, bool TF, typename A >
+struct MultTrait< T1, DynamicVector<T2,TF,A>, EnableIf_<IsNumeric<T1> > >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,TF,A>, StaticVector<T2,N,TF> >
 {
    using Type = StaticVector< MultTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,false>, StaticVector<T2,N,true> >
+template< typename T1, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,false,A>, StaticVector<T2,N,true> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,true>, StaticVector<T2,N,false> >
+template< typename T1, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,true,A>, StaticVector<T2,N,false> >
 {
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct MultTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = StaticVector< MultTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,false>, DynamicVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename A >
+struct MultTrait< StaticVector<T1,N,false>, DynamicVector<T2,true,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,true>, DynamicVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename A >
+struct MultTrait< StaticVector<T1,N,true>, DynamicVector<T2,false,A> >
 {
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF> >
 {
    using Type = HybridVector< MultTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,false>, HybridVector<T2,N,true> >
+template< typename T1, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,false,A>, HybridVector<T2,N,true> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,true>, HybridVector<T2,N,false> >
+template< typename T1, typename A, typename T2, size_t N >
+struct MultTrait< DynamicVector<T1,true,A>, HybridVector<T2,N,false> >
 {
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct MultTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = HybridVector< MultTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,false>, DynamicVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename A >
+struct MultTrait< HybridVector<T1,N,false>, DynamicVector<T2,true,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,true>, DynamicVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename A >
+struct MultTrait< HybridVector<T1,N,true>, DynamicVector<T2,false,A> >
 {
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct MultTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename A1, typename T2, typename A2 >
+struct MultTrait< DynamicVector<T1,false,A1>, DynamicVector<T2,true,A2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename A1, typename T2, typename A2 >
+struct MultTrait< DynamicVector<T1,true,A1>, DynamicVector<T2,false,A2> >
 {
    using Type = MultTrait_<T1,T2>;
 };
@@ -2931,38 +3166,38 @@ struct MultTrait< DynamicVector<T1,true>, DynamicVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< DynamicVector<T1,TF>, T2, EnableIf_<IsNumeric<T2> > >
+template< typename T1, bool TF, typename A, typename T2 >
+struct DivTrait< DynamicVector<T1,TF,A>, T2, EnableIf_<IsNumeric<T2> > >
 {
    using Type = DynamicVector< DivTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct DivTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct DivTrait< DynamicVector<T1,TF,A>, StaticVector<T2,N,TF> >
 {
    using Type = StaticVector< DivTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct DivTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct DivTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = StaticVector< DivTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct DivTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct DivTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF> >
 {
    using Type = HybridVector< DivTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct DivTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct DivTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = HybridVector< DivTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct DivTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< DivTrait_<T1,T2>, TF >;
 };
@@ -2980,8 +3215,8 @@ struct DivTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct CrossTrait< DynamicVector<T1,TF>, StaticVector<T2,3UL,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct CrossTrait< DynamicVector<T1,TF,A>, StaticVector<T2,3UL,TF> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -2990,8 +3225,8 @@ struct CrossTrait< DynamicVector<T1,TF>, StaticVector<T2,3UL,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct CrossTrait< StaticVector<T1,3UL,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct CrossTrait< StaticVector<T1,3UL,TF>, DynamicVector<T2,TF,A> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -3000,8 +3235,8 @@ struct CrossTrait< StaticVector<T1,3UL,TF>, DynamicVector<T2,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct CrossTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename A, typename T2, size_t N >
+struct CrossTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -3010,8 +3245,8 @@ struct CrossTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct CrossTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A >
+struct CrossTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -3020,8 +3255,8 @@ struct CrossTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct CrossTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct CrossTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -3043,8 +3278,8 @@ struct CrossTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF, typename OP >
-struct UnaryMapTrait< DynamicVector<T,TF>, OP >
+template< typename T, bool TF, typename A, typename OP >
+struct UnaryMapTrait< DynamicVector<T,TF,A>, OP >
 {
    using Type = DynamicVector< UnaryMapTrait_<T,OP>, TF >;
 };
@@ -3062,32 +3297,32 @@ struct UnaryMapTrait< DynamicVector<T,TF>, OP >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N, typename OP >
-struct BinaryMapTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF>, OP >
+template< typename T1, bool TF, typename A, typename T2, size_t N, typename OP >
+struct BinaryMapTrait< DynamicVector<T1,TF,A>, StaticVector<T2,N,TF>, OP >
 {
    using Type = StaticVector< BinaryMapTrait_<T1,T2,OP>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2, typename OP >
-struct BinaryMapTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF>, OP >
+template< typename T1, size_t N, bool TF, typename T2, typename A, typename OP >
+struct BinaryMapTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A>, OP >
 {
    using Type = StaticVector< BinaryMapTrait_<T1,T2,OP>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2, size_t N, typename OP >
-struct BinaryMapTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF>, OP >
+template< typename T1, bool TF, typename A, typename T2, size_t N, typename OP >
+struct BinaryMapTrait< DynamicVector<T1,TF,A>, HybridVector<T2,N,TF>, OP >
 {
    using Type = HybridVector< BinaryMapTrait_<T1,T2,OP>, N, TF >;
 };
 
-template< typename T1, size_t N, bool TF, typename T2, typename OP >
-struct BinaryMapTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF>, OP >
+template< typename T1, size_t N, bool TF, typename T2, typename A, typename OP >
+struct BinaryMapTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A>, OP >
 {
    using Type = HybridVector< BinaryMapTrait_<T1,T2,OP>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2, typename OP >
-struct BinaryMapTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF>, OP >
+template< typename T1, bool TF, typename A1, typename T2, typename A2, typename OP >
+struct BinaryMapTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2>, OP >
 {
    using Type = DynamicVector< BinaryMapTrait_<T1,T2,OP>, TF >;
 };
@@ -3105,8 +3340,8 @@ struct BinaryMapTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF>, OP >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct HighType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct HighType< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< typename HighType<T1,T2>::Type, TF >;
 };
@@ -3124,8 +3359,8 @@ struct HighType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct LowType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename A1, typename T2, typename A2 >
+struct LowType< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    using Type = DynamicVector< typename LowType<T1,T2>::Type, TF >;
 };
@@ -3143,14 +3378,14 @@ struct LowType< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF, size_t I, size_t N >
-struct SubvectorTrait< DynamicVector<T,TF>, I, N >
+template< typename T, bool TF, typename A, size_t I, size_t N >
+struct SubvectorTrait< DynamicVector<T,TF,A>, I, N >
 {
    using Type = StaticVector<T,N,TF>;
 };
 
-template< typename T, bool TF >
-struct SubvectorTrait< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct SubvectorTrait< DynamicVector<T,TF,A> >
 {
    using Type = DynamicVector<T,TF>;
 };
@@ -3168,14 +3403,14 @@ struct SubvectorTrait< DynamicVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF, size_t... CEAs >
-struct ElementsTrait< DynamicVector<T,TF>, CEAs... >
+template< typename T, bool TF, typename A, size_t... CEAs >
+struct ElementsTrait< DynamicVector<T,TF,A>, CEAs... >
 {
    using Type = StaticVector<T,sizeof...(CEAs),TF>;
 };
 
-template< typename T, bool TF >
-struct ElementsTrait< DynamicVector<T,TF> >
+template< typename T, bool TF, typename A >
+struct ElementsTrait< DynamicVector<T,TF,A> >
 {
    using Type = DynamicVector<T,TF>;
 };
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Types.h>
 
 
@@ -53,10 +54,12 @@ namespace blaze {
 
 template< typename, bool, bool, bool > class CustomMatrix;
 template< typename, bool, bool, bool > class CustomVector;
-template< typename, bool > class DynamicVector;
-template< typename, bool > class DynamicMatrix;
+template< typename T, bool, typename = AlignedAllocator<T> > class DynamicVector;
+template< typename T, bool, typename = AlignedAllocator<T> > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, bool > class ScratchMatrix;
+template< typename, bool > class ScratchVector;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
@@ -0,0 +1,301 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ScratchMatrix.h
+//  \brief Header file for the implementation of a dense matrix drawn from the scratch arena
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SCRATCHMATRIX_H_
+#define _BLAZE_MATH_DENSE_SCRATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsCustom.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/ScratchArena.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dense matrix for the intermediate results of expression templates.
+// \ingroup dense_matrix
+//
+// The ScratchMatrix class template is an aligned and padded CustomMatrix, whose elements are
+// drawn from the scratch arena of the calling thread (see ScratchArena). It is used instead of
+// a DynamicMatrix for the intermediate evaluation of operands within expression templates, as
+// for instance the evaluation of \f$ A*B \f$ within the expression \f$ (A*B)*x \f$. Since the
+// scratch arena reuses the same memory for all temporaries of subsequent assignments, the
+// evaluation of operands does not result in any dynamic memory allocation.
+//
+// A ScratchMatrix is immediately initialized with the given matrix and cannot be resized or
+// copied. It must be destroyed by the same thread that created it, which restricts its use to
+// local variables.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class ScratchMatrix
+   : private ScratchArray<Type>
+   , public CustomMatrix<Type,aligned,padded,SO>
+{
+ private:
+   //**Type definitions****************************************************************************
+   using CustomType = CustomMatrix<Type,aligned,padded,SO>;  //!< Type of the underlying custom matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO2 >
+   explicit inline ScratchMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   using CustomType::data;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t spacing( size_t m, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline ScratchMatrix<Type,SO>::ScratchMatrix( const Matrix<MT,SO2>& m )
+   : ScratchArray<Type>( spacing( (~m).rows(), (~m).columns() ) *
+                         ( SO ? (~m).columns() : (~m).rows() ) )
+   , CustomType( ScratchArray<Type>::data(), (~m).rows(), (~m).columns(),
+                 spacing( (~m).rows(), (~m).columns() ) )
+{
+   if( IsSparseMatrix<MT>::value ) {
+      CustomType::reset();
+   }
+
+   smpAssign( *this, ~m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculation of the padded number of elements per row/column.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The padded number of elements per row (row-major) or column (column-major).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t ScratchMatrix<Type,SO>::spacing( size_t m, size_t n ) noexcept
+{
+   return nextMultiple<size_t>( SO ? m : n, SIMDTrait<Type>::size );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct HasConstDataAccess< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct HasMutableDataAccess< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCUSTOM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsCustom< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsAligned< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsContiguous< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsPadded< ScratchMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
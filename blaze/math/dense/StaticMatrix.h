@@ -6446,14 +6446,14 @@ struct MultTrait< HybridVector<T1,L,true>, StaticMatrix<T2,M,N,SO> >
    using Type = StaticVector< MultTrait_<T1,T2>, N, true >;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO>, DynamicVector<T2,false> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A >
+struct MultTrait< StaticMatrix<T1,M,N,SO>, DynamicVector<T2,false,A> >
 {
    using Type = StaticVector< MultTrait_<T1,T2>, M, false >;
 };
 
-template< typename T1, typename T2, size_t M, size_t N, bool SO >
-struct MultTrait< DynamicVector<T1,true>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, typename A, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< DynamicVector<T1,true,A>, StaticMatrix<T2,M,N,SO> >
 {
    using Type = StaticVector< MultTrait_<T1,T2>, N, true >;
 };
@@ -61,6 +61,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -216,10 +217,10 @@ class DMatDVecMultExpr
    using RightOperand = If_< IsExpression<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using LT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using RT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -2819,10 +2820,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the dense matrix operand of the left-hand side expression.
-   using LT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using LT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
 
    //! Type for the assignment of the dense vector operand of the left-hand side expression.
-   using RT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using RT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -65,6 +65,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -244,10 +245,10 @@ class DMatSMatMultExpr
    using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateLeft, const RT1, CT1 >;
+   using LT = IfTrue_< evaluateLeft, const ScratchTrait_<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side sparse matrix operand.
-   using RT = IfTrue_< evaluateRight, const RT2, CT2 >;
+   using RT = IfTrue_< evaluateRight, const ScratchTrait_<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -67,6 +67,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -267,10 +268,10 @@ class DMatTDMatMultExpr
    using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateLeft, const RT1, CT1 >;
+   using LT = IfTrue_< evaluateLeft, const ScratchTrait_<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = IfTrue_< evaluateRight, const RT2, CT2 >;
+   using RT = IfTrue_< evaluateRight, const ScratchTrait_<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -4452,10 +4453,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateLeft, const RT1, CT1 >;
+   using LT = IfTrue_< evaluateLeft, const ScratchTrait_<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = IfTrue_< evaluateRight, const RT2, CT2 >;
+   using RT = IfTrue_< evaluateRight, const ScratchTrait_<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -61,6 +61,7 @@
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -221,10 +222,10 @@ class DVecDVecOuterExpr
    using RightOperand = If_< IsExpression<VT2>, const VT2, const VT2& >;
 
    //! Type for the assignment of the left-hand side dense vector operand.
-   using LT = IfTrue_< evaluateLeft, const RT1, CT1 >;
+   using LT = IfTrue_< evaluateLeft, const ScratchTrait_<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = IfTrue_< evaluateRight, const RT2, CT2 >;
+   using RT = IfTrue_< evaluateRight, const ScratchTrait_<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**ConstIterator class definition**************************************************************
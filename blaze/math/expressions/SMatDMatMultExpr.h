@@ -64,6 +64,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -83,6 +84,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Max.h>
@@ -256,10 +258,10 @@ class SMatDMatMultExpr
    using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side sparse matrix operand.
-   using LT = IfTrue_< evaluateLeft, const RT1, CT1 >;
+   using LT = IfTrue_< evaluateLeft, const ScratchTrait_<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = IfTrue_< evaluateRight, const RT2, CT2 >;
+   using RT = IfTrue_< evaluateRight, const ScratchTrait_<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -730,6 +732,13 @@ class SMatDMatMultExpr
 
       constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT5>::value );
 
+      if( !IsTriangular<MT5>::value ) {
+         if( LOW || UPP )
+            reset( C );
+         blockedKernel<true,false>( C, A, B );
+         return;
+      }
+
       reset( C );
 
       for( size_t i=0UL; i<A.rows(); ++i )
@@ -832,6 +841,242 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Register-blocked vectorized kernel**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked vectorized kernel of the sparse matrix-dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the register-blocked vectorized kernel for the assignment (\a Init),
+   // addition assignment and subtraction assignment (\a Sub) of the sparse matrix-dense matrix
+   // multiplication with a non-triangular dense matrix. For every row of the sparse matrix, a block
+   // of up to four SIMD vectors of the according row of the target matrix is accumulated in
+   // registers by broadcasting each non-zero element and multiplying it with the according
+   // SIMD vectors of the dense matrix. Thus every element of the target matrix is loaded and
+   // stored exactly once, independent of the number of non-zero elements per row. In case the
+   // column range of the target matrix does not depend on the row index (i.e. for general target
+   // matrices), two rows of the sparse matrix are processed against the same block of columns at
+   // once. The non-zero elements of both rows are traversed simultaneously into two independent
+   // sets of accumulators, which keeps the current block of the dense matrix in cache for both
+   // rows and doubles the number of independent multiply-add chains.
+   */
+   template< bool Init       // Assignment flag
+           , bool Sub        // Subtraction flag
+           , typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void blockedKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      using ConstIterator = ConstIterator_<MT4>;
+
+      constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT5>::value );
+      constexpr bool pairwise( !LOW && !UPP && !( Init && ( SYM || HERM ) ) );
+
+      size_t i( 0UL );
+
+      for( ; pairwise && (i+1UL) < A.rows(); i+=2UL )
+      {
+         const ConstIterator begin1( A.begin(i    ) );
+         const ConstIterator end1  ( A.end(i      ) );
+         const ConstIterator begin2( A.begin(i+1UL) );
+         const ConstIterator end2  ( A.end(i+1UL  ) );
+
+         const size_t jend( B.columns() );
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+         size_t j( 0UL );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+         {
+            SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+            ConstIterator element1( begin1 );
+            ConstIterator element2( begin2 );
+
+            for( ; element1!=end1 && element2!=end2; ++element1, ++element2 ) {
+               const size_t   k1( element1->index() );
+               const size_t   k2( element2->index() );
+               const SIMDType a1( set( element1->value() ) );
+               const SIMDType a2( set( element2->value() ) );
+               xmm1 += a1 * B.load(k1,j             );
+               xmm2 += a1 * B.load(k1,j+SIMDSIZE    );
+               xmm3 += a1 * B.load(k1,j+SIMDSIZE*2UL);
+               xmm4 += a1 * B.load(k1,j+SIMDSIZE*3UL);
+               xmm5 += a2 * B.load(k2,j             );
+               xmm6 += a2 * B.load(k2,j+SIMDSIZE    );
+               xmm7 += a2 * B.load(k2,j+SIMDSIZE*2UL);
+               xmm8 += a2 * B.load(k2,j+SIMDSIZE*3UL);
+            }
+
+            for( ; element1!=end1; ++element1 ) {
+               const size_t   k ( element1->index() );
+               const SIMDType a1( set( element1->value() ) );
+               xmm1 += a1 * B.load(k,j             );
+               xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+               xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+               xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+            }
+
+            for( ; element2!=end2; ++element2 ) {
+               const size_t   k ( element2->index() );
+               const SIMDType a2( set( element2->value() ) );
+               xmm5 += a2 * B.load(k,j             );
+               xmm6 += a2 * B.load(k,j+SIMDSIZE    );
+               xmm7 += a2 * B.load(k,j+SIMDSIZE*2UL);
+               xmm8 += a2 * B.load(k,j+SIMDSIZE*3UL);
+            }
+
+            storeBlock<Init,Sub>( C, i    , j             , xmm1 );
+            storeBlock<Init,Sub>( C, i    , j+SIMDSIZE    , xmm2 );
+            storeBlock<Init,Sub>( C, i    , j+SIMDSIZE*2UL, xmm3 );
+            storeBlock<Init,Sub>( C, i    , j+SIMDSIZE*3UL, xmm4 );
+            storeBlock<Init,Sub>( C, i+1UL, j             , xmm5 );
+            storeBlock<Init,Sub>( C, i+1UL, j+SIMDSIZE    , xmm6 );
+            storeBlock<Init,Sub>( C, i+1UL, j+SIMDSIZE*2UL, xmm7 );
+            storeBlock<Init,Sub>( C, i+1UL, j+SIMDSIZE*3UL, xmm8 );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE )
+         {
+            SIMDType xmm1, xmm2;
+
+            for( ConstIterator element=begin1; element!=end1; ++element ) {
+               xmm1 += set( element->value() ) * B.load(element->index(),j);
+            }
+
+            for( ConstIterator element=begin2; element!=end2; ++element ) {
+               xmm2 += set( element->value() ) * B.load(element->index(),j);
+            }
+
+            storeBlock<Init,Sub>( C, i    , j, xmm1 );
+            storeBlock<Init,Sub>( C, i+1UL, j, xmm2 );
+         }
+
+         for( ; remainder && j<jend; ++j )
+         {
+            ElementType value1{};
+            ElementType value2{};
+
+            for( ConstIterator element=begin1; element!=end1; ++element ) {
+               value1 += element->value() * B(element->index(),j);
+            }
+
+            for( ConstIterator element=begin2; element!=end2; ++element ) {
+               value2 += element->value() * B(element->index(),j);
+            }
+
+            if( Init ) {
+               C(i    ,j) = value1;
+               C(i+1UL,j) = value2;
+            }
+            else if( Sub ) {
+               C(i    ,j) -= value1;
+               C(i+1UL,j) -= value2;
+            }
+            else {
+               C(i    ,j) += value1;
+               C(i+1UL,j) += value2;
+            }
+         }
+      }
+
+      for( ; i<A.rows(); ++i )
+      {
+         const ConstIterator begin( A.begin(i) );
+         const ConstIterator end  ( A.end(i)   );
+
+         const size_t jbegin( UPP ? ( i & size_t(-SIMDSIZE) ) : 0UL );
+         const size_t jend( ( LOW || ( Init && ( SYM || HERM ) ) ) ? i+1UL : B.columns() );
+         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+         size_t j( jbegin );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+         {
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const size_t   k ( element->index() );
+               const SIMDType a1( set( element->value() ) );
+               xmm1 += a1 * B.load(k,j             );
+               xmm2 += a1 * B.load(k,j+SIMDSIZE    );
+               xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+               xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+            }
+
+            storeBlock<Init,Sub>( C, i, j             , xmm1 );
+            storeBlock<Init,Sub>( C, i, j+SIMDSIZE    , xmm2 );
+            storeBlock<Init,Sub>( C, i, j+SIMDSIZE*2UL, xmm3 );
+            storeBlock<Init,Sub>( C, i, j+SIMDSIZE*3UL, xmm4 );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE )
+         {
+            SIMDType xmm1;
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               xmm1 += set( element->value() ) * B.load(element->index(),j);
+            }
+
+            storeBlock<Init,Sub>( C, i, j, xmm1 );
+         }
+
+         for( ; remainder && j<jend; ++j )
+         {
+            ElementType value{};
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               value += element->value() * B(element->index(),j);
+            }
+
+            if( Init )     C(i,j)  = value;
+            else if( Sub ) C(i,j) -= value;
+            else           C(i,j) += value;
+         }
+      }
+
+      if( Init && ( SYM || HERM ) ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=i+1UL; j<B.columns(); ++j ) {
+               C(i,j) = HERM ? conj( C(j,i) ) : C(j,i);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block storage*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Storing an accumulated SIMD vector of the register-blocked kernel.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param i The row index of the SIMD vector.
+   // \param j The column index of the first element of the SIMD vector.
+   // \param xmm The accumulated SIMD vector.
+   // \return void
+   */
+   template< bool Init       // Assignment flag
+           , bool Sub        // Subtraction flag
+           , typename MT3 >  // Type of the left-hand side target matrix
+   static BLAZE_ALWAYS_INLINE void storeBlock( MT3& C, size_t i, size_t j, const SIMDType& xmm )
+   {
+      if( Init )     C.store( i, j, xmm );
+      else if( Sub ) C.store( i, j, C.load(i,j) - xmm );
+      else           C.store( i, j, C.load(i,j) + xmm );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1138,6 +1383,11 @@ class SMatDMatMultExpr
 
       constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT5>::value );
 
+      if( !IsTriangular<MT5>::value ) {
+         blockedKernel<false,false>( C, A, B );
+         return;
+      }
+
       for( size_t i=0UL; i<A.rows(); ++i )
       {
          const ConstIterator end( A.end(i) );
@@ -1501,6 +1751,11 @@ class SMatDMatMultExpr
 
       constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT5>::value );
 
+      if( !IsTriangular<MT5>::value ) {
+         blockedKernel<false,true>( C, A, B );
+         return;
+      }
+
       for( size_t i=0UL; i<A.rows(); ++i )
       {
          const ConstIterator end( A.end(i) );
@@ -56,6 +56,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -163,10 +164,10 @@ class SMatDVecMultExpr
    using RightOperand = If_< IsExpression<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side sparse matrix operand.
-   using LT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using LT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using RT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
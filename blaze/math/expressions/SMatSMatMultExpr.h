@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
@@ -52,10 +51,11 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -83,8 +83,8 @@
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
-#include <blaze/util/SmallVector.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 #include <blaze/util/Unused.h>
 
@@ -158,6 +158,24 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPRowKernel struct is a helper struct for the selection of the parallel evaluation
+       strategy for dense target matrices. In case neither of the two matrix operands requires an
+       intermediate evaluation, no symmetry can be exploited and both the target matrix and the
+       result of the multiplication are numeric, the nested \value will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSMPRowKernel {
+      enum : bool { value = !evaluateLeft && !evaluateRight && T1::smpAssignable &&
+                            IsNumeric< ElementType_<T1> >::value &&
+                            IsNumeric< ElementType_< MultTrait_<RT1,RT2> > >::value &&
+                            !CanExploitSymmetry<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = SMatSMatMultExpr<MT1,MT2>;   //!< Type of this SMatSMatMultExpr instance.
@@ -492,13 +510,11 @@ class SMatSMatMultExpr
       }
 
       (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
 
       // Performing the matrix-matrix multiplication
-      SmallVector<ElementType,128UL> values ( (~lhs).columns(), ElementType() );
-      SmallVector<bool,128UL>        valid  ( (~lhs).columns(), false );
-      SmallVector<size_t,128UL>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
+      SparseAccumulator<ElementType>& spa( getSparseAccumulator<ElementType>() );
+      spa.configure( (~lhs).columns(), ( (~lhs).rows() > 0UL )?( nonzeros / (~lhs).rows() )
+                                                              :( 0UL ) );
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
@@ -506,59 +522,17 @@ class SMatSMatMultExpr
          for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
          {
             const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
-            {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
-               }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
-               }
+            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+               spa.add( relem->index(), lelem->value() * relem->value() );
             }
          }
 
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
+         BLAZE_INTERNAL_ASSERT( spa.nonZeros() <= (~lhs).columns(), "Invalid number of non-zero elements" );
 
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
-
-                  reset( valid [j] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
+         spa.extract( [&]( size_t j, const ElementType& value ) {
+            if( !isDefault( value ) )
+               (~lhs).append( i, j, value );
+         } );
 
          (~lhs).finalize( i );
       }
@@ -891,6 +865,96 @@ class SMatSMatMultExpr
    // No special implementation for the multiplication assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**SMP row kernel******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel kernel for the sparse matrix-sparse matrix multiplication to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param op The operation for the accumulation of a single product into the target.
+   // \return void
+   //
+   // The rows of the target matrix are split into one contiguous block per thread (see smpFor()).
+   // Row \a i of \a C only depends on row \a i of \a A, therefore each thread accumulates the
+   // products of its rows directly into the target matrix without any synchronization and without
+   // the default value check of the serial kernel. In case of an assignment the target matrix is
+   // expected to be reset to zero before the kernel is called. Since the threads only read the
+   // sparse operands via constant iterators, their buffered insertions are flushed once before
+   // the threads start (see CompressedMatrix::flush()).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the accumulation operation
+   static void smpRowKernel( MT3& C, const MT4& A, const MT5& B, OP op )
+   {
+      using LeftIterator  = ConstIterator_<MT4>;
+      using RightIterator = ConstIterator_<MT5>;
+
+      flush( A );
+      flush( B );
+
+      smpFor( 0UL, A.rows(), [&]( size_t first, size_t last )
+      {
+         for( size_t i=first; i<last; ++i ) {
+            const LeftIterator lend( A.end(i) );
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  op( C(i,relem->index()), lelem->value() * relem->value() );
+               }
+            }
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices (row partitioning)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a dense
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse
+   // matrix-sparse matrix multiplication expression to a dense matrix by means of a partitioning
+   // of the rows of the target matrix (see smpRowKernel()). Due to the explicit application of
+   // the SFINAE principle this function can only be selected by the compiler in case no operand
+   // requires an intermediate evaluation and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPRowKernel<MT,MT1,MT2> >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      SMatSMatMultExpr::smpRowKernel( ~lhs, A, B,
+         []( Reference_<MT> c, const ElementType& value ) { c += value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to matrices******************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a matrix
@@ -962,6 +1026,49 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense matrices (row partitioning)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-sparse matrix multiplication to a dense
+   //        matrix (\f$ C+=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-sparse matrix multiplication expression to a dense matrix by means of a partitioning
+   // of the rows of the target matrix (see smpRowKernel()). Due to the explicit application of
+   // the SFINAE principle this function can only be selected by the compiler in case no operand
+   // requires an intermediate evaluation and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPRowKernel<MT,MT1,MT2> >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      SMatSMatMultExpr::smpRowKernel( ~lhs, A, B,
+         []( Reference_<MT> c, const ElementType& value ) { c += value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a sparse matrix-sparse matrix multiplication to a dense
@@ -1038,6 +1145,49 @@ class SMatSMatMultExpr
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices (row partitioning)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-sparse matrix multiplication to a dense
+   //        matrix (\f$ C-=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-sparse matrix multiplication expression to a dense matrix by means of a partitioning
+   // of the rows of the target matrix (see smpRowKernel()). Due to the explicit application of
+   // the SFINAE principle this function can only be selected by the compiler in case no operand
+   // requires an intermediate evaluation and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPRowKernel<MT,MT1,MT2> >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      SMatSMatMultExpr::smpRowKernel( ~lhs, A, B,
+         []( Reference_<MT> c, const ElementType& value ) { c -= value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to dense matrices************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP subtraction assignment of a sparse matrix-sparse matrix multiplication to a
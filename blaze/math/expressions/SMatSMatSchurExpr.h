@@ -52,6 +52,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -344,20 +345,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) = l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(i,l->index()) = l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -402,20 +393,10 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs).append( i, l->index(), l->value() * r->value() );
+                    } );
 
          (~lhs).finalize( i );
       }
@@ -467,20 +448,10 @@ class SMatSMatSchurExpr
       std::vector<size_t> nonzeros( n, 0UL );
       for( size_t i=0UL; i<m; ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               ++nonzeros[l->index()];
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       ++nonzeros[l->index()];
+                    } );
       }
 
       // Resizing the left-hand side sparse matrix
@@ -491,20 +462,10 @@ class SMatSMatSchurExpr
       // Performing the Schur product
       for( size_t i=0UL; i<m; ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs).append( i, l->index(), l->value() * r->value() );
+                    } );
       }
    }
    /*! \endcond */
@@ -576,20 +537,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) += l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(i,l->index()) += l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -666,20 +617,10 @@ class SMatSMatSchurExpr
 
       for( size_t i=0UL; i<(~lhs).rows(); ++i )
       {
-         const LeftIterator  lend( A.end(i) );
-         const RightIterator rend( B.end(i) );
-
-         LeftIterator  l( A.begin(i) );
-         RightIterator r( B.begin(i) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) -= l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(i), A.end(i), B.begin(i), B.end(i),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(i,l->index()) -= l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsOpposedView.h>
 #include <blaze/util/FunctionTrace.h>
@@ -160,50 +161,19 @@ inline decltype(auto)
    }
    else
    {
-      const LeftIterator  lend( left.end()  );
-      const RightIterator rend( right.end() );
-      LeftIterator  l( left.begin()  );
-      RightIterator r( right.begin() );
-
-      if( l == lend || r == rend ) return sp;
-
-      while( true ) {
-         if( l->index() < r->index() ) {
-            ++l;
-            if( l == lend ) break;
-         }
-         else if( r->index() < l->index() ) {
-            ++r;
-            if( r == rend ) break;
-         }
-         else {
-            sp = l->value() * r->value();
-            ++l;
-            ++r;
-            break;
-         }
-      }
-
-      if( l != lend && r != rend )
-      {
-         while( true ) {
-            if( l->index() < r->index() ) {
-               ++l;
-               if( l == lend ) break;
-            }
-            else if( r->index() < l->index() ) {
-               ++r;
-               if( r == rend ) break;
-            }
-            else {
-               sp += l->value() * r->value();
-               ++l;
-               if( l == lend ) break;
-               ++r;
-               if( r == rend ) break;
-            }
-         }
-      }
+      bool first( true );
+
+      intersect( left.begin(), left.end(), right.begin(), right.end(),
+                 [&sp,&first]( LeftIterator l, RightIterator r )
+                 {
+                    if( first ) {
+                       sp = l->value() * r->value();
+                       first = false;
+                    }
+                    else {
+                       sp += l->value() * r->value();
+                    }
+                 } );
    }
 
    return sp;
@@ -51,6 +51,7 @@
 #include <blaze/math/expressions/VecVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -273,20 +274,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const LeftIterator  lend( x.end() );
-      const RightIterator rend( y.end() );
-
-      LeftIterator  l( x.begin()  );
-      RightIterator r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] = l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( LeftIterator l, RightIterator r ) {
+                    (~lhs)[l->index()] = l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -324,20 +315,10 @@ class SVecSVecMultExpr
       (~lhs).reserve( min( x.nonZeros(), y.nonZeros() ) );
 
       // Performing the vector multiplication
-      const LeftIterator  lend( x.end() );
-      const RightIterator rend( y.end() );
-
-      LeftIterator  l( x.begin()  );
-      RightIterator r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs).append( l->index(), l->value() * r->value() );
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( LeftIterator l, RightIterator r ) {
+                    (~lhs).append( l->index(), l->value() * r->value() );
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -371,20 +352,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const LeftIterator  lend( x.end() );
-      const RightIterator rend( y.end() );
-
-      LeftIterator  l( x.begin() );
-      RightIterator r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] += l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( LeftIterator l, RightIterator r ) {
+                    (~lhs)[l->index()] += l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -422,20 +393,10 @@ class SVecSVecMultExpr
       BLAZE_INTERNAL_ASSERT( y.size() == rhs.rhs_.size(), "Invalid vector size" );
       BLAZE_INTERNAL_ASSERT( x.size() == (~lhs).size()  , "Invalid vector size" );
 
-      const LeftIterator  lend( x.end() );
-      const RightIterator rend( y.end() );
-
-      LeftIterator  l( x.begin()  );
-      RightIterator r( y.begin() );
-
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] -= l->value() * r->value();
-            ++r;
-         }
-      }
+      intersect( x.begin(), x.end(), y.begin(), y.end(),
+                 [&]( LeftIterator l, RightIterator r ) {
+                    (~lhs)[l->index()] -= l->value() * r->value();
+                 } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -266,6 +266,51 @@ inline void resetUpper( SparseMatrix<MT,SO>& dm )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given sparse matrix has no pending buffered insertions.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \return \a true in case there are no pending buffered insertions, \a false if not.
+//
+// This function is the fallback for all sparse matrices that don't buffer insertions. It is
+// used by the SMP assignment kernels to check their operands before the parallel execution
+// starts. It always returns \a true.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline bool isFlushed( const SparseMatrix<MT,SO>& sm ) noexcept
+{
+   UNUSED_PARAMETER( sm );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merging all buffered insertions into the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \return void
+//
+// This function is the fallback for all sparse matrices that don't buffer insertions. It is
+// used by the SMP assignment kernels to prepare their operands before the parallel execution
+// starts. It has no effect.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline void flush( const SparseMatrix<MT,SO>& sm ) noexcept
+{
+   UNUSED_PARAMETER( sm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -61,6 +61,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -218,10 +219,10 @@ class TDVecDMatMultExpr
    using RightOperand = If_< IsExpression<MT>, const MT, const MT& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -2568,10 +2569,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    using RightOperand = ST;
 
    //! Type for the assignment of the dense vector operand of the left-hand side expression.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Type for the assignment of the dense matrix operand of the left-hand side expression.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -53,11 +54,18 @@
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/TVecMatMultExpr.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
+#include <blaze/math/typetraits/HasDualIndex.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -72,12 +80,17 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -133,6 +146,22 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPScatter struct is a helper struct for the selection of the parallel evaluation
+       strategy with private accumulators. In case neither the vector nor the matrix operand
+       requires an intermediate evaluation and both the target vector and the result of the
+       multiplication are numeric, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseSMPScatter {
+      enum : bool { value = !evaluateVector && !evaluateMatrix && T1::smpAssignable &&
+                            IsNumeric< ElementType_<T1> >::value &&
+                            IsNumeric< ElementType_< MultTrait_<VRT,MRT> > >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = TDVecSMatMultExpr<VT,MT>;    //!< Type of this TDVecSMatMultExpr instance.
@@ -149,10 +178,10 @@ class TDVecSMatMultExpr
    using RightOperand = If_< IsExpression<MT>, const MT, const MT& >;
 
    //! Composite type of the left-hand side dense vector expression.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Composite type of the right-hand side sparse matrix expression.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -614,6 +643,121 @@ class TDVecSMatMultExpr
    // No special implementation for the division assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP scatter kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel kernel for the transpose dense vector-sparse matrix multiplication with
+   //        private accumulators.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \param threads The number of blocks of rows to be processed in parallel.
+   // \param op The assignment operation for the final result.
+   // \return void
+   //
+   // Since several rows of the sparse matrix contribute to the same elements of the target
+   // vector, the rows are split into \a threads contiguous blocks. Every block accumulates
+   // its contributions in a private dense buffer, which avoids any synchronization between the
+   // threads. In a second parallel pass the buffers are summed up element by element (always
+   // in the same order to get reproducible results) and the sum is combined with the target
+   // vector via the given assignment operation. Since the threads only read the sparse matrix
+   // via constant iterators, its buffered insertions are flushed once before the threads start
+   // (see CompressedMatrix::flush()).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static void smpScatterKernel( VT1& y, const VT2& x, const MT1& A, size_t threads, OP op )
+   {
+      using ConstIterator = ConstIterator_< RemoveReference_<MT1> >;
+
+      const size_t M( A.columns() );
+      const size_t N( A.rows() );
+
+      BLAZE_INTERNAL_ASSERT( threads > 0UL && threads <= N, "Invalid number of threads" );
+
+      flush( A );
+
+      const size_t blockSize( ( N - 1UL ) / threads + 1UL );
+      const size_t blocks   ( ( N - 1UL ) / blockSize + 1UL );
+
+      std::vector<ElementType> buffers( blocks*M, ElementType() );
+
+      smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+      {
+         for( size_t b=first; b<last; ++b )
+         {
+            ElementType* const tmp( buffers.data() + b*M );
+            const size_t iend( min( ( b+1UL )*blockSize, N ) );
+
+            for( size_t i=b*blockSize; i<iend; ++i )
+            {
+               const ConstIterator end( A.end(i) );
+
+               for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+                  tmp[element->index()] += x[i] * element->value();
+               }
+            }
+         }
+      } );
+
+      smpFor( 0UL, M, [&]( size_t first, size_t last )
+      {
+         for( size_t k=first; k<last; ++k )
+         {
+            ElementType sum( buffers[k] );
+
+            for( size_t b=1UL; b<blocks; ++b ) {
+               sum += buffers[b*M+k];
+            }
+
+            op( y[k], sum );
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (private accumulators)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose dense vector-sparse matrix multiplication to a dense
+   //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose dense
+   // vector-sparse matrix multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.rows() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      TDVecSMatMultExpr::smpScatterKernel( ~lhs, rhs.vec_, rhs.mat_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y = value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense vectors*************************************************************
    /*!\brief SMP assignment of a transpose dense vector-sparse matrix multiplication to a dense
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -721,6 +865,44 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (private accumulators)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a transpose dense vector-sparse matrix multiplication to a
+   //        dense vector (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a transpose
+   // dense vector-sparse matrix multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpAddAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.rows() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         addAssign( ~lhs, rhs );
+         return;
+      }
+
+      TDVecSMatMultExpr::smpScatterKernel( ~lhs, rhs.vec_, rhs.mat_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y += value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -763,6 +945,44 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (private accumulators)**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a transpose dense vector-sparse matrix multiplication
+   //        to a dense vector (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a transpose
+   // dense vector-sparse matrix multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpSubAssign( DenseVector<VT2,true>& lhs, const TDVecSMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.rows() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         subAssign( ~lhs, rhs );
+         return;
+      }
+
+      TDVecSMatMultExpr::smpScatterKernel( ~lhs, rhs.vec_, rhs.mat_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y -= value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -875,7 +1095,7 @@ class TDVecSMatMultExpr
 */
 template< typename VT  // Type of the left-hand side dense vector
         , typename MT  // Type of the right-hand side sparse matrix
-        , typename = DisableIf_< IsSymmetric<MT> > >
+        , typename = DisableIf_< Or< IsSymmetric<MT>, HasDualIndex<MT> > > >
 inline const TDVecSMatMultExpr<VT,MT>
    tdvecsmatmult( const DenseVector<VT,true>& vec, const SparseMatrix<MT,false>& mat )
 {
@@ -919,6 +1139,39 @@ inline decltype(auto)
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a transpose dense vector and a
+//        row-major sparse matrix with dual index (\f$ \vec{a}=B*\vec{c} \f$).
+// \ingroup dense_vector
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side row-major sparse matrix for the multiplication.
+// \return The resulting transpose vector.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// transpose dense vector and a row-major sparse matrix with a row-wise and a column-wise index
+// (see the HasDualIndex type trait). Since the transpose of the matrix is again a row-major
+// matrix, it restructures the expression \f$ \vec{y}^T=\vec{x}^T*A \f$ to the expression
+// \f$ \vec{y}^T=(A^T*\vec{x})^T \f$, which computes every element of the result by a single
+// dot product instead of scattering the rows of the matrix.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , typename MT  // Type of the right-hand side sparse matrix
+        , EnableIf_< And< HasDualIndex<MT>, Not< IsSymmetric<MT> > > >* = nullptr >
+inline decltype(auto)
+   tdvecsmatmult( const DenseVector<VT,true>& vec, const SparseMatrix<MT,false>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~vec).size() == (~mat).rows(), "Invalid vector and matrix sizes" );
+
+   return trans( trans( ~mat ) * trans( ~vec ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
 //        row-major sparse matrix (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -60,6 +60,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
@@ -215,10 +216,10 @@ class TDVecTDMatMultExpr
    using RightOperand = If_< IsExpression<MT>, const MT, const MT& >;
 
    //! Type for the assignment of the left-hand side dense matrix operand.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -2822,10 +2823,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
    using RightOperand = ST;
 
    //! Type for the assignment of the dense vector operand of the left-hand side expression.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Type for the assignment of the dense matrix operand of the left-hand side expression.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -56,6 +56,7 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -163,10 +164,10 @@ class TDVecTSMatMultExpr
    using RightOperand = If_< IsExpression<MT>, const MT, const MT& >;
 
    //! Composite type of the left-hand side dense vector expression.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Composite type of the right-hand side sparse matrix expression.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/ColumnVector.h>
@@ -55,10 +56,17 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
+#include <blaze/math/typetraits/HasDualIndex.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -73,12 +81,17 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -134,6 +147,22 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPScatter struct is a helper struct for the selection of the parallel evaluation
+       strategy with private accumulators. In case neither the vector nor the matrix operand
+       requires an intermediate evaluation and both the target vector and the result of the
+       multiplication are numeric, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseSMPScatter {
+      enum : bool { value = !evaluateVector && !evaluateMatrix && T1::smpAssignable &&
+                            IsNumeric< ElementType_<T1> >::value &&
+                            IsNumeric< ElementType_< MultTrait_<MRT,VRT> > >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = TSMatDVecMultExpr<MT,VT>;    //!< Type of this TSMatDVecMultExpr instance.
@@ -150,10 +179,10 @@ class TSMatDVecMultExpr
    using RightOperand = If_< IsExpression<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side sparse matrix operand.
-   using LT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using LT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using RT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -626,6 +655,121 @@ class TSMatDVecMultExpr
    // No special implementation for the division assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**SMP scatter kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel kernel for the transpose sparse matrix-dense vector multiplication with
+   //        private accumulators.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param threads The number of blocks of columns to be processed in parallel.
+   // \param op The assignment operation for the final result.
+   // \return void
+   //
+   // Since several columns of the sparse matrix contribute to the same elements of the target
+   // vector, the columns are split into \a threads contiguous blocks. Every block accumulates
+   // its contributions in a private dense buffer, which avoids any synchronization between the
+   // threads. In a second parallel pass the buffers are summed up element by element (always
+   // in the same order to get reproducible results) and the sum is combined with the target
+   // vector via the given assignment operation. Since the threads only read the sparse matrix
+   // via constant iterators, its buffered insertions are flushed once before the threads start
+   // (see CompressedMatrix::flush()).
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static void smpScatterKernel( VT1& y, const MT1& A, const VT2& x, size_t threads, OP op )
+   {
+      using ConstIterator = ConstIterator_< RemoveReference_<MT1> >;
+
+      const size_t M( A.rows() );
+      const size_t N( A.columns() );
+
+      BLAZE_INTERNAL_ASSERT( threads > 0UL && threads <= N, "Invalid number of threads" );
+
+      flush( A );
+
+      const size_t blockSize( ( N - 1UL ) / threads + 1UL );
+      const size_t blocks   ( ( N - 1UL ) / blockSize + 1UL );
+
+      std::vector<ElementType> buffers( blocks*M, ElementType() );
+
+      smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+      {
+         for( size_t b=first; b<last; ++b )
+         {
+            ElementType* const tmp( buffers.data() + b*M );
+            const size_t jend( min( ( b+1UL )*blockSize, N ) );
+
+            for( size_t j=b*blockSize; j<jend; ++j )
+            {
+               const ConstIterator end( A.end(j) );
+
+               for( ConstIterator element=A.begin(j); element!=end; ++element ) {
+                  tmp[element->index()] += element->value() * x[j];
+               }
+            }
+         }
+      } );
+
+      smpFor( 0UL, M, [&]( size_t first, size_t last )
+      {
+         for( size_t k=first; k<last; ++k )
+         {
+            ElementType sum( buffers[k] );
+
+            for( size_t b=1UL; b<blocks; ++b ) {
+               sum += buffers[b*M+k];
+            }
+
+            op( y[k], sum );
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors (private accumulators)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose sparse
+   // matrix-dense vector multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.columns() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      TSMatDVecMultExpr::smpScatterKernel( ~lhs, rhs.mat_, rhs.vec_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y = value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense vectors*************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose sparse matrix-dense vector multiplication to a dense
@@ -737,6 +881,44 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors (private accumulators)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a transpose sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a transpose
+   // sparse matrix-dense vector multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpAddAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.columns() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         addAssign( ~lhs, rhs );
+         return;
+      }
+
+      TSMatDVecMultExpr::smpScatterKernel( ~lhs, rhs.mat_, rhs.vec_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y += value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -779,6 +961,44 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors (private accumulators)**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a transpose sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a transpose
+   // sparse matrix-dense vector multiplication expression to a dense vector by means of private
+   // accumulators (see smpScatterKernel()). Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case no operand requires an
+   // intermediate evaluation.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPScatter<VT2> >
+      smpSubAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t threads( min( getNumThreads(), rhs.mat_.columns() ) );
+
+      if( threads < 2UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         subAssign( ~lhs, rhs );
+         return;
+      }
+
+      TSMatDVecMultExpr::smpScatterKernel( ~lhs, rhs.mat_, rhs.vec_, threads,
+         []( Reference_<VT2> y, const ElementType& value ) { y -= value; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -895,7 +1115,7 @@ class TSMatDVecMultExpr
 */
 template< typename MT  // Type of the left-hand side sparse matrix
         , typename VT  // Type of the right-hand side dense vector
-        , typename = DisableIf_< IsSymmetric<MT> > >
+        , typename = DisableIf_< Or< IsSymmetric<MT>, HasDualIndex<MT> > > >
 inline const TSMatDVecMultExpr<MT,VT>
    tsmatdvecmult( const SparseMatrix<MT,true>& mat, const DenseVector<VT,false>& vec )
 {
@@ -939,6 +1159,39 @@ inline decltype(auto)
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a column-major sparse matrix with
+//        dual index and a dense vector (\f$ \vec{a}=B*\vec{c} \f$).
+// \ingroup sparse_vector
+//
+// \param mat The left-hand side column-major sparse matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// column-major sparse matrix with a row-wise and a column-wise index (see the HasDualIndex
+// type trait) and a dense vector. Since the transpose of the matrix is again a column-major
+// matrix, it restructures the expression \f$ \vec{y}=A*\vec{x} \f$ to the expression
+// \f$ \vec{y}=(\vec{x}^T*A^T)^T \f$, which computes every element of the result by a single
+// dot product instead of scattering the columns of the matrix.
+*/
+template< typename MT  // Type of the left-hand side sparse matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , EnableIf_< And< HasDualIndex<MT>, Not< IsSymmetric<MT> > > >* = nullptr >
+inline decltype(auto)
+   tsmatdvecmult( const SparseMatrix<MT,true>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~mat).columns() == (~vec).size(), "Invalid matrix and vector sizes" );
+
+   return trans( trans( ~vec ) * trans( ~mat ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a column-major sparse matrix and a
 //        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -52,10 +51,10 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -83,7 +82,6 @@
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
-#include <blaze/util/SmallVector.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/RemoveReference.h>
@@ -528,13 +526,11 @@ class TSMatTSMatMultExpr
       }
 
       (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
 
       // Performing the matrix-matrix multiplication
-      SmallVector<ElementType,128UL> values ( (~lhs).rows(), ElementType() );
-      SmallVector<bool,128UL>        valid  ( (~lhs).rows(), false );
-      SmallVector<size_t,128UL>      indices( (~lhs).rows(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
+      SparseAccumulator<ElementType>& spa( getSparseAccumulator<ElementType>() );
+      spa.configure( (~lhs).rows(), ( (~lhs).columns() > 0UL )?( nonzeros / (~lhs).columns() )
+                                                              :( 0UL ) );
 
       for( size_t j=0UL; j<(~lhs).columns(); ++j )
       {
@@ -542,59 +538,17 @@ class TSMatTSMatMultExpr
          for( RightIterator relem=B.begin(j); relem!=rend; ++relem )
          {
             const LeftIterator lend( A.end( relem->index() ) );
-            for( LeftIterator lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
-            {
-               if( !valid[lelem->index()] ) {
-                  values[lelem->index()] = lelem->value() * relem->value();
-                  valid [lelem->index()] = 1;
-                  indices[nonzeros] = lelem->index();
-                  ++nonzeros;
-                  if( lelem->index() < minIndex ) minIndex = lelem->index();
-                  if( lelem->index() > maxIndex ) maxIndex = lelem->index();
-               }
-               else {
-                  values[lelem->index()] += lelem->value() * relem->value();
-               }
+            for( LeftIterator lelem=A.begin( relem->index() ); lelem!=lend; ++lelem ) {
+               spa.add( lelem->index(), lelem->value() * relem->value() );
             }
          }
 
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).rows(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+         BLAZE_INTERNAL_ASSERT( spa.nonZeros() <= (~lhs).rows(), "Invalid number of non-zero elements" );
 
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t i=0UL; i<nonzeros; ++i )
-               {
-                  const size_t index( indices[i] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( index, j, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t i=minIndex; i<=maxIndex; ++i )
-               {
-                  if( !isDefault( values[i] ) ) {
-                     (~lhs).append( i, j, values[i] );
-                     reset( values[i] );
-                  }
-
-                  reset( valid [i] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
+         spa.extract( [&]( size_t i, const ElementType& value ) {
+            if( !isDefault( value ) )
+               (~lhs).append( i, j, value );
+         } );
 
          (~lhs).finalize( j );
       }
@@ -52,6 +52,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -344,20 +345,10 @@ class TSMatTSMatSchurExpr
 
       for( size_t j=0UL; j<(~lhs).columns(); ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(l->index(),j) = l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(l->index(),j) = l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -407,20 +398,10 @@ class TSMatTSMatSchurExpr
       std::vector<size_t> nonzeros( m, 0UL );
       for( size_t j=0UL; j<n; ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               ++nonzeros[l->index()];
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       ++nonzeros[l->index()];
+                    } );
       }
 
       // Resizing the left-hand side sparse matrix
@@ -431,20 +412,10 @@ class TSMatTSMatSchurExpr
       // Performing the Schur product
       for( size_t j=0UL; j<n; ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( l->index(), j, l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs).append( l->index(), j, l->value() * r->value() );
+                    } );
       }
    }
    /*! \endcond */
@@ -490,20 +461,10 @@ class TSMatTSMatSchurExpr
       // Performing the Schur product
       for( size_t j=0UL; j<(~lhs).columns(); ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( l->index(), j, l->value() * r->value() );
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs).append( l->index(), j, l->value() * r->value() );
+                    } );
 
          (~lhs).finalize( j );
       }
@@ -578,20 +539,10 @@ class TSMatTSMatSchurExpr
 
       for( size_t j=0UL; j<(~lhs).columns(); ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(l->index(),j) += l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(l->index(),j) += l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -668,20 +619,10 @@ class TSMatTSMatSchurExpr
 
       for( size_t j=0UL; j<(~lhs).columns(); ++j )
       {
-         const LeftIterator  lend( A.end(j) );
-         const RightIterator rend( B.end(j) );
-
-         LeftIterator  l( A.begin(j) );
-         RightIterator r( B.begin(j) );
-
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(l->index(),j) -= l->value() * r->value();
-               ++r;
-            }
-         }
+         intersect( A.begin(j), A.end(j), B.begin(j), B.end(j),
+                    [&]( LeftIterator l, RightIterator r ) {
+                       (~lhs)(l->index(),j) -= l->value() * r->value();
+                    } );
       }
    }
    /*! \endcond */
@@ -59,6 +59,7 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ScratchTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
@@ -208,10 +209,10 @@ class TSVecDMatMultExpr
    using RightOperand = If_< IsExpression<MT>, const MT, const MT& >;
 
    //! Type for the assignment of the left-hand side sparse vector operand.
-   using LT = IfTrue_< evaluateVector, const VRT, VCT >;
+   using LT = IfTrue_< evaluateVector, const ScratchTrait_<VRT>, VCT >;
 
    //! Type for the assignment of the right-hand side dense matrix operand.
-   using RT = IfTrue_< evaluateMatrix, const MRT, MCT >;
+   using RT = IfTrue_< evaluateMatrix, const ScratchTrait_<MRT>, MCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
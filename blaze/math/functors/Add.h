@@ -0,0 +1,113 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Add.h
+//  \brief Header file for the Add functor
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_ADD_H_
+#define _BLAZE_MATH_FUNCTORS_ADD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/SIMDPack.h>
+#include <blaze/math/simd/Addition.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/system/Inline.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the addition operator.
+// \ingroup functors
+*/
+struct Add
+{
+   //**********************************************************************************************
+   /*!\brief Default constructor of the Add functor.
+   */
+   explicit inline Add()
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the addition for the given objects/values.
+   //
+   // \param a The left-hand side object/value.
+   // \param b The right-hand side object/value.
+   // \return The result of the addition for the given objects/values.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) operator()( const T1& a, const T2& b ) const
+   {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return HasSIMDAdd<T1,T2>::value; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the addition for the given SIMD vectors.
+   //
+   // \param a The left-hand side SIMD vector.
+   // \param b The right-hand side SIMD vector.
+   // \return The result of the addition for the given SIMD vectors.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) load( const T1& a, const T2& b ) const
+   {
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T1 );
+      BLAZE_CONSTRAINT_MUST_BE_SIMD_PACK( T2 );
+      return a + b;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
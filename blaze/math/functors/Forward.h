@@ -47,6 +47,7 @@ namespace blaze {
 struct Abs;
 struct Acos;
 struct Acosh;
+struct Add;
 struct AddAssign;
 struct Asin;
 struct Asinh;
@@ -83,8 +84,11 @@ struct InvSqrt;
 struct Log;
 struct Log2;
 struct Log10;
+struct LogicalAnd;
+struct LogicalOr;
 struct Max;
 struct Min;
+struct Mult;
 struct MultAssign;
 struct Noop;
 struct Pow;
@@ -0,0 +1,238 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/CountNonZeros.h
+//  \brief Header file for the SIMD nonzero counting functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_COUNTNONZEROS_H_
+#define _BLAZE_MATH_SIMD_COUNTNONZEROS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of set bits in the given SIMD comparison mask.
+// \ingroup simd
+//
+// \param mask The given comparison mask.
+// \return The number of set bits.
+//
+// This auxiliary function is written in terms of portable bit operations, which all supported
+// compilers translate into a single \c popcnt instruction in case it is available.
+*/
+BLAZE_ALWAYS_INLINE size_t countMaskBits( unsigned int mask ) noexcept
+{
+   mask = mask - ( ( mask >> 1 ) & 0x55555555U );
+   mask = ( mask & 0x33333333U ) + ( ( mask >> 2 ) & 0x33333333U );
+   mask = ( mask + ( mask >> 4 ) ) & 0x0F0F0F0FU;
+   return ( mask * 0x01010101U ) >> 24;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the 32-bit integral SIMD vector.
+// \ingroup simd
+//
+// \param a The SIMD vector to be examined.
+// \return The number of non-zero vector elements.
+//
+// This operation is only available for SSE2, AVX2, and AVX-512.
+*/
+template< typename T >  // Type of the SIMD element
+BLAZE_ALWAYS_INLINE size_t countNonZeros( const SIMDi32<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return countMaskBits( _mm512_test_epi32_mask( (~a).value, (~a).value ) );
+}
+#elif BLAZE_AVX2_MODE
+{
+   const __m256i zeros( _mm256_cmpeq_epi32( (~a).value, _mm256_setzero_si256() ) );
+   return 8UL - countMaskBits( _mm256_movemask_ps( _mm256_castsi256_ps( zeros ) ) );
+}
+#elif BLAZE_SSE2_MODE
+{
+   const __m128i zeros( _mm_cmpeq_epi32( (~a).value, _mm_setzero_si128() ) );
+   return 4UL - countMaskBits( _mm_movemask_ps( _mm_castsi128_ps( zeros ) ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the 64-bit integral SIMD vector.
+// \ingroup simd
+//
+// \param a The SIMD vector to be examined.
+// \return The number of non-zero vector elements.
+//
+// This operation is only available for SSE4, AVX2, and AVX-512.
+*/
+template< typename T >  // Type of the SIMD element
+BLAZE_ALWAYS_INLINE size_t countNonZeros( const SIMDi64<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return countMaskBits( _mm512_test_epi64_mask( (~a).value, (~a).value ) );
+}
+#elif BLAZE_AVX2_MODE
+{
+   const __m256i zeros( _mm256_cmpeq_epi64( (~a).value, _mm256_setzero_si256() ) );
+   return 4UL - countMaskBits( _mm256_movemask_pd( _mm256_castsi256_pd( zeros ) ) );
+}
+#elif BLAZE_SSE4_MODE
+{
+   const __m128i zeros( _mm_cmpeq_epi64( (~a).value, _mm_setzero_si128() ) );
+   return 2UL - countMaskBits( _mm_movemask_pd( _mm_castsi128_pd( zeros ) ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the single precision floating point SIMD vector.
+// \ingroup simd
+//
+// \param a The SIMD vector to be examined.
+// \return The number of non-zero vector elements.
+//
+// In accordance with the strict semantics of the isDefault() function, negative zeros are
+// counted as zeros and NaN values are counted as non-zero elements. This operation is only
+// available for SSE, AVX, and AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE size_t countNonZeros( const SIMDf32<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return countMaskBits( _mm512_cmp_ps_mask( (~a).eval().value, _mm512_setzero_ps(), _CMP_NEQ_UQ ) );
+}
+#elif BLAZE_AVX_MODE
+{
+   const __m256 mask( _mm256_cmp_ps( (~a).eval().value, _mm256_setzero_ps(), _CMP_NEQ_UQ ) );
+   return countMaskBits( _mm256_movemask_ps( mask ) );
+}
+#elif BLAZE_SSE_MODE
+{
+   return countMaskBits( _mm_movemask_ps( _mm_cmpneq_ps( (~a).eval().value, _mm_setzero_ps() ) ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the double precision floating point SIMD vector.
+// \ingroup simd
+//
+// \param a The SIMD vector to be examined.
+// \return The number of non-zero vector elements.
+//
+// In accordance with the strict semantics of the isDefault() function, negative zeros are
+// counted as zeros and NaN values are counted as non-zero elements. This operation is only
+// available for SSE2, AVX, and AVX-512.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE size_t countNonZeros( const SIMDf64<T>& a ) noexcept
+#if BLAZE_AVX512F_MODE
+{
+   return countMaskBits( _mm512_cmp_pd_mask( (~a).eval().value, _mm512_setzero_pd(), _CMP_NEQ_UQ ) );
+}
+#elif BLAZE_AVX_MODE
+{
+   const __m256d mask( _mm256_cmp_pd( (~a).eval().value, _mm256_setzero_pd(), _CMP_NEQ_UQ ) );
+   return countMaskBits( _mm256_movemask_pd( mask ) );
+}
+#elif BLAZE_SSE2_MODE
+{
+   return countMaskBits( _mm_movemask_pd( _mm_cmpneq_pd( (~a).eval().value, _mm_setzero_pd() ) ) );
+}
+#else
+= delete;
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
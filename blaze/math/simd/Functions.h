@@ -52,6 +52,7 @@
 #include <blaze/math/simd/Cbrt.h>
 #include <blaze/math/simd/Ceil.h>
 #include <blaze/math/simd/Conj.h>
+#include <blaze/math/simd/CountNonZeros.h>
 #include <blaze/math/simd/Cos.h>
 #include <blaze/math/simd/Cosh.h>
 #include <blaze/math/simd/Division.h>
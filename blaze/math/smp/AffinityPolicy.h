@@ -0,0 +1,74 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AffinityPolicy.h
+//  \brief Header file for the thread affinity policies
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_AFFINITYPOLICY_H_
+#define _BLAZE_MATH_SMP_AFFINITYPOLICY_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AFFINITY POLICY VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread affinity policy.
+// \ingroup smp
+//
+// The AffinityPolicy type enumeration represents the different placements of the threads of the
+// C++11 and Boost thread-based parallelization on the available CPUs (see setThreadAffinity()).
+// The following policies are available:
+//
+//  - \c noAffinity: The threads are not bound to any CPU and may be migrated by the operating
+//          system (default).
+//  - \c compactAffinity: The threads are pinned to the available CPUs as close to each other as
+//          possible: all hardware threads of a core are used before the next core is used, and
+//          all cores of a package (socket) are used before the next package is used.
+//  - \c scatterAffinity: The threads are pinned to the available CPUs as evenly as possible:
+//          consecutive threads are distributed round robin over the packages and cores, and the
+//          additional hardware threads of the cores are only used after all cores are occupied.
+*/
+enum AffinityPolicy
+{
+   noAffinity      = 0,  //!< Flag for threads without affinity.
+   compactAffinity = 1,  //!< Flag for a compact placement of the threads.
+   scatterAffinity = 2   //!< Flag for a scattered placement of the threads.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
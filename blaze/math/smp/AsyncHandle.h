@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/AsyncHandle.h
+//  \brief Header file for the AsyncHandle class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_ASYNCHANDLE_H_
+#define _BLAZE_MATH_SMP_ASYNCHANDLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Waitable handle for an asynchronous parallel operation.
+// \ingroup smp
+//
+// The AsyncHandle class represents the result of an asynchronous parallel operation (see
+// asyncAssign()). It can be used to query whether the operation has been completed and to
+// wait for its completion:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x( 10000UL ), y;
+   // ... Initialization of A and x
+
+   blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );
+
+   // ... Work that doesn't depend on y and doesn't modify A, x, or y
+
+   handle.wait();  // Waiting for the completion of the assignment
+   \endcode
+
+// In case any task of the operation throws an exception, the first of these exceptions is
+// rethrown by the wait() function. Note that the destructor of an AsyncHandle also waits for
+// the completion of the operation (though without rethrowing any exception). A default
+// constructed AsyncHandle represents an already completed operation.
+*/
+class AsyncHandle
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Shared state of all tasks of an asynchronous operation.
+   struct State {
+      State() : pending_( 0UL ), error_() {}
+
+      std::atomic<size_t>     pending_;  //!< The number of pending tasks.
+      std::mutex              mutex_;    //!< Synchronization mutex.
+      std::condition_variable cond_;     //!< Condition variable for the completion of all tasks.
+      std::exception_ptr      error_;    //!< The first exception thrown by any task.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline AsyncHandle();
+   inline AsyncHandle( AsyncHandle&& handle ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~AsyncHandle();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline AsyncHandle& operator=( AsyncHandle&& handle );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait();
+
+   template< typename OP > inline auto task( OP op );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void block() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<State> state_;  //!< The shared state of the asynchronous operation.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for an AsyncHandle.
+//
+// The default constructor creates a handle for an already completed operation.
+*/
+inline AsyncHandle::AsyncHandle()
+   : state_( std::make_shared<State>() )  // The shared state of the asynchronous operation
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for AsyncHandle.
+//
+// \param handle The handle to be moved into this instance.
+*/
+inline AsyncHandle::AsyncHandle( AsyncHandle&& handle ) noexcept
+   : state_( std::move( handle.state_ ) )  // The shared state of the asynchronous operation
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for AsyncHandle.
+//
+// The destructor waits for the completion of the operation. Any exception thrown by a task of
+// the operation is discarded.
+*/
+inline AsyncHandle::~AsyncHandle()
+{
+   block();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for AsyncHandle.
+//
+// \param handle The handle to be moved into this instance.
+// \return Reference to the assigned handle.
+//
+// Before taking over the given handle, this function waits for the completion of the operation
+// currently represented by the handle. Any exception thrown by this operation is discarded.
+*/
+inline AsyncHandle& AsyncHandle::operator=( AsyncHandle&& handle )
+{
+   if( &handle != this ) {
+      block();
+      state_ = std::move( handle.state_ );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the operation has been completed.
+//
+// \return \a true in case the operation has been completed, \a false if not.
+*/
+inline bool AsyncHandle::isReady() const
+{
+   return !state_ || state_->pending_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the operation.
+//
+// \return void
+//
+// This function blocks until all tasks of the operation have been completed. In case any task
+// has thrown an exception, the first of these exceptions is rethrown.
+*/
+inline void AsyncHandle::wait()
+{
+   block();
+
+   if( state_ && state_->error_ ) {
+      std::exception_ptr error( state_->error_ );
+      state_->error_ = nullptr;
+      std::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a task of the asynchronous operation.
+//
+// \param op The operation to be executed by the task.
+// \return The task executing the given operation.
+//
+// This function creates a task, which executes the given operation within a thread-local
+// parallel section (see LocalParallelSection) and afterwards signals its completion to the
+// handle. The handle is not ready until the task has been executed.\n
+// This function must \b NOT be called explicitly! It is used internally by the backends of
+// the asynchronous parallel operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the operation
+inline auto AsyncHandle::task( OP op )
+{
+   ++state_->pending_;
+
+   return [state=state_, op]() mutable
+   {
+      try {
+         LocalParallelSection<int> section;
+         op();
+      }
+      catch( ... ) {
+         std::lock_guard<std::mutex> lock( state->mutex_ );
+         if( !state->error_ )
+            state->error_ = std::current_exception();
+      }
+
+      if( --state->pending_ == 0UL ) {
+         std::lock_guard<std::mutex> lock( state->mutex_ );
+         state->cond_.notify_all();
+      }
+   };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocks until all tasks of the operation have been completed.
+//
+// \return void
+*/
+inline void AsyncHandle::block() const noexcept
+{
+   if( !state_ || state_->pending_ == 0UL )
+      return;
+
+   std::unique_lock<std::mutex> lock( state_->mutex_ );
+   state_->cond_.wait( lock, [this]() { return state_->pending_ == 0UL; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,425 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Calibration.h
+//  \brief Header file for the runtime calibration of the SMP thresholds
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_CALIBRATION_H_
+#define _BLAZE_MATH_SMP_CALIBRATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CALIBRATION UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the minimum runtime of the given operation.
+// \ingroup smp
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation in seconds.
+//
+// The operation is repeated until a single measurement takes at least one millisecond in order
+// to compensate for the resolution of the timer. The minimum of several measurements is used
+// to reduce the influence of other processes.
+*/
+template< typename OP >  // Type of the operation
+double calibrationTime( OP op )
+{
+   size_t reps( 1UL );
+
+   op();
+
+   while( true )
+   {
+      timing::WcTimer timer;
+
+      for( size_t trial=0UL; trial<3UL; ++trial ) {
+         timer.start();
+         for( size_t rep=0UL; rep<reps; ++rep ) {
+            op();
+         }
+         timer.end();
+      }
+
+      if( timer.min() >= 1E-3 || reps >= 65536UL )
+         return timer.min() / reps;
+
+      reps *= 2UL;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determination of the smallest problem size for which the parallel execution pays off.
+// \ingroup smp
+//
+// \param first The smallest problem size to be probed.
+// \param last The largest problem size to be probed.
+// \param probe The probe comparing the serial and the parallel execution for a given size.
+// \return The smallest probed size for which the parallel execution is faster.
+//
+// This function probes the problem sizes \a first, 2*\a first, 4*\a first, ... up to \a last
+// and returns the first size for which the given probe reports a faster parallel execution. All
+// probes require the parallel execution to be at least 10% faster than the serial execution in
+// order to compensate for measurement noise. In
+// case the parallel execution never pays off, the function returns the largest value of type
+// size_t.
+*/
+template< typename Probe >  // Type of the probe
+size_t calibrateBreakEven( size_t first, size_t last, Probe probe )
+{
+   for( size_t n=first; n<=last; n*=2UL ) {
+      if( probe( n ) )
+         return n;
+   }
+
+   return std::numeric_limits<size_t>::max();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of a family of SMP thresholds by means of a calibrated representative.
+// \ingroup smp
+//
+// \param measured The calibrated value of the representative of the family.
+// \param reference The compile time default of the representative of the family.
+// \param thresholds The SMP thresholds of the family.
+// \return void
+//
+// This function sets the given SMP thresholds to their compile time defaults scaled by the
+// ratio between the calibrated and the default value of the representative of the family. In
+// case the parallel execution of the representative never paid off, all SMP thresholds of the
+// family are set to the largest value of type size_t.
+*/
+template< size_t... Is >  // Indices of the SMP thresholds
+void scaleSMPThresholds( size_t measured, size_t reference, SMPThreshold<Is>... thresholds )
+{
+   UNUSED_PARAMETER( thresholds... );
+
+   const double factor( static_cast<double>( measured ) / std::max( reference, size_t(1UL) ) );
+
+   const auto scale = [measured,factor]( size_t value ) -> size_t
+   {
+      if( measured == std::numeric_limits<size_t>::max() )
+         return measured;
+
+      const double scaled( static_cast<double>( std::max( value, size_t(1UL) ) ) * factor );
+
+      if( scaled >= static_cast<double>( std::numeric_limits<size_t>::max() ) )
+         return std::numeric_limits<size_t>::max();
+
+      return static_cast<size_t>( scaled );
+   };
+
+   const size_t values[] = { scale( SMPThresholdTable<int>::defaults[Is] )... };
+   const size_t indices[] = { Is... };
+
+   for( size_t i=0UL; i<sizeof...( Is ); ++i ) {
+      SMPThresholdTable<int>::values[indices[i]] = values[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Calibration functions */
+//@{
+void calibrateSMPThresholds();
+void saveSMPThresholds( const std::string& filename );
+bool loadSMPThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of all SMP thresholds for the current system.
+// \ingroup smp
+//
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function determines the SMP thresholds for the current system and the current number
+// of threads. For that purpose the serial and the parallel execution of four representative
+// operations (the dense vector addition, the dense matrix addition, the dense matrix/dense
+// vector multiplication, and the dense matrix/dense matrix multiplication) are compared for
+// increasing problem sizes. The smallest problem size for which the parallel execution pays off
+// becomes the threshold of the representative operation. All other SMP thresholds are derived
+// from their compile time defaults by the ratio between the calibrated and the default value of
+// the representative of their family. The calibration takes approximately one second. Since the
+// calibration instantiates several parallel kernels, the calibration functions are not part of
+// the general <tt><blaze/Math.h></tt> header, but have to be included explicitly:
+
+   \code
+   #include <blaze/math/smp/Calibration.h>
+
+   int main()
+   {
+      // Reusing the calibration of a previous run or calibrating the SMP thresholds
+      if( !blaze::loadSMPThresholds( "blaze_thresholds.txt" ) ) {
+         blaze::calibrateSMPThresholds();
+         blaze::saveSMPThresholds( "blaze_thresholds.txt" );
+      }
+
+      // ...
+   }
+   \endcode
+
+// In case only a single thread is used or in case the function is called inside a serial or
+// parallel section, the function has no effect. Note that the function must not be called while
+// other threads execute any (parallel) operation, since it adapts the unsynchronized runtime
+// values of the SMP thresholds.
+*/
+inline void calibrateSMPThresholds()
+{
+   using Table = SMPThresholdTable<int>;
+
+   if( getNumThreads() < 2UL || isSerialSectionActive() || isParallelSectionActive() )
+      return;
+
+   size_t previous[Table::size];
+   std::copy( Table::values, Table::values + Table::size, previous );
+
+   try
+   {
+      // Forcing the parallel execution of all operations during the calibration
+      std::fill( Table::values, Table::values + Table::size, size_t(0UL) );
+
+      const size_t dvecdvecadd = calibrateBreakEven( 256UL, 1048576UL, []( size_t n )
+      {
+         const DynamicVector<double> a( n, 1.0 ), b( n, 2.0 );
+         DynamicVector<double> c( n );
+         const double ser( calibrationTime( [&]() { c = serial( a + b ); } ) );
+         const double par( calibrationTime( [&]() { c = a + b; } ) );
+         return par < 0.9*ser;
+      } );
+
+      const size_t dmatdmatadd = calibrateBreakEven( 16UL, 1024UL, []( size_t n )
+      {
+         const DynamicMatrix<double> A( n, n, 1.0 ), B( n, n, 2.0 );
+         DynamicMatrix<double> C( n, n );
+         const double ser( calibrationTime( [&]() { C = serial( A + B ); } ) );
+         const double par( calibrationTime( [&]() { C = A + B; } ) );
+         return par < 0.9*ser;
+      } );
+
+      const size_t dmatdvecmult = calibrateBreakEven( 16UL, 2048UL, []( size_t n )
+      {
+         const DynamicMatrix<double> A( n, n, 1.0 );
+         const DynamicVector<double> x( n, 2.0 );
+         DynamicVector<double> y( n );
+         const double ser( calibrationTime( [&]() { y = serial( A * x ); } ) );
+         const double par( calibrationTime( [&]() { y = A * x; } ) );
+         return par < 0.9*ser;
+      } );
+
+      const size_t dmatdmatmult = calibrateBreakEven( 8UL, 256UL, []( size_t n )
+      {
+         const DynamicMatrix<double> A( n, n, 1.0 ), B( n, n, 2.0 );
+         DynamicMatrix<double> C( n, n );
+         const double ser( calibrationTime( [&]() { C = serial( A * B ); } ) );
+         const double par( calibrationTime( [&]() { C = A * B; } ) );
+         return par < 0.9*ser;
+      } );
+
+      const auto square = []( size_t n ) {
+         return ( n == std::numeric_limits<size_t>::max() )?( n ):( n*n );
+      };
+
+      scaleSMPThresholds( dvecdvecadd, SMP_DVECDVECADD_DEFAULT_THRESHOLD,
+                          SMP_DVECASSIGN_THRESHOLD, SMP_DVECSCALARMULT_THRESHOLD,
+                          SMP_DVECDVECADD_THRESHOLD, SMP_DVECDVECSUB_THRESHOLD,
+                          SMP_DVECDVECMULT_THRESHOLD, SMP_DVECDVECDIV_THRESHOLD );
+
+      scaleSMPThresholds( square( dmatdmatadd ), SMP_DMATDMATADD_DEFAULT_THRESHOLD,
+                          SMP_DVECDVECOUTER_THRESHOLD, SMP_DMATASSIGN_THRESHOLD,
+                          SMP_DMATSCALARMULT_THRESHOLD, SMP_DMATDMATADD_THRESHOLD,
+                          SMP_DMATTDMATADD_THRESHOLD, SMP_DMATDMATSUB_THRESHOLD,
+                          SMP_DMATTDMATSUB_THRESHOLD, SMP_DMATDMATSCHUR_THRESHOLD,
+                          SMP_DMATTDMATSCHUR_THRESHOLD, SMP_SMATTRANSPOSE_THRESHOLD,
+                          SMP_DMATSMATCONVERT_THRESHOLD, SMP_SMATREORDER_THRESHOLD );
+
+      scaleSMPThresholds( dmatdvecmult, SMP_DMATDVECMULT_DEFAULT_THRESHOLD,
+                          SMP_DMATDVECMULT_THRESHOLD, SMP_TDMATDVECMULT_THRESHOLD,
+                          SMP_TDVECDMATMULT_THRESHOLD, SMP_TDVECTDMATMULT_THRESHOLD,
+                          SMP_DMATSVECMULT_THRESHOLD, SMP_TDMATSVECMULT_THRESHOLD,
+                          SMP_TSVECDMATMULT_THRESHOLD, SMP_TSVECTDMATMULT_THRESHOLD,
+                          SMP_SMATDVECMULT_THRESHOLD, SMP_TSMATDVECMULT_THRESHOLD,
+                          SMP_TDVECSMATMULT_THRESHOLD, SMP_TDVECTSMATMULT_THRESHOLD,
+                          SMP_SMATSVECMULT_THRESHOLD, SMP_TSMATSVECMULT_THRESHOLD,
+                          SMP_TSVECSMATMULT_THRESHOLD, SMP_TSVECTSMATMULT_THRESHOLD );
+
+      scaleSMPThresholds( square( dmatdmatmult ), SMP_DMATDMATMULT_DEFAULT_THRESHOLD,
+                          SMP_DMATDMATMULT_THRESHOLD, SMP_DMATTDMATMULT_THRESHOLD,
+                          SMP_TDMATDMATMULT_THRESHOLD, SMP_TDMATTDMATMULT_THRESHOLD,
+                          SMP_DMATSMATMULT_THRESHOLD, SMP_DMATTSMATMULT_THRESHOLD,
+                          SMP_TDMATSMATMULT_THRESHOLD, SMP_TDMATTSMATMULT_THRESHOLD,
+                          SMP_SMATDMATMULT_THRESHOLD, SMP_SMATTDMATMULT_THRESHOLD,
+                          SMP_TSMATDMATMULT_THRESHOLD, SMP_TSMATTDMATMULT_THRESHOLD,
+                          SMP_SMATSMATMULT_THRESHOLD, SMP_SMATTSMATMULT_THRESHOLD,
+                          SMP_TSMATSMATMULT_THRESHOLD, SMP_TSMATTSMATMULT_THRESHOLD );
+   }
+   catch( ... )
+   {
+      std::copy( previous, previous + Table::size, Table::values );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the current values of all SMP thresholds to the given file.
+// \ingroup smp
+//
+// \param filename The name of the output file.
+// \return void
+// \exception std::runtime_error Output file could not be written.
+//
+// This function writes the current values of all SMP thresholds to the given file (one threshold
+// per line, consisting of the name and the value of the threshold). The file can be used to
+// restore the thresholds via the loadSMPThresholds() function.
+*/
+inline void saveSMPThresholds( const std::string& filename )
+{
+   using Table = SMPThresholdTable<int>;
+
+   std::ofstream file( filename.c_str() );
+
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      file << Table::names[i] << " " << Table::values[i] << "\n";
+   }
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Output file could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading the values of SMP thresholds from the given file.
+// \ingroup smp
+//
+// \param filename The name of the input file.
+// \return \a true if the file has been read successfully, \a false if it could not be opened.
+// \exception std::runtime_error Invalid SMP threshold file.
+//
+// This function reads the values of SMP thresholds from a file written by the saveSMPThresholds()
+// function. All thresholds not contained in the file keep their current value. In case the file
+// cannot be opened, the function returns \a false and no threshold is changed. In case the file
+// contains an invalid line, a \a std::runtime_error exception is thrown and no threshold is
+// changed. Just as setSMPThreshold(), the function must not be called while other threads
+// execute any (parallel) operation.
+*/
+inline bool loadSMPThresholds( const std::string& filename )
+{
+   using Table = SMPThresholdTable<int>;
+
+   std::ifstream file( filename.c_str() );
+
+   if( !file )
+      return false;
+
+   size_t values[Table::size];
+   std::copy( Table::values, Table::values + Table::size, values );
+
+   std::string line;
+
+   while( std::getline( file, line ) )
+   {
+      std::istringstream iss( line );
+      std::string name;
+      size_t value( 0UL );
+
+      if( !( iss >> name ) )
+         continue;
+
+      const auto pos( std::find( Table::names, Table::names + Table::size, name ) );
+
+      if( pos == Table::names + Table::size || !( iss >> value ) || ( iss >> name ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid SMP threshold file" );
+      }
+
+      values[pos - Table::names] = value;
+   }
+
+   std::copy( values, values + Table::size, Table::values );
+
+   return true;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
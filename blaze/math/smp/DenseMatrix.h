@@ -48,6 +48,8 @@
 #include <blaze/math/smp/threads/DenseMatrix.h>
 #elif BLAZE_HPX_PARALLEL_MODE
 #include <blaze/math/smp/hpx/DenseMatrix.h>
+#elif BLAZE_TBB_PARALLEL_MODE
+#include <blaze/math/smp/tbb/DenseMatrix.h>
 #else
 #include <blaze/math/smp/default/DenseMatrix.h>
 #endif
@@ -48,6 +48,8 @@
 #include <blaze/math/smp/threads/DenseVector.h>
 #elif BLAZE_HPX_PARALLEL_MODE
 #include <blaze/math/smp/hpx/DenseVector.h>
+#elif BLAZE_TBB_PARALLEL_MODE
+#include <blaze/math/smp/tbb/DenseVector.h>
 #else
 #include <blaze/math/smp/default/DenseVector.h>
 #endif
@@ -0,0 +1,186 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FirstTouch.h
+//  \brief Header file for the parallel first-touch initialization of dense vectors and matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector to be initialized.
+// \param op The initialization operation for a range of elements.
+// \return void
+//
+// This function splits the given dense vector into the same blocks of elements as the SMP
+// assignment and calls the given operation for each block in parallel. The operation \a op
+// has to provide a function call operator of the form <tt>void operator()( size_t first,
+// size_t last )</tt>, which initializes the elements in the range \f$ [first..last) \f$.
+// Since the operating system places every memory page on the NUMA node of the thread that
+// touches it first, the memory is spread among the NUMA nodes of all participating threads.
+// Note however that the blocks are distributed dynamically among the threads of the SMP
+// backend. Therefore a block is not guaranteed to be touched by the same thread that later
+// assigns it, and kernels with a weighted partitioning use different blocks altogether.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch( DenseVector<VT,TF>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT> >::size );
+
+   const size_t size( (~lhs).size() );
+
+   if( size == 0UL )
+      return;
+
+   const size_t threads      ( getNumThreads() );
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( VT::simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t blocks       ( ( size - 1UL ) / sizePerThread + 1UL );
+
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b ) {
+         op( b*sizePerThread, min( ( b+1UL )*sizePerThread, size ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix to be initialized.
+// \param op The initialization operation for a block of elements.
+// \return void
+//
+// This function splits the given dense matrix into the same submatrices as the SMP assignment
+// and calls the given operation for each submatrix in parallel. The operation \a op has to
+// provide a function call operator of the form <tt>void operator()( size_t row, size_t column,
+// size_t m, size_t n )</tt>, which initializes the \f$ m \times n \f$ submatrix starting at
+// the given row and column. Since the operating system places every memory page on the NUMA
+// node of the thread that touches it first, the memory is spread among the NUMA nodes of all
+// participating threads. Note however that the submatrices are distributed dynamically among
+// the threads of the SMP backend. Therefore a submatrix is not guaranteed to be touched by the
+// same thread that later assigns it, and kernels with a weighted partitioning use different
+// submatrices altogether.\n
+// This function must \b NOT be called explicitly! It is used internally for the NUMA-aware
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the initialization operation
+void smpFirstTouch( DenseMatrix<MT,SO>& lhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT> >::size );
+
+   const size_t M( (~lhs).rows()    );
+   const size_t N( (~lhs).columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   const ThreadMapping threads( createThreadMapping( getNumThreads(), ~lhs ) );
+
+   const size_t addon1     ( ( ( M % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( M / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( MT::simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( N % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( N / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( MT::simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t rowBlocks( ( M - 1UL ) / rowsPerThread + 1UL );
+   const size_t colBlocks( ( N - 1UL ) / colsPerThread + 1UL );
+
+   smpFor( 0UL, rowBlocks*colBlocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b )
+      {
+         const size_t row   ( ( b / colBlocks )*rowsPerThread );
+         const size_t column( ( b % colBlocks )*colsPerThread );
+
+         op( row, column, min( rowsPerThread, M - row ), min( colsPerThread, N - column ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/AffinityPolicy.h>
 #include <blaze/system/SMP.h>
 
 #if BLAZE_OPENMP_PARALLEL_MODE
@@ -48,6 +49,8 @@
 #include <blaze/math/smp/threads/Functions.h>
 #elif BLAZE_HPX_PARALLEL_MODE
 #include <blaze/math/smp/hpx/Functions.h>
+#elif BLAZE_TBB_PARALLEL_MODE
+#include <blaze/math/smp/tbb/Functions.h>
 #else
 #include <blaze/math/smp/default/Functions.h>
 #endif
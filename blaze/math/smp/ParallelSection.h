@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <blaze/math/Exception.h>
 #include <blaze/util/Suffix.h>
 
@@ -58,7 +59,10 @@ namespace blaze {
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
 // It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// that serves as a utility for debugging the shared-memory parallelization. Within a task of an
+// asynchronous parallel operation (see the LocalParallelSection class) a parallel section is
+// only thread-local, i.e. it doesn't affect the global activity flag and the SMP functions
+// started within the section are executed serially (see isLocalParallelSectionActive()).
 */
 template< typename T >
 class ParallelSection
@@ -89,16 +93,29 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   const bool global_;  //!< Flag for a parallel section that sets the global activity flag.
+
+   static std::atomic<bool> active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the
+                                           currently executed code is inside a parallel
+                                           section), the flag is set to \a true, otherwise
+                                           it is \a false. The flag is atomic since it is
+                                           read by the tasks of asynchronous operations
+                                           while other threads start parallel sections. */
+
+   static thread_local bool local_;  //!< Thread-local activity flag for the parallel section.
+                                     /*!< In case the calling thread executes a task of an
+                                          asynchronous parallel operation (see the
+                                          LocalParallelSection class), the flag is set to
+                                          \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    friend bool isParallelSectionActive();
+   friend bool isLocalParallelSectionActive();
+   template< typename > friend class LocalParallelSection;
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -116,7 +133,10 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+std::atomic<bool> ParallelSection<T>::active_{ false };
+
+template< typename T >
+thread_local bool ParallelSection<T>::local_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -134,10 +154,17 @@ bool ParallelSection<T>::active_ = false;
 //
 // \param activate Activation flag for the parallel section.
 // \exception std::runtime_error Nested parallel sections detected.
+//
+// In case the calling thread executes a task of an asynchronous parallel operation, the parallel
+// section is thread-local and the global activity flag remains unchanged.
 */
 template< typename T >
 inline ParallelSection<T>::ParallelSection( bool activate )
+   : global_( !local_ )  // Flag for a parallel section that sets the global activity flag
 {
+   if( !global_ )
+      return;
+
    if( active_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Nested parallel sections detected" );
    }
@@ -161,7 +188,8 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 template< typename T >
 inline ParallelSection<T>::~ParallelSection()
 {
-   active_ = false;  // Resetting the activity flag
+   if( global_ )
+      active_ = false;  // Resetting the activity flag
 }
 //*************************************************************************************************
 
@@ -183,13 +211,65 @@ inline ParallelSection<T>::~ParallelSection()
 template< typename T >
 inline ParallelSection<T>::operator bool() const
 {
-   return active_;
+   return local_ || active_;
 }
 //*************************************************************************************************
 
 
 
 
+//=================================================================================================
+//
+//  CLASS LOCALPARALLELSECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local parallel section for the tasks of asynchronous parallel operations.
+// \ingroup smp
+//
+// The LocalParallelSection class marks the execution of a task of an asynchronous parallel
+// operation (see asyncAssign()) on the calling thread. In contrast to the ParallelSection class
+// the parallel section is only active for the calling thread, i.e. only SMP functions executed
+// by the calling thread detect the active parallel section and are executed serially. This
+// enables other threads to start their own parallel operations while the task is executed.
+*/
+template< typename T >
+class LocalParallelSection
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the LocalParallelSection class.
+   */
+   inline LocalParallelSection()
+      : previous_( ParallelSection<T>::local_ )  // The previous state of the thread-local flag
+   {
+      ParallelSection<T>::local_ = true;
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor of the LocalParallelSection class.
+   */
+   inline ~LocalParallelSection()
+   {
+      ParallelSection<T>::local_ = previous_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const bool previous_;  //!< The previous state of the thread-local activity flag.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
@@ -200,6 +280,7 @@ inline ParallelSection<T>::operator bool() const
 /*!\name ParallelSection functions */
 //@{
 inline bool isParallelSectionActive();
+inline bool isLocalParallelSectionActive();
 //@}
 //*************************************************************************************************
 
@@ -212,7 +293,24 @@ inline bool isParallelSectionActive();
 */
 inline bool isParallelSectionActive()
 {
-   return ParallelSection<int>::active_;
+   return ParallelSection<int>::local_ || ParallelSection<int>::active_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a thread-local parallel section is active or not.
+// \ingroup smp
+//
+// \return \a true if the calling thread executes a task of an asynchronous operation, \a false
+//         if not.
+//
+// Within a task of an asynchronous parallel operation (see the LocalParallelSection class) all
+// SMP functions are executed serially on the calling thread.
+*/
+inline bool isLocalParallelSectionActive()
+{
+   return ParallelSection<int>::local_;
 }
 //*************************************************************************************************
 
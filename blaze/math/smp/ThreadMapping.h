@@ -41,12 +41,32 @@
 //*************************************************************************************************
 
 #include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
 #include <blaze/math/shims/Round.h>
 #include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatVecMultExpr.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsTVecMatMultExpr.h>
+#include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
@@ -114,6 +134,713 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  THREADPARTITION FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partition of an index range into contiguous blocks.
+// \ingroup smp
+//
+// A thread partition contains the boundaries of the blocks of an index range: block \a b spans
+// the indices \f$ [partition[b],partition[b+1]) \f$. The first boundary is always 0, the last
+// boundary is the size of the index range. Empty blocks are never part of a partition.
+*/
+using ThreadPartition = std::vector<size_t>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a uniform partition of the given index range.
+// \ingroup smp
+//
+// \param size The size of the index range.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \return The uniform partition of the index range.
+//
+// This function splits the range \f$ [0,size) \f$ into at most \a blocks blocks of equal size.
+// The size of the blocks is rounded up to the next multiple of \a alignment.
+*/
+inline ThreadPartition createUniformPartition( size_t size, size_t blocks, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks" );
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment - 1UL ) ) == 0UL, "Invalid alignment" );
+
+   const size_t addon       ( ( ( size % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( size / blocks + addon );
+   const size_t rest        ( equalShare & ( alignment - 1UL ) );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
+
+   ThreadPartition partition( 1UL, 0UL );
+
+   for( size_t b=1UL; b<=blocks && partition.back()<size; ++b ) {
+      partition.push_back( min( b*sizePerBlock, size ) );
+   }
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a weighted partition of the given index range.
+// \ingroup smp
+//
+// \param size The size of the index range.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \param weight The cost of processing a single index.
+// \return The weighted partition of the index range.
+//
+// This function splits the range \f$ [0,size) \f$ into at most \a blocks blocks of (roughly)
+// equal total cost, where the cost of index \a i is given by \a weight(i). The block boundaries
+// are placed at the multiple of \a alignment closest to the ideal position.
+*/
+template< typename WF >  // Type of the weight function
+ThreadPartition createWeightedPartition( size_t size, size_t blocks, size_t alignment, WF weight )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks" );
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment - 1UL ) ) == 0UL, "Invalid alignment" );
+
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      total += weight( i );
+   }
+
+   ThreadPartition partition( 1UL, 0UL );
+
+   size_t sum( 0UL );
+   size_t b  ( 1UL );
+
+   for( size_t i=0UL; i<size && b<blocks; ++i )
+   {
+      sum += weight( i );
+
+      if( sum*blocks < total*b )
+         continue;
+
+      while( b < blocks && sum*blocks >= total*b ) {
+         ++b;
+      }
+
+      const size_t boundary( min( ( i + 1UL + alignment/2UL ) & ~( alignment - 1UL ), size ) );
+
+      if( boundary > partition.back() ) {
+         partition.push_back( boundary );
+      }
+   }
+
+   if( partition.back() < size ) {
+      partition.push_back( size );
+   }
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the given index range into blocks of limited cost.
+// \ingroup smp
+//
+// \param size The size of the index range.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \param cost The cost of processing a block of indices.
+// \param limit The maximum cost of a single block.
+// \param partition The resulting partition.
+// \return \a true if at most \a blocks blocks are required, \a false if not.
+//
+// This function greedily extends each block to the last aligned boundary for which the cost of
+// the block does not exceed \a limit. Each block contains at least a single aligned chunk.
+*/
+template< typename CF >  // Type of the cost function
+bool partitionByCost( size_t size, size_t blocks, size_t alignment, CF cost, size_t limit,
+                      ThreadPartition& partition )
+{
+   const size_t chunks( ( size + alignment - 1UL ) / alignment );
+
+   partition.assign( 1UL, 0UL );
+
+   size_t chunk( 0UL );
+
+   while( chunk < chunks )
+   {
+      if( partition.size() > blocks )
+         return false;
+
+      const size_t begin( partition.back() );
+
+      size_t lower( chunk+1UL );
+      size_t upper( chunks );
+
+      while( lower < upper ) {
+         const size_t middle( upper - ( upper - lower ) / 2UL );
+         if( cost( begin, min( middle*alignment, size ) ) <= limit )
+            lower = middle;
+         else
+            upper = middle - 1UL;
+      }
+
+      chunk = lower;
+      partition.push_back( min( chunk*alignment, size ) );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a partition of the given index range based on the cost of entire blocks.
+// \ingroup smp
+//
+// \param size The size of the index range.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \param cost The cost of processing a block of indices.
+// \return The balanced partition of the index range.
+//
+// This function splits the range \f$ [0,size) \f$ into at most \a blocks blocks such that the
+// maximum cost of a single block is minimized. In contrast to createWeightedPartition(), the
+// cost of a block is not required to be the sum of the costs of its indices, but \a cost(b,e)
+// must not decrease with increasing \a e. The minimum maximum cost is determined by a binary
+// search, which requires \f$ O(blocks \cdot log(size) \cdot log(cost(0,size))) \f$ evaluations
+// of the cost function.
+*/
+template< typename CF >  // Type of the cost function
+ThreadPartition createBalancedPartition( size_t size, size_t blocks, size_t alignment, CF cost )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks" );
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment - 1UL ) ) == 0UL, "Invalid alignment" );
+
+   ThreadPartition partition( 1UL, 0UL );
+
+   if( size == 0UL )
+      return partition;
+
+   size_t lower( 0UL );
+   size_t upper( cost( 0UL, size ) );
+
+   while( lower < upper ) {
+      const size_t middle( lower + ( upper - lower ) / 2UL );
+      if( partitionByCost( size, blocks, alignment, cost, middle, partition ) )
+         upper = middle;
+      else
+         lower = middle + 1UL;
+   }
+
+   partitionByCost( size, blocks, alignment, cost, upper, partition );
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost estimate for the rows/columns of a sparse matrix operand.
+// \ingroup smp
+//
+// The cost of a row/column of a sparse matrix is estimated by its number of non-zero elements.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct NonZerosWeight
+{
+   inline size_t operator()( size_t i ) const { return A_.nonZeros(i) + 1UL; }
+
+   const MT& A_;  //!< The sparse matrix operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost estimate for blocks of a triangular matrix operand that end at the block.
+// \ingroup smp
+//
+// The restructured submatrices of a product only contain the structurally non-zero part of a
+// triangular operand. For a block \f$ [begin,end) \f$ of the rows of a lower or the columns of
+// an upper matrix, this part spans the first \a end columns/rows. Therefore the cost of the
+// block is estimated by \f$ (end-begin) \cdot min(end,limit) \f$.
+*/
+struct LeadingBlockCost
+{
+   inline size_t operator()( size_t begin, size_t end ) const {
+      return ( end - begin ) * ( min( end, limit_ ) + 1UL );
+   }
+
+   size_t limit_;  //!< The length of the rows/columns.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost estimate for blocks of a triangular matrix operand that start at the block.
+// \ingroup smp
+//
+// For a block \f$ [begin,end) \f$ of the rows of an upper or the columns of a lower matrix, the
+// structurally non-zero part of the restructured submatrix spans the columns/rows from \a begin
+// to \a limit. Therefore the cost of the block is estimated by \f$ (end-begin) \cdot (limit-begin) \f$.
+*/
+struct TrailingBlockCost
+{
+   inline size_t operator()( size_t begin, size_t end ) const {
+      return ( end - begin ) * ( limit_ - min( begin, limit_ ) + 1UL );
+   }
+
+   size_t limit_;  //!< The length of the rows/columns.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the row partition of sparse matrix operands.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the matrix operand
+struct HasSparseRows
+   : public And< IsSparseMatrix<MT>, IsRowMajorMatrix<MT>, Not< IsComputation<MT> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the column partition of sparse matrix operands.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the matrix operand
+struct HasSparseColumns
+   : public And< IsSparseMatrix<MT>, IsColumnMajorMatrix<MT>, Not< IsComputation<MT> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the partition of lower triangular matrix operands.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the matrix operand
+struct HasLowerShape
+   : public And< IsLower<MT>, Not< IsUpper<MT> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the partition of upper triangular matrix operands.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the matrix operand
+struct HasUpperShape
+   : public And< IsUpper<MT>, Not< IsLower<MT> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a sparse row-major matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< HasSparseRows<MT>, ThreadPartition >
+   partitionOperandRows( const MT& A, size_t blocks, size_t alignment )
+{
+   return createWeightedPartition( A.rows(), blocks, alignment, NonZerosWeight<MT>{ A } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a lower triangular matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< And< HasLowerShape<MT>, Not< HasSparseRows<MT> > >, ThreadPartition >
+   partitionOperandRows( const MT& A, size_t blocks, size_t alignment )
+{
+   return createBalancedPartition( A.rows(), blocks, alignment, LeadingBlockCost{ A.columns() } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of an upper triangular matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< And< HasUpperShape<MT>, Not< HasSparseRows<MT> > >, ThreadPartition >
+   partitionOperandRows( const MT& A, size_t blocks, size_t alignment )
+{
+   return createBalancedPartition( A.rows(), blocks, alignment, TrailingBlockCost{ A.columns() } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a general matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline DisableIf_< Or< HasSparseRows<MT>, HasLowerShape<MT>, HasUpperShape<MT> >, ThreadPartition >
+   partitionOperandRows( const MT& A, size_t blocks, size_t alignment )
+{
+   return createUniformPartition( A.rows(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a sparse column-major matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< HasSparseColumns<MT>, ThreadPartition >
+   partitionOperandColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   return createWeightedPartition( A.columns(), blocks, alignment, NonZerosWeight<MT>{ A } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a lower triangular matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< And< HasLowerShape<MT>, Not< HasSparseColumns<MT> > >, ThreadPartition >
+   partitionOperandColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   return createBalancedPartition( A.columns(), blocks, alignment, TrailingBlockCost{ A.rows() } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of an upper triangular matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline EnableIf_< And< HasUpperShape<MT>, Not< HasSparseColumns<MT> > >, ThreadPartition >
+   partitionOperandColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   return createBalancedPartition( A.columns(), blocks, alignment, LeadingBlockCost{ A.rows() } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a general matrix operand.
+// \ingroup smp
+//
+// \param A The matrix operand.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline DisableIf_< Or< HasSparseColumns<MT>, HasLowerShape<MT>, HasUpperShape<MT> >, ThreadPartition >
+   partitionOperandColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   return createUniformPartition( A.columns(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a matrix-matrix multiplication expression.
+// \ingroup smp
+//
+// \param A The matrix-matrix multiplication expression.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the multiplication expression.
+//
+// The cost of a row of the product is determined by the according row of the left-hand side
+// operand (see the restructuring of submatrices of multiplication expressions).
+*/
+template< typename MT >  // Type of the matrix
+inline EnableIf_< IsMatMatMultExpr<MT>, ThreadPartition >
+   partitionRows( const MT& A, size_t blocks, size_t alignment )
+{
+   return partitionOperandRows( A.leftOperand(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of a matrix.
+// \ingroup smp
+//
+// \param A The matrix.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the rows of the matrix.
+//
+// Only sparse row-major matrices result in a weighted partition. Dense (triangular) matrices
+// are split uniformly since all elements of a submatrix are assigned.
+*/
+template< typename MT >  // Type of the matrix
+inline DisableIf_< IsMatMatMultExpr<MT>, ThreadPartition >
+   partitionRows( const MT& A, size_t blocks, size_t alignment )
+{
+   if( HasSparseRows<MT>::value )
+      return partitionOperandRows( A, blocks, alignment );
+   else
+      return createUniformPartition( A.rows(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a matrix-matrix multiplication expression.
+// \ingroup smp
+//
+// \param A The matrix-matrix multiplication expression.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the multiplication expression.
+//
+// The cost of a column of the product is determined by the according column of the right-hand
+// side operand (see the restructuring of submatrices of multiplication expressions).
+*/
+template< typename MT >  // Type of the matrix
+inline EnableIf_< IsMatMatMultExpr<MT>, ThreadPartition >
+   partitionColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   return partitionOperandColumns( A.rightOperand(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of a matrix.
+// \ingroup smp
+//
+// \param A The matrix.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the columns of the matrix.
+//
+// Only sparse column-major matrices result in a weighted partition. Dense (triangular) matrices
+// are split uniformly since all elements of a submatrix are assigned.
+*/
+template< typename MT >  // Type of the matrix
+inline DisableIf_< IsMatMatMultExpr<MT>, ThreadPartition >
+   partitionColumns( const MT& A, size_t blocks, size_t alignment )
+{
+   if( HasSparseColumns<MT>::value )
+      return partitionOperandColumns( A, blocks, alignment );
+   else
+      return createUniformPartition( A.columns(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions a matrix/vector multiplication expression.
+// \ingroup smp
+//
+// \param v The matrix/vector multiplication expression.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the multiplication expression.
+*/
+template< typename VT >  // Type of the vector
+inline EnableIf_< IsMatVecMultExpr<VT>, ThreadPartition >
+   partitionElements( const VT& v, size_t blocks, size_t alignment )
+{
+   return partitionOperandRows( v.leftOperand(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions a vector/matrix multiplication expression.
+// \ingroup smp
+//
+// \param v The vector/matrix multiplication expression.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The partition of the multiplication expression.
+*/
+template< typename VT >  // Type of the vector
+inline EnableIf_< IsTVecMatMultExpr<VT>, ThreadPartition >
+   partitionElements( const VT& v, size_t blocks, size_t alignment )
+{
+   return partitionOperandColumns( v.rightOperand(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions a vector.
+// \ingroup smp
+//
+// \param v The vector.
+// \param blocks The maximum number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return The uniform partition of the vector.
+*/
+template< typename VT >  // Type of the vector
+inline DisableIf_< Or< IsMatVecMultExpr<VT>, IsTVecMatMultExpr<VT> >, ThreadPartition >
+   partitionElements( const VT& v, size_t blocks, size_t alignment )
+{
+   return createUniformPartition( v.size(), blocks, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a load-balanced partition of a vector for the given number of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads.
+// \param v The vector to be assigned in parallel.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \return The partition of the vector into at most \a threads blocks.
+//
+// This function partitions the given vector into blocks of equal estimated cost. For a product
+// of a triangular matrix and a vector the blocks are sized such that the restructured blocks
+// of the product require roughly the same number of floating point operations, for a product
+// of a sparse matrix and a vector the blocks contain the same number of non-zero elements. All
+// other vectors are split into blocks of equal size.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag of the vector
+ThreadPartition createThreadPartition( size_t threads, const Vector<VT,TF>& v, size_t alignment )
+{
+   return partitionElements( ~v, threads, alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a load-balanced 2D partition of a matrix for the given number of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads.
+// \param A The matrix to be assigned in parallel.
+// \param alignment The alignment of the block boundaries (a power of two).
+// \return The partitions of the rows and columns of the matrix.
+//
+// This function partitions the given matrix according to the 2D mapping of the given number of
+// threads (see createThreadMapping()). The rows and columns are split into blocks of equal
+// estimated cost: for a product with triangular operands the restructured blocks of the product
+// require roughly the same number of floating point operations, for a sparse matrix or a product with sparse operands the blocks
+// contain the same number of non-zero elements. In all other cases the rows and columns are
+// split into blocks of equal size. All block boundaries are aligned to \a alignment.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+std::pair<ThreadPartition,ThreadPartition>
+   createThreadPartition( size_t threads, const Matrix<MT,SO>& A, size_t alignment )
+{
+   const ThreadMapping threadmap( createThreadMapping( threads, ~A ) );
+
+   return std::make_pair( partitionRows   ( ~A, threadmap.first , alignment )
+                        , partitionColumns( ~A, threadmap.second, alignment ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
+#include <blaze/math/smp/AffinityPolicy.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
@@ -60,6 +62,10 @@ namespace blaze {
 //@{
 BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
 BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( AffinityPolicy policy );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( AffinityPolicy policy, size_t node );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( const std::vector<size_t>& cpus );
+BLAZE_ALWAYS_INLINE void   setThreadSpinTime( size_t microseconds );
 BLAZE_ALWAYS_INLINE void   shutDownThreads();
 //@}
 //*************************************************************************************************
@@ -101,6 +107,71 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \return void
+//
+// Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   UNUSED_PARAMETER( policy );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the CPUs of a NUMA node.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \param node The index of the NUMA node.
+// \return void
+//
+// Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy, size_t node )
+{
+   UNUSED_PARAMETER( policy, node );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   UNUSED_PARAMETER( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the spin time of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t microseconds )
+{
+   UNUSED_PARAMETER( microseconds );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -145,6 +216,7 @@ namespace {
 BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE      );
 BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_HPX_PARALLEL_MODE         );
+BLAZE_STATIC_ASSERT( !BLAZE_TBB_PARALLEL_MODE         );
 
 }
 /*! \endcond */
@@ -57,7 +57,6 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -116,29 +115,24 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP o
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads    ( getNumThreads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
+   const auto partition( createThreadPartition( getNumThreads(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threadmap.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   const size_t addon2     ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threadmap.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const size_t rowBlocks   ( rows.size()    - 1UL );
+   const size_t columnBlocks( columns.size() - 1UL );
 
-   for_loop( par, size_t(0), threads, [&](int i)
+   for_loop( par, size_t(0), rowBlocks*columnBlocks, [&](size_t k)
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i( k / columnBlocks );
+      const size_t j( k % columnBlocks );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
-         return;
+      const size_t row   ( rows[i]    );
+      const size_t column( columns[j] );
 
-      const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+      const size_t m( rows[i+1UL]    - row    );
+      const size_t n( columns[j+1UL] - column );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -197,25 +191,24 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( getNumThreads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
+   const auto partition( createThreadPartition( getNumThreads(), ~rhs, 1UL ) );
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threadmap.first + addon1 );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
+   const size_t rowBlocks   ( rows.size()    - 1UL );
+   const size_t columnBlocks( columns.size() - 1UL );
 
-   for_loop( par, size_t(0), threads, [&](int i)
+   for_loop( par, size_t(0), rowBlocks*columnBlocks, [&](size_t k)
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i( k / columnBlocks );
+      const size_t j( k % columnBlocks );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
-         return;
+      const size_t row   ( rows[i]    );
+      const size_t column( columns[j] );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( rows[i+1UL]    - row    );
+      const size_t n( columns[j+1UL] - column );
 
       auto       target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
       const auto source( submatrix<unaligned>( ~rhs, row, column, m, n ) );
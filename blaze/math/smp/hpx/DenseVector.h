@@ -53,6 +53,7 @@
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
@@ -118,20 +119,13 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP o
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( getNumThreads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const ThreadPartition partition(
+      createThreadPartition( getNumThreads(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for_loop( par, size_t(0), threads, [&](int i)
+   for_loop( par, size_t(0), partition.size()-1UL, [&](int i)
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         return;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
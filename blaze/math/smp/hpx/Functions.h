@@ -47,6 +47,7 @@
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -76,6 +77,25 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function has no effect for the HPX-based parallelization. The waiting behavior of the
+// HPX worker threads is determined by the HPX runtime.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t microseconds )
+{
+   UNUSED_PARAMETER( microseconds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -61,7 +61,6 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -117,30 +116,25 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const int threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
+   const auto partition( createThreadPartition( omp_get_max_threads(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threadmap.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   const size_t addon2     ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threadmap.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const size_t rowBlocks   ( rows.size()    - 1UL );
+   const size_t columnBlocks( columns.size() - 1UL );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0; i<threads; ++i )
+#pragma omp parallel for schedule(dynamic,1)
+   for( int k=0; k<int( rowBlocks*columnBlocks ); ++k )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i( size_t(k) / columnBlocks );
+      const size_t j( size_t(k) % columnBlocks );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
-         continue;
+      const size_t row   ( rows[i]    );
+      const size_t column( columns[j] );
 
-      const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+      const size_t m( rows[i+1UL]    - row    );
+      const size_t n( columns[j+1UL] - column );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -196,26 +190,25 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
+   const auto partition( createThreadPartition( omp_get_max_threads(), ~rhs, 1UL ) );
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threadmap.first + addon1 );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
+   const size_t rowBlocks   ( rows.size()    - 1UL );
+   const size_t columnBlocks( columns.size() - 1UL );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( size_t i=0; i<threads; ++i )
+#pragma omp parallel for schedule(dynamic,1)
+   for( int k=0; k<int( rowBlocks*columnBlocks ); ++k )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i( size_t(k) / columnBlocks );
+      const size_t j( size_t(k) % columnBlocks );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
-         continue;
+      const size_t row   ( rows[i]    );
+      const size_t column( columns[j] );
 
-      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( rows[i+1UL]    - row    );
+      const size_t n( columns[j+1UL] - column );
 
       auto       target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
       const auto source( submatrix<unaligned>( ~rhs, row, column, m, n ) );
@@ -311,7 +304,6 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -405,7 +397,6 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -499,7 +490,6 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -593,7 +583,6 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
          schurAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, SchurAssign() );
       }
    }
@@ -53,6 +53,7 @@
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
@@ -114,21 +115,16 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const ThreadPartition partition(
+      createThreadPartition( omp_get_max_threads(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
-   {
-      const size_t index( i*sizePerThread );
+   const int blocks( partition.size() - 1UL );
 
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+#pragma omp parallel for schedule(dynamic,1)
+   for( int i=0; i<blocks; ++i )
+   {
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
@@ -184,11 +180,11 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const int    threads      ( omp_get_num_threads() );
+   const int    threads      ( omp_get_max_threads() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp parallel for schedule(dynamic,1)
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -289,7 +285,6 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -381,7 +376,6 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -473,7 +467,6 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -565,7 +558,6 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
          multAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, MultAssign() );
       }
    }
@@ -657,7 +649,6 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
          divAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
          openmpAssign( ~lhs, ~rhs, DivAssign() );
       }
    }
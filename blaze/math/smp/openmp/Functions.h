@@ -40,12 +40,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/AffinityPolicy.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -100,6 +103,83 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \return void
+//
+// This function has no effect for the OpenMP-based parallelization. The placement of the
+// OpenMP threads is controlled via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   UNUSED_PARAMETER( policy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the CPUs of a NUMA node.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \param node The index of the NUMA node.
+// \return void
+//
+// This function has no effect for the OpenMP-based parallelization. The placement of the
+// OpenMP threads is controlled via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy, size_t node )
+{
+   UNUSED_PARAMETER( policy, node );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// This function has no effect for the OpenMP-based parallelization. The placement of the
+// OpenMP threads is controlled via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   UNUSED_PARAMETER( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function has no effect for the OpenMP-based parallelization. The waiting behavior of the
+// OpenMP threads is controlled via the \c OMP_WAIT_POLICY environment variable.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t microseconds )
+{
+   UNUSED_PARAMETER( microseconds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,360 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/tbb/Functions.h
+//  \brief Header file for the TBB-based SMP utility functions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TBB_FUNCTIONS_H_
+#define _BLAZE_MATH_SMP_TBB_FUNCTIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <tbb/task_arena.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/AffinityPolicy.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TASK ARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary class template for the management of an externally supplied TBB task arena.
+// \ingroup smp
+//
+// The TaskArena class template holds the TBB task arena that is used for all TBB-based parallel
+// operations. This is either an externally supplied task arena (see the setTaskArena() function)
+// or a task arena owned by \b Blaze that restricts the number of threads (see the setNumThreads()
+// function). In case no task arena has been set, the parallel operations are executed in the
+// task arena of the calling thread.
+*/
+template< typename T >
+struct TaskArena
+{
+   static std::atomic<tbb::task_arena*> arena_;  //!< The currently active task arena.
+   static std::unique_ptr<tbb::task_arena> owned_;  //!< The task arena owned by Blaze.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+std::atomic<tbb::task_arena*> TaskArena<T>::arena_{ nullptr };
+
+template< typename T >
+std::unique_ptr<tbb::task_arena> TaskArena<T>::owned_{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP utility functions */
+//@{
+BLAZE_ALWAYS_INLINE size_t getNumThreads();
+BLAZE_ALWAYS_INLINE void   setNumThreads( size_t number );
+BLAZE_ALWAYS_INLINE void   setTaskArena( tbb::task_arena& arena );
+BLAZE_ALWAYS_INLINE void   resetTaskArena();
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( AffinityPolicy policy );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( AffinityPolicy policy, size_t node );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( const std::vector<size_t>& cpus );
+BLAZE_ALWAYS_INLINE void   setThreadSpinTime( size_t microseconds );
+BLAZE_ALWAYS_INLINE void   shutDownThreads();
+
+template< typename OP >
+BLAZE_ALWAYS_INLINE void executeInTaskArena( OP op );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads used for TBB parallel operations.
+// \ingroup smp
+//
+// \return The number of threads used for TBB parallel operations.
+//
+// Via this function the number of threads used for TBB parallel operations can be queried. In
+// case a task arena has been set via the setTaskArena() or the setNumThreads() function, the
+// function returns the maximum concurrency of this task arena, otherwise it returns the maximum
+// concurrency of the task arena of the calling thread.
+*/
+BLAZE_ALWAYS_INLINE size_t getNumThreads()
+{
+   tbb::task_arena* arena( TaskArena<int>::arena_ );
+
+   return ( arena != nullptr )
+          ?( static_cast<size_t>( arena->max_concurrency() ) )
+          :( static_cast<size_t>( tbb::this_task_arena::max_concurrency() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of threads to be used for TBB parallel operations.
+// \ingroup smp
+//
+// \param number The given number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// Via this function the maximum number of threads for TBB parallel operations can be specified.
+// For that purpose \b Blaze creates a task arena with the given maximum concurrency, in which
+// all subsequent parallel operations are executed. This task arena replaces a task arena
+// previously supplied via the setTaskArena() function. Note that the given \a number must be in
+// the range \f$[1..\infty)\f$. In case an invalid number of threads is specified, a
+// \a std::invalid_argument exception is thrown. Also note that this function must \b NOT be
+// called while a parallel operation is in progress.
+*/
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
+{
+   if( number == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   std::unique_ptr<tbb::task_arena> arena( new tbb::task_arena( static_cast<int>( number ) ) );
+
+   TaskArena<int>::arena_ = arena.get();
+   TaskArena<int>::owned_.swap( arena );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the TBB task arena for all TBB parallel operations.
+// \ingroup smp
+//
+// \param arena The task arena to be used for all subsequent parallel operations.
+// \return void
+//
+// Via this function an externally managed TBB task arena can be supplied to the \b Blaze
+// library. All subsequent parallel operations are executed within this task arena, i.e. they
+// share the worker threads of the arena with all other tasks of the application instead of
+// competing with them:
+
+   \code
+   tbb::task_arena arena( 8 );
+   blaze::setTaskArena( arena );
+
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+   C = A * B;  // Executed by the worker threads of 'arena'
+   \endcode
+
+// Note that the task arena is not owned by \b Blaze and has to outlive all parallel operations
+// (see the resetTaskArena() function). Also note that this function must \b NOT be called while
+// a parallel operation is in progress.
+*/
+BLAZE_ALWAYS_INLINE void setTaskArena( tbb::task_arena& arena )
+{
+   TaskArena<int>::arena_ = &arena;
+   TaskArena<int>::owned_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the TBB task arena for all TBB parallel operations.
+// \ingroup smp
+//
+// \return void
+//
+// This function removes a task arena previously set via the setTaskArena() or the setNumThreads()
+// function. All subsequent parallel operations are executed in the task arena of the calling
+// thread.
+*/
+BLAZE_ALWAYS_INLINE void resetTaskArena()
+{
+   TaskArena<int>::arena_ = nullptr;
+   TaskArena<int>::owned_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \return void
+//
+// This function has no effect for the TBB-based parallelization. The worker threads are owned
+// and placed by the TBB task scheduler (see for instance \c tbb::task_arena::constraints).
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   UNUSED_PARAMETER( policy );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the CPUs of a NUMA node.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \param node The index of the NUMA node.
+// \return void
+//
+// This function has no effect for the TBB-based parallelization. The worker threads are owned
+// and placed by the TBB task scheduler (see for instance \c tbb::task_arena::constraints).
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy, size_t node )
+{
+   UNUSED_PARAMETER( policy, node );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// This function has no effect for the TBB-based parallelization. The worker threads are owned
+// and placed by the TBB task scheduler (see for instance \c tbb::task_arena::constraints).
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   UNUSED_PARAMETER( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the spin time of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function has no effect for the TBB-based parallelization. The waiting behavior of the
+// worker threads is determined by the TBB task scheduler.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t microseconds )
+{
+   UNUSED_PARAMETER( microseconds );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Shutdown of the threads used for TBB parallel operations.
+// \ingroup smp
+//
+// \return void
+//
+// This function has no effect for the TBB-based parallelization. In contrast to the C++11 and
+// Boost thread-based parallelizations, \b Blaze does not create any threads of its own, but
+// executes all parallel operations as tasks of the TBB task scheduler, which owns the worker
+// threads and is responsible for their shutdown. The function is merely provided in order to
+// enable code that calls shutDownThreads() at the end of the \c main() function to be compiled
+// with all parallelizations. In order to release a task arena created via the setNumThreads()
+// function before the end of the program, the resetTaskArena() function can be used.
+*/
+BLAZE_ALWAYS_INLINE void shutDownThreads()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given operation in the TBB task arena.
+// \ingroup smp
+//
+// \param op The operation to be executed.
+// \return void
+//
+// This function executes the given operation within the task arena supplied via the
+// setTaskArena() function. In case no task arena has been supplied, the operation is
+// executed directly by the calling thread (i.e. in the task arena of the calling thread).
+*/
+template< typename OP >  // Type of the operation
+BLAZE_ALWAYS_INLINE void executeInTaskArena( OP op )
+{
+   tbb::task_arena* arena( TaskArena<int>::arena_ );
+
+   if( arena != nullptr )
+      arena->execute( op );
+   else
+      op();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_TBB_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,422 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncAssign.h
+//  \brief C++11/Boost thread-based asynchronous assignment implementation
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/AsyncHandle.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD-BASED ASYNCHRONOUS ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based asynchronous assignment of a dense vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \param handle The handle of the asynchronous assignment.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based asynchronous
+// assignment of a dense vector to a dense vector. It partitions the target in the same way as the
+// according SMP assignment, but returns without waiting for the completion of the tasks. Every
+// task assigns its part of the right-hand side vector via the smpAssign() function, which is executed serially
+// due to the thread-local parallel section of the task (see AsyncHandle::task()), but selects
+// the SMP assignment kernels of the expression.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// asyncAssign() function.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+void threadAsyncAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, AsyncHandle& handle )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET1 = ElementType_<VT1>;
+   using ET2 = ElementType_<VT2>;
+
+   constexpr bool simdEnabled( VT1::simdEnabled && VT2::simdEnabled && IsSIMDCombinable<ET1,ET2>::value );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT1> >::size );
+
+   const bool lhsAligned( (~lhs).isAligned() );
+   const bool rhsAligned( (~rhs).isAligned() );
+
+   const ThreadPartition partition(
+      createThreadPartition( TheThreadBackend::size(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
+
+   for( size_t i=1UL; i<partition.size(); ++i )
+   {
+      const size_t index( partition[i-1UL] );
+      const size_t size ( partition[i] - index );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
+         const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
+         TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
+         const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
+         TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
+         const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
+         TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+      }
+      else {
+         auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
+         const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
+         TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based asynchronous assignment of a dense matrix to a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \param handle The handle of the asynchronous assignment.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based asynchronous
+// assignment of a dense matrix to a dense matrix. It partitions the target in the same way as the
+// according SMP assignment, but returns without waiting for the completion of the tasks. Every
+// task assigns its part of the right-hand side matrix via the smpAssign() function, which is executed serially
+// due to the thread-local parallel section of the task (see AsyncHandle::task()), but selects
+// the SMP assignment kernels of the expression.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// asyncAssign() function.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+void threadAsyncAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, AsyncHandle& handle )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET1 = ElementType_<MT1>;
+   using ET2 = ElementType_<MT2>;
+
+   constexpr bool simdEnabled( MT1::simdEnabled && MT2::simdEnabled && IsSIMDCombinable<ET1,ET2>::value );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT1> >::size );
+
+   const bool lhsAligned( (~lhs).isAligned() );
+   const bool rhsAligned( (~rhs).isAligned() );
+
+   const auto partition( createThreadPartition( TheThreadBackend::size(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
+
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
+
+   for( size_t i=1UL; i<rows.size(); ++i )
+   {
+      const size_t row( rows[i-1UL] );
+      const size_t m  ( rows[i] - row );
+
+      for( size_t j=1UL; j<columns.size(); ++j )
+      {
+         const size_t column( columns[j-1UL] );
+         const size_t n     ( columns[j] - column );
+
+         if( simdEnabled && lhsAligned && rhsAligned ) {
+            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+         }
+         else if( simdEnabled && lhsAligned ) {
+            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+         }
+         else if( simdEnabled && rhsAligned ) {
+            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+         }
+         else {
+            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+            TheThreadBackend::schedule( handle.task( [target,source]() mutable { smpAssign( target, source ); } ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based asynchronous assignment to a
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return The handle of the (already completed) assignment.
+//
+// This function implements the default C++11/Boost thread-based asynchronous assignment to a
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the target vector is not a dense vector, is restricted, or in
+// case any operand is not SMP-assignable. In this case the assignment is performed synchronously.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline DisableIf_< And< IsDenseVector<VT1>, IsDenseVector<VT2>, Not< IsRestricted<VT1> >
+                      , IsSMPAssignable<VT1>, IsSMPAssignable<VT2> >, AsyncHandle >
+   asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   ~lhs = ~rhs;
+
+   return AsyncHandle();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based asynchronous assignment to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return The handle of the asynchronous assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function performs the C++11/Boost thread-based asynchronous assignment to a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case both operands are SMP-assignable dense vectors and the target vector
+// is not restricted. In case the assignment cannot be executed in parallel (e.g. within a serial
+// or parallel section or in case of aliasing), it is performed synchronously.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline EnableIf_< And< IsDenseVector<VT1>, IsDenseVector<VT2>, Not< IsRestricted<VT1> >
+                     , IsSMPAssignable<VT1>, IsSMPAssignable<VT2> >, AsyncHandle >
+   asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT2> );
+
+   AsyncHandle handle;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       !(~rhs).canSMPAssign() || (~rhs).canAlias( &~lhs ) ) {
+      ~lhs = ~rhs;
+   }
+   else {
+      resize( ~lhs, (~rhs).size(), false );
+      threadAsyncAssign( ~lhs, ~rhs, handle );
+   }
+
+   return handle;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based asynchronous assignment to a
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return The handle of the (already completed) assignment.
+//
+// This function implements the default C++11/Boost thread-based asynchronous assignment to a
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case the target matrix is not a dense matrix, is restricted, or in
+// case any operand is not SMP-assignable. In this case the assignment is performed synchronously.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline DisableIf_< And< IsDenseMatrix<MT1>, IsDenseMatrix<MT2>, Not< IsRestricted<MT1> >
+                      , IsSMPAssignable<MT1>, IsSMPAssignable<MT2> >, AsyncHandle >
+   asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   ~lhs = ~rhs;
+
+   return AsyncHandle();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based asynchronous assignment to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return The handle of the asynchronous assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the C++11/Boost thread-based asynchronous assignment to a dense matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case both operands are SMP-assignable dense matrices and the target matrix
+// is not restricted. In case the assignment cannot be executed in parallel (e.g. within a serial
+// or parallel section or in case of aliasing), it is performed synchronously.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline EnableIf_< And< IsDenseMatrix<MT1>, IsDenseMatrix<MT2>, Not< IsRestricted<MT1> >
+                     , IsSMPAssignable<MT1>, IsSMPAssignable<MT2> >, AsyncHandle >
+   asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   AsyncHandle handle;
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       !(~rhs).canSMPAssign() || (~rhs).canAlias( &~lhs ) ) {
+      ~lhs = ~rhs;
+   }
+   else {
+      resize( ~lhs, (~rhs).rows(), (~rhs).columns(), false );
+      threadAsyncAssign( ~lhs, ~rhs, handle );
+   }
+
+   return handle;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
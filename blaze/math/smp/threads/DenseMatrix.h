@@ -60,7 +60,6 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -107,6 +106,8 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   threadpool::TaskGroup group;
+
    using ET1 = ElementType_<MT1>;
    using ET2 = ElementType_<MT2>;
 
@@ -116,59 +117,45 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
-
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const auto partition( createThreadPartition( TheThreadBackend::size(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=1UL; i<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( rows[i-1UL] );
+      const size_t m  ( rows[i] - row );
 
-      if( row >= (~lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=1UL; j<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+         const size_t column( columns[j-1UL] );
+         const size_t n     ( columns[j] - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( group, target, source, op );
          }
          else if( simdEnabled && lhsAligned ) {
             auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( group, target, source, op );
          }
          else if( simdEnabled && rhsAligned ) {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( group, target, source, op );
          }
          else {
             auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
             const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
+            TheThreadBackend::schedule( group, target, source, op );
          }
       }
    }
 
-   TheThreadBackend::wait();
+   TheThreadBackend::wait( group );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -203,38 +190,30 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   threadpool::TaskGroup group;
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
+   const auto partition( createThreadPartition( TheThreadBackend::size(), ~rhs, 1UL ) );
 
-   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
+   const ThreadPartition& rows   ( partition.first  );
+   const ThreadPartition& columns( partition.second );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=1UL; i<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i-1UL] );
+      const size_t m  ( rows[i] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=1UL; j<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+         const size_t column( columns[j-1UL] );
+         const size_t n     ( columns[j] - column );
 
          auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( group, target, source, op );
       }
    }
 
-   TheThreadBackend::wait();
+   TheThreadBackend::wait( group );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -321,7 +300,7 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
       }
       else {
@@ -415,7 +394,7 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
       }
       else {
@@ -510,7 +489,7 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
       }
       else {
@@ -605,7 +584,7 @@ inline EnableIf_< And< IsDenseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          schurAssign( ~lhs, ~rhs );
       }
       else {
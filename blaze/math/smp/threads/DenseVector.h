@@ -52,6 +52,7 @@
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
@@ -106,6 +107,8 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   threadpool::TaskGroup group;
+
    using ET1 = ElementType_<VT1>;
    using ET2 = ElementType_<VT2>;
 
@@ -115,44 +118,37 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const ThreadPartition partition(
+      createThreadPartition( TheThreadBackend::size(), ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=1UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i-1UL] );
+      const size_t size ( partition[i] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( group, target, source, op );
       }
       else if( simdEnabled && lhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( group, target, source, op );
       }
       else if( simdEnabled && rhsAligned ) {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( group, target, source, op );
       }
       else {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::schedule( group, target, source, op );
       }
    }
 
-   TheThreadBackend::wait();
+   TheThreadBackend::wait( group );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -187,6 +183,8 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   threadpool::TaskGroup group;
+
    const size_t threads      ( TheThreadBackend::size() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
@@ -201,10 +199,10 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-      TheThreadBackend::schedule( target, source, op );
+      TheThreadBackend::schedule( group, target, source, op );
    }
 
-   TheThreadBackend::wait();
+   TheThreadBackend::wait( group );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -289,7 +287,7 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          assign( ~lhs, ~rhs );
       }
       else {
@@ -381,7 +379,7 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          addAssign( ~lhs, ~rhs );
       }
       else {
@@ -474,7 +472,7 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          subAssign( ~lhs, ~rhs );
       }
       else {
@@ -567,7 +565,7 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          multAssign( ~lhs, ~rhs );
       }
       else {
@@ -659,7 +657,7 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
    BLAZE_PARALLEL_SECTION
    {
-      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      if( isSerialSectionActive() || isLocalParallelSectionActive() || !(~rhs).canSMPAssign() ) {
          divAssign( ~lhs, ~rhs );
       }
       else {
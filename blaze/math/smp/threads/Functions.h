@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/AffinityPolicy.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
@@ -98,6 +100,94 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations according to the given policy.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \return void
+//
+// Via this function the threads for thread parallel operations can be pinned to the CPUs
+// available to the process according to the given affinity policy (see the AffinityPolicy
+// enumeration). Note that thread affinity is currently only supported on Linux systems.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy )
+{
+   TheThreadBackend::setAffinity( policy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the CPUs of a NUMA node.
+// \ingroup smp
+//
+// \param policy The affinity policy.
+// \param node The index of the NUMA node.
+// \return void
+// \exception std::invalid_argument Invalid NUMA node.
+//
+// Via this function the threads for thread parallel operations can be pinned to the CPUs of
+// the given NUMA node according to the given affinity policy (see the AffinityPolicy
+// enumeration). In case the given node does not exist or none of its CPUs is available to the
+// process, a \a std::invalid_argument exception is thrown. Note that thread affinity is
+// currently only supported on Linux systems.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( AffinityPolicy policy, size_t node )
+{
+   TheThreadBackend::setAffinity( policy, node );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads used for thread parallel operations to the given CPUs.
+// \ingroup smp
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// Via this function the threads for thread parallel operations can be pinned to explicit CPUs:
+// the thread with index \a i is pinned to the CPU <tt>cpus[i % cpus.size()]</tt>. In case
+// \a cpus is empty, the threads are allowed to run on all available CPUs again. Note that
+// thread affinity is currently only supported on Linux systems.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   TheThreadBackend::setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of the threads used for thread parallel operations.
+// \ingroup smp
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// Via this function it is possible to specify how long idle threads busy wait for new work and
+// how long a thread parallel operation busy waits for the completion of all threads before they
+// block. Spinning reduces the latency of the dispatch and of the completion of thread parallel
+// operations considerably, but occupies the CPUs during the spin time. A spin time of 0 disables
+// spinning. Note that the threads don't spin as long as the number of threads exceeds the number
+// of CPUs available to the process.
+*/
+BLAZE_ALWAYS_INLINE void setThreadSpinTime( size_t microseconds )
+{
+   TheThreadBackend::setSpinTime( microseconds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
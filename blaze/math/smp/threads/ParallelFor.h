@@ -0,0 +1,143 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ParallelFor.h
+//  \brief Header file for the C++11/Boost thread-based SMP parallel for loop
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL FOR LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP parallel for loop.
+// \ingroup smp
+//
+// \param begin The first index of the iteration range.
+// \param end The index one past the last index of the iteration range.
+// \param op The operation to be executed on each index block.
+// \return void
+//
+// This function splits the index range \f$ [begin..end) \f$ into one contiguous block per
+// thread of the thread backend and calls the given operation for each of these blocks in
+// parallel. The operation \a op has to provide a function call operator of the form
+// <tt>void operator()( size_t first, size_t last )</tt>, which must only write to data
+// associated with its own block. In case a serial section is active or the function is
+// called from within an active parallel section, the operation is called exactly once for
+// the complete range.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of sparse matrix and vector kernels. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename OP >  // Type of the block operation
+inline void smpFor( size_t begin, size_t end, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( begin >= end )
+      return;
+
+   const size_t threads( TheThreadBackend::size() );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || threads == 1UL ) {
+      op( begin, end );
+      return;
+   }
+
+   const size_t size         ( end - begin );
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( size / threads + addon );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      threadpool::TaskGroup group;
+
+      for( size_t i=0UL; i<threads; ++i )
+      {
+         const size_t first( begin + i*sizePerThread );
+
+         if( first >= end )
+            continue;
+
+         const size_t last( min( first + sizePerThread, end ) );
+         TheThreadBackend::schedule( group, [&op,first,last]() { op( first, last ); } );
+      }
+
+      TheThreadBackend::wait( group );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,8 +50,15 @@
 #  include <boost/thread/thread.hpp>
 #endif
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/AffinityPolicy.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
@@ -75,7 +82,33 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution.
+//
+// The threads of the backend system can be pinned to specific CPUs, either via the setAffinity()
+// functions or via the following environment variables, which are evaluated once during the
+// initialization of the thread pool:
+//
+//  - \c BLAZE_THREAD_AFFINITY: Either \c none (the default), \c compact, \c scatter (see the
+//    AffinityPolicy enumeration), or an explicit list of CPUs (as for instance \c "0-3,8-11"),
+//    in which case the thread with index \a i is pinned to the \a i-th CPU of the list.
+//  - \c BLAZE_NUMA_NODE: Restricts the \c compact and \c scatter policies to the CPUs of the
+//    given NUMA node.
+//
+// Invalid settings are ignored. Since the scheduled tasks of every (compound) assignment are
+// always distributed in the same order, every thread processes the same part of the target
+// operand in every call, which in combination with pinned threads allows to reuse the cached
+// data of the previous calls.\n
+// In order to reduce the latency of the dispatch of tasks and of the wait() function, idle
+// threads busy wait for new tasks for a certain time before they block on a condition variable
+// and the wait() function busy waits for the completion of all tasks before it blocks (see the
+// ThreadPool class description). The spin time can be specified via the setSpinTime() function
+// or via the \c BLAZE_SPIN_TIME environment variable (in microseconds), which is evaluated once
+// during the initialization of the thread pool. In case the variable is not set or invalid, the
+// spin time is \c defaultSpinTime microseconds. Independent of the spin time the threads don't
+// spin as long as the number of threads exceeds the number of CPUs available to the process.\n
+// The tasks of every synchronous (compound) assignment are registered with a separate task group
+// (see the threadpool::TaskGroup class), i.e. the assignment only waits for the completion of its
+// own tasks and not for the tasks of concurrently running asynchronous assignments.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -86,12 +119,26 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Compilation flags***************************************************************************
+   //! The default spin time of idle and waiting threads (in microseconds).
+   static constexpr size_t defaultSpinTime = 100UL;
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    static inline size_t size  ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+   static inline void   wait  ( const threadpool::TaskGroup& group );
+
+   static inline std::vector<size_t> affinity();
+   static inline size_t              spinTime();
+
+   static inline void setAffinity( AffinityPolicy policy );
+   static inline void setAffinity( AffinityPolicy policy, size_t node );
+   static inline void setAffinity( const std::vector<size_t>& cpus );
+   static inline void setSpinTime( size_t microseconds );
    //@}
    //**********************************************************************************************
 
@@ -100,6 +147,15 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void schedule( OP op );
+
+   template< typename Target, typename Source, typename OP >
+   static inline void schedule( threadpool::TaskGroup& group, Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void schedule( threadpool::TaskGroup& group, OP op );
    //@}
    //**********************************************************************************************
 
@@ -153,6 +209,11 @@ class ThreadBackend
    /*!\name Initialization functions */
    //@{
    static inline size_t initPool();
+   static inline std::vector<size_t> initAffinity();
+   static inline size_t              initSpinTime();
+
+   static inline std::vector<size_t> nodeCPUs  ( size_t node );
+   static inline std::vector<size_t> selectCPUs( AffinityPolicy policy, std::vector<size_t> cpus );
    //@}
    //**********************************************************************************************
 
@@ -183,7 +244,8 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT>
+   ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initAffinity(), initSpinTime() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -262,6 +324,164 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed. In contrast
+// to the wait() function for all scheduled tasks it does not wait for the tasks of any other
+// operation, as for instance the tasks of a concurrently running asynchronous assignment.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::wait( const threadpool::TaskGroup& group )
+{
+   threadpool_.wait( group );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads of the thread backend system are pinned to.
+//
+// \return The CPUs the threads are pinned to (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::affinity()
+{
+   return threadpool_.affinity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spin time of the idle and waiting threads of the thread backend system.
+//
+// \return The spin time in microseconds.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::spinTime()
+{
+   return threadpool_.spinTime();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads of the thread backend system according to the given policy.
+//
+// \param policy The affinity policy.
+// \return void
+//
+// This function pins the threads of the thread backend system to the CPUs available to the
+// process according to the given affinity policy (see the AffinityPolicy enumeration).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( AffinityPolicy policy )
+{
+   threadpool_.setAffinity( selectCPUs( policy, threadpool::availableCPUs() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads of the thread backend system to the CPUs of a NUMA node.
+//
+// \param policy The affinity policy.
+// \param node The index of the NUMA node.
+// \return void
+// \exception std::invalid_argument Invalid NUMA node.
+//
+// This function pins the threads of the thread backend system to the CPUs of the given NUMA
+// node according to the given affinity policy (see the AffinityPolicy enumeration). In case
+// the given node does not exist or none of its CPUs is available to the process, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( AffinityPolicy policy, size_t node )
+{
+   const std::vector<size_t> cpus( nodeCPUs( node ) );
+
+   if( cpus.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid NUMA node" );
+   }
+
+   threadpool_.setAffinity( selectCPUs( policy, cpus ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the threads of the thread backend system to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// This function pins the thread with index \a i to the CPU <tt>cpus[i % cpus.size()]</tt>. In
+// case \a cpus is empty, the threads are allowed to run on all available CPUs again.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   threadpool_.setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the spin time of the idle and waiting threads of the thread backend system.
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function sets the time idle threads busy wait for new tasks and the time the wait()
+// function busy waits for the completion of all tasks before they block. A spin time of 0
+// disables spinning.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setSpinTime( size_t microseconds )
+{
+   threadpool_.setSpinTime( microseconds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -297,6 +517,84 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given operation for execution.
+//
+// \param op The operation to be executed.
+// \return void
+//
+// This function schedules the given operation for execution. The operation \a op has to
+// provide a function call operator of the form <tt>void operator()()</tt>.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( OP op )
+{
+   threadpool_.schedule( op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an assignment of the given operands as part of the given task group.
+//
+// \param group The task group of the assignment.
+// \param target The target operand to be assigned to.
+// \param source The source operand to be assigned to the target.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function schedules a (compound) assignment of the two given operands for execution and
+// registers it with the given task group (see wait()).
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Target  // Type of the target operand
+        , typename Source  // Type of the source operand
+        , typename OP >    // Type of the assignment operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( threadpool::TaskGroup& group, Target& target,
+                                                  const Source& source, OP op )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   threadpool_.schedule( group, Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given operation as part of the given task group.
+//
+// \param group The task group of the operation.
+// \param op The operation to be executed.
+// \return void
+//
+// This function schedules the given operation for execution and registers it with the given
+// task group (see wait()). The operation \a op has to provide a function call operator of the
+// form <tt>void operator()()</tt>.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+template< typename OP >  // Type of the operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( threadpool::TaskGroup& group, OP op )
+{
+   threadpool_.schedule( group, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -338,6 +636,151 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial CPUs the threads of the thread pool are pinned to.
+//
+// \return The initial CPUs (empty in case the threads are not pinned).
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// and \c BLAZE_NUMA_NODE environment variables. In case the environment variables are not
+// defined, not set, or invalid, the function returns an empty vector.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr )
+      return std::vector<size_t>();
+
+   const std::string setting( env );
+
+   AffinityPolicy policy( noAffinity );
+
+   if( setting == "compact" )
+      policy = compactAffinity;
+   else if( setting == "scatter" )
+      policy = scatterAffinity;
+   else if( setting != "none" ) {
+      try {
+         return threadpool::parseCPUList( setting );
+      }
+      catch( std::invalid_argument& ) {
+         return std::vector<size_t>();
+      }
+   }
+
+   const char* node = std::getenv( "BLAZE_NUMA_NODE" );
+
+   if( node == nullptr )
+      return selectCPUs( policy, threadpool::availableCPUs() );
+   else return selectCPUs( policy, nodeCPUs( max( 0, atoi( node ) ) ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial spin time of the idle and waiting threads of the thread pool.
+//
+// \return The initial spin time in microseconds.
+//
+// This function determines the initial spin time based on the \c BLAZE_SPIN_TIME environment
+// variable. In case the environment variable is not defined, not set, or invalid, the function
+// returns \c defaultSpinTime. Otherwise it returns the specified number of microseconds.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::initSpinTime()
+{
+   const char* env = std::getenv( "BLAZE_SPIN_TIME" );
+
+   if( env == nullptr || *env == '\0' )
+      return defaultSpinTime;
+
+   char* end( nullptr );
+   const long spin( std::strtol( env, &end, 10 ) );
+
+   if( *end != '\0' || spin < 0L )
+      return defaultSpinTime;
+   else return static_cast<size_t>( spin );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs of the given NUMA node that are available to the process.
+//
+// \param node The index of the NUMA node.
+// \return The available CPUs of the NUMA node (empty in case there are none).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::nodeCPUs( size_t node )
+{
+   const std::vector<size_t> available( threadpool::availableCPUs() );
+   const std::vector<size_t> cpus( threadpool::nodeCPUs( node ) );
+
+   std::vector<size_t> result;
+   std::set_intersection( available.begin(), available.end(), cpus.begin(), cpus.end(),
+                          std::back_inserter( result ) );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orders the given CPUs according to the given affinity policy.
+//
+// \param policy The affinity policy.
+// \param cpus The CPUs to be ordered.
+// \return The ordered CPUs (empty in case of the \c noAffinity policy).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t>
+   ThreadBackend<TT,MT,LT,CT>::selectCPUs( AffinityPolicy policy, std::vector<size_t> cpus )
+{
+   switch( policy ) {
+      case compactAffinity: return threadpool::compactOrder( std::move( cpus ) );
+      case scatterAffinity: return threadpool::scatterOrder( std::move( cpus ) );
+      default             : return std::vector<size_t>();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
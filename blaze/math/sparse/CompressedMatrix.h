@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -51,8 +53,13 @@
 #include <blaze/math/Forward.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -67,7 +74,9 @@
 #include <blaze/math/traits/SubmatrixTrait.h>
 #include <blaze/math/traits/SubTrait.h>
 #include <blaze/math/traits/UnaryMapTrait.h>
+#include <blaze/math/typetraits/HasSIMDCountNonZeros.h>
 #include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsShrinkable.h>
@@ -76,6 +85,7 @@
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -93,9 +103,11 @@
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Not.h>
+#include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -377,15 +389,15 @@ class CompressedMatrix
    /*!\name Data access functions */
    //@{
    inline Reference      operator()( size_t i, size_t j ) noexcept;
-   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const;
    inline Reference      at( size_t i, size_t j );
    inline ConstReference at( size_t i, size_t j ) const;
-   inline Iterator       begin ( size_t i ) noexcept;
-   inline ConstIterator  begin ( size_t i ) const noexcept;
-   inline ConstIterator  cbegin( size_t i ) const noexcept;
-   inline Iterator       end   ( size_t i ) noexcept;
-   inline ConstIterator  end   ( size_t i ) const noexcept;
-   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
    //@}
    //**********************************************************************************************
 
@@ -434,6 +446,9 @@ class CompressedMatrix
    inline Iterator insert  ( size_t i, size_t j, const Type& value );
    inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void     finalize( size_t i );
+   inline void     bufferedInsert( size_t i, size_t j, const Type& value );
+   inline void     flush() const;
+   inline bool     isFlushed() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -494,6 +509,19 @@ class CompressedMatrix
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT, bool SO2 >
+   struct VectorizedConversion {
+      enum : bool { value = useOptimizedKernels && SO2 == SO && MT::simdEnabled &&
+                            IsSame< Type, ElementType_<MT> >::value &&
+                            HasSIMDCountNonZeros<Type>::value &&
+                            !IsUpper<MT>::value && !IsLower<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
@@ -507,6 +535,27 @@ class CompressedMatrix
    inline size_t extendCapacity() const noexcept;
           void   reserveElements( size_t nonzeros );
 
+   template< typename MT > void transposeAssign( const MT& rhs, size_t blocks );
+
+   template< typename MT, bool SO2 >
+   inline DisableIf_< VectorizedConversion<MT,SO2>, size_t >
+      countDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i ) const;
+
+   template< typename MT, bool SO2 >
+   inline EnableIf_< VectorizedConversion<MT,SO2>, size_t >
+      countDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i ) const;
+
+   template< typename MT, bool SO2 >
+   inline DisableIf_< VectorizedConversion<MT,SO2> >
+      assignDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i );
+
+   template< typename MT, bool SO2 >
+   inline EnableIf_< VectorizedConversion<MT,SO2> >
+      assignDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i );
+
+   template< typename MT, bool SO2 >
+   void assignDenseComputation( const DenseMatrix<MT,SO2>& rhs, bool parallel );
+
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
    //@}
@@ -516,9 +565,19 @@ class CompressedMatrix
    /*!\name Insertion functions */
    //@{
    Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+   void     mergeBuffer() const;
    //@}
    //**********************************************************************************************
 
+   //**Type definitions****************************************************************************
+   //! States of the buffer of pending insertions.
+   enum BufferState : int {
+      flushed  = 0,  //!< No pending insertions.
+      buffered = 1,  //!< Pending insertions that have not been merged yet.
+      merging  = 2   //!< Pending insertions that are currently merged by a constant access.
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -528,6 +587,9 @@ class CompressedMatrix
    Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
 
+   mutable std::vector< std::pair<size_t,ElementBase> > buffer_;  //!< Buffer of pending insertions.
+   mutable std::atomic<BufferState> state_{ flushed };          //!< The state of the insertion buffer.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -705,11 +767,15 @@ template< typename Type  // Data type of the matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
-   const size_t nonzeros( sm.nonZeros() );
+   sm.flush();
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += sm.end_[i] - sm.begin_[i];
 
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=0UL; i<m_; ++i ) {
-      end_[i] = castDown( std::copy( sm.begin(i), sm.end(i), castUp( begin_[i] ) ) );
+      end_[i] = castDown( std::copy( sm.begin_[i], sm.end_[i], castUp( begin_[i] ) ) );
       begin_[i+1UL] = end_[i];
    }
    end_[m_] = begin_[0UL]+nonzeros;
@@ -725,12 +791,16 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
-   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
-   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
-   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each row
-   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each row
+   : m_       ( sm.m_ )                    // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                    // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )             // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )                // Pointers to the first non-zero element of each row
+   , end_     ( sm.end_ )                  // Pointers one past the last non-zero element of each row
+   , buffer_  ( std::move( sm.buffer_ ) )  // Buffer of pending insertions
+   , state_   ( sm.state_.load() )         // The state of the insertion buffer
 {
+   sm.state_ = flushed;
+
    sm.m_        = 0UL;
    sm.n_        = 0UL;
    sm.capacity_ = 0UL;
@@ -868,7 +938,7 @@ inline typename CompressedMatrix<Type,SO>::Reference
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -953,9 +1023,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) noexcept
+   CompressedMatrix<Type,SO>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return begin_[i];
 }
 //*************************************************************************************************
@@ -975,9 +1046,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+   CompressedMatrix<Type,SO>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return begin_[i];
 }
 //*************************************************************************************************
@@ -997,9 +1069,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+   CompressedMatrix<Type,SO>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return begin_[i];
 }
 //*************************************************************************************************
@@ -1019,9 +1092,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i ) noexcept
+   CompressedMatrix<Type,SO>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return end_[i];
 }
 //*************************************************************************************************
@@ -1041,9 +1115,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+   CompressedMatrix<Type,SO>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return end_[i];
 }
 //*************************************************************************************************
@@ -1063,9 +1138,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+   CompressedMatrix<Type,SO>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
+   flush();
    return end_[i];
 }
 //*************************************************************************************************
@@ -1149,7 +1225,14 @@ inline CompressedMatrix<Type,SO>&
 
    if( &rhs == this ) return *this;
 
-   const size_t nonzeros( rhs.nonZeros() );
+   rhs.flush();
+
+   buffer_.clear();
+   state_ = flushed;
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<rhs.m_; ++i )
+      nonzeros += rhs.end_[i] - rhs.begin_[i];
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
    {
@@ -1208,6 +1291,11 @@ inline CompressedMatrix<Type,SO>&
    capacity_ = rhs.capacity_;
    begin_    = rhs.begin_;
    end_      = rhs.end_;
+   buffer_   = std::move( rhs.buffer_ );
+   state_    = rhs.state_.load();
+
+   rhs.buffer_.clear();
+   rhs.state_ = flushed;
 
    rhs.m_        = 0UL;
    rhs.n_        = 0UL;
@@ -1520,6 +1608,7 @@ template< typename Type  // Data type of the matrix
 inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   flush();
    return end_[i] - begin_[i];
 }
 //*************************************************************************************************
@@ -1534,6 +1623,9 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::reset()
 {
+   buffer_.clear();
+   state_ = flushed;
+
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
 }
@@ -1556,6 +1648,7 @@ template< typename Type  // Data type of the matrix
 inline void CompressedMatrix<Type,SO>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   flush();
    end_[i] = begin_[i];
 }
 //*************************************************************************************************
@@ -1572,6 +1665,9 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::clear()
 {
+   buffer_.clear();
+   state_ = flushed;
+
    if( end_ != nullptr )
       end_[0UL] = end_[m_];
    m_ = 0UL;
@@ -1601,6 +1697,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
+   flush();
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -1696,6 +1794,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 {
+   flush();
+
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
 }
@@ -1722,6 +1822,8 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 {
    using std::swap;
 
+   flush();
+
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
@@ -1815,6 +1917,8 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
+   flush();
+
    if( i < ( m_ - 1UL ) )
       end_[i+1] = castDown( std::move( begin_[i+1], end_[i+1], castUp( end_[i] ) ) );
    begin_[i+1] = end_[i];
@@ -1859,6 +1963,11 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
    swap( capacity_, sm.capacity_ );
    swap( begin_, sm.begin_ );
    swap( end_  , sm.end_   );
+   swap( buffer_, sm.buffer_ );
+
+   const BufferState state( state_.load() );
+   state_ = sm.state_.load();
+   sm.state_ = state;
 }
 //*************************************************************************************************
 
@@ -2164,6 +2273,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
 {
+   flush();
+
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
    BLAZE_USER_ASSERT( end_[i] < end_[m_], "Not enough reserved capacity left" );
@@ -2198,6 +2309,8 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
+   flush();
+
    begin_[i+1UL] = end_[i];
    if( i != m_-1UL )
       end_[i+1UL] = end_[i];
@@ -2205,6 +2318,258 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Buffered insertion of an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return void
+//
+// This function provides an efficient way to insert elements in random order into a compressed
+// matrix. In contrast to the insert() function, which has to shift all subsequent elements and
+// therefore has a linear complexity per insertion, the new element is only recorded in an
+// internal buffer. All buffered elements are merged into the matrix in a single sorted pass by
+// an explicit call to the flush() function or by the next access to the elements of the matrix
+// (as for instance via the function call operator, begin() and end(), find(), nonZeros(), or as
+// operand of an expression). In case the matrix already contains an element at position
+// \f$(i,j)\f$, its value is replaced. In case several values are inserted at the same position,
+// the value of the last insertion is used.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+
+   for( const Edge& edge : edges ) {
+      A.bufferedInsert( edge.from, edge.to, edge.weight );  // Amortized constant time insertion
+   }
+
+   A.flush();  // Merging all buffered elements into the matrix
+   \endcode
+
+// \note The merge is also performed on read access via a constant matrix. In case several threads
+// read the matrix at the same time (as for instance in an SMP assignment), the first access
+// performs the merge and all other threads wait until it is complete. Calling flush() before
+// the matrix is shared between threads avoids this delay. Also note that the merge invalidates
+// all iterators to elements of the matrix!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::bufferedInsert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   buffer_.emplace_back( i, ElementBase( value, j ) );
+   state_.store( buffered, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merging all buffered insertions into the compressed matrix.
+//
+// \return void
+//
+// This function merges all elements inserted via the bufferedInsert() function into the
+// compressed matrix. In case there are no buffered elements, the function has no effect. Since
+// the merge doesn't change the value of the matrix, the function can also be called on constant
+// matrices. It is safe to call the function from several threads at the same time: The first
+// thread performs the merge, all other threads wait until the merge is complete.
+//
+// \note The merge invalidates all iterators to elements of the matrix!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrix<Type,SO>::flush() const
+{
+   BufferState state( state_.load( std::memory_order_acquire ) );
+
+   while( state != flushed )
+   {
+      if( state == buffered &&
+          state_.compare_exchange_weak( state, merging, std::memory_order_acquire ) ) {
+         mergeBuffer();
+         state_.store( flushed, std::memory_order_release );
+         return;
+      }
+
+      std::this_thread::yield();
+      state = state_.load( std::memory_order_acquire );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the compressed matrix has no pending buffered insertions.
+//
+// \return \a true in case there are no pending buffered insertions, \a false if not.
+//
+// This function returns whether all elements inserted via the bufferedInsert() function have
+// been merged into the compressed matrix, i.e. whether the next access to the elements of the
+// matrix can be performed without a merge.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompressedMatrix<Type,SO>::isFlushed() const noexcept
+{
+   return state_.load( std::memory_order_acquire ) == flushed;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merging the buffered insertions into the compressed matrix.
+//
+// \return void
+//
+// This function merges all buffered insertions into the compressed matrix in a single sorted
+// pass. In case all affected rows provide enough capacity, the elements are merged in-place,
+// else all rows are merged into a newly allocated storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::mergeBuffer() const
+{
+   using Pending = std::pair<size_t,ElementBase>;
+
+   BLAZE_INTERNAL_ASSERT( !buffer_.empty(), "Empty insertion buffer detected" );
+
+   std::stable_sort( buffer_.begin(), buffer_.end(), []( const Pending& a, const Pending& b )
+   {
+      return ( a.first < b.first ) ||
+             ( a.first == b.first && a.second.index() < b.second.index() );
+   } );
+
+   // Removing duplicate insertions (the value of the last insertion is kept)
+   auto last( buffer_.begin() );
+   for( auto element=buffer_.begin()+1UL; element!=buffer_.end(); ++element ) {
+      if( element->first == last->first && element->second.index() == last->second.index() )
+         last->second.value() = std::move( element->second.value() );
+      else
+         *(++last) = std::move( *element );
+   }
+   buffer_.erase( ++last, buffer_.end() );
+
+   // Counting the number of new elements per row
+   std::vector<size_t> added;
+   size_t total( 0UL );
+   bool inplace( true );
+
+   for( auto run=buffer_.begin(); run!=buffer_.end(); )
+   {
+      const size_t i( run->first );
+      Iterator element( begin_[i] );
+      size_t count( 0UL );
+
+      for( ; run!=buffer_.end() && run->first == i; ++run ) {
+         element = std::lower_bound( element, end_[i], run->second.index(),
+                                     []( const Element& e, size_t index ) { return e.index_ < index; } );
+         if( element == end_[i] || element->index_ != run->second.index() )
+            ++count;
+      }
+
+      if( count > size_t( begin_[i+1UL] - end_[i] ) )
+         inplace = false;
+
+      added.push_back( count );
+      total += count;
+   }
+
+   // Merging the buffered elements in-place (from back to front within each row)
+   if( inplace )
+   {
+      auto count( added.begin() );
+
+      for( auto first=buffer_.begin(); first!=buffer_.end(); ++count )
+      {
+         const size_t i( first->first );
+         auto next( first );
+         while( next != buffer_.end() && next->first == i ) ++next;
+
+         Iterator src( end_[i] );
+         Iterator dst( end_[i] + *count );
+
+         for( auto pending=next; pending!=first; )
+         {
+            const size_t index( ( pending-1 )->second.index() );
+            --dst;
+
+            if( src != begin_[i] && ( src-1 )->index_ > index ) {
+               --src;
+               dst->value_ = std::move( src->value_ );
+               dst->index_ = src->index_;
+            }
+            else {
+               --pending;
+               if( src != begin_[i] && ( src-1 )->index_ == index )
+                  --src;
+               dst->value_ = std::move( pending->second.value() );
+               dst->index_ = index;
+            }
+         }
+
+         end_[i] += *count;
+         first = next;
+      }
+   }
+
+   // Merging all rows and the buffered elements into a new storage
+   else
+   {
+      size_t nonzeros( total );
+      for( size_t i=0UL; i<m_; ++i )
+         nonzeros += end_[i] - begin_[i];
+
+      const size_t newCapacity( max( nonzeros, capacity() ) );
+      const Iterator storage( allocate<Element>( newCapacity ) );
+      const Iterator old( begin_[0UL] );
+
+      Iterator dst( storage );
+      auto run( buffer_.begin() );
+
+      for( size_t i=0UL; i<m_; ++i )
+      {
+         Iterator src( begin_[i] );
+         const Iterator srcEnd( end_[i] );
+
+         begin_[i] = dst;
+
+         for( ; run!=buffer_.end() && run->first == i; ++run, ++dst )
+         {
+            const size_t index( run->second.index() );
+
+            for( ; src!=srcEnd && src->index_ < index; ++src, ++dst ) {
+               dst->value_ = std::move( src->value_ );
+               dst->index_ = src->index_;
+            }
+
+            if( src != srcEnd && src->index_ == index )
+               ++src;
+
+            dst->value_ = std::move( run->second.value() );
+            dst->index_ = index;
+         }
+
+         for( ; src!=srcEnd; ++src, ++dst ) {
+            dst->value_ = std::move( src->value_ );
+            dst->index_ = src->index_;
+         }
+
+         end_[i] = dst;
+      }
+
+      begin_[m_] = dst;
+      end_[m_] = end_[capacity_] = storage + newCapacity;
+
+      deallocate( old );
+   }
+
+   buffer_.clear();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2319,6 +2684,8 @@ template< typename Type    // Data type of the matrix
 template< typename Pred >  // Type of the unary predicate
 inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
 {
+   flush();
+
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::remove_if( castUp( begin_[i] ), castUp( end_[i] ),
                                           [predicate=predicate]( const ElementBase& element) {
@@ -2404,6 +2771,7 @@ template< typename Type  // Data type of the matrix
 inline typename CompressedMatrix<Type,SO>::Iterator
    CompressedMatrix<Type,SO>::find( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
 //*************************************************************************************************
@@ -2457,6 +2825,7 @@ template< typename Type  // Data type of the matrix
 inline typename CompressedMatrix<Type,SO>::Iterator
    CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
 //*************************************************************************************************
@@ -2483,6 +2852,7 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
    CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   flush();
    return std::lower_bound( begin_[i], end_[i], j,
                             []( const Element& element, size_t index )
                             {
@@ -2512,6 +2882,7 @@ template< typename Type  // Data type of the matrix
 inline typename CompressedMatrix<Type,SO>::Iterator
    CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
 //*************************************************************************************************
@@ -2538,6 +2909,7 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
    CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   flush();
    return std::upper_bound( begin_[i], end_[i], j,
                             []( size_t index, const Element& element )
                             {
@@ -2609,6 +2981,8 @@ template< typename Type     // Data type of the matrix
 template< typename Other >  // Data type of the scalar value
 inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
 {
+   flush();
+
    for( size_t i=0UL; i<m_; ++i )
       for( Iterator element=begin_[i]; element!=end_[i]; ++element )
          element->value_ *= scalar;
@@ -2686,7 +3060,7 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the assignment of a row-major dense matrix.
+/*!\brief Default implementation of the assignment of a dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be assigned.
 // \return void
@@ -2695,6 +3069,13 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
+//
+// The assignment is performed in two passes: the first pass counts the number of non-zero
+// elements in every row of \a rhs, the second pass copies the non-zero elements into the
+// exactly sized rows of the compressed matrix. Both passes work on independent rows and are
+// executed in parallel in case the number of elements of \a rhs reaches the according SMP
+// threshold. Since the elements of a dense matrix computation would be evaluated in both
+// passes, computations are instead evaluated once by means of assignDenseComputation().
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -2708,158 +3089,529 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
    if( m_ == 0UL || n_ == 0UL )
       return;
 
-   size_t nonzeros( 0UL );
+   const bool parallel( m_*n_ >= SMP_DMATSMATCONVERT_THRESHOLD );
 
-   for( size_t i=1UL; i<=m_; ++i )
-      begin_[i] = end_[i] = end_[m_];
+   if( IsComputation<MT>::value ) {
+      assignDenseComputation( ~rhs, parallel );
+      return;
+   }
 
-   for( size_t i=0UL; i<m_; ++i )
+   // Counting the number of non-zero elements per row
+   std::vector<size_t> offsets( m_+1UL, 0UL );
+
+   const auto count = [&]( size_t first, size_t last )
    {
-      begin_[i] = end_[i] = begin_[0UL]+nonzeros;
+      for( size_t i=first; i<last; ++i ) {
+         offsets[i+1UL] = countDenseElements( ~rhs, i );
+      }
+   };
 
-      const size_t jbegin( ( IsUpper<MT>::value )
-                           ?( IsStrictlyUpper<MT>::value ? i+1UL : i )
-                           :( 0UL ) );
-      const size_t jend  ( ( IsLower<MT>::value )
-                           ?( IsStrictlyLower<MT>::value ? i : i+1UL )
-                           :( n_ ) );
+   if( parallel )
+      smpFor( 0UL, m_, count );
+   else
+      count( 0UL, m_ );
 
-      for( size_t j=jbegin; j<jend; ++j )
-      {
-         if( nonzeros == capacity() ) {
-            reserveElements( extendCapacity() );
-            for( size_t k=i+1UL; k<=m_; ++k )
-               begin_[k] = end_[k] = end_[m_];
-         }
+   for( size_t i=0UL; i<m_; ++i ) {
+      offsets[i+1UL] += offsets[i];
+   }
 
-         end_[i]->value_ = (~rhs)(i,j);
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i] = begin_[0UL];
+   }
 
-         if( !isDefault<strict>( end_[i]->value_ ) ) {
-            end_[i]->index_ = j;
-            ++end_[i];
-            ++nonzeros;
-         }
-      }
+   if( offsets[m_] > capacity() ) {
+      reserveElements( offsets[m_] );
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i];
+      begin_[i+1UL] = begin_[0UL] + offsets[i+1UL];
    }
 
-   begin_[m_] = begin_[0UL]+nonzeros;
+   // Copying the non-zero elements into the rows of the compressed matrix
+   const auto fill = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i ) {
+         assignDenseElements( ~rhs, i );
+         BLAZE_INTERNAL_ASSERT( end_[i] == begin_[i+1UL], "Invalid number of elements detected" );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m_, fill );
+   else
+      fill( 0UL, m_ );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the assignment of a row-major compressed matrix.
-//
-// \param rhs The right-hand side compressed matrix to be assigned.
-// \return void
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the number of non-zero elements in a single row of a dense matrix.
 //
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// \param rhs The right-hand side dense matrix.
+// \param i The index of the row.
+// \return The number of non-zero elements in row \a i of \a rhs.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename CompressedMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedConversion<MT,SO2>, size_t >
+   CompressedMatrix<Type,SO>::countDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i ) const
 {
-   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
-   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
-   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+   const size_t jbegin( ( IsUpper<MT>::value )
+                        ?( IsStrictlyUpper<MT>::value ? i+1UL : i )
+                        :( 0UL ) );
+   const size_t jend  ( ( IsLower<MT>::value )
+                        ?( IsStrictlyLower<MT>::value ? i : i+1UL )
+                        :( n_ ) );
 
-   if( m_ == 0UL || begin_[0] == nullptr )
-      return;
+   size_t nonzeros( 0UL );
 
-   for( size_t i=0UL; i<m_; ++i ) {
-      end_[i] = castDown( std::copy( (~rhs).begin(i), (~rhs).end(i), castUp( begin_[i] ) ) );
-      begin_[i+1UL] = end_[i];
+   for( size_t j=jbegin; j<jend; ++j ) {
+      const Type value( (~rhs)(i,j) );
+      if( !isDefault<strict>( value ) )
+         ++nonzeros;
    }
+
+   return nonzeros;
 }
+/*! \endcond */
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the assignment of a column-major compressed matrix.
-//
-// \param rhs The right-hand side compressed matrix to be assigned.
-// \return void
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized counting of the non-zero elements in a single row of a dense matrix.
 //
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// \param rhs The right-hand side dense matrix.
+// \param i The index of the row.
+// \return The number of non-zero elements in row \a i of \a rhs.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
-template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline EnableIf_< typename CompressedMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedConversion<MT,SO2>, size_t >
+   CompressedMatrix<Type,SO>::countDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i ) const
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
 
-   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
-   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
-   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+   const size_t jpos( n_ & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
 
-   using RhsIterator = ConstIterator_<MT>;
+   size_t nonzeros( 0UL );
+   size_t j( 0UL );
 
-   // Counting the number of elements per row
-   std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      nonzeros += countNonZeros( (~rhs).load(i,j) );
    }
-
-   // Resizing the compressed matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+   for( ; j<n_; ++j ) {
+      if( !isDefault<strict>( (~rhs)(i,j) ) )
+         ++nonzeros;
    }
 
-   // Appending the elements to the rows of the compressed matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
-   }
+   return nonzeros;
 }
+/*! \endcond */
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the addition assignment of a dense matrix.
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the non-zero elements of a single row of a dense matrix.
 //
-// \param rhs The right-hand side dense matrix to be added.
+// \param rhs The right-hand side dense matrix.
+// \param i The index of the row.
 // \return void
 //
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// This function appends the non-zero elements of row \a i of \a rhs to the according row of
+// the compressed matrix, which must provide exactly the required capacity.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline DisableIf_< typename CompressedMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedConversion<MT,SO2> >
+   CompressedMatrix<Type,SO>::assignDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i )
 {
-   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   const size_t jbegin( ( IsUpper<MT>::value )
+                        ?( IsStrictlyUpper<MT>::value ? i+1UL : i )
+                        :( 0UL ) );
+   const size_t jend  ( ( IsLower<MT>::value )
+                        ?( IsStrictlyLower<MT>::value ? i : i+1UL )
+                        :( n_ ) );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
-   swap( tmp );
+   for( size_t j=jbegin; j<jend; ++j )
+   {
+      const Type value( (~rhs)(i,j) );
+
+      if( !isDefault<strict>( value ) ) {
+         end_[i]->value_ = value;
+         end_[i]->index_ = j;
+         ++end_[i];
+      }
+   }
 }
+/*! \endcond */
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Default implementation of the addition assignment of a compressed matrix.
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized copy of the non-zero elements of a single row of a dense matrix.
 //
-// \param rhs The right-hand side compressed matrix to be added.
+// \param rhs The right-hand side dense matrix.
+// \param i The index of the row.
 // \return void
 //
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
+// This function appends the non-zero elements of row \a i of \a rhs to the according row of
+// the compressed matrix, which must provide exactly the required capacity. SIMD packs without
+// any non-zero element are skipped entirely.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline EnableIf_< typename CompressedMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedConversion<MT,SO2> >
+   CompressedMatrix<Type,SO>::assignDenseElements( const DenseMatrix<MT,SO2>& rhs, size_t i )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n_ & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE )
+   {
+      if( countNonZeros( (~rhs).load(i,j) ) == 0UL )
+         continue;
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         const Type value( (~rhs)(i,j+k) );
+
+         if( !isDefault<strict>( value ) ) {
+            end_[i]->value_ = value;
+            end_[i]->index_ = j+k;
+            ++end_[i];
+         }
+      }
+   }
+
+   for( ; j<n_; ++j )
+   {
+      const Type value( (~rhs)(i,j) );
+
+      if( !isDefault<strict>( value ) ) {
+         end_[i]->value_ = value;
+         end_[i]->index_ = j;
+         ++end_[i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of a dense matrix computation.
+//
+// \param rhs The right-hand side dense matrix computation.
+// \param parallel \a true in case the assignment is executed in parallel, \a false if not.
+// \return void
+//
+// This function assigns the given dense matrix computation, evaluating each of its elements
+// exactly once. Every block of rows buffers the non-zero elements of its rows, from which
+// the exactly sized rows of the compressed matrix are filled afterwards. Since the rows are
+// stored contiguously, the buffered elements of each block are copied in a single sweep.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+void CompressedMatrix<Type,SO>::assignDenseComputation( const DenseMatrix<MT,SO2>& rhs, bool parallel )
+{
+   // Evaluating the non-zero elements of each block of rows
+   std::vector<size_t> offsets( m_+1UL, 0UL );
+   std::vector< std::vector<ElementBase> > blocks( m_ );
+
+   const auto evaluate = [&]( size_t first, size_t last )
+   {
+      std::vector<ElementBase>& elements( blocks[first] );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         const size_t jbegin( ( IsUpper<MT>::value )
+                              ?( IsStrictlyUpper<MT>::value ? i+1UL : i )
+                              :( 0UL ) );
+         const size_t jend  ( ( IsLower<MT>::value )
+                              ?( IsStrictlyLower<MT>::value ? i : i+1UL )
+                              :( n_ ) );
+
+         const size_t size( elements.size() );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            const Type value( (~rhs)(i,j) );
+            if( !isDefault<strict>( value ) )
+               elements.emplace_back( value, j );
+         }
+
+         offsets[i+1UL] = elements.size() - size;
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m_, evaluate );
+   else
+      evaluate( 0UL, m_ );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      offsets[i+1UL] += offsets[i];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i] = begin_[0UL];
+   }
+
+   if( offsets[m_] > capacity() ) {
+      reserveElements( offsets[m_] );
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i] = begin_[0UL] + offsets[i+1UL];
+   }
+
+   // Copying the buffered elements into the rows of the compressed matrix
+   const auto fill = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i ) {
+         std::copy( blocks[i].begin(), blocks[i].end(), castUp( begin_[i] ) );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m_, fill );
+   else
+      fill( 0UL, m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major compressed matrix.
+//
+// \param rhs The right-hand side compressed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   if( m_ == 0UL || begin_[0] == nullptr )
+      return;
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = castDown( std::copy( (~rhs).begin(i), (~rhs).end(i), castUp( begin_[i] ) ) );
+      begin_[i+1UL] = end_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major compressed matrix.
+//
+// \param rhs The right-hand side compressed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side compressed matrix
+inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t threads( min( getNumThreads(), n_ ) );
+
+   if( threads > 1UL && (~rhs).nonZeros() >= SMP_SMATTRANSPOSE_THRESHOLD &&
+       !isSerialSectionActive() && !isParallelSectionActive() ) {
+      transposeAssign( ~rhs, threads );
+      return;
+   }
+
+   using RhsIterator = ConstIterator_<MT>;
+
+   // Counting the number of elements per row
+   std::vector<size_t> rowLengths( m_, 0UL );
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++rowLengths[element->index()];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+   }
+
+   // Appending the elements to the rows of the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         append( element->index(), j, element->value() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parallel assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side column-major sparse matrix to be assigned.
+// \param blocks The number of column blocks to be processed in parallel.
+// \return void
+//
+// This function assigns the given column-major sparse matrix by means of a parallel counting
+// sort. The columns of \a rhs are split into \a blocks contiguous blocks. In a first parallel
+// pass, every block counts its number of elements per row. The exclusive prefix sums of these
+// histograms (over the blocks of each row and over all rows) determine the position of every
+// element in the compressed matrix, which are filled in a second parallel pass. Since all blocks
+// write to disjoint positions, no synchronization is required and since the blocks are ordered
+// by column index, the elements of each row are sorted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+void CompressedMatrix<Type,SO>::transposeAssign( const MT& rhs, size_t blocks )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL && blocks <= n_, "Invalid number of blocks" );
+
+   const size_t blockSize( ( n_ - 1UL ) / blocks + 1UL );
+
+   // Counting the number of elements per row within each block of columns
+   std::vector<size_t> offsets( blocks*m_, 0UL );
+
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b )
+      {
+         size_t* const counts( offsets.data() + b*m_ );
+         const size_t jend( min( ( b+1UL )*blockSize, n_ ) );
+
+         for( size_t j=b*blockSize; j<jend; ++j ) {
+            for( auto element=rhs.begin(j); element!=rhs.end(j); ++element )
+               ++counts[element->index()];
+         }
+      }
+   } );
+
+   // Computing the row lengths and the offsets of each block within the rows
+   std::vector<size_t> rowLengths( m_ );
+
+   smpFor( 0UL, m_, [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+      {
+         size_t length( 0UL );
+         for( size_t b=0UL; b<blocks; ++b ) {
+            const size_t count( offsets[b*m_+i] );
+            offsets[b*m_+i] = length;
+            length += count;
+         }
+         rowLengths[i] = length;
+      }
+   } );
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+   }
+
+   // Scattering the elements into the rows of the compressed matrix
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b )
+      {
+         size_t* const positions( offsets.data() + b*m_ );
+         const size_t jend( min( ( b+1UL )*blockSize, n_ ) );
+
+         for( size_t j=b*blockSize; j<jend; ++j ) {
+            for( auto element=rhs.begin(j); element!=rhs.end(j); ++element ) {
+               const Iterator pos( begin_[element->index()] + positions[element->index()]++ );
+               pos->value_ = element->value();
+               pos->index_ = j;
+            }
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i+1UL];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a compressed matrix.
+//
+// \param rhs The right-hand side compressed matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
@@ -3140,15 +3892,15 @@ class CompressedMatrix<Type,true>
    /*!\name Data access functions */
    //@{
    inline Reference      operator()( size_t i, size_t j ) noexcept;
-   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const;
    inline Reference      at( size_t i, size_t j );
    inline ConstReference at( size_t i, size_t j ) const;
-   inline Iterator       begin ( size_t j ) noexcept;
-   inline ConstIterator  begin ( size_t j ) const noexcept;
-   inline ConstIterator  cbegin( size_t j ) const noexcept;
-   inline Iterator       end   ( size_t j ) noexcept;
-   inline ConstIterator  end   ( size_t j ) const noexcept;
-   inline ConstIterator  cend  ( size_t j ) const noexcept;
+   inline Iterator       begin ( size_t j );
+   inline ConstIterator  begin ( size_t j ) const;
+   inline ConstIterator  cbegin( size_t j ) const;
+   inline Iterator       end   ( size_t j );
+   inline ConstIterator  end   ( size_t j ) const;
+   inline ConstIterator  cend  ( size_t j ) const;
    //@}
    //**********************************************************************************************
 
@@ -3197,6 +3949,9 @@ class CompressedMatrix<Type,true>
    inline Iterator insert  ( size_t i, size_t j, const Type& value );
    inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void     finalize( size_t j );
+   inline void     bufferedInsert( size_t i, size_t j, const Type& value );
+   inline void     flush() const;
+   inline bool     isFlushed() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -3257,6 +4012,19 @@ class CompressedMatrix<Type,true>
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT, bool SO >
+   struct VectorizedConversion {
+      enum : bool { value = useOptimizedKernels && SO == true && MT::simdEnabled &&
+                            IsSame< Type, ElementType_<MT> >::value &&
+                            HasSIMDCountNonZeros<Type>::value &&
+                            !IsUpper<MT>::value && !IsLower<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
@@ -3270,6 +4038,27 @@ class CompressedMatrix<Type,true>
    inline size_t extendCapacity() const noexcept;
           void   reserveElements( size_t nonzeros );
 
+   template< typename MT > void transposeAssign( const MT& rhs, size_t blocks );
+
+   template< typename MT, bool SO >
+   inline DisableIf_< VectorizedConversion<MT,SO>, size_t >
+      countDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j ) const;
+
+   template< typename MT, bool SO >
+   inline EnableIf_< VectorizedConversion<MT,SO>, size_t >
+      countDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j ) const;
+
+   template< typename MT, bool SO >
+   inline DisableIf_< VectorizedConversion<MT,SO> >
+      assignDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j );
+
+   template< typename MT, bool SO >
+   inline EnableIf_< VectorizedConversion<MT,SO> >
+      assignDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j );
+
+   template< typename MT, bool SO >
+   void assignDenseComputation( const DenseMatrix<MT,SO>& rhs, bool parallel );
+
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
    //@}
@@ -3279,9 +4068,19 @@ class CompressedMatrix<Type,true>
    /*!\name Insertion functions */
    //@{
    Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+   void     mergeBuffer() const;
    //@}
    //**********************************************************************************************
 
+   //**Type definitions****************************************************************************
+   //! States of the buffer of pending insertions.
+   enum BufferState : int {
+      flushed  = 0,  //!< No pending insertions.
+      buffered = 1,  //!< Pending insertions that have not been merged yet.
+      merging  = 2   //!< Pending insertions that are currently merged by a constant access.
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -3291,6 +4090,9 @@ class CompressedMatrix<Type,true>
    Iterator* begin_;  //!< Pointers to the first non-zero element of each column.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each column.
 
+   mutable std::vector< std::pair<size_t,ElementBase> > buffer_;  //!< Buffer of pending insertions.
+   mutable std::atomic<BufferState> state_{ flushed };          //!< The state of the insertion buffer.
+
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
    //**********************************************************************************************
@@ -3478,11 +4280,15 @@ template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
-   const size_t nonzeros( sm.nonZeros() );
+   sm.flush();
+
+   size_t nonzeros( 0UL );
+   for( size_t j=0UL; j<n_; ++j )
+      nonzeros += sm.end_[j] - sm.begin_[j];
 
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=0UL; j<n_; ++j ) {
-      end_[j] = castDown( std::copy( sm.begin(j), sm.end(j), castUp( begin_[j] ) ) );
+      end_[j] = castDown( std::copy( sm.begin_[j], sm.end_[j], castUp( begin_[j] ) ) );
       begin_[j+1UL] = end_[j];
    }
    end_[n_] = begin_[0UL]+nonzeros;
@@ -3499,12 +4305,16 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
-   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
-   , capacity_( sm.capacity_ )  // The current capacity of the pointer array
-   , begin_   ( sm.begin_ )     // Pointers to the first non-zero element of each column
-   , end_     ( sm.end_ )       // Pointers one past the last non-zero element of each column
+   : m_       ( sm.m_ )                    // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                    // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )             // The current capacity of the pointer array
+   , begin_   ( sm.begin_ )                // Pointers to the first non-zero element of each column
+   , end_     ( sm.end_ )                  // Pointers one past the last non-zero element of each column
+   , buffer_  ( std::move( sm.buffer_ ) )  // Buffer of pending insertions
+   , state_   ( sm.state_.load() )         // The state of the insertion buffer
 {
+   sm.state_ = flushed;
+
    sm.m_        = 0UL;
    sm.n_        = 0UL;
    sm.capacity_ = 0UL;
@@ -3648,7 +4458,7 @@ inline typename CompressedMatrix<Type,true>::Reference
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3731,9 +4541,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j ) noexcept
+   CompressedMatrix<Type,true>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return begin_[j];
 }
 /*! \endcond */
@@ -3749,9 +4560,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const noexcept
+   CompressedMatrix<Type,true>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return begin_[j];
 }
 /*! \endcond */
@@ -3767,9 +4579,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const noexcept
+   CompressedMatrix<Type,true>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return begin_[j];
 }
 /*! \endcond */
@@ -3785,9 +4598,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j ) noexcept
+   CompressedMatrix<Type,true>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return end_[j];
 }
 /*! \endcond */
@@ -3803,9 +4617,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const noexcept
+   CompressedMatrix<Type,true>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return end_[j];
 }
 /*! \endcond */
@@ -3821,9 +4636,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 */
 template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const noexcept
+   CompressedMatrix<Type,true>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
+   flush();
    return end_[j];
 }
 /*! \endcond */
@@ -3914,7 +4730,14 @@ inline CompressedMatrix<Type,true>&
 
    if( &rhs == this ) return *this;
 
-   const size_t nonzeros( rhs.nonZeros() );
+   rhs.flush();
+
+   buffer_.clear();
+   state_ = flushed;
+
+   size_t nonzeros( 0UL );
+   for( size_t j=0UL; j<rhs.n_; ++j )
+      nonzeros += rhs.end_[j] - rhs.begin_[j];
 
    if( rhs.n_ > capacity_ || nonzeros > capacity() )
    {
@@ -3974,6 +4797,11 @@ inline CompressedMatrix<Type,true>&
    capacity_ = rhs.capacity_;
    begin_    = rhs.begin_;
    end_      = rhs.end_;
+   buffer_   = std::move( rhs.buffer_ );
+   state_    = rhs.state_.load();
+
+   rhs.buffer_.clear();
+   rhs.state_ = flushed;
 
    rhs.m_        = 0UL;
    rhs.n_        = 0UL;
@@ -4287,6 +5115,7 @@ template< typename Type >  // Data type of the matrix
 inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   flush();
    return end_[j] - begin_[j];
 }
 /*! \endcond */
@@ -4302,6 +5131,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 template< typename Type >  // Data type of the matrix
 inline void CompressedMatrix<Type,true>::reset()
 {
+   buffer_.clear();
+   state_ = flushed;
+
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
 }
@@ -4323,6 +5155,7 @@ template< typename Type >  // Data type of the matrix
 inline void CompressedMatrix<Type,true>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   flush();
    end_[j] = begin_[j];
 }
 /*! \endcond */
@@ -4340,6 +5173,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 template< typename Type >  // Data type of the matrix
 inline void CompressedMatrix<Type,true>::clear()
 {
+   buffer_.clear();
+   state_ = flushed;
+
    if( end_ != nullptr )
       end_[0UL] = end_[n_];
    m_ = 0UL;
@@ -4370,6 +5206,8 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
+   flush();
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -4466,6 +5304,8 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 template< typename Type >  // Data type of the matrix
 inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 {
+   flush();
+
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
 }
@@ -4490,6 +5330,8 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 {
    using std::swap;
 
+   flush();
+
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
@@ -4583,6 +5425,8 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
+   flush();
+
    if( j < ( n_ - 1UL ) )
       end_[j+1] = castDown( std::move( begin_[j+1], end_[j+1], castUp( end_[j] ) ) );
    begin_[j+1] = end_[j];
@@ -4629,6 +5473,11 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
    swap( capacity_, sm.capacity_ );
    swap( begin_, sm.begin_ );
    swap( end_  , sm.end_   );
+   swap( buffer_, sm.buffer_ );
+
+   const BufferState state( state_.load() );
+   state_ = sm.state_.load();
+   sm.state_ = state;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4937,6 +5786,8 @@ typename CompressedMatrix<Type,true>::Iterator
 template< typename Type >  // Data type of the matrix
 inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
 {
+   flush();
+
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
    BLAZE_USER_ASSERT( end_[j] < end_[n_], "Not enough reserved capacity left" );
@@ -4972,6 +5823,8 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
 
+   flush();
+
    begin_[j+1UL] = end_[j];
    if( j != n_-1UL )
       end_[j+1UL] = end_[j];
@@ -4980,6 +5833,262 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Buffered insertion of an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return void
+//
+// This function provides an efficient way to insert elements in random order into a compressed
+// matrix. In contrast to the insert() function, which has to shift all subsequent elements and
+// therefore has a linear complexity per insertion, the new element is only recorded in an
+// internal buffer. All buffered elements are merged into the matrix in a single sorted pass by
+// an explicit call to the flush() function or by the next access to the elements of the matrix
+// (as for instance via the function call operator, begin() and end(), find(), nonZeros(), or as
+// operand of an expression). In case the matrix already contains an element at position
+// \f$(i,j)\f$, its value is replaced. In case several values are inserted at the same position,
+// the value of the last insertion is used.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::columnMajor> A( 1000UL, 1000UL );
+
+   for( const Edge& edge : edges ) {
+      A.bufferedInsert( edge.from, edge.to, edge.weight );  // Amortized constant time insertion
+   }
+
+   A.flush();  // Merging all buffered elements into the matrix
+   \endcode
+
+// \note The merge is also performed on read access via a constant matrix. In case several threads
+// read the matrix at the same time (as for instance in an SMP assignment), the first access
+// performs the merge and all other threads wait until it is complete. Calling flush() before
+// the matrix is shared between threads avoids this delay. Also note that the merge invalidates
+// all iterators to elements of the matrix!
+*/
+template< typename Type >  // Data type of the matrix
+inline void CompressedMatrix<Type,true>::bufferedInsert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   buffer_.emplace_back( j, ElementBase( value, i ) );
+   state_.store( buffered, std::memory_order_relaxed );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merging all buffered insertions into the compressed matrix.
+//
+// \return void
+//
+// This function merges all elements inserted via the bufferedInsert() function into the
+// compressed matrix. In case there are no buffered elements, the function has no effect. Since
+// the merge doesn't change the value of the matrix, the function can also be called on constant
+// matrices. It is safe to call the function from several threads at the same time: The first
+// thread performs the merge, all other threads wait until the merge is complete.
+//
+// \note The merge invalidates all iterators to elements of the matrix!
+*/
+template< typename Type >  // Data type of the matrix
+inline void CompressedMatrix<Type,true>::flush() const
+{
+   BufferState state( state_.load( std::memory_order_acquire ) );
+
+   while( state != flushed )
+   {
+      if( state == buffered &&
+          state_.compare_exchange_weak( state, merging, std::memory_order_acquire ) ) {
+         mergeBuffer();
+         state_.store( flushed, std::memory_order_release );
+         return;
+      }
+
+      std::this_thread::yield();
+      state = state_.load( std::memory_order_acquire );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the compressed matrix has no pending buffered insertions.
+//
+// \return \a true in case there are no pending buffered insertions, \a false if not.
+//
+// This function returns whether all elements inserted via the bufferedInsert() function have
+// been merged into the compressed matrix, i.e. whether the next access to the elements of the
+// matrix can be performed without a merge.
+*/
+template< typename Type >  // Data type of the matrix
+inline bool CompressedMatrix<Type,true>::isFlushed() const noexcept
+{
+   return state_.load( std::memory_order_acquire ) == flushed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merging the buffered insertions into the compressed matrix.
+//
+// \return void
+//
+// This function merges all buffered insertions into the compressed matrix in a single sorted
+// pass. In case all affected columns provide enough capacity, the elements are merged in-place,
+// else all columns are merged into a newly allocated storage.
+*/
+template< typename Type >  // Data type of the matrix
+void CompressedMatrix<Type,true>::mergeBuffer() const
+{
+   using Pending = std::pair<size_t,ElementBase>;
+
+   BLAZE_INTERNAL_ASSERT( !buffer_.empty(), "Empty insertion buffer detected" );
+
+   std::stable_sort( buffer_.begin(), buffer_.end(), []( const Pending& a, const Pending& b )
+   {
+      return ( a.first < b.first ) ||
+             ( a.first == b.first && a.second.index() < b.second.index() );
+   } );
+
+   // Removing duplicate insertions (the value of the last insertion is kept)
+   auto last( buffer_.begin() );
+   for( auto element=buffer_.begin()+1UL; element!=buffer_.end(); ++element ) {
+      if( element->first == last->first && element->second.index() == last->second.index() )
+         last->second.value() = std::move( element->second.value() );
+      else
+         *(++last) = std::move( *element );
+   }
+   buffer_.erase( ++last, buffer_.end() );
+
+   // Counting the number of new elements per column
+   std::vector<size_t> added;
+   size_t total( 0UL );
+   bool inplace( true );
+
+   for( auto run=buffer_.begin(); run!=buffer_.end(); )
+   {
+      const size_t j( run->first );
+      Iterator element( begin_[j] );
+      size_t count( 0UL );
+
+      for( ; run!=buffer_.end() && run->first == j; ++run ) {
+         element = std::lower_bound( element, end_[j], run->second.index(),
+                                     []( const Element& e, size_t index ) { return e.index_ < index; } );
+         if( element == end_[j] || element->index_ != run->second.index() )
+            ++count;
+      }
+
+      if( count > size_t( begin_[j+1UL] - end_[j] ) )
+         inplace = false;
+
+      added.push_back( count );
+      total += count;
+   }
+
+   // Merging the buffered elements in-place (from back to front within each column)
+   if( inplace )
+   {
+      auto count( added.begin() );
+
+      for( auto first=buffer_.begin(); first!=buffer_.end(); ++count )
+      {
+         const size_t j( first->first );
+         auto next( first );
+         while( next != buffer_.end() && next->first == j ) ++next;
+
+         Iterator src( end_[j] );
+         Iterator dst( end_[j] + *count );
+
+         for( auto pending=next; pending!=first; )
+         {
+            const size_t index( ( pending-1 )->second.index() );
+            --dst;
+
+            if( src != begin_[j] && ( src-1 )->index_ > index ) {
+               --src;
+               dst->value_ = std::move( src->value_ );
+               dst->index_ = src->index_;
+            }
+            else {
+               --pending;
+               if( src != begin_[j] && ( src-1 )->index_ == index )
+                  --src;
+               dst->value_ = std::move( pending->second.value() );
+               dst->index_ = index;
+            }
+         }
+
+         end_[j] += *count;
+         first = next;
+      }
+   }
+
+   // Merging all columns and the buffered elements into a new storage
+   else
+   {
+      size_t nonzeros( total );
+      for( size_t j=0UL; j<n_; ++j )
+         nonzeros += end_[j] - begin_[j];
+
+      const size_t newCapacity( max( nonzeros, capacity() ) );
+      const Iterator storage( allocate<Element>( newCapacity ) );
+      const Iterator old( begin_[0UL] );
+
+      Iterator dst( storage );
+      auto run( buffer_.begin() );
+
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         Iterator src( begin_[j] );
+         const Iterator srcEnd( end_[j] );
+
+         begin_[j] = dst;
+
+         for( ; run!=buffer_.end() && run->first == j; ++run, ++dst )
+         {
+            const size_t index( run->second.index() );
+
+            for( ; src!=srcEnd && src->index_ < index; ++src, ++dst ) {
+               dst->value_ = std::move( src->value_ );
+               dst->index_ = src->index_;
+            }
+
+            if( src != srcEnd && src->index_ == index )
+               ++src;
+
+            dst->value_ = std::move( run->second.value() );
+            dst->index_ = index;
+         }
+
+         for( ; src!=srcEnd; ++src, ++dst ) {
+            dst->value_ = std::move( src->value_ );
+            dst->index_ = src->index_;
+         }
+
+         end_[j] = dst;
+      }
+
+      begin_[n_] = dst;
+      end_[n_] = end_[capacity_] = storage + newCapacity;
+
+      deallocate( old );
+   }
+
+   buffer_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -5093,6 +6202,8 @@ template< typename Type >  // Data type of the matrix
 template< typename Pred >  // Type of the unary predicate
 inline void CompressedMatrix<Type,true>::erase( Pred predicate )
 {
+   flush();
+
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::remove_if( castUp( begin_[j] ), castUp( end_[j] ),
                                           [predicate=predicate]( const ElementBase& element ) {
@@ -5176,6 +6287,7 @@ template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::Iterator
    CompressedMatrix<Type,true>::find( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
 /*! \endcond */
@@ -5228,6 +6340,7 @@ template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::Iterator
    CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
 /*! \endcond */
@@ -5253,6 +6366,7 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
    CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   flush();
    return std::lower_bound( begin_[j], end_[j], i,
                             []( const Element& element, size_t index )
                             {
@@ -5281,6 +6395,7 @@ template< typename Type >  // Data type of the matrix
 inline typename CompressedMatrix<Type,true>::Iterator
    CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
 {
+   flush();
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
 /*! \endcond */
@@ -5306,6 +6421,7 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
    CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   flush();
    return std::upper_bound( begin_[j], end_[j], i,
                             []( size_t index, const Element& element )
                             {
@@ -5380,6 +6496,8 @@ template< typename Type >   // Data type of the matrix
 template< typename Other >  // Data type of the scalar value
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
 {
+   flush();
+
    for( size_t j=0UL; j<n_; ++j )
       for( Iterator element=begin_[j]; element!=end_[j]; ++element )
          element->value_ *= scalar;
@@ -5471,6 +6589,13 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
+//
+// The assignment is performed in two passes: the first pass counts the number of non-zero
+// elements in every column of \a rhs, the second pass copies the non-zero elements into the
+// exactly sized columns of the compressed matrix. Both passes work on independent columns and
+// are executed in parallel in case the number of elements of \a rhs reaches the according SMP
+// threshold. Since the elements of a dense matrix computation would be evaluated in both
+// passes, computations are instead evaluated once by means of assignDenseComputation().
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the right-hand side dense matrix
@@ -5483,41 +6608,311 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
    if( m_ == 0UL || n_ == 0UL )
       return;
 
+   const bool parallel( m_*n_ >= SMP_DMATSMATCONVERT_THRESHOLD );
+
+   if( IsComputation<MT>::value ) {
+      assignDenseComputation( ~rhs, parallel );
+      return;
+   }
+
+   // Counting the number of non-zero elements per column
+   std::vector<size_t> offsets( n_+1UL, 0UL );
+
+   const auto count = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         offsets[j+1UL] = countDenseElements( ~rhs, j );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n_, count );
+   else
+      count( 0UL, n_ );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      offsets[j+1UL] += offsets[j];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j] = begin_[0UL];
+   }
+
+   if( offsets[n_] > capacity() ) {
+      reserveElements( offsets[n_] );
+   }
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j];
+      begin_[j+1UL] = begin_[0UL] + offsets[j+1UL];
+   }
+
+   // Copying the non-zero elements into the columns of the compressed matrix
+   const auto fill = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         assignDenseElements( ~rhs, j );
+         BLAZE_INTERNAL_ASSERT( end_[j] == begin_[j+1UL], "Invalid number of elements detected" );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n_, fill );
+   else
+      fill( 0UL, n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the number of non-zero elements in a single column of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix.
+// \param j The index of the column.
+// \return The number of non-zero elements in column \a j of \a rhs.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side dense matrix
+        , bool SO >        // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename CompressedMatrix<Type,true>::BLAZE_TEMPLATE VectorizedConversion<MT,SO>, size_t >
+   CompressedMatrix<Type,true>::countDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j ) const
+{
+   const size_t ibegin( ( IsLower<MT>::value )
+                        ?( IsStrictlyLower<MT>::value ? j+1UL : j )
+                        :( 0UL ) );
+   const size_t iend  ( ( IsUpper<MT>::value )
+                        ?( IsStrictlyUpper<MT>::value ? j : j+1UL )
+                        :( m_ ) );
+
    size_t nonzeros( 0UL );
 
-   for( size_t j=1UL; j<=n_; ++j )
-      begin_[j] = end_[j] = end_[n_];
+   for( size_t i=ibegin; i<iend; ++i ) {
+      const Type value( (~rhs)(i,j) );
+      if( !isDefault<strict>( value ) )
+         ++nonzeros;
+   }
 
-   for( size_t j=0UL; j<n_; ++j )
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized counting of the non-zero elements in a single column of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix.
+// \param j The index of the column.
+// \return The number of non-zero elements in column \a j of \a rhs.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side dense matrix
+        , bool SO >        // Storage order of the right-hand side dense matrix
+inline EnableIf_< typename CompressedMatrix<Type,true>::BLAZE_TEMPLATE VectorizedConversion<MT,SO>, size_t >
+   CompressedMatrix<Type,true>::countDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j ) const
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( m_ & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t nonzeros( 0UL );
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      nonzeros += countNonZeros( (~rhs).load(i,j) );
+   }
+   for( ; i<m_; ++i ) {
+      if( !isDefault<strict>( (~rhs)(i,j) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the non-zero elements of a single column of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix.
+// \param j The index of the column.
+// \return void
+//
+// This function appends the non-zero elements of column \a j of \a rhs to the according column
+// of the compressed matrix, which must provide exactly the required capacity.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side dense matrix
+        , bool SO >        // Storage order of the right-hand side dense matrix
+inline DisableIf_< typename CompressedMatrix<Type,true>::BLAZE_TEMPLATE VectorizedConversion<MT,SO> >
+   CompressedMatrix<Type,true>::assignDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j )
+{
+   const size_t ibegin( ( IsLower<MT>::value )
+                        ?( IsStrictlyLower<MT>::value ? j+1UL : j )
+                        :( 0UL ) );
+   const size_t iend  ( ( IsUpper<MT>::value )
+                        ?( IsStrictlyUpper<MT>::value ? j : j+1UL )
+                        :( m_ ) );
+
+   for( size_t i=ibegin; i<iend; ++i )
    {
-      begin_[j] = end_[j] = begin_[0UL]+nonzeros;
+      const Type value( (~rhs)(i,j) );
+
+      if( !isDefault<strict>( value ) ) {
+         end_[j]->value_ = value;
+         end_[j]->index_ = i;
+         ++end_[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      const size_t ibegin( ( IsLower<MT>::value )
-                           ?( IsStrictlyLower<MT>::value ? j+1UL : j )
-                           :( 0UL ) );
-      const size_t iend  ( ( IsUpper<MT>::value )
-                           ?( IsStrictlyUpper<MT>::value ? j : j+1UL )
-                           :( m_ ) );
 
-      for( size_t i=ibegin; i<iend; ++i )
-      {
-         if( nonzeros == capacity() ) {
-            reserveElements( extendCapacity() );
-            for( size_t k=j+1UL; k<=n_; ++k )
-               begin_[k] = end_[k] = end_[n_];
-         }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized copy of the non-zero elements of a single column of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix.
+// \param j The index of the column.
+// \return void
+//
+// This function appends the non-zero elements of column \a j of \a rhs to the according column
+// of the compressed matrix, which must provide exactly the required capacity. SIMD packs
+// without any non-zero element are skipped entirely.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side dense matrix
+        , bool SO >        // Storage order of the right-hand side dense matrix
+inline EnableIf_< typename CompressedMatrix<Type,true>::BLAZE_TEMPLATE VectorizedConversion<MT,SO> >
+   CompressedMatrix<Type,true>::assignDenseElements( const DenseMatrix<MT,SO>& rhs, size_t j )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( m_ & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
-         end_[j]->value_ = (~rhs)(i,j);
+   size_t i( 0UL );
 
-         if( !isDefault<strict>( end_[j]->value_ ) ) {
-            end_[j]->index_ = i;
+   for( ; i<ipos; i+=SIMDSIZE )
+   {
+      if( countNonZeros( (~rhs).load(i,j) ) == 0UL )
+         continue;
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         const Type value( (~rhs)(i+k,j) );
+
+         if( !isDefault<strict>( value ) ) {
+            end_[j]->value_ = value;
+            end_[j]->index_ = i+k;
             ++end_[j];
-            ++nonzeros;
          }
       }
    }
 
-   begin_[n_] = begin_[0UL]+nonzeros;
+   for( ; i<m_; ++i )
+   {
+      const Type value( (~rhs)(i,j) );
+
+      if( !isDefault<strict>( value ) ) {
+         end_[j]->value_ = value;
+         end_[j]->index_ = i;
+         ++end_[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of a dense matrix computation.
+//
+// \param rhs The right-hand side dense matrix computation.
+// \param parallel \a true in case the assignment is executed in parallel, \a false if not.
+// \return void
+//
+// This function assigns the given dense matrix computation, evaluating each of its elements
+// exactly once. Every block of columns buffers the non-zero elements of its columns, from which
+// the exactly sized columns of the compressed matrix are filled afterwards. Since the columns are
+// stored contiguously, the buffered elements of each block are copied in a single sweep.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side dense matrix
+        , bool SO >        // Storage order of the right-hand side dense matrix
+void CompressedMatrix<Type,true>::assignDenseComputation( const DenseMatrix<MT,SO>& rhs, bool parallel )
+{
+   // Evaluating the non-zero elements of each block of columns
+   std::vector<size_t> offsets( n_+1UL, 0UL );
+   std::vector< std::vector<ElementBase> > blocks( n_ );
+
+   const auto evaluate = [&]( size_t first, size_t last )
+   {
+      std::vector<ElementBase>& elements( blocks[first] );
+
+      for( size_t j=first; j<last; ++j )
+      {
+         const size_t ibegin( ( IsLower<MT>::value )
+                              ?( IsStrictlyLower<MT>::value ? j+1UL : j )
+                              :( 0UL ) );
+         const size_t iend  ( ( IsUpper<MT>::value )
+                              ?( IsStrictlyUpper<MT>::value ? j : j+1UL )
+                              :( m_ ) );
+
+         const size_t size( elements.size() );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            const Type value( (~rhs)(i,j) );
+            if( !isDefault<strict>( value ) )
+               elements.emplace_back( value, i );
+         }
+
+         offsets[j+1UL] = elements.size() - size;
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n_, evaluate );
+   else
+      evaluate( 0UL, n_ );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      offsets[j+1UL] += offsets[j];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j] = begin_[0UL];
+   }
+
+   if( offsets[n_] > capacity() ) {
+      reserveElements( offsets[n_] );
+   }
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j] = begin_[0UL] + offsets[j+1UL];
+   }
+
+   // Copying the buffered elements into the columns of the compressed matrix
+   const auto fill = [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         std::copy( blocks[j].begin(), blocks[j].end(), castUp( begin_[j] ) );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n_, fill );
+   else
+      fill( 0UL, n_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5579,6 +6974,14 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
+   const size_t threads( min( getNumThreads(), m_ ) );
+
+   if( threads > 1UL && (~rhs).nonZeros() >= SMP_SMATTRANSPOSE_THRESHOLD &&
+       !isSerialSectionActive() && !isParallelSectionActive() ) {
+      transposeAssign( ~rhs, threads );
+      return;
+   }
+
    using RhsIterator = ConstIterator_<MT>;
 
    // Counting the number of elements per column
@@ -5603,6 +7006,95 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side row-major sparse matrix to be assigned.
+// \param blocks The number of row blocks to be processed in parallel.
+// \return void
+//
+// This function assigns the given row-major sparse matrix by means of a parallel counting sort.
+// The rows of \a rhs are split into \a blocks contiguous blocks. In a first parallel pass, every
+// block counts its number of elements per column. The exclusive prefix sums of these histograms
+// (over the blocks of each column and over all columns) determine the position of every element
+// in the compressed matrix, which are filled in a second parallel pass. Since all blocks write
+// to disjoint positions, no synchronization is required and since the blocks are ordered by row
+// index, the elements of each column are sorted.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side sparse matrix
+void CompressedMatrix<Type,true>::transposeAssign( const MT& rhs, size_t blocks )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL && blocks <= m_, "Invalid number of blocks" );
+
+   const size_t blockSize( ( m_ - 1UL ) / blocks + 1UL );
+
+   // Counting the number of elements per column within each block of rows
+   std::vector<size_t> offsets( blocks*n_, 0UL );
+
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b )
+      {
+         size_t* const counts( offsets.data() + b*n_ );
+         const size_t iend( min( ( b+1UL )*blockSize, m_ ) );
+
+         for( size_t i=b*blockSize; i<iend; ++i ) {
+            for( auto element=rhs.begin(i); element!=rhs.end(i); ++element )
+               ++counts[element->index()];
+         }
+      }
+   } );
+
+   // Computing the column lengths and the offsets of each block within the columns
+   std::vector<size_t> columnLengths( n_ );
+
+   smpFor( 0UL, n_, [&]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j )
+      {
+         size_t length( 0UL );
+         for( size_t b=0UL; b<blocks; ++b ) {
+            const size_t count( offsets[b*n_+j] );
+            offsets[b*n_+j] = length;
+            length += count;
+         }
+         columnLengths[j] = length;
+      }
+   } );
+
+   // Resizing the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
+   }
+
+   // Scattering the elements into the columns of the compressed matrix
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last )
+   {
+      for( size_t b=first; b<last; ++b )
+      {
+         size_t* const positions( offsets.data() + b*n_ );
+         const size_t iend( min( ( b+1UL )*blockSize, m_ ) );
+
+         for( size_t i=b*blockSize; i<iend; ++i ) {
+            for( auto element=rhs.begin(i); element!=rhs.end(i); ++element ) {
+               const Iterator pos( begin_[element->index()] + positions[element->index()]++ );
+               pos->value_ = element->value();
+               pos->index_ = i;
+            }
+         }
+      }
+   } );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j+1UL];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a dense matrix.
@@ -5773,6 +7265,12 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m );
 template< typename Type, bool SO >
 inline bool isIntact( const CompressedMatrix<Type,SO>& m );
 
+template< typename Type, bool SO >
+inline bool isFlushed( const CompressedMatrix<Type,SO>& m ) noexcept;
+
+template< typename Type, bool SO >
+inline void flush( const CompressedMatrix<Type,SO>& m );
+
 template< typename Type, bool SO >
 inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
 //@}
@@ -5895,6 +7393,53 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix has no pending buffered insertions.
+// \ingroup compressed_matrix
+//
+// \param m The compressed matrix to be tested.
+// \return \a true in case there are no pending buffered insertions, \a false if not.
+//
+// A compressed matrix with pending buffered insertions (see CompressedMatrix::bufferedInsert())
+// merges these insertions on the next access to its elements. This function can be used to
+// check whether the matrix has already been flushed:
+
+   \code
+   blaze::CompressedMatrix<int> A;
+   // ... Resizing and buffered insertion of elements
+   A.flush();
+   assert( isFlushed( A ) );
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isFlushed( const CompressedMatrix<Type,SO>& m ) noexcept
+{
+   return m.isFlushed();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merging all buffered insertions into the given compressed matrix.
+// \ingroup compressed_matrix
+//
+// \param m The given compressed matrix.
+// \return void
+//
+// This function merges all pending buffered insertions (see CompressedMatrix::bufferedInsert())
+// into the given compressed matrix. It is used by the SMP assignment kernels to perform the
+// merge on the calling thread before the parallel execution starts.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void flush( const CompressedMatrix<Type,SO>& m )
+{
+   m.flush();
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Swapping the contents of two compressed matrices.
 // \ingroup compressed_matrix
@@ -6006,26 +7551,26 @@ struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A >
+struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename A, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO,A>, CompressedMatrix<T2,SO> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A>, CompressedMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
 };
@@ -6127,26 +7672,26 @@ struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A >
+struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename A, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO,A>, CompressedMatrix<T2,SO> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A>, CompressedMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
 };
@@ -6224,14 +7769,14 @@ struct SchurTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct SchurTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A>, CompressedMatrix<T2,SO2> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
 };
@@ -6309,14 +7854,14 @@ struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A >
+struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename A, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true,A>, CompressedMatrix<T2,SO> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
@@ -6369,14 +7914,14 @@ struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A>, CompressedMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
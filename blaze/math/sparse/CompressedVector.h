@@ -2501,14 +2501,14 @@ struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    using Type = HybridVector< AddTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = DynamicVector< AddTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct AddTrait< DynamicVector<T1,TF,A>, CompressedVector<T2,TF> >
 {
    using Type = DynamicVector< AddTrait_<T1,T2>, TF >;
 };
@@ -2568,14 +2568,14 @@ struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    using Type = HybridVector< SubTrait_<T1,T2>, N, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = DynamicVector< SubTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct SubTrait< DynamicVector<T1,TF,A>, CompressedVector<T2,TF> >
 {
    using Type = DynamicVector< SubTrait_<T1,T2>, TF >;
 };
@@ -2695,38 +2695,38 @@ struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false> >
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = CompressedVector< MultTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename T2, typename A >
+struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true,A> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, true >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A >
+struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false,A> >
 {
    using Type = MultTrait_<T1,T2>;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct MultTrait< DynamicVector<T1,TF,A>, CompressedVector<T2,TF> >
 {
    using Type = CompressedVector< MultTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename A, typename T2 >
+struct MultTrait< DynamicVector<T1,false,A>, CompressedVector<T2,true> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename A, typename T2 >
+struct MultTrait< DynamicVector<T1,true,A>, CompressedVector<T2,false> >
 {
    using Type = MultTrait_<T1,T2>;
 };
@@ -2828,14 +2828,14 @@ struct DivTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    using Type = CompressedVector< DivTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct DivTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A> >
 {
    using Type = CompressedVector< DivTrait_<T1,T2>, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct DivTrait< DynamicVector<T1,TF,A>, CompressedVector<T2,TF> >
 {
    using Type = CompressedVector< DivTrait_<T1,T2>, TF >;
 };
@@ -2911,8 +2911,8 @@ struct CrossTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct CrossTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A >
+struct CrossTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -2921,8 +2921,8 @@ struct CrossTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
    using Type = StaticVector< SubTrait_<T,T>, 3UL, TF >;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct CrossTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename A, typename T2 >
+struct CrossTrait< DynamicVector<T1,TF,A>, CompressedVector<T2,TF> >
 {
  private:
    using T = MultTrait_<T1,T2>;
@@ -0,0 +1,1748 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DualCompressedMatrix.h
+//  \brief Implementation of a sparse matrix with a row-wise and a column-wise index
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DUALCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DUALCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/BandTrait.h>
+#include <blaze/math/traits/ColumnsTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowsTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasDualIndex.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dual_compressed_matrix DualCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix with a row-wise and a
+//        column-wise index.
+// \ingroup dual_compressed_matrix
+//
+// The DualCompressedMatrix class template is the representation of an arbitrary sized sparse
+// matrix that is stored both in compressed row and in compressed column format. The non-zero
+// elements are stored once in an internal CompressedMatrix of the given storage order (the
+// primary index). Additionally, the matrix maintains a secondary index in the opposite storage
+// order, which refers to the values of the primary index. The type of the elements and the
+// storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class DualCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. DualCompressedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the primary
+//          index of the matrix. The default value is blaze::rowMajor.
+//
+// A dual compressed matrix is created from any other dense or sparse matrix. Since both indices
+// have to be kept consistent, it is only possible to read from the elements; every change of
+// the matrix requires the assignment of a complete new matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedMatrix<double,rowMajor> A( 4, 3 );
+   // ... Initialization of A
+
+   blaze::DualCompressedMatrix<double,rowMajor> D( A );
+
+   D(1,2) = 2.0;       // Compilation error: It is not possible to write to a dual matrix
+   double d = D(1,2);  // Access to the element (1,2)
+   D = 2.0 * A;        // Assignment of a new matrix, both indices are rebuilt
+   \endcode
+
+// The transpose of a dual compressed matrix is available at no cost: in contrast to the
+// transpose of a CompressedMatrix, which switches the storage order, the transpose of a
+// DualCompressedMatrix traverses the secondary index and therefore keeps the storage order of
+// the matrix. All matrix/vector multiplications with a dual compressed matrix or its transpose
+// are automatically restructured such that the matrix is traversed in a gather-style fashion
+// (i.e. every element of the result is computed as the dot product of a single row/column and
+// the vector). This is especially beneficial for iterative algorithms that require products
+// with both the matrix and its transpose (as for instance alternating least squares or the
+// propagation on bipartite graphs):
+
+   \code
+   using blaze::DualCompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   DualCompressedMatrix<double,rowMajor> D( 1000, 500 );
+   DynamicVector<double,columnVector> x( 500 ), y( 1000 ), u, v;
+   DynamicVector<double,rowVector> z( 1000 ), w;
+
+   u = D * x;           // Traversal of the row-wise index
+   v = trans( D ) * y;  // Traversal of the column-wise index
+   w = z * D;           // Traversal of the column-wise index
+   \endcode
+
+// Note that the secondary index stores a pointer to the value and the index of each element,
+// which increases the memory footprint of the matrix in comparison to a CompressedMatrix.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class DualCompressedMatrix
+   : public SparseMatrix< DualCompressedMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = DualCompressedMatrix<Type,SO>;  //!< Type of this DualCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;          //!< Base type of this DualCompressedMatrix instance.
+   using ResultType     = CompressedMatrix<Type,SO>;      //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO>;     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO>;     //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the matrix elements.
+   using ReturnType     = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                    //!< Data type for composite expression templates.
+   using Reference      = const Type&;                    //!< Reference to a matrix element.
+   using ConstReference = const Type&;                    //!< Reference to a constant matrix element.
+
+   //! Iterator over the elements of the primary index.
+   using ConstIterator = ConstIterator_< CompressedMatrix<Type,SO> >;
+   using Iterator      = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a DualCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = DualCompressedMatrix<NewType,SO>;  //!< The type of the other DualCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a DualCompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = DualCompressedMatrix<Type,SO>;  //!< The type of the other DualCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**TransposeElement class definition***********************************************************
+   /*!\brief Element of the secondary index of the dual compressed matrix.
+   //
+   // The element refers to the value of a non-zero element of the primary index and stores the
+   // row index (in case of a row-major matrix) or column index (in case of a column-major matrix)
+   // of the element.
+   */
+   class TransposeElement
+      : private SparseElement
+   {
+    public:
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the value of the element in the primary index.
+      size_t      index_;  //!< The index of the element within the secondary index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class DualCompressedMatrix<Type,SO>;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using TransposeIterator = const TransposeElement*;  //!< Iterator over the secondary index.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DualCompressedMatrix();
+   explicit inline DualCompressedMatrix( size_t m, size_t n );
+
+   template< typename MT, bool SO2 >
+   explicit inline DualCompressedMatrix( const Matrix<MT,SO2>& m );
+
+            inline DualCompressedMatrix( const DualCompressedMatrix& m );
+            inline DualCompressedMatrix( DualCompressedMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline DualCompressedMatrix& operator=( const DualCompressedMatrix& rhs );
+   inline DualCompressedMatrix& operator=( DualCompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline DualCompressedMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( DualCompressedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Transpose index functions*******************************************************************
+   /*!\name Transpose index functions */
+   //@{
+   inline TransposeIterator tbegin( size_t j ) const noexcept;
+   inline TransposeIterator tend  ( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void buildIndex();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,SO>     matrix_;    //!< The primary index including the non-zero values.
+   std::vector<size_t>           offsets_;   //!< The row/column offsets of the secondary index.
+   std::vector<TransposeElement> elements_;  //!< The elements of the secondary index.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DualCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>::DualCompressedMatrix()
+   : matrix_  ()            // The primary index including the non-zero values
+   , offsets_ ( 1UL, 0UL )  // The row/column offsets of the secondary index
+   , elements_()            // The elements of the secondary index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix doesn't contain any non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>::DualCompressedMatrix( size_t m, size_t n )
+   : matrix_  ( m, n )                       // The primary index including the non-zero values
+   , offsets_ ( ( SO ? m : n ) + 1UL, 0UL )  // The row/column offsets of the secondary index
+   , elements_()                             // The elements of the secondary index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// The matrix is sized according to the given matrix and each non-default element of the given
+// matrix results in a non-zero element of the dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline DualCompressedMatrix<Type,SO>::DualCompressedMatrix( const Matrix<MT,SO2>& m )
+   : matrix_  ( ~m )  // The primary index including the non-zero values
+   , offsets_ ()      // The row/column offsets of the secondary index
+   , elements_()      // The elements of the secondary index
+{
+   buildIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DualCompressedMatrix.
+//
+// \param m Dual compressed matrix to be copied.
+//
+// Since the secondary index refers to the values of the primary index, the secondary index of
+// the new matrix is rebuilt from the copied primary index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>::DualCompressedMatrix( const DualCompressedMatrix& m )
+   : matrix_  ( m.matrix_ )  // The primary index including the non-zero values
+   , offsets_ ()             // The row/column offsets of the secondary index
+   , elements_()             // The elements of the secondary index
+{
+   buildIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for DualCompressedMatrix.
+//
+// \param m The dual compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>::DualCompressedMatrix( DualCompressedMatrix&& m ) noexcept
+   : matrix_  ( std::move( m.matrix_ ) )    // The primary index including the non-zero values
+   , offsets_ ( std::move( m.offsets_ ) )   // The row/column offsets of the secondary index
+   , elements_( std::move( m.elements_ ) )  // The elements of the secondary index
+{
+   m.offsets_.assign( 1UL, 0UL );
+   m.elements_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the dual compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstReference
+   DualCompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   return matrix_(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the dual compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstReference
+   DualCompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   return matrix_.begin(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return matrix_.cbegin(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   return matrix_.end(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return matrix_.cend(i);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DualCompressedMatrix.
+//
+// \param rhs Dual compressed matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>&
+   DualCompressedMatrix<Type,SO>::operator=( const DualCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   matrix_ = rhs.matrix_;
+   buildIndex();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for DualCompressedMatrix.
+//
+// \param rhs The dual compressed matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DualCompressedMatrix<Type,SO>&
+   DualCompressedMatrix<Type,SO>::operator=( DualCompressedMatrix&& rhs ) noexcept
+{
+   matrix_   = std::move( rhs.matrix_ );
+   offsets_  = std::move( rhs.offsets_ );
+   elements_ = std::move( rhs.elements_ );
+
+   rhs.offsets_.assign( 1UL, 0UL );
+   rhs.elements_.clear();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given matrix and both indices are rebuilt. The
+// right-hand side matrix is evaluated before the dual compressed matrix is modified, which
+// makes the assignment safe in case of aliasing.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DualCompressedMatrix<Type,SO>&
+   DualCompressedMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   CompressedMatrix<Type,SO> tmp( ~rhs );
+   matrix_.swap( tmp );
+   buildIndex();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the dual compressed matrix.
+//
+// \return The number of rows of the dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the dual compressed matrix.
+//
+// \return The number of columns of the dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the dual compressed matrix.
+//
+// \return The capacity of the dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::capacity() const noexcept
+{
+   return matrix_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   return matrix_.capacity(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the dual compressed matrix
+//
+// \return The number of non-zero elements in the dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::nonZeros() const
+{
+   return elements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t DualCompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   return matrix_.nonZeros(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements from both indices. The size of the matrix is
+// preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DualCompressedMatrix<Type,SO>::reset()
+{
+   matrix_.reset();
+   buildIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DualCompressedMatrix<Type,SO>::clear()
+{
+   matrix_.clear();
+   offsets_.assign( 1UL, 0UL );
+   elements_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dual compressed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DualCompressedMatrix<Type,SO>::swap( DualCompressedMatrix& m ) noexcept
+{
+   matrix_.swap( m.matrix_ );
+   offsets_.swap( m.offsets_ );
+   elements_.swap( m.elements_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rebuilding the secondary index from the primary index.
+//
+// \return void
+//
+// The secondary index is built by a counting sort of all non-zero elements of the primary
+// index. Since the rows/columns of the primary index are traversed in increasing order, the
+// elements of each column/row of the secondary index are sorted by their index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void DualCompressedMatrix<Type,SO>::buildIndex()
+{
+   const CompressedMatrix<Type,SO>& A( matrix_ );
+
+   const size_t majors( SO ? A.columns() : A.rows() );
+   const size_t minors( SO ? A.rows() : A.columns() );
+
+   // Counting the number of non-zero elements per column/row
+   offsets_.assign( minors+1UL, 0UL );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         ++offsets_[element->index()+1UL];
+      }
+   }
+
+   for( size_t j=0UL; j<minors; ++j ) {
+      offsets_[j+1UL] += offsets_[j];
+   }
+
+   // Distributing the non-zero elements to the columns/rows of the secondary index
+   std::vector<size_t> positions( offsets_.begin(), offsets_.end()-1 );
+   elements_.resize( offsets_[minors] );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         TransposeElement& tmp( elements_[positions[element->index()]++] );
+         tmp.value_ = &element->value();
+         tmp.index_ = i;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   return matrix_.find( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   return matrix_.lowerBound( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::ConstIterator
+   DualCompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   return matrix_.upperBound( i, j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSE INDEX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of column/row \a j of the secondary index.
+//
+// \param j The column/row index.
+// \return Iterator to the first element of column/row \a j of the secondary index.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of column \a j, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of row \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::TransposeIterator
+   DualCompressedMatrix<Type,SO>::tbegin( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j+1UL < offsets_.size(), "Invalid dual matrix row/column access index" );
+
+   return elements_.data() + offsets_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of column/row \a j of the secondary index.
+//
+// \param j The column/row index.
+// \return Iterator just past the last element of column/row \a j of the secondary index.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of column \a j, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of row \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename DualCompressedMatrix<Type,SO>::TransposeIterator
+   DualCompressedMatrix<Type,SO>::tend( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j+1UL < offsets_.size(), "Invalid dual matrix row/column access index" );
+
+   return elements_.data() + offsets_[j+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DualCompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool DualCompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool DualCompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DUALCOMPRESSEDMATRIXTRANS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the transpose of a dual compressed matrix.
+// \ingroup dual_compressed_matrix
+//
+// The DualCompressedMatrixTrans class represents the compile time expression for the transpose
+// of a dual compressed matrix. In contrast to the transpose of other sparse matrices, it keeps
+// the storage order of the transposed matrix and traverses the secondary index of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class DualCompressedMatrixTrans
+   : public Expression< SparseMatrix< DualCompressedMatrixTrans<Type,SO>, SO > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DualCompressedMatrixTrans<Type,SO>;  //!< Type of this DualCompressedMatrixTrans instance.
+   using ResultType    = CompressedMatrix<Type,SO>;           //!< Result type for expression template evaluations.
+   using OppositeType  = CompressedMatrix<Type,!SO>;          //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = CompressedMatrix<Type,!SO>;          //!< Transpose type for expression template evaluations.
+   using ElementType   = Type;                                //!< Resulting element type.
+   using ReturnType    = const Type&;                         //!< Return type for expression template evaluations.
+   using CompositeType = const This&;                         //!< Data type for composite expression templates.
+
+   //! Type of the transposed dual compressed matrix.
+   using Operand = DualCompressedMatrix<Type,SO>;
+
+   //! Iterator over the elements of the secondary index.
+   using ConstIterator = typename Operand::TransposeIterator;
+   using Iterator       = ConstIterator;  //!< Iterator over non-constant elements.
+   using Reference      = const Type&;    //!< Reference to a matrix element.
+   using ConstReference = const Type&;    //!< Reference to a constant matrix element.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = Operand::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DualCompressedMatrixTrans class.
+   //
+   // \param dm The dual compressed matrix to be transposed.
+   */
+   explicit inline DualCompressedMatrixTrans( const Operand& dm ) noexcept
+      : dm_( dm )  // The transposed dual compressed matrix
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < dm_.columns(), "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < dm_.rows()   , "Invalid column access index" );
+      return dm_(j,i);
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= dm_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= dm_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+   //
+   // \param i The row/column index.
+   // \return Iterator to the first non-zero element of row/column \a i.
+   */
+   inline ConstIterator begin( size_t i ) const noexcept {
+      return dm_.tbegin(i);
+   }
+   //**********************************************************************************************
+
+   //**Cbegin function*****************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+   //
+   // \param i The row/column index.
+   // \return Iterator to the first non-zero element of row/column \a i.
+   */
+   inline ConstIterator cbegin( size_t i ) const noexcept {
+      return dm_.tbegin(i);
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+   //
+   // \param i The row/column index.
+   // \return Iterator just past the last non-zero element of row/column \a i.
+   */
+   inline ConstIterator end( size_t i ) const noexcept {
+      return dm_.tend(i);
+   }
+   //**********************************************************************************************
+
+   //**Cend function*******************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+   //
+   // \param i The row/column index.
+   // \return Iterator just past the last non-zero element of row/column \a i.
+   */
+   inline ConstIterator cend( size_t i ) const noexcept {
+      return dm_.tend(i);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return dm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return dm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse matrix.
+   //
+   // \return The number of non-zero elements in the sparse matrix.
+   */
+   inline size_t nonZeros() const {
+      return dm_.nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the specified row/column.
+   //
+   // \param i The index of the row/column.
+   // \return The number of non-zero elements of row/column \a i.
+   */
+   inline size_t nonZeros( size_t i ) const {
+      return end(i) - begin(i);
+   }
+   //**********************************************************************************************
+
+   //**Find function*******************************************************************************
+   /*!\brief Searches for a specific matrix element.
+   //
+   // \param i The row index of the search element.
+   // \param j The column index of the search element.
+   // \return Iterator to the element in case the index is found, end() iterator otherwise.
+   */
+   inline ConstIterator find( size_t i, size_t j ) const {
+      const ConstIterator pos( lowerBound( i, j ) );
+      if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+         return pos;
+      else return end( SO ? j : i );
+   }
+   //**********************************************************************************************
+
+   //**LowerBound function*************************************************************************
+   /*!\brief Returns an iterator to the first index not less then the given index.
+   //
+   // \param i The row index of the search element.
+   // \param j The column index of the search element.
+   // \return Iterator to the first index not less then the given index, end() iterator otherwise.
+   */
+   inline ConstIterator lowerBound( size_t i, size_t j ) const {
+      const size_t index( SO ? i : j );
+      return std::lower_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                               []( const auto& element, size_t idx ) {
+                                  return element.index() < idx;
+                               } );
+   }
+   //**********************************************************************************************
+
+   //**UpperBound function*************************************************************************
+   /*!\brief Returns an iterator to the first index greater then the given index.
+   //
+   // \param i The row index of the search element.
+   // \param j The column index of the search element.
+   // \return Iterator to the first index greater then the given index, end() iterator otherwise.
+   */
+   inline ConstIterator upperBound( size_t i, size_t j ) const {
+      const size_t index( SO ? i : j );
+      return std::upper_bound( begin( SO ? j : i ), end( SO ? j : i ), index,
+                               []( size_t idx, const auto& element ) {
+                                  return idx < element.index();
+                               } );
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the transposed dual compressed matrix.
+   //
+   // \return The transposed dual compressed matrix.
+   */
+   inline const Operand& operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const Operand& dm_;  //!< The transposed dual compressed matrix.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DUALCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DualCompressedMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline const DualCompressedMatrixTrans<Type,SO> trans( const DualCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline const DualCompressedMatrix<Type,SO>& trans( const DualCompressedMatrixTrans<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( DualCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void clear( DualCompressedMatrix<Type,SO>& m );
+
+template< bool RF, typename Type, bool SO >
+inline bool isDefault( const DualCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const DualCompressedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( DualCompressedMatrix<Type,SO>& a, DualCompressedMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the transpose of the given dual compressed matrix.
+// \ingroup dual_compressed_matrix
+//
+// \param m The dual compressed matrix to be transposed.
+// \return The transpose of the matrix.
+//
+// This function returns an expression representing the transpose of the given dual compressed
+// matrix. In contrast to the transpose of other sparse matrices the resulting expression has
+// the same storage order as the given matrix, i.e. the transpose of a row-major matrix is again
+// a row-major matrix, whose rows are given by the secondary (column-wise) index of the matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::DualCompressedMatrix<double,rowMajor> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+   y = trans( A ) * x;  // Row-major sparse matrix/dense vector multiplication
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const DualCompressedMatrixTrans<Type,SO> trans( const DualCompressedMatrix<Type,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DualCompressedMatrixTrans<Type,SO>( m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the transpose of a transpose dual compressed matrix.
+// \ingroup dual_compressed_matrix
+//
+// \param m The transpose dual compressed matrix to be (re-)transposed.
+// \return The original dual compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const DualCompressedMatrix<Type,SO>& trans( const DualCompressedMatrixTrans<Type,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return m.operand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given dual compressed matrix.
+// \ingroup dual_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( DualCompressedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given dual compressed matrix.
+// \ingroup dual_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( DualCompressedMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given dual compressed matrix is in default state.
+// \ingroup dual_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the dual compressed matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false. The following example demonstrates the use of
+// the \a isDefault() function:
+
+   \code
+   blaze::DualCompressedMatrix<int> D;
+   // ... Resizing and initialization
+   if( isDefault( D ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( D ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const DualCompressedMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given dual compressed matrix are intact.
+// \ingroup dual_compressed_matrix
+//
+// \param m The dual compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the dual compressed matrix are intact, i.e.
+// if its state is valid. Next to the invariants of the primary index this includes that every
+// element of the secondary index refers to the according element of the primary index. In case
+// the invariants are intact, the function returns \a true, else it will return \a false. The
+// following example demonstrates the use of the \a isIntact() function:
+
+   \code
+   blaze::DualCompressedMatrix<int> D;
+   // ... Resizing and initialization
+   if( isIntact( D ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const DualCompressedMatrix<Type,SO>& m )
+{
+   const size_t majors( SO ? m.columns() : m.rows() );
+   const size_t minors( SO ? m.rows() : m.columns() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      if( m.end(i) < m.begin(i) )
+         return false;
+      for( auto element=m.begin(i); element!=m.end(i); ++element ) {
+         if( element->index() >= minors ||
+             ( element != m.begin(i) && (element-1UL)->index() >= element->index() ) )
+            return false;
+      }
+      nonzeros += m.nonZeros(i);
+   }
+
+   if( nonzeros != m.nonZeros() )
+      return false;
+
+   for( size_t j=0UL; j<minors; ++j ) {
+      for( auto element=m.tbegin(j); element!=m.tend(j); ++element ) {
+         if( element->index() >= majors ||
+             ( element != m.tbegin(j) && (element-1UL)->index() >= element->index() ) )
+            return false;
+         const auto pos( SO ? m.find( j, element->index() ) : m.find( element->index(), j ) );
+         if( pos == m.end( element->index() ) || &pos->value() != &element->value() )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dual compressed matrices.
+// \ingroup dual_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( DualCompressedMatrix<Type,SO>& a, DualCompressedMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASDUALINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct HasDualIndex< DualCompressedMatrix<T,SO> >
+   : public TrueType
+{};
+
+template< typename T, bool SO >
+struct HasDualIndex< DualCompressedMatrixTrans<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t I, size_t J, size_t M, size_t N >
+struct SubmatrixTrait< DualCompressedMatrix<T,SO>, I, J, M, N >
+{
+   using Type = StaticMatrix<T,M,N,SO>;
+};
+
+template< typename T, bool SO >
+struct SubmatrixTrait< DualCompressedMatrix<T,SO> >
+{
+   using Type = CompressedMatrix<T,SO>;
+};
+
+template< typename T, bool SO, size_t I, size_t J, size_t M, size_t N >
+struct SubmatrixTrait< DualCompressedMatrixTrans<T,SO>, I, J, M, N >
+{
+   using Type = StaticMatrix<T,M,N,SO>;
+};
+
+template< typename T, bool SO >
+struct SubmatrixTrait< DualCompressedMatrixTrans<T,SO> >
+{
+   using Type = CompressedMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowTrait< DualCompressedMatrix<T,SO>, CRAs... >
+{
+   using Type = CompressedVector<T,true>;
+};
+
+template< typename T, bool SO, size_t... CRAs >
+struct RowTrait< DualCompressedMatrixTrans<T,SO>, CRAs... >
+{
+   using Type = CompressedVector<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CRAs >
+struct RowsTrait< DualCompressedMatrix<T,SO>, CRAs... >
+{
+   using Type = CompressedMatrix<T,false>;
+};
+
+template< typename T, bool SO, size_t... CRAs >
+struct RowsTrait< DualCompressedMatrixTrans<T,SO>, CRAs... >
+{
+   using Type = CompressedMatrix<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnTrait< DualCompressedMatrix<T,SO>, CCAs... >
+{
+   using Type = CompressedVector<T,false>;
+};
+
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnTrait< DualCompressedMatrixTrans<T,SO>, CCAs... >
+{
+   using Type = CompressedVector<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnsTrait< DualCompressedMatrix<T,SO>, CCAs... >
+{
+   using Type = CompressedMatrix<T,true>;
+};
+
+template< typename T, bool SO, size_t... CCAs >
+struct ColumnsTrait< DualCompressedMatrixTrans<T,SO>, CCAs... >
+{
+   using Type = CompressedMatrix<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, ptrdiff_t... CBAs >
+struct BandTrait< DualCompressedMatrix<T,SO>, CBAs... >
+{
+   using Type = CompressedVector<T,defaultTransposeFlag>;
+};
+
+template< typename T, bool SO, ptrdiff_t... CBAs >
+struct BandTrait< DualCompressedMatrixTrans<T,SO>, CBAs... >
+{
+   using Type = CompressedVector<T,defaultTransposeFlag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,747 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/EllMatrix.h
+//  \brief Header file for the ELLPACK/COO hybrid sparse matrix
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_ELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief ELLPACK/COO hybrid sparse matrix.
+// \ingroup sparse_matrix
+//
+// The EllMatrix class template is a read-only sparse matrix format that is tailored to the
+// fast multiplication with dense vectors. The first \a width non-zero elements of each row are
+// stored in a dense, column-major ELLPACK slab: the k-th non-zero elements of all rows are stored
+// contiguously in the k-th column of the slab, rows with less than \a width non-zero elements
+// are padded with explicit zeros. All remaining non-zero elements of the longer rows are stored
+// in a row-sorted coordinate (COO) list:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> x, y;
+   // ... Resizing and initialization
+
+   const blaze::EllMatrix<double> E( A );  // Width chosen from the row-length histogram
+   y = E * x;                              // Same result as 'y = A * x'
+   \endcode
+
+// Due to the regular layout of the slab the matrix/vector multiplication processes SIMDSIZE
+// consecutive rows at once via aligned loads of the matrix values. The slab width is by default
+// chosen as the largest row length that is reached by at least a third of all rows, such that
+// few long rows cannot blow up the padding. Alternatively the width can be given explicitly.
+// The padded elements are skipped by the multiplication, i.e. they never access the vector and
+// a non-finite vector element only propagates to rows with a corresponding non-zero element.
+*/
+template< typename Type >  // Data type of the matrix
+class EllMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = EllMatrix<Type>;  //!< Type of this EllMatrix instance.
+   using ElementType = Type;             //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline EllMatrix() noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline EllMatrix( const SparseMatrix<MT,SO>& sm );
+
+   template< typename MT, bool SO >
+   explicit inline EllMatrix( const SparseMatrix<MT,SO>& sm, size_t width );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type operator()( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows()      const noexcept;
+   inline size_t columns()   const noexcept;
+   inline size_t width()     const noexcept;
+   inline size_t nonZeros()  const noexcept;
+   inline size_t overflow()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication functions********************************************************************
+   /*!\name Multiplication functions */
+   //@{
+   template< typename VT, typename ET >
+   inline void multiply( const DenseVector<VT,columnVector>& x, DynamicVector<ET,columnVector>& y ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using SIMDType = SIMDTrait_<Type>;  //!< SIMD type of the matrix elements.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT, typename ET >
+   struct VectorizedMultiply {
+      enum : bool { value = useOptimizedKernels &&
+                            IsVectorizable<Type>::value &&
+                            IsSame< Type, ElementType_<VT> >::value &&
+                            IsSame< Type, ET >::value &&
+                            HasSIMDAdd<Type,Type>::value &&
+                            HasSIMDMult<Type,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void fill( const MT& A, size_t width );
+
+   static size_t selectWidth( const std::vector<size_t>& lengths );
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication functions********************************************************************
+   /*!\name Multiplication functions */
+   //@{
+   template< typename VT, typename ET >
+   inline DisableIf_< VectorizedMultiply<VT,ET> >
+      multiplySlab( const VT& x, DynamicVector<ET,columnVector>& y, size_t ibegin, size_t iend ) const;
+
+   template< typename VT, typename ET >
+   inline EnableIf_< VectorizedMultiply<VT,ET> >
+      multiplySlab( const VT& x, DynamicVector<ET,columnVector>& y, size_t ibegin, size_t iend ) const;
+
+   template< typename VT, typename ET >
+   inline void multiplyOverflow( const VT& x, DynamicVector<ET,columnVector>& y,
+                                 size_t ibegin, size_t iend ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the matrix.
+   size_t n_;         //!< The current number of columns of the matrix.
+   size_t nonZeros_;  //!< The total number of non-zero elements of the matrix.
+
+   DynamicMatrix<Type,columnMajor>   values_;   //!< The values of the ELLPACK slab.
+   DynamicMatrix<size_t,columnMajor> indices_;  //!< The column indices of the ELLPACK slab.
+   std::vector<size_t>               lengths_;  //!< The number of non-padded slab elements per row.
+
+   std::vector<size_t> cooRows_;     //!< The row indices of the overflow elements.
+   std::vector<size_t> cooColumns_;  //!< The column indices of the overflow elements.
+   std::vector<Type>   cooValues_;   //!< The values of the overflow elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for EllMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline EllMatrix<Type>::EllMatrix() noexcept
+   : m_         ( 0UL )  // The current number of rows of the matrix
+   , n_         ( 0UL )  // The current number of columns of the matrix
+   , nonZeros_  ( 0UL )  // The total number of non-zero elements of the matrix
+   , values_    ()       // The values of the ELLPACK slab
+   , indices_   ()       // The column indices of the ELLPACK slab
+   , lengths_   ()       // The number of non-padded slab elements per row
+   , cooRows_   ()       // The row indices of the overflow elements
+   , cooColumns_()       // The column indices of the overflow elements
+   , cooValues_ ()       // The values of the overflow elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a sparse matrix.
+//
+// \param sm Sparse matrix to be converted.
+//
+// The width of the ELLPACK slab is chosen from the row-length histogram of the given matrix:
+// it is the largest row length that is reached by at least a third of all rows. All non-zero
+// elements beyond this width are stored in the coordinate overflow list.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline EllMatrix<Type>::EllMatrix( const SparseMatrix<MT,SO>& sm )
+   : EllMatrix()
+{
+   If_< IsRowMajorMatrix<MT>
+      , CompositeType_<MT>
+      , const CompressedMatrix< ElementType_<MT>, rowMajor > > A( ~sm );
+
+   std::vector<size_t> lengths( A.rows() );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      lengths[i] = A.nonZeros( i );
+   }
+
+   fill( A, selectWidth( lengths ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a sparse matrix with an explicit slab width.
+//
+// \param sm Sparse matrix to be converted.
+// \param width The width of the ELLPACK slab.
+//
+// The first \a width non-zero elements of each row are stored in the ELLPACK slab, all further
+// non-zero elements are stored in the coordinate overflow list.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline EllMatrix<Type>::EllMatrix( const SparseMatrix<MT,SO>& sm, size_t width )
+   : EllMatrix()
+{
+   If_< IsRowMajorMatrix<MT>
+      , CompositeType_<MT>
+      , const CompressedMatrix< ElementType_<MT>, rowMajor > > A( ~sm );
+
+   fill( A, width );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type >  // Data type of the matrix
+inline Type EllMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   for( size_t k=0UL; k<lengths_[i]; ++k ) {
+      if( indices_(i,k) == j )
+         return values_(i,k);
+   }
+
+   const auto range( std::equal_range( cooRows_.begin(), cooRows_.end(), i ) );
+   for( auto pos=range.first; pos!=range.second; ++pos ) {
+      const size_t index( pos - cooRows_.begin() );
+      if( cooColumns_[index] == j )
+         return cooValues_[index];
+   }
+
+   return Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t EllMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t EllMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the ELLPACK slab.
+//
+// \return The number of elements stored per row in the ELLPACK slab.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t EllMatrix<Type>::width() const noexcept
+{
+   return values_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+//
+// The padding elements of the ELLPACK slab are not counted.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t EllMatrix<Type>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the coordinate overflow list.
+//
+// \return The number of non-zero elements that are not part of the ELLPACK slab.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t EllMatrix<Type>::overflow() const noexcept
+{
+   return cooValues_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the ELLPACK slab and the overflow list from a row-major matrix.
+//
+// \param A The row-major sparse matrix to be converted.
+// \param width The width of the ELLPACK slab.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the row-major sparse matrix
+void EllMatrix<Type>::fill( const MT& A, size_t width )
+{
+   m_ = A.rows();
+   n_ = A.columns();
+   nonZeros_ = A.nonZeros();
+
+   values_ .resize( m_, width, false );
+   indices_.resize( m_, width, false );
+   lengths_.resize( m_ );
+
+   size_t overflow( 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t length( A.nonZeros( i ) );
+      if( length > width )
+         overflow += length - width;
+   }
+
+   cooRows_   .reserve( overflow );
+   cooColumns_.reserve( overflow );
+   cooValues_ .reserve( overflow );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      size_t k( 0UL );
+      size_t last( 0UL );
+
+      auto element( A.begin(i) );
+      for( ; element!=A.end(i) && k<width; ++element, ++k ) {
+         values_(i,k)  = element->value();
+         indices_(i,k) = last = element->index();
+      }
+
+      lengths_[i] = k;
+
+      for( ; k<width; ++k ) {
+         values_(i,k)  = Type();
+         indices_(i,k) = last;
+      }
+
+      for( ; element!=A.end(i); ++element ) {
+         cooRows_.push_back( i );
+         cooColumns_.push_back( element->index() );
+         cooValues_.push_back( element->value() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the width of the ELLPACK slab from the given row lengths.
+//
+// \param lengths The number of non-zero elements of all rows.
+// \return The largest row length that is reached by at least a third of all rows.
+*/
+template< typename Type >  // Data type of the matrix
+size_t EllMatrix<Type>::selectWidth( const std::vector<size_t>& lengths )
+{
+   if( lengths.empty() )
+      return 0UL;
+
+   std::vector<size_t> histogram( *std::max_element( lengths.begin(), lengths.end() ) + 1UL );
+   for( size_t length : lengths ) {
+      ++histogram[length];
+   }
+
+   const size_t required( std::max<size_t>( lengths.size() / 3UL, 1UL ) );
+
+   size_t count( 0UL );
+   size_t width( histogram.size() - 1UL );
+
+   for( ; width>0UL; --width ) {
+      count += histogram[width];
+      if( count >= required ) break;
+   }
+
+   return width;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of the matrix with a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param x The right-hand side dense column vector.
+// \param y The target dense column vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the matrix and the given dense vector \a x and stores
+// the result in \a y, which is resized to the number of rows of the matrix. In contrast to the
+// multiplication operator, the memory of \a y is reused, which is beneficial for iterative
+// solvers. Blocks of rows are processed in parallel, where each block first processes its part
+// of the ELLPACK slab and afterwards the corresponding overflow elements.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT      // Type of the right-hand side dense vector
+        , typename ET >    // Element type of the target vector
+inline void EllMatrix<Type>::multiply( const DenseVector<VT,columnVector>& x,
+                                       DynamicVector<ET,columnVector>& y ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( n_ != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_<VT> tmp( ~x );
+
+   y.resize( m_, false );
+
+   const size_t blocks( ( m_ + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   const auto kernel = [&]( size_t first, size_t last )
+   {
+      const size_t ibegin( first*SIMDSIZE );
+      const size_t iend  ( std::min( last*SIMDSIZE, m_ ) );
+
+      multiplySlab    ( tmp, y, ibegin, iend );
+      multiplyOverflow( tmp, y, ibegin, iend );
+   };
+
+   if( m_ < SMP_SMATDVECMULT_THRESHOLD )
+      kernel( 0UL, blocks );
+   else
+      smpFor( 0UL, blocks, kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication of a range of rows of the ELLPACK slab with a dense vector.
+//
+// \param x The right-hand side dense column vector.
+// \param y The target dense column vector.
+// \param ibegin The index of the first row.
+// \param iend The index one past the last row.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT      // Type of the right-hand side dense vector
+        , typename ET >    // Element type of the target vector
+inline DisableIf_< typename EllMatrix<Type>::template VectorizedMultiply<VT,ET> >
+   EllMatrix<Type>::multiplySlab( const VT& x, DynamicVector<ET,columnVector>& y,
+                                  size_t ibegin, size_t iend ) const
+{
+   for( size_t i=ibegin; i<iend; ++i ) {
+      reset( y[i] );
+   }
+
+   for( size_t k=0UL; k<values_.columns(); ++k ) {
+      for( size_t i=ibegin; i<iend; ++i ) {
+         if( k < lengths_[i] )
+            y[i] += values_(i,k) * x[indices_(i,k)];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD-based multiplication of a range of rows of the ELLPACK slab with a dense vector.
+//
+// \param x The right-hand side dense column vector.
+// \param y The target dense column vector.
+// \param ibegin The index of the first row (a multiple of SIMDSIZE).
+// \param iend The index one past the last row.
+// \return void
+//
+// The values of SIMDSIZE consecutive rows are loaded via aligned loads from the columns of the
+// slab, the corresponding vector elements are gathered into an aligned buffer. Slab columns in
+// which all SIMDSIZE rows are padded are skipped, in partially padded columns the gathered
+// vector elements of the padded rows are replaced by zero.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT      // Type of the right-hand side dense vector
+        , typename ET >    // Element type of the target vector
+inline EnableIf_< typename EllMatrix<Type>::template VectorizedMultiply<VT,ET> >
+   EllMatrix<Type>::multiplySlab( const VT& x, DynamicVector<ET,columnVector>& y,
+                                  size_t ibegin, size_t iend ) const
+{
+   BLAZE_INTERNAL_ASSERT( ibegin % SIMDSIZE == 0UL, "Invalid row alignment detected" );
+
+   const size_t ipos( ibegin + ( ( iend - ibegin ) & size_t(-SIMDSIZE) ) );
+
+   AlignedArray<Type,SIMDSIZE> gathered;
+
+   size_t i( ibegin );
+
+   for( ; i<ipos; i+=SIMDSIZE )
+   {
+      const auto lengths( std::minmax_element( lengths_.begin()+i, lengths_.begin()+i+SIMDSIZE ) );
+      const size_t kpos( *lengths.first  );
+      const size_t kend( *lengths.second );
+      BLAZE_INTERNAL_ASSERT( kend <= values_.columns(), "Invalid slab length detected" );
+
+      SIMDType xmm;
+
+      size_t k( 0UL );
+
+      for( ; k<kpos; ++k ) {
+         const size_t* const indices( indices_.data(k) + i );
+         for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+            gathered[l] = x[indices[l]];
+         }
+         xmm += values_.load(i,k) * loada( gathered.data() );
+      }
+
+      for( ; k<kend; ++k ) {
+         const size_t* const indices( indices_.data(k) + i );
+         for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+            gathered[l] = ( k < lengths_[i+l] ) ? x[indices[l]] : Type();
+         }
+         xmm += values_.load(i,k) * loada( gathered.data() );
+      }
+
+      y.store( i, xmm );
+   }
+
+   for( ; i<iend; ++i ) {
+      Type value = Type();
+      for( size_t k=0UL; k<lengths_[i]; ++k ) {
+         value += values_(i,k) * x[indices_(i,k)];
+      }
+      y[i] = value;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the overflow elements of a range of rows with a dense vector.
+//
+// \param x The right-hand side dense column vector.
+// \param y The target dense column vector.
+// \param ibegin The index of the first row.
+// \param iend The index one past the last row.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT      // Type of the right-hand side dense vector
+        , typename ET >    // Element type of the target vector
+inline void EllMatrix<Type>::multiplyOverflow( const VT& x, DynamicVector<ET,columnVector>& y,
+                                               size_t ibegin, size_t iend ) const
+{
+   const size_t begin( std::lower_bound( cooRows_.begin(), cooRows_.end(), ibegin ) - cooRows_.begin() );
+   const size_t end  ( std::lower_bound( cooRows_.begin(), cooRows_.end(), iend   ) - cooRows_.begin() );
+
+   for( size_t index=begin; index<end; ++index ) {
+      y[cooRows_[index]] += cooValues_[index] * x[cooColumns_[index]];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of an EllMatrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param mat The left-hand side ELLPACK/COO matrix for the multiplication.
+// \param vec The right-hand side dense column vector for the multiplication.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// In case the number of columns of the matrix does not match the size of the vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline DynamicVector< MultTrait_< Type, ElementType_<VT> >, columnVector >
+   operator*( const EllMatrix<Type>& mat, const DenseVector<VT,columnVector>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_< Type, ElementType_<VT> >, columnVector > y;
+   mat.multiply( vec, y );
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
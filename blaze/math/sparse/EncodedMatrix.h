@@ -0,0 +1,2670 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/EncodedMatrix.h
+//  \brief Implementation of a sparse matrix with reduced precision or dictionary encoded values
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ENCODEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_ENCODEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/ValueEncoding.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/BandTrait.h>
+#include <blaze/math/traits/ColumnsTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DeclDiagTrait.h>
+#include <blaze/math/traits/DeclHermTrait.h>
+#include <blaze/math/traits/DeclLowTrait.h>
+#include <blaze/math/traits/DeclSymTrait.h>
+#include <blaze/math/traits/DeclUppTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowsTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SchurTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/UnaryMapTrait.h>
+#include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup encoded_matrix EncodedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix with encoded values.
+// \ingroup encoded_matrix
+//
+// The EncodedMatrix class template is the representation of an arbitrary sized sparse matrix
+// whose non-zero elements are not stored as values of the element type, but in an encoded,
+// more compact form. On every access the stored code is converted back to the element type,
+// i.e. all computations are performed in the precision of the element type. Since sparse
+// matrix/vector and sparse matrix/matrix multiplications are limited by the memory bandwidth,
+// the smaller memory footprint directly translates into faster multiplications. The element
+// type, the encoding of the values, and the storage order of the matrix can be specified via
+// the three template parameters:
+
+   \code
+   template< typename Type, typename Encoding, bool SO >
+   class EncodedMatrix;
+   \endcode
+
+//  - Type    : specifies the type of the matrix elements. EncodedMatrix can be used with any
+//              non-cv-qualified, non-reference, non-pointer numeric element type.
+//  - Encoding: specifies the encoding of the values. Possible encodings are any type that is
+//              convertible from and to the element type (as for instance \c float for
+//              \c double matrices, or blaze::BFloat16 for 16 bit values with the range of
+//              \c float) or the dictionary encoding blaze::Dictionary, which stores every
+//              distinct value only once and the position of the value within the dictionary
+//              per non-zero element (for instance blaze::Dictionary<uint8_t> for matrices
+//              with at most 256 distinct values). The default encoding is \c float.
+//  - SO      : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the
+//              matrix. The default value is blaze::rowMajor.
+//
+// An encoded matrix is either created from any other dense or sparse matrix, in which case
+// every non-default element of the given matrix is encoded, or it is filled via the low-level
+// reserve(), append(), and finalize() functions. Afterwards it is only possible to read from
+// the elements:
+
+   \code
+   using blaze::rowMajor;
+
+   // Setup of the row-major encoded matrix
+   //
+   //       ( 0 1 0 )
+   //   A = ( 0 2 3 )
+   //       ( 0 0 0 )
+   //       ( 4 0 0 )
+   //
+   blaze::EncodedMatrix<double,float,rowMajor> A( 4, 3 );
+
+   A.reserve( 4 );          // Reserving enough capacity for 4 non-zero elements
+   A.append( 0, 1, 1.0 );   // Appending the value 1 in row 0 with column index 1
+   A.finalize( 0 );         // Finalizing row 0
+   A.append( 1, 1, 2.0 );   // Appending the value 2 in row 1 with column index 1
+   A.append( 1, 2, 3.0 );   // Appending the value 3 in row 1 with column index 2
+   A.finalize( 1 );         // Finalizing row 1
+   A.finalize( 2 );         // Finalizing the empty row 2 to prepare row 3
+   A.append( 3, 0, 4.0 );   // Appending the value 4 in row 3 with column index 0
+   A.finalize( 3 );         // Finalizing row 3
+
+   A(1,2) = 2.0;            // Compilation error: It is not possible to write to an encoded matrix
+   double d = A(1,2);       // Access to the element (1,2)
+
+   // In order to traverse all non-zero elements currently stored in the matrix, the begin()
+   // and end() functions can be used. In the example, all non-zero elements of the 2nd row
+   // of A are traversed.
+   for( EncodedMatrix<double,float,rowMajor>::Iterator i=A.begin(1); i!=A.end(1); ++i ) {
+      ... = i->value();  // Access to the decoded value of the non-zero element
+      ... = i->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// EncodedMatrix can be used in all operations (addition, subtraction, multiplication, ...)
+// with all possible combinations of row-major and column-major dense and sparse matrices and
+// vectors. The values are decoded on the fly within the sparse kernels, i.e. the conversion
+// to the element type takes place in registers and the full precision values are never
+// written back to memory:
+
+   \code
+   using blaze::EncodedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::Dictionary;
+   using blaze::rowMajor;
+
+   CompressedMatrix<double,rowMajor> A( 5, 5 );
+   // ... Initialization of A
+
+   EncodedMatrix<double,float,rowMajor> E( A );                 // Single precision values
+   EncodedMatrix<double,Dictionary<uint8_t>,rowMajor> D( A );  // Up to 256 distinct values
+   DynamicVector<double> x( 5 ), y;
+   DynamicMatrix<double,rowMajor> B( 5, 5 ), C;
+
+   y = E * x;  // Encoded matrix/dense vector multiplication in double precision
+   C = D * B;  // Encoded matrix/dense matrix multiplication in double precision
+   \endcode
+
+// Note that the conversion to a lower precision encoding is lossy. Elements whose value is
+// rounded to zero by the encoding are not stored. In contrast, the dictionary encoding is
+// exact, but throws a \a std::length_error exception in case the matrix contains more distinct
+// values than the type of the codes can represent. Note that all NaN values are represented by
+// a single entry of the dictionary.
+*/
+template< typename Type                    // Data type of the matrix
+        , typename Encoding = float        // Encoding of the values
+        , bool SO = defaultStorageOrder >  // Storage order
+class EncodedMatrix
+   : public SparseMatrix< EncodedMatrix<Type,Encoding,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Codec = ValueEncoding<Type,Encoding>;  //!< Encoding and decoding of the values.
+   using Code  = typename Codec::Code;          //!< Type of the stored codes.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = EncodedMatrix<Type,Encoding,SO>;   //!< Type of this EncodedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;             //!< Base type of this EncodedMatrix instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using OppositeType   = EncodedMatrix<Type,Encoding,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = EncodedMatrix<Type,Encoding,!SO>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the encoded matrix elements.
+   using ReturnType     = const Type;                        //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = const Type;                        //!< Reference to an encoded matrix element.
+   using ConstReference = const Type;                        //!< Reference to a constant encoded matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain an EncodedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = EncodedMatrix<NewType,Encoding,SO>;  //!< The type of the other EncodedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain an EncodedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = EncodedMatrix<Type,Encoding,SO>;  //!< The type of the other EncodedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the encoded matrix.
+   //
+   // The iterator refers to the stored index and the stored code of the current element. The
+   // code is only decoded on access to the value of the element.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the encoded matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                       //!< Pointer return type.
+      using ReferenceType    = ValueType&;                       //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : index_( nullptr )  // Pointer to the index of the current encoded matrix element
+         , code_ ( nullptr )  // Pointer to the code of the current encoded matrix element
+         , dict_ ( nullptr )  // Pointer to the first element of the dictionary
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param index Pointer to the index of the initial matrix element.
+      // \param code Pointer to the code of the initial matrix element.
+      // \param dict Pointer to the first element of the dictionary.
+      */
+      inline ConstIterator( const size_t* index, const Code* code, const Type* dict ) noexcept
+         : index_( index )  // Pointer to the index of the current encoded matrix element
+         , code_ ( code  )  // Pointer to the code of the current encoded matrix element
+         , dict_ ( dict  )  // Pointer to the first element of the dictionary
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ++index_;
+         ++code_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         return ConstIterator( index_++, code_++, dict_ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         --index_;
+         --code_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         return ConstIterator( index_--, code_--, dict_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) noexcept {
+         index_ += inc;
+         code_  += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) noexcept {
+         index_ -= dec;
+         code_  -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( Codec::decode( *code_, dict_ ), *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the sparse matrix element at a distance of \a n elements.
+      //
+      // \param n The distance to the accessed element.
+      // \return The accessed sparse element.
+      */
+      inline const Element operator[]( size_t n ) const {
+         return Element( Codec::decode( code_[n], dict_ ), index_[n] );
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Type value() const {
+         return Codec::decode( *code_, dict_ );
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const noexcept {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const noexcept {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const noexcept {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) noexcept {
+         return ConstIterator( it.index_ + inc, it.code_ + inc, it.dict_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) noexcept {
+         return ConstIterator( it.index_ + inc, it.code_ + inc, it.dict_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) noexcept {
+         return ConstIterator( it.index_ - dec, it.code_ - dec, it.dict_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const size_t* index_;  //!< Pointer to the index of the current encoded matrix element.
+      const Code*   code_;   //!< Pointer to the code of the current encoded matrix element.
+      const Type*   dict_;   //!< Pointer to the first element of the dictionary.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline EncodedMatrix() noexcept;
+   explicit inline EncodedMatrix( size_t m, size_t n );
+
+   template< typename MT, bool SO2 >
+   explicit inline EncodedMatrix( const Matrix<MT,SO2>& m );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO2 >
+   inline EncodedMatrix& operator=( const Matrix<MT,SO2>& rhs );
+
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t distinctValues() const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   reserve( size_t nonzeros );
+   inline void   swap( EncodedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline EncodedMatrix& transpose();
+   inline EncodedMatrix& ctranspose();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline void assign( const MT& rhs );
+
+   template< typename MT >
+   inline void setupDictionary( const MT& rhs, TrueType );
+
+   template< typename MT >
+   inline void setupDictionary( const MT& rhs, FalseType );
+
+   inline Code encode( const Type& value, TrueType );
+   inline Code encode( const Type& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                     //!< The current number of rows of the encoded matrix.
+   size_t n_;                     //!< The current number of columns of the encoded matrix.
+   std::vector<size_t> offsets_;  //!< Offsets of the first element of each row/column.
+   std::vector<size_t> indices_;  //!< The column/row indices of the non-zero elements.
+   std::vector<Code> codes_;      //!< The encoded values of the non-zero elements.
+   std::vector<Type> dict_;       //!< The dictionary of distinct values.
+   std::vector<Code> order_;      //!< The dictionary codes in ascending order of the values.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for EncodedMatrix.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline EncodedMatrix<Type,Encoding,SO>::EncodedMatrix() noexcept
+   : m_      ( 0UL )  // The current number of rows of the encoded matrix
+   , n_      ( 0UL )  // The current number of columns of the encoded matrix
+   , offsets_()       // Offsets of the first element of each row/column
+   , indices_()       // The column/row indices of the non-zero elements
+   , codes_  ()       // The encoded values of the non-zero elements
+   , dict_   ()       // The dictionary of distinct values
+   , order_  ()       // The dictionary codes in ascending order of the values
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty encoded matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix doesn't contain any non-zero elements. It can be filled via the reserve(),
+// append(), and finalize() functions.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline EncodedMatrix<Type,Encoding,SO>::EncodedMatrix( size_t m, size_t n )
+   : m_      ( m )                          // The current number of rows of the encoded matrix
+   , n_      ( n )                          // The current number of columns of the encoded matrix
+   , offsets_( ( SO ? n : m ) + 1UL, 0UL )  // Offsets of the first element of each row/column
+   , indices_()                             // The column/row indices of the non-zero elements
+   , codes_  ()                             // The encoded values of the non-zero elements
+   , dict_   ()                             // The dictionary of distinct values
+   , order_  ()                             // The dictionary codes in ascending order of the values
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be encoded.
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// The matrix is sized according to the given matrix. Each non-default element of the given
+// matrix is encoded. Elements whose encoded value is a default value are not stored.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename MT        // Type of the foreign matrix
+        , bool SO2 >         // Storage order of the foreign matrix
+inline EncodedMatrix<Type,Encoding,SO>::EncodedMatrix( const Matrix<MT,SO2>& m )
+   : m_      ( (~m).rows() )     // The current number of rows of the encoded matrix
+   , n_      ( (~m).columns() )  // The current number of columns of the encoded matrix
+   , offsets_()                  // Offsets of the first element of each row/column
+   , indices_()                  // The column/row indices of the non-zero elements
+   , codes_  ()                  // The encoded values of the non-zero elements
+   , dict_   ()                  // The dictionary of distinct values
+   , order_  ()                  // The dictionary codes in ascending order of the values
+{
+   using Tmp = If_< And< IsSparseMatrix<MT>, BoolConstant< SO == SO2 > >
+                  , CompositeType_<MT>
+                  , const CompressedMatrix<ElementType_<MT>,SO> >;
+
+   Tmp tmp( ~m );
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the encoded matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The decoded value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstReference
+   EncodedMatrix<Type,Encoding,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid encoded matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid encoded matrix column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos != end( SO ? j : i ) )
+      return pos->value();
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The decoded value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstReference
+   EncodedMatrix<Type,Encoding,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid encoded matrix row/column access index" );
+
+   return ConstIterator( indices_.data() + offsets_[i], codes_.data() + offsets_[i], dict_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid encoded matrix row/column access index" );
+
+   const size_t k( offsets_[i+1UL] );
+   return ConstIterator( indices_.data() + k, codes_.data() + k, dict_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be encoded.
+// \return Reference to the assigned matrix.
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// The matrix is resized according to the given matrix and each non-default element of the
+// given matrix is encoded. The right-hand side matrix is evaluated before the encoded matrix
+// is modified, which makes the assignment safe in case of aliasing.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename MT        // Type of the right-hand side matrix
+        , bool SO2 >         // Storage order of the right-hand side matrix
+inline EncodedMatrix<Type,Encoding,SO>&
+   EncodedMatrix<Type,Encoding,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   EncodedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the encoded matrix.
+//
+// \return The number of rows of the encoded matrix.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the encoded matrix.
+//
+// \return The number of columns of the encoded matrix.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the encoded matrix.
+//
+// \return The capacity of the encoded matrix.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::capacity() const noexcept
+{
+   return indices_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid encoded matrix row/column access index" );
+
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the encoded matrix
+//
+// \return The number of non-zero elements in the encoded matrix.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::nonZeros() const
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid encoded matrix row/column access index" );
+
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of values in the dictionary of the encoded matrix.
+//
+// \return The number of distinct values in case of a dictionary encoding, 0 otherwise.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline size_t EncodedMatrix<Type,Encoding,SO>::distinctValues() const noexcept
+{
+   return dict_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all non-zero elements from the encoded matrix.
+//
+// \return void
+//
+// This function removes all non-zero elements (and the dictionary) from the encoded matrix.
+// The dimensions of the matrix remain unchanged.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::reset()
+{
+   std::fill( offsets_.begin(), offsets_.end(), 0UL );
+   indices_.clear();
+   codes_.clear();
+   dict_.clear();
+   order_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the encoded matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the encoded matrix is 0.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   offsets_.clear();
+   indices_.clear();
+   codes_.clear();
+   dict_.clear();
+   order_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the encoded matrix.
+//
+// \param nonzeros The new minimum capacity of the encoded matrix.
+// \return void
+//
+// This function increases the capacity of the encoded matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::reserve( size_t nonzeros )
+{
+   indices_.reserve( nonzeros );
+   codes_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two encoded matrices.
+//
+// \param m The encoded matrix to be swapped.
+// \return void
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::swap( EncodedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( offsets_, m.offsets_ );
+   swap( indices_, m.indices_ );
+   swap( codes_, m.codes_ );
+   swap( dict_, m.dict_ );
+   swap( order_, m.order_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Encoding the non-zero elements of the given sparse matrix.
+//
+// \param rhs The sparse matrix with the same storage order as this matrix.
+// \return void
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// This function encodes all non-default elements of the given sparse matrix. In case of a
+// dictionary encoding, the dictionary of all distinct non-default values is set up first. The
+// size of the encoded matrix has to be set prior to the call of this function.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename MT >      // Type of the right-hand side sparse matrix
+inline void EncodedMatrix<Type,Encoding,SO>::assign( const MT& rhs )
+{
+   const size_t majors( SO ? n_ : m_ );
+
+   offsets_.assign( majors+1UL, 0UL );
+   indices_.clear();
+   codes_.clear();
+   dict_.clear();
+   order_.clear();
+
+   setupDictionary( rhs, BoolConstant<Codec::dictionary>() );
+
+   indices_.reserve( rhs.nonZeros() );
+   codes_.reserve( rhs.nonZeros() );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      for( auto element=rhs.begin(i); element!=rhs.end(i); ++element )
+      {
+         const Type value( element->value() );
+         if( isDefault<strict>( value ) )
+            continue;
+
+         const Code code( encode( value, BoolConstant<Codec::dictionary>() ) );
+         if( !isDefault<strict>( Codec::decode( code, dict_.data() ) ) ) {
+            indices_.push_back( element->index() );
+            codes_.push_back( code );
+         }
+      }
+      offsets_[i+1UL] = indices_.size();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the dictionary of all distinct non-default values of the given sparse matrix.
+//
+// \param rhs The sparse matrix with the same storage order as this matrix.
+// \return void
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// The values are stored in ascending order, i.e. the codes are initially ordered by value.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename MT >      // Type of the right-hand side sparse matrix
+inline void EncodedMatrix<Type,Encoding,SO>::setupDictionary( const MT& rhs, TrueType )
+{
+   const size_t majors( SO ? n_ : m_ );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      for( auto element=rhs.begin(i); element!=rhs.end(i); ++element ) {
+         const Type value( element->value() );
+         if( !isDefault<strict>( value ) )
+            dict_.push_back( value );
+      }
+   }
+
+   std::sort( dict_.begin(), dict_.end(), Codec::less );
+   dict_.erase( std::unique( dict_.begin(), dict_.end(), Codec::equal ), dict_.end() );
+
+   if( dict_.size() > size_t( std::numeric_limits<Code>::max() ) + 1UL ) {
+      dict_.clear();
+      BLAZE_THROW_LENGTH_ERROR( "Too many distinct values for dictionary encoding" );
+   }
+
+   order_.resize( dict_.size() );
+   for( size_t i=0UL; i<dict_.size(); ++i ) {
+      order_[i] = static_cast<Code>( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the dictionary for encodings without dictionary.
+//
+// \param rhs The sparse matrix with the same storage order as this matrix.
+// \return void
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename MT >      // Type of the right-hand side sparse matrix
+inline void EncodedMatrix<Type,Encoding,SO>::setupDictionary( const MT& rhs, FalseType )
+{
+   UNUSED_PARAMETER( rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Encoding of a single value by means of the dictionary.
+//
+// \param value The value to be encoded.
+// \return The code of the given value.
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// The value is looked up by means of the codes in ascending order of the values. A value that is
+// not yet contained in the dictionary is appended to the dictionary, i.e. the codes of all stored
+// elements remain valid.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::Code
+   EncodedMatrix<Type,Encoding,SO>::encode( const Type& value, TrueType )
+{
+   const auto pos( std::lower_bound( order_.begin(), order_.end(), value,
+                                     [this]( Code code, const Type& v ) {
+                                        return Codec::less( dict_[code], v );
+                                     } ) );
+
+   if( pos != order_.end() && !Codec::less( value, dict_[*pos] ) )
+      return *pos;
+
+   if( dict_.size() > size_t( std::numeric_limits<Code>::max() ) ) {
+      BLAZE_THROW_LENGTH_ERROR( "Too many distinct values for dictionary encoding" );
+   }
+
+   const Code code( static_cast<Code>( dict_.size() ) );
+   const size_t index( pos - order_.begin() );
+
+   order_.reserve( order_.size()+1UL );
+   dict_.push_back( value );
+   order_.insert( order_.begin()+index, code );
+
+   return code;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Encoding of a single value without dictionary.
+//
+// \param value The value to be encoded.
+// \return The code of the given value.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::Code
+   EncodedMatrix<Type,Encoding,SO>::encode( const Type& value, FalseType )
+{
+   return Codec::encode( value, nullptr, 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the encoded matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+// \exception std::length_error Too many distinct values for the dictionary encoding.
+//
+// This function provides a very efficient way to fill an encoded matrix with elements. It
+// appends a new element to the end of the specified row/column. Therefore it is strictly
+// necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the encoded matrix
+//  - all previous rows/columns of the matrix must have been finalized via finalize()
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the
+// encoded value is a default value (for instance 0 in case of integral or floating point
+// values) it is not appended. Per default the values are not tested.
+//
+// \note The \c finalize() function has to be explicitly called for each row/column, even
+// for empty ones!
+// \note In case of a dictionary encoding, a value that is not yet contained in the dictionary is
+// added to the dictionary.
+// \note In case the capacity of the matrix is exceeded, append() invalidates all iterators
+// into the matrix!
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( check && isDefault<strict>( value ) )
+      return;
+
+   const Code code( encode( value, BoolConstant<Codec::dictionary>() ) );
+
+   if( check && isDefault<strict>( Codec::decode( code, dict_.data() ) ) )
+      return;
+
+   indices_.push_back( SO ? i : j );
+   codes_.push_back( code );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void EncodedMatrix<Type,Encoding,SO>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid row/column access index" );
+
+   offsets_[i+1UL] = indices_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid encoded matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid encoded matrix column access index" );
+
+   const size_t major( SO ? j : i );
+   const size_t* const first( indices_.data() + offsets_[major] );
+   const size_t* const last ( indices_.data() + offsets_[major+1UL] );
+
+   return begin( major ) + ( std::lower_bound( first, last, SO ? i : j ) - first );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline typename EncodedMatrix<Type,Encoding,SO>::ConstIterator
+   EncodedMatrix<Type,Encoding,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid encoded matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid encoded matrix column access index" );
+
+   const size_t major( SO ? j : i );
+   const size_t* const first( indices_.data() + offsets_[major] );
+   const size_t* const last ( indices_.data() + offsets_[major+1UL] );
+
+   return begin( major ) + ( std::upper_bound( first, last, SO ? i : j ) - first );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// The transpose is computed via a counting sort of the non-zero elements according to their
+// column/row index, which preserves the ascending order of the indices in each row/column.
+// The codes of the elements are moved along with the indices and are not re-encoded.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline EncodedMatrix<Type,Encoding,SO>& EncodedMatrix<Type,Encoding,SO>::transpose()
+{
+   const size_t majors( SO ? n_ : m_ );
+   const size_t minors( SO ? m_ : n_ );
+
+   std::vector<size_t> offsets( minors+1UL, 0UL );
+   std::vector<size_t> indices( indices_.size() );
+   std::vector<Code> codes( codes_.size() );
+
+   for( size_t index : indices_ ) {
+      ++offsets[index+1UL];
+   }
+
+   for( size_t k=0UL; k<minors; ++k ) {
+      offsets[k+1UL] += offsets[k];
+   }
+
+   std::vector<size_t> pos( offsets.begin(), offsets.end()-1L );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         const size_t p( pos[indices_[k]]++ );
+         indices[p] = i;
+         codes[p] = codes_[k];
+      }
+   }
+
+   std::swap( m_, n_ );
+   offsets_.swap( offsets );
+   indices_.swap( indices );
+   codes_.swap( codes );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since the values of an encoded matrix cannot be modified, this function is restricted to
+// matrices with built-in element type, for which the conjugate transpose is identical to the
+// transpose.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline EncodedMatrix<Type,Encoding,SO>& EncodedMatrix<Type,Encoding,SO>::ctranspose()
+{
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( Type );
+
+   return transpose();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename Other >   // Data type of the foreign expression
+inline bool EncodedMatrix<Type,Encoding,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+template< typename Other >   // Data type of the foreign expression
+inline bool EncodedMatrix<Type,Encoding,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline bool EncodedMatrix<Type,Encoding,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ENCODEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name EncodedMatrix operators */
+//@{
+template< typename Type, typename Encoding, bool SO >
+inline void reset( EncodedMatrix<Type,Encoding,SO>& m );
+
+template< typename Type, typename Encoding, bool SO >
+inline void clear( EncodedMatrix<Type,Encoding,SO>& m );
+
+template< bool RF, typename Type, typename Encoding, bool SO >
+inline bool isDefault( const EncodedMatrix<Type,Encoding,SO>& m );
+
+template< typename Type, typename Encoding, bool SO >
+inline bool isIntact( const EncodedMatrix<Type,Encoding,SO>& m );
+
+template< typename Type, typename Encoding, bool SO >
+inline void swap( EncodedMatrix<Type,Encoding,SO>& a, EncodedMatrix<Type,Encoding,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given encoded matrix.
+// \ingroup encoded_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void reset( EncodedMatrix<Type,Encoding,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given encoded matrix.
+// \ingroup encoded_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void clear( EncodedMatrix<Type,Encoding,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given encoded matrix is in default state.
+// \ingroup encoded_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the encoded matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::EncodedMatrix<double,float> E;
+   // ... Resizing and initialization
+   if( isDefault( E ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( E ) ) { ... }
+   \endcode
+*/
+template< bool RF            // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline bool isDefault( const EncodedMatrix<Type,Encoding,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given encoded matrix are intact.
+// \ingroup encoded_matrix
+//
+// \param m The encoded matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the encoded matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::EncodedMatrix<double,float> E;
+   // ... Resizing and initialization
+   if( isIntact( E ) ) { ... }
+   \endcode
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline bool isIntact( const EncodedMatrix<Type,Encoding,SO>& m )
+{
+   const size_t majors( SO ? m.columns() : m.rows() );
+   const size_t minors( SO ? m.rows() : m.columns() );
+
+   if( m.nonZeros() > m.capacity() )
+      return false;
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      if( m.end(i) < m.begin(i) )
+         return false;
+      for( auto element=m.begin(i); element!=m.end(i); ++element ) {
+         if( element->index() >= minors ||
+             ( element != m.begin(i) && (element-1UL)->index() >= element->index() ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two encoded matrices.
+// \ingroup encoded_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+inline void swap( EncodedMatrix<Type,Encoding,SO>& a, EncodedMatrix<Type,Encoding,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename E2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename E2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, typename A >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, DynamicMatrix<T2,SO,A> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2, typename A >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, DynamicMatrix<T2,SO2,A> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename A, typename T2, typename E2 >
+struct AddTrait< DynamicMatrix<T1,SO,A>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename A, typename T2, typename E2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, bool AF, bool PF >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename E2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, typename E2, bool SO2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename E2 >
+struct AddTrait< CompressedMatrix<T1,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, typename E2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, typename E2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, typename E2, bool SO2 >
+struct AddTrait< EncodedMatrix<T1,E1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename E2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename E2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, typename A >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, DynamicMatrix<T2,SO,A> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2, typename A >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, DynamicMatrix<T2,SO2,A> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename A, typename T2, typename E2 >
+struct SubTrait< DynamicMatrix<T1,SO,A>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename A, typename T2, typename E2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, bool AF, bool PF >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2, typename E2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, typename E2, bool SO2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename E2 >
+struct SubTrait< CompressedMatrix<T1,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, typename E2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, typename E2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2> , SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, typename E2, bool SO2 >
+struct SubTrait< EncodedMatrix<T1,E1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2> , false >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHURTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct SchurTrait< StaticMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct SchurTrait< HybridMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2, typename A >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, DynamicMatrix<T2,SO2,A> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename A, typename T2, typename E2, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, typename E2, bool SO2 >
+struct SchurTrait< CustomMatrix<T1,AF,PF,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2, typename E2 >
+struct SchurTrait< CompressedMatrix<T1,SO>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, typename E2, bool SO2 >
+struct SchurTrait< CompressedMatrix<T1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, typename E2, bool SO2 >
+struct SchurTrait< EncodedMatrix<T1,E1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E1, bool SO, typename T2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename T2, typename E2, bool SO >
+struct MultTrait< T1, EncodedMatrix<T2,E2,SO>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, size_t N >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, StaticVector<T2,N,false> >
+{
+   using Type = StaticVector< MultTrait_<T1,T2>, N, false >;
+};
+
+template< typename T1, size_t N, typename T2, typename E2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = StaticVector< MultTrait_<T1,T2>, N, true >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, size_t N >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, HybridVector<T2,N,false> >
+{
+   using Type = HybridVector< MultTrait_<T1,T2>, N, false >;
+};
+
+template< typename T1, size_t N, typename T2, typename E2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = HybridVector< MultTrait_<T1,T2>, N, true >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, typename A >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, DynamicVector<T2,false,A> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename A, typename T2, typename E2, bool SO >
+struct MultTrait< DynamicVector<T1,true,A>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2, bool AF, bool PF >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, typename E2, bool SO >
+struct MultTrait< CustomVector<T1,AF,PF,true>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, typename E1, bool SO, typename T2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO>, CompressedVector<T2,false> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, typename E2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, EncodedMatrix<T2,E2,SO> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, typename E2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2, typename A >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, DynamicMatrix<T2,SO2,A> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename A, typename T2, typename E2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, typename E2, bool SO2 >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, typename E2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, typename E1, bool SO1, typename T2, typename E2, bool SO2 >
+struct MultTrait< EncodedMatrix<T1,E1,SO1>, EncodedMatrix<T2,E2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E1, bool SO, typename T2 >
+struct DivTrait< EncodedMatrix<T1,E1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompressedMatrix< DivTrait_<T1,T2>, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UNARYMAPTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, typename OP >
+struct UnaryMapTrait< EncodedMatrix<T,E,SO>, OP >
+{
+   using Type = CompressedMatrix< UnaryMapTrait_<T,OP>, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLSYMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO >
+struct DeclSymTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = SymmetricMatrix< CompressedMatrix<T,SO> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLHERMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO >
+struct DeclHermTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = HermitianMatrix< CompressedMatrix<T,SO> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLLOWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO >
+struct DeclLowTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = LowerMatrix< CompressedMatrix<T,SO> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLUPPTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO >
+struct DeclUppTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = UpperMatrix< CompressedMatrix<T,SO> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLDIAGTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO >
+struct DeclDiagTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = DiagonalMatrix< CompressedMatrix<T,SO> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HIGHTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E, bool SO, typename T2 >
+struct HighType< EncodedMatrix<T1,E,SO>, EncodedMatrix<T2,E,SO> >
+{
+   using Type = EncodedMatrix< typename HighType<T1,T2>::Type, E, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename E, bool SO, typename T2 >
+struct LowType< EncodedMatrix<T1,E,SO>, EncodedMatrix<T2,E,SO> >
+{
+   using Type = EncodedMatrix< typename LowType<T1,T2>::Type, E, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, size_t I, size_t J, size_t M, size_t N >
+struct SubmatrixTrait< EncodedMatrix<T,E,SO>, I, J, M, N >
+{
+   using Type = StaticMatrix<T,M,N,SO>;
+};
+
+template< typename T, typename E, bool SO >
+struct SubmatrixTrait< EncodedMatrix<T,E,SO> >
+{
+   using Type = CompressedMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, size_t... CRAs >
+struct RowTrait< EncodedMatrix<T,E,SO>, CRAs... >
+{
+   using Type = CompressedVector<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, size_t... CRAs >
+struct RowsTrait< EncodedMatrix<T,E,SO>, CRAs... >
+{
+   using Type = CompressedMatrix<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, size_t... CCAs >
+struct ColumnTrait< EncodedMatrix<T,E,SO>, CCAs... >
+{
+   using Type = CompressedVector<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, size_t... CCAs >
+struct ColumnsTrait< EncodedMatrix<T,E,SO>, CCAs... >
+{
+   using Type = CompressedMatrix<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename E, bool SO, ptrdiff_t... CBAs >
+struct BandTrait< EncodedMatrix<T,E,SO>, CBAs... >
+{
+   using Type = CompressedVector<T,defaultTransposeFlag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
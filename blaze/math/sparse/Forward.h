@@ -46,7 +46,11 @@ namespace blaze {
 
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
+template< typename, bool > class DualCompressedMatrix;
+template< typename, bool > class DualCompressedMatrixTrans;
+template< typename, typename, bool > class EncodedMatrix;
 template< typename, bool > class IdentityMatrix;
+template< typename, bool > class PatternMatrix;
 
 } // namespace blaze
 
@@ -1885,26 +1885,26 @@ struct AddTrait< HybridMatrix<T1,M,N,SO1>, IdentityMatrix<T2,SO2> >
    using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< IdentityMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A >
+struct AddTrait< IdentityMatrix<T1,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct AddTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, IdentityMatrix<T2,SO> >
+template< typename T1, bool SO, typename A, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO,A>, IdentityMatrix<T2,SO> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A>, IdentityMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
 };
@@ -2030,26 +2030,26 @@ struct SubTrait< HybridMatrix<T1,M,N,SO1>, IdentityMatrix<T2,SO2> >
    using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< IdentityMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A >
+struct SubTrait< IdentityMatrix<T1,SO>, DynamicMatrix<T2,SO,A> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct SubTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, IdentityMatrix<T2,SO> >
+template< typename T1, bool SO, typename A, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO,A>, IdentityMatrix<T2,SO> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A>, IdentityMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
 };
@@ -2151,14 +2151,14 @@ struct SchurTrait< HybridMatrix<T1,M,N,SO1>, IdentityMatrix<T2,SO2> >
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct SchurTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SchurTrait< DynamicMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1,A>, IdentityMatrix<T2,SO2> >
 {
    using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
 };
@@ -2254,14 +2254,14 @@ struct MultTrait< HybridVector<T1,N,true>, IdentityMatrix<T2,SO> >
    using Type = HybridVector< MultTrait_<T1,T2>, N, true >;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< IdentityMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A >
+struct MultTrait< IdentityMatrix<T1,SO>, DynamicVector<T2,false,A> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, false >;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, IdentityMatrix<T2,SO> >
+template< typename T1, typename A, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true,A>, IdentityMatrix<T2,SO> >
 {
    using Type = DynamicVector< MultTrait_<T1,T2>, true >;
 };
@@ -2314,14 +2314,14 @@ struct MultTrait< HybridMatrix<T1,M,N,SO1>, IdentityMatrix<T2,SO2> >
    using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A >
+struct MultTrait< IdentityMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename A, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A>, IdentityMatrix<T2,SO2> >
 {
    using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
 };
@@ -0,0 +1,270 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Intersection.h
+//  \brief Header file for the intersection of the index sets of sparse vectors and matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_INTERSECTION_H_
+#define _BLAZE_MATH_SPARSE_INTERSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum ratio of the number of elements for the galloping intersection.
+// \ingroup sparse
+//
+// In case the larger of two index ranges contains at least \a gallopingRatio times as many
+// elements as the smaller range, the intersection searches the indices of the smaller range
+// within the larger range via exponential search instead of merging the two ranges.
+*/
+constexpr size_t gallopingRatio = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTERSECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the detection of random access iterators.
+// \ingroup sparse
+*/
+template< typename Iterator >
+struct IsRandomAccessIterator
+   : public IsSame< typename std::iterator_traits<Iterator>::iterator_category
+                  , std::random_access_iterator_tag >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches the first element with an index not less than the given index.
+// \ingroup sparse
+//
+// \param first Iterator to the first element of the index range.
+// \param last Iterator one past the last element of the index range.
+// \param index The index to be searched.
+// \return Iterator to the first element with an index not less than \a index.
+//
+// This function performs an exponential (galloping) search starting from \a first followed
+// by a binary search within the final interval. Therefore the complexity is logarithmic in
+// the distance between \a first and the found element.
+*/
+template< typename Iterator >  // Type of the random access iterator
+inline Iterator gallop( Iterator first, Iterator last, size_t index )
+{
+   const size_t size( last - first );
+
+   if( size == 0UL || first->index() >= index )
+      return first;
+
+   size_t lower( 0UL );
+   size_t upper( 1UL );
+
+   while( upper < size && ( first + upper )->index() < index ) {
+      lower = upper;
+      upper *= 2UL;
+   }
+
+   if( upper > size )
+      upper = size;
+
+   // Invariant: The element at "lower" has a smaller index, the element at "upper" does not
+   while( upper - lower > 1UL ) {
+      const size_t middle( lower + ( upper - lower ) / 2UL );
+      if( ( first + middle )->index() < index )
+         lower = middle;
+      else
+         upper = middle;
+   }
+
+   return first + upper;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping intersection of a short and a long index range.
+// \ingroup sparse
+//
+// \param sbegin Iterator to the first element of the short index range.
+// \param send Iterator one past the last element of the short index range.
+// \param lbegin Iterator to the first element of the long index range.
+// \param lend Iterator one past the last element of the long index range.
+// \param op The operation to be applied to all pairs of elements with matching indices.
+// \return void
+*/
+template< typename Iterator1  // Type of the iterator of the short index range
+        , typename Iterator2  // Type of the iterator of the long index range
+        , typename OP >       // Type of the operation
+inline void gallopingIntersect( Iterator1 sbegin, Iterator1 send,
+                                Iterator2 lbegin, Iterator2 lend, OP op )
+{
+   for( ; sbegin!=send; ++sbegin ) {
+      lbegin = gallop( lbegin, lend, sbegin->index() );
+      if( lbegin == lend ) return;
+      if( lbegin->index() == sbegin->index() ) {
+         op( sbegin, lbegin );
+         ++lbegin;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given operation to all pairs of elements with matching indices.
+// \ingroup sparse
+//
+// \param lbegin Iterator to the first element of the left-hand side index range.
+// \param lend Iterator one past the last element of the left-hand side index range.
+// \param rbegin Iterator to the first element of the right-hand side index range.
+// \param rend Iterator one past the last element of the right-hand side index range.
+// \param op The operation to be applied to all pairs of elements with matching indices.
+// \return void
+//
+// This function computes the intersection of the two given sorted index ranges and calls
+// \a op with the left-hand side and the right-hand side iterator of each common index, in
+// ascending order of the indices. Forward iterators are merged in a single pass. In case both
+// iterators are random access iterators, the shorter range is searched within the longer range
+// via exponential search if the number of elements differs by at least a factor of
+// blaze::gallopingRatio. Otherwise both ranges are merged.
+*/
+template< typename Iterator1  // Type of the left-hand side iterator
+        , typename Iterator2  // Type of the right-hand side iterator
+        , typename OP >       // Type of the operation
+inline EnableIf_< And< IsRandomAccessIterator<Iterator1>, IsRandomAccessIterator<Iterator2> > >
+   intersect( Iterator1 lbegin, Iterator1 lend, Iterator2 rbegin, Iterator2 rend, OP op )
+{
+   const size_t lsize( lend - lbegin );
+   const size_t rsize( rend - rbegin );
+
+   if( lsize == 0UL || rsize == 0UL ) {
+      return;
+   }
+   else if( lsize * gallopingRatio <= rsize ) {
+      gallopingIntersect( lbegin, lend, rbegin, rend, op );
+   }
+   else if( rsize * gallopingRatio <= lsize ) {
+      gallopingIntersect( rbegin, rend, lbegin, lend,
+                          [&op]( Iterator2 r, Iterator1 l ) { op( l, r ); } );
+   }
+   else {
+      while( true ) {
+         if( lbegin->index() < rbegin->index() ) {
+            ++lbegin;
+            if( lbegin == lend ) break;
+         }
+         else if( rbegin->index() < lbegin->index() ) {
+            ++rbegin;
+            if( rbegin == rend ) break;
+         }
+         else {
+            op( lbegin, rbegin );
+            ++lbegin;
+            if( lbegin == lend ) break;
+            ++rbegin;
+            if( rbegin == rend ) break;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given operation to all pairs of elements with matching indices.
+// \ingroup sparse
+//
+// \param lbegin Iterator to the first element of the left-hand side index range.
+// \param lend Iterator one past the last element of the left-hand side index range.
+// \param rbegin Iterator to the first element of the right-hand side index range.
+// \param rend Iterator one past the last element of the right-hand side index range.
+// \param op The operation to be applied to all pairs of elements with matching indices.
+// \return void
+//
+// This overload of the intersect() function merges two index ranges of which at least one
+// does not provide random access iterators.
+*/
+template< typename Iterator1  // Type of the left-hand side iterator
+        , typename Iterator2  // Type of the right-hand side iterator
+        , typename OP >       // Type of the operation
+inline DisableIf_< And< IsRandomAccessIterator<Iterator1>, IsRandomAccessIterator<Iterator2> > >
+   intersect( Iterator1 lbegin, Iterator1 lend, Iterator2 rbegin, Iterator2 rend, OP op )
+{
+   for( ; lbegin!=lend; ++lbegin ) {
+      while( rbegin!=rend && rbegin->index() < lbegin->index() ) ++rbegin;
+      if( rbegin==rend ) return;
+      if( lbegin->index() == rbegin->index() ) {
+         op( lbegin, rbegin );
+         ++rbegin;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
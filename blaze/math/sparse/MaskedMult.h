@@ -0,0 +1,478 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MaskedMult.h
+//  \brief Header file for the masked sparse matrix multiplication
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MASKEDMULT_H_
+#define _BLAZE_MATH_SPARSE_MASKEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MASKED MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Masked multiplication functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+               const SparseMatrix<MT3,SO3>& mask );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   complementMaskedMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+                         const SparseMatrix<MT3,SO3>& mask );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major representation of a sparse matrix operand of a masked multiplication.
+// \ingroup sparse_matrix
+//
+// Row-major operands are used via their composite type, column-major operands are converted
+// into a row-major compressed matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+using MaskedMultOperand_ = If_< IsRowMajorMatrix<MT>
+                              , CompositeType_<MT>
+                              , const CompressedMatrix< ElementType_<MT>, rowMajor > >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the sizes of the operands of a masked multiplication.
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix.
+// \param rhs The right-hand side sparse matrix.
+// \param mask The sparse mask matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2      // Storage order of the right-hand side sparse matrix
+        , typename MT3  // Type of the mask matrix
+        , bool SO3 >    // Storage order of the mask matrix
+inline void checkMaskedMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+                             const SparseMatrix<MT3,SO3>& mask )
+{
+   if( (~lhs).columns() != (~rhs).rows() ||
+       (~mask).rows() != (~lhs).rows() || (~mask).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise (Gustavson) backend of the masked multiplication.
+// \ingroup sparse_matrix
+//
+// \param A The row-major left-hand side sparse matrix.
+// \param B The row-major right-hand side sparse matrix.
+// \param M The row-major sparse mask matrix.
+// \return The result of the masked multiplication.
+//
+// This function computes the masked product of the two given row-major matrices row by row.
+// All products \f$ A(i,k) \cdot B(k,j) \f$ are only accumulated in case the position
+// \f$ (i,j) \f$ is selected by the (complemented) mask, i.e. no intermediate elements outside
+// the result pattern are created. The rows of the result are computed in parallel in case the
+// size of the result exceeds the SMP_SMATSMATMULT_THRESHOLD.
+*/
+template< bool Complement  // Complement flag for the mask
+        , typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2     // Type of the right-hand side sparse matrix
+        , typename MT3 >   // Type of the mask matrix
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMultRowwise( const MT1& A, const MT2& B, const MT3& M )
+{
+   using ET = MultTrait_< ElementType_<MT1>, ElementType_<MT2> >;
+
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   // Determining the (maximum) number of non-zero elements per row. The marker value 2i+1
+   // indicates a masked column of row i, the marker value 2i+2 a column of the result.
+   std::vector<size_t> nonzeros( m );
+
+   const bool parallel( m*n >= SMP_SMATSMATMULT_THRESHOLD );
+
+   if( Complement )
+   {
+      const auto countElements = [&]( size_t first, size_t last )
+      {
+         std::vector<size_t> marker( n, 0UL );
+
+         for( size_t i=first; i<last; ++i )
+         {
+            for( auto mel=M.begin(i); mel!=M.end(i); ++mel )
+               marker[mel->index()] = 2UL*i+1UL;
+
+            size_t count( 0UL );
+            for( auto ael=A.begin(i); ael!=A.end(i); ++ael ) {
+               for( auto bel=B.begin(ael->index()); bel!=B.end(ael->index()); ++bel ) {
+                  if( marker[bel->index()] < 2UL*i+1UL ) {
+                     marker[bel->index()] = 2UL*i+2UL;
+                     ++count;
+                  }
+               }
+            }
+
+            nonzeros[i] = count;
+         }
+      };
+
+      if( parallel )
+         smpFor( 0UL, m, countElements );
+      else
+         countElements( 0UL, m );
+   }
+   else
+   {
+      for( size_t i=0UL; i<m; ++i )
+         nonzeros[i] = M.nonZeros(i);
+   }
+
+   CompressedMatrix<ET,rowMajor> C( m, n, nonzeros );
+
+   // Accumulating the products of each row; the accumulator holds both the elements of the
+   // result and the (complemented) masked columns
+   const size_t expected( ( m > 0UL )?( ( Complement ? C.capacity() + M.nonZeros() : C.capacity() ) / m )
+                                     :( 0UL ) );
+
+   const auto accumulate = [&]( size_t first, size_t last )
+   {
+      SparseAccumulator<ET>& spa( getSparseAccumulator<ET>() );
+      spa.configure( n, expected );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         for( auto mel=M.begin(i); mel!=M.end(i); ++mel )
+            spa.enable( mel->index() );
+
+         for( auto ael=A.begin(i); ael!=A.end(i); ++ael ) {
+            for( auto bel=B.begin(ael->index()); bel!=B.end(ael->index()); ++bel ) {
+               spa.template addMasked<Complement>( bel->index(), ael->value() * bel->value() );
+            }
+         }
+
+         spa.extract( [&]( size_t j, const ET& value ) {
+            C.append( i, j, value );
+         } );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m, accumulate );
+   else
+      accumulate( 0UL, m );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dot product backend of the masked multiplication.
+// \ingroup sparse_matrix
+//
+// \param A The row-major left-hand side sparse matrix.
+// \param B The column-major right-hand side sparse matrix.
+// \param M The row-major sparse mask matrix.
+// \return The result of the masked multiplication.
+//
+// This function computes each element \f$ C(i,j) \f$ selected by the mask as the sparse dot
+// product of the row \a i of \a A and the column \a j of \a B. The work is proportional to the
+// number of elements of the mask, which makes this backend the preferred choice for very sparse
+// masks (as for instance in triangle counting). The rows of the result are computed in parallel
+// in case the size of the result exceeds the SMP_SMATSMATMULT_THRESHOLD.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the mask matrix
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMultDot( const MT1& A, const MT2& B, const MT3& M )
+{
+   using ET = MultTrait_< ElementType_<MT1>, ElementType_<MT2> >;
+
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   std::vector<size_t> nonzeros( m );
+   for( size_t i=0UL; i<m; ++i )
+      nonzeros[i] = M.nonZeros(i);
+
+   CompressedMatrix<ET,rowMajor> C( m, n, nonzeros );
+
+   const bool parallel( m*n >= SMP_SMATSMATMULT_THRESHOLD );
+
+   const auto compute = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+      {
+         if( A.begin(i) == A.end(i) )
+            continue;
+
+         for( auto mel=M.begin(i); mel!=M.end(i); ++mel )
+         {
+            const size_t j( mel->index() );
+
+            auto ael( A.begin(i) );
+            auto bel( B.begin(j) );
+            const auto aend( A.end(i) );
+            const auto bend( B.end(j) );
+
+            ET sum{};
+            bool found( false );
+
+            while( ael != aend && bel != bend )
+            {
+               if( ael->index() < bel->index() ) {
+                  ++ael;
+               }
+               else if( bel->index() < ael->index() ) {
+                  ++bel;
+               }
+               else {
+                  if( found ) {
+                     sum += ael->value() * bel->value();
+                  }
+                  else {
+                     sum = ael->value() * bel->value();
+                     found = true;
+                  }
+                  ++ael;
+                  ++bel;
+               }
+            }
+
+            if( found )
+               C.append( i, j, sum );
+         }
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m, compute );
+   else
+      compute( 0UL, m );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the masked multiplication for a row-major right-hand side matrix.
+// \ingroup sparse_matrix
+//
+// \param A The row-major left-hand side sparse matrix.
+// \param rhs The row-major right-hand side sparse matrix.
+// \param M The row-major sparse mask matrix.
+// \return The result of the masked multiplication.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the mask matrix
+inline CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMultBackend( const MT1& A, const SparseMatrix<MT2,rowMajor>& rhs, const MT3& M )
+{
+   CompositeType_<MT2> B( ~rhs );
+   return maskedMultRowwise<false>( A, B, M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the masked multiplication for a column-major right-hand side matrix.
+// \ingroup sparse_matrix
+//
+// \param A The row-major left-hand side sparse matrix.
+// \param rhs The column-major right-hand side sparse matrix.
+// \param M The row-major sparse mask matrix.
+// \return The result of the masked multiplication.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the mask matrix
+inline CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMultBackend( const MT1& A, const SparseMatrix<MT2,columnMajor>& rhs, const MT3& M )
+{
+   CompositeType_<MT2> B( ~rhs );
+   return maskedMultDot( A, B, M );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked multiplication of two sparse matrices (\f$ C \langle M \rangle = A \cdot B \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \param mask The sparse mask matrix.
+// \return The masked product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes only those elements of the sparse matrix product \f$ A \cdot B \f$
+// that are selected by the given mask, i.e. the positions of the explicitly stored elements of
+// \a mask (independent of their values). In contrast to the Schur product of the full product
+// and the mask (\f$ (A \cdot B) \circ M \f$) no intermediate elements outside the pattern of the
+// mask are created. Positions of the mask without any contribution of \f$ A \cdot B \f$ are not
+// stored in the resulting row-major compressed matrix. In case the right-hand side matrix is a
+// column-major matrix, every selected element is computed as sparse dot product, else the rows
+// of \a rhs are accumulated per row of the result. In both cases, the rows of sufficiently large
+// results are computed in parallel. The following example demonstrates the counting of triangles in an
+// undirected graph:
+
+   \code
+   blaze::CompressedMatrix<int,blaze::rowMajor> L;  // Strictly lower part of the adjacency matrix
+   // ... Resizing and initialization
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> C( maskedMult( L, trans( L ), L ) );
+
+   size_t triangles( 0UL );
+   for( size_t i=0UL; i<C.rows(); ++i )
+      for( auto element=C.begin(i); element!=C.end(i); ++element )
+         triangles += element->value();
+   \endcode
+
+// In case the number of columns of \a lhs does not match the number of rows of \a rhs or the
+// size of the mask does not match the size of the product, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2      // Storage order of the right-hand side sparse matrix
+        , typename MT3  // Type of the mask matrix
+        , bool SO3 >    // Storage order of the mask matrix
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   maskedMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+               const SparseMatrix<MT3,SO3>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   checkMaskedMult( ~lhs, ~rhs, ~mask );
+
+   MaskedMultOperand_<MT1> A( ~lhs );
+   MaskedMultOperand_<MT3> M( ~mask );
+
+   return maskedMultBackend( A, ~rhs, M );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two sparse matrices with complemented mask
+//        (\f$ C \langle \neg M \rangle = A \cdot B \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \param mask The sparse mask matrix.
+// \return The product of the two matrices restricted to the complement of the mask.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes only those elements of the sparse matrix product \f$ A \cdot B \f$
+// that are \b not selected by the given mask, i.e. all positions of the explicitly stored
+// elements of \a mask are skipped. This is for instance useful to restrict a breadth-first
+// search to the unvisited vertices of a graph. The rows of sufficiently large resulting row-major
+// compressed matrices are computed in parallel. In case the number of columns of \a lhs does not match the
+// number of rows of \a rhs or the size of the mask does not match the size of the product, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2      // Storage order of the right-hand side sparse matrix
+        , typename MT3  // Type of the mask matrix
+        , bool SO3 >    // Storage order of the mask matrix
+CompressedMatrix< MultTrait_< ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   complementMaskedMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+                         const SparseMatrix<MT3,SO3>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   checkMaskedMult( ~lhs, ~rhs, ~mask );
+
+   MaskedMultOperand_<MT1> A( ~lhs );
+   MaskedMultOperand_<MT2> B( ~rhs );
+   MaskedMultOperand_<MT3> M( ~mask );
+
+   return maskedMultRowwise<true>( A, B, M );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,515 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the bandwidth reducing reordering of sparse matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/views/Elements.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& sm );
+
+template< typename MT, bool SO >
+CompressedMatrix<ElementType_<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+decltype(auto) permute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+ResultType_<VT> unpermute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm );
+
+std::vector<size_t> invertPermutation( const std::vector<size_t>& perm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the symmetric adjacency structure of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \param ptr The resulting offsets of the adjacency lists.
+// \param adj The resulting (sorted) adjacency lists.
+// \return void
+//
+// This function sets up the adjacency graph of the sparsity pattern of \f$ A + A^T \f$ without
+// the diagonal elements in compressed form. The adjacency list of node \a i is given by the
+// range \f$ [ptr[i]..ptr[i+1]) \f$ of \a adj and is sorted in ascending order.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void setupAdjacency( const SparseMatrix<MT,SO>& sm, std::vector<size_t>& ptr, std::vector<size_t>& adj )
+{
+   const size_t n( (~sm).rows() );
+
+   std::vector<size_t> count( n+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+         if( element->index() != i ) {
+            ++count[i+1UL];
+            ++count[element->index()+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      count[i+1UL] += count[i];
+   }
+
+   std::vector<size_t> pos( count.begin(), count.end()-1L );
+   adj.resize( count[n] );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j != i ) {
+            adj[pos[i]++] = j;
+            adj[pos[j]++] = i;
+         }
+      }
+   }
+
+   std::vector<size_t> length( n, 0UL );
+
+   const bool parallel( adj.size() >= SMP_SMATREORDER_THRESHOLD );
+
+   const auto sortLists = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i ) {
+         const auto begin( adj.begin() + count[i] );
+         const auto end  ( adj.begin() + count[i+1UL] );
+         std::sort( begin, end );
+         length[i] = std::unique( begin, end ) - begin;
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n, sortLists );
+   else
+      sortLists( 0UL, n );
+
+   ptr.resize( n+1UL );
+   ptr[0UL] = 0UL;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      std::copy( adj.begin()+count[i], adj.begin()+count[i]+length[i], adj.begin()+ptr[i] );
+      ptr[i+1UL] = ptr[i] + length[i];
+   }
+
+   adj.resize( ptr[n] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Breadth-first traversal of a connected component of an adjacency graph.
+// \ingroup sparse_matrix
+//
+// \param ptr The offsets of the adjacency lists.
+// \param adj The adjacency lists.
+// \param root The root node of the traversal.
+// \param marker The node markers.
+// \param tag The unique tag of the current traversal.
+// \param order The resulting breadth-first order of the visited nodes.
+// \param levels The resulting offsets of the level sets within \a order.
+// \return void
+//
+// This function computes the level structure rooted at the node \a root by a breadth-first
+// traversal of all reachable nodes. All visited nodes are marked with the given \a tag, which
+// has to differ from all tags of previous traversals. On return, the nodes of level \a l are
+// given by the range \f$ [levels[l]..levels[l+1]) \f$ of \a order.
+*/
+inline void rootedLevels( const std::vector<size_t>& ptr, const std::vector<size_t>& adj,
+                          size_t root, std::vector<size_t>& marker, size_t tag,
+                          std::vector<size_t>& order, std::vector<size_t>& levels )
+{
+   order.clear();
+   levels.clear();
+
+   order.push_back( root );
+   marker[root] = tag;
+
+   size_t first( 0UL );
+
+   while( first < order.size() )
+   {
+      const size_t last( order.size() );
+      levels.push_back( first );
+
+      for( size_t k=first; k<last; ++k ) {
+         const size_t node( order[k] );
+         for( size_t l=ptr[node]; l<ptr[node+1UL]; ++l ) {
+            if( marker[adj[l]] != tag ) {
+               marker[adj[l]] = tag;
+               order.push_back( adj[l] );
+            }
+         }
+      }
+
+      first = last;
+   }
+
+   levels.push_back( order.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a reverse Cuthill-McKee ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \return The reverse Cuthill-McKee permutation.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a bandwidth reducing reverse Cuthill-McKee (RCM) ordering of the
+// given sparse matrix. The ordering is based on the sparsity pattern of \f$ A + A^T \f$, i.e.
+// it can be applied to both structurally symmetric and unsymmetric matrices. Every connected
+// component is traversed starting from a pseudo-peripheral node, which is determined by means
+// of the George-Liu algorithm. The resulting vector \a perm represents the permutation in the
+// form \f$ B(i,j) = A(perm[i],perm[j]) \f$, i.e. \c perm[i] is the original index of the row
+// and column that is moved to position \a i. In case the given matrix is not a square matrix,
+// a \a std::invalid_argument exception is thrown.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( rcm( A ) );
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B( permute( A, perm ) );
+   const blaze::DynamicVector<double,blaze::columnVector> z( permute( x, perm ) );
+
+   y = unpermute( B * z, perm );  // Equivalent to y = A * x
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~sm ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~sm).rows() );
+
+   std::vector<size_t> ptr, adj;
+   setupAdjacency( ~sm, ptr, adj );
+
+   const auto degree = [&ptr]( size_t i ) {
+      return ptr[i+1UL] - ptr[i];
+   };
+
+   const auto lessDegree = [&degree]( size_t i, size_t j ) {
+      return degree(i) < degree(j) || ( degree(i) == degree(j) && i < j );
+   };
+
+   std::vector<size_t> nodes( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      nodes[i] = i;
+   }
+   std::sort( nodes.begin(), nodes.end(), lessDegree );
+
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   std::vector<size_t> marker( n, 0UL ), order, levels;
+   size_t tag( 0UL );
+
+   for( size_t start : nodes )
+   {
+      if( marker[start] != 0UL )
+         continue;
+
+      // Determining a pseudo-peripheral node of the connected component (George-Liu)
+      size_t root( start );
+      rootedLevels( ptr, adj, root, marker, ++tag, order, levels );
+
+      while( true )
+      {
+         const size_t height( levels.size() );
+         const size_t candidate( *std::min_element( order.begin()+levels[height-2UL], order.end(), lessDegree ) );
+
+         rootedLevels( ptr, adj, candidate, marker, ++tag, order, levels );
+
+         if( levels.size() <= height )
+            break;
+
+         root = candidate;
+      }
+
+      // Cuthill-McKee traversal of the connected component
+      ++tag;
+      perm.push_back( root );
+      marker[root] = tag;
+
+      for( size_t k=perm.size()-1UL; k<perm.size(); ++k )
+      {
+         const size_t node( perm[k] );
+         const size_t first( perm.size() );
+
+         for( size_t l=ptr[node]; l<ptr[node+1UL]; ++l ) {
+            if( marker[adj[l]] != tag ) {
+               marker[adj[l]] = tag;
+               perm.push_back( adj[l] );
+            }
+         }
+
+         std::sort( perm.begin()+first, perm.end(), lessDegree );
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation size detected" );
+
+   std::reverse( perm.begin(), perm.end() );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \param perm The permutation to be applied.
+// \return The permuted matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation size.
+//
+// This function applies the given permutation symmetrically to the rows and columns of the
+// given sparse matrix, i.e. it computes the matrix \f$ B = P A P^T \f$ with
+// \f$ B(i,j) = A(perm[i],perm[j]) \f$. The rows (or columns in case of a column-major matrix)
+// of the resulting compressed matrix are filled in parallel in case the number of non-zero
+// elements of the matrix exceeds the SMP_SMATREORDER_THRESHOLD. In case the given matrix is
+// not a square matrix or the size of the permutation does not match the size of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+CompressedMatrix<ElementType_<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_<MT>;
+
+   if( !isSquare( ~sm ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( perm.size() != (~sm).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation size" );
+   }
+
+   const size_t n( perm.size() );
+   const std::vector<size_t> iperm( invertPermutation( perm ) );
+
+   std::vector<size_t> nonzeros( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros[i] = (~sm).nonZeros( perm[i] );
+   }
+
+   CompressedMatrix<ET,SO> tmp( n, n, nonzeros );
+
+   const bool parallel( (~sm).nonZeros() >= SMP_SMATREORDER_THRESHOLD );
+
+   const auto fillRows = [&]( size_t first, size_t last )
+   {
+      std::vector< std::pair<size_t,ET> > buffer;
+
+      for( size_t i=first; i<last; ++i )
+      {
+         buffer.clear();
+
+         for( auto element=(~sm).begin( perm[i] ); element!=(~sm).end( perm[i] ); ++element ) {
+            buffer.emplace_back( iperm[element->index()], element->value() );
+         }
+
+         std::sort( buffer.begin(), buffer.end(),
+                    []( const std::pair<size_t,ET>& a, const std::pair<size_t,ET>& b ) {
+                       return a.first < b.first;
+                    } );
+
+         for( const auto& element : buffer ) {
+            if( SO == rowMajor )
+               tmp.append( i, element.first, element.second );
+            else
+               tmp.append( element.first, i, element.second );
+         }
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, n, fillRows );
+   else
+      fillRows( 0UL, n );
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given dense vector.
+// \ingroup sparse_matrix
+//
+// \param dv The given dense vector.
+// \param perm The permutation to be applied.
+// \return View on the permuted dense vector.
+// \exception std::invalid_argument Invalid permutation size.
+//
+// This function returns a view on the given dense vector that represents the vector permuted
+// by the given permutation, i.e. the element \a i of the view corresponds to the element
+// \c perm[i] of the given vector. The permutation matches the permutation of a sparse matrix
+// via the permute() function, i.e. assigning the resulting view to a dense vector is executed
+// in parallel by means of the SMP assignment. In case the size of the permutation does not
+// match the size of the vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+decltype(auto) permute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( perm.size() != (~dv).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation size" );
+   }
+
+   return elements( ~dv, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverse permutation of the given dense vector.
+// \ingroup sparse_matrix
+//
+// \param dv The given dense vector.
+// \param perm The permutation to be reverted.
+// \return The dense vector in the original ordering.
+// \exception std::invalid_argument Invalid permutation size.
+//
+// This function reverts the given permutation on the given dense vector, i.e. it maps a
+// vector in the permuted ordering of a previous call to the permute() function back to the
+// original ordering. The scattered assignment is executed in parallel by means of the SMP
+// assignment. In case the size of the permutation does not match the size of the vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+ResultType_<VT> unpermute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( perm.size() != (~dv).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation size" );
+   }
+
+   ResultType_<VT> tmp( (~dv).size() );
+   elements( tmp, perm ) = ~dv;
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup sparse_matrix
+//
+// \param perm The given permutation.
+// \return The inverse permutation.
+//
+// This function computes the inverse permutation \a iperm of the given permutation \a perm,
+// i.e. \c iperm[perm[i]] is equal to \a i for all indices \a i.
+*/
+inline std::vector<size_t> invertPermutation( const std::vector<size_t>& perm )
+{
+   std::vector<size_t> iperm( perm.size() );
+
+   for( size_t i=0UL; i<perm.size(); ++i ) {
+      BLAZE_USER_ASSERT( perm[i] < perm.size(), "Invalid permutation index detected" );
+      iperm[perm[i]] = i;
+   }
+
+   return iperm;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
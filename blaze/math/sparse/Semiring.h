@@ -0,0 +1,333 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Semiring.h
+//  \brief Header file for the semiring sparse matrix multiplication
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SEMIRING_H_
+#define _BLAZE_MATH_SPARSE_SEMIRING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SEMIRING MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the element type of a semiring multiplication.
+// \ingroup sparse_matrix
+//
+// The element type of the result of a semiring multiplication is the decayed result type of the
+// multiplicative operation applied to the two given element types.
+*/
+template< typename MultOp  // Type of the multiplicative operation
+        , typename T1      // Element type of the left-hand side operand
+        , typename T2 >    // Element type of the right-hand side operand
+using SemiringMultElement_ = Decay_< decltype( std::declval<MultOp>()( std::declval<T1>(), std::declval<T2>() ) ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major representation of a sparse matrix operand of a semiring multiplication.
+// \ingroup sparse_matrix
+//
+// Row-major operands are used via their composite type, column-major operands are converted
+// into a row-major compressed matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+using SemiringMultOperand_ = If_< IsRowMajorMatrix<MT>
+                                , CompositeType_<MT>
+                                , const CompressedMatrix< ElementType_<MT>, rowMajor > >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Semiring multiplication functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename AddOp, typename MultOp >
+CompressedMatrix< SemiringMultElement_< MultOp, ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   semiringMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+                 AddOp add, MultOp mult );
+
+template< typename MT, bool SO, typename VT, typename AddOp, typename MultOp, typename T >
+DynamicVector< SemiringMultElement_< MultOp, ElementType_<MT>, ElementType_<VT> >, columnVector >
+   semiringMult( const SparseMatrix<MT,SO>& mat, const DenseVector<VT,columnVector>& vec,
+                 AddOp add, MultOp mult, const T& zero );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two sparse matrices over a semiring (\f$ C = A \oplus.\otimes B \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \param add The additive operation of the semiring.
+// \param mult The multiplicative operation of the semiring.
+// \return The semiring product of the two matrices.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the two given sparse matrices, where the usual addition
+// and multiplication are replaced by the given binary operations \a add and \a mult:
+
+      \f[ C(i,j) = \bigoplus_{k} A(i,k) \otimes B(k,j) \f]
+
+// The reduction only runs over the structural non-zero elements of \a lhs and \a rhs. Thus an
+// element \f$ C(i,j) \f$ is only stored in case at least one pair of non-zero elements contributes
+// to it and the additive identity of the semiring is never required explicitly. Any pair of
+// functors can be used, as for instance the functors of the Blaze library (e.g. blaze::Min,
+// blaze::Max, blaze::Add, blaze::Mult, blaze::LogicalOr and blaze::LogicalAnd) or lambdas. The
+// following example demonstrates a single relaxation step of a shortest path computation via
+// the tropical (min,+) semiring:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> D;  // Current distances
+   blaze::CompressedMatrix<double,blaze::rowMajor> W;  // Edge weights of the graph
+   // ... Resizing and initialization
+
+   D = semiringMult( D, W, blaze::Min(), blaze::Add() );
+   \endcode
+
+// The result is computed row by row (Gustavson's algorithm). In case the size of the result
+// exceeds the SMP_SMATSMATMULT_THRESHOLD, the rows of the result are computed in parallel.
+// Column-major operands are converted into row-major compressed matrices before the
+// multiplication. In case the number of columns of \a lhs does not match the number of rows of
+// \a rhs, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1       // Type of the left-hand side sparse matrix
+        , bool SO1           // Storage order of the left-hand side sparse matrix
+        , typename MT2       // Type of the right-hand side sparse matrix
+        , bool SO2           // Storage order of the right-hand side sparse matrix
+        , typename AddOp     // Type of the additive operation
+        , typename MultOp >  // Type of the multiplicative operation
+CompressedMatrix< SemiringMultElement_< MultOp, ElementType_<MT1>, ElementType_<MT2> >, rowMajor >
+   semiringMult( const SparseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
+                 AddOp add, MultOp mult )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = SemiringMultElement_< MultOp, ElementType_<MT1>, ElementType_<MT2> >;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   SemiringMultOperand_<MT1> A( ~lhs );
+   SemiringMultOperand_<MT2> B( ~rhs );
+
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   const bool parallel( m*n >= SMP_SMATSMATMULT_THRESHOLD );
+
+   // Symbolic phase: determining the number of non-zero elements per row of the result
+   std::vector<size_t> nonzeros( m );
+
+   const auto countElements = [&]( size_t first, size_t last )
+   {
+      std::vector<size_t> marker( n, m );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         size_t count( 0UL );
+
+         for( auto ael=A.begin(i); ael!=A.end(i); ++ael ) {
+            for( auto bel=B.begin(ael->index()); bel!=B.end(ael->index()); ++bel ) {
+               if( marker[bel->index()] != i ) {
+                  marker[bel->index()] = i;
+                  ++count;
+               }
+            }
+         }
+
+         nonzeros[i] = count;
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m, countElements );
+   else
+      countElements( 0UL, m );
+
+   CompressedMatrix<ET,rowMajor> C( m, n, nonzeros );
+
+   // Numeric phase: accumulating the contributions to each row of the result
+   const auto accumulate = [&]( size_t first, size_t last )
+   {
+      SparseAccumulator<ET>& spa( getSparseAccumulator<ET>() );
+      spa.configure( n, ( m > 0UL )?( C.capacity() / m ):( 0UL ) );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         for( auto ael=A.begin(i); ael!=A.end(i); ++ael ) {
+            for( auto bel=B.begin(ael->index()); bel!=B.end(ael->index()); ++bel ) {
+               spa.add( bel->index(), mult( ael->value(), bel->value() ), add );
+            }
+         }
+
+         spa.extract( [&]( size_t j, const ET& value ) {
+            C.append( i, j, value );
+         } );
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m, accumulate );
+   else
+      accumulate( 0UL, m );
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a sparse matrix and a dense vector over a semiring
+//        (\f$ \vec{y} = A \oplus.\otimes \vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param mat The left-hand side sparse matrix for the multiplication.
+// \param vec The right-hand side dense column vector for the multiplication.
+// \param add The additive operation of the semiring.
+// \param mult The multiplicative operation of the semiring.
+// \param zero The additive identity of the semiring.
+// \return The semiring product of the matrix and the vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the given sparse matrix and dense vector, where the
+// usual addition and multiplication are replaced by the given binary operations \a add and
+// \a mult:
+
+      \f[ y_i = zero \oplus \bigoplus_{j} A(i,j) \otimes x_j \f]
+
+// The reduction only runs over the structural non-zero elements of \a mat. Since the result
+// is a dense vector, the additive identity of the semiring (\a zero) has to be specified
+// explicitly. It is used as result of all rows without non-zero elements. The following
+// example demonstrates a single step of a reachability computation via the boolean (or,and)
+// semiring:
+
+   \code
+   blaze::CompressedMatrix<bool,blaze::rowMajor> A;  // Adjacency matrix of the graph
+   blaze::DynamicVector<bool,blaze::columnVector> x;  // Currently reached vertices
+   // ... Resizing and initialization
+
+   x = semiringMult( A, x, blaze::LogicalOr(), blaze::LogicalAnd(), false );
+   \endcode
+
+// In case the number of rows of \a mat exceeds the SMP_SMATDVECMULT_THRESHOLD, the rows of the
+// result are computed in parallel. A column-major matrix is converted into a
+// row-major compressed matrix before the multiplication. In case the number of columns of the
+// matrix does not match the size of the vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT      // Type of the left-hand side sparse matrix
+        , bool SO          // Storage order of the left-hand side sparse matrix
+        , typename VT      // Type of the right-hand side dense vector
+        , typename AddOp   // Type of the additive operation
+        , typename MultOp  // Type of the multiplicative operation
+        , typename T >     // Type of the additive identity
+DynamicVector< SemiringMultElement_< MultOp, ElementType_<MT>, ElementType_<VT> >, columnVector >
+   semiringMult( const SparseMatrix<MT,SO>& mat, const DenseVector<VT,columnVector>& vec,
+                 AddOp add, MultOp mult, const T& zero )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = SemiringMultElement_< MultOp, ElementType_<MT>, ElementType_<VT> >;
+
+   if( (~mat).columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   SemiringMultOperand_<MT> A( ~mat );
+   CompositeType_<VT> x( ~vec );
+
+   const size_t m( A.rows() );
+
+   DynamicVector<ET,columnVector> y( m );
+
+   const bool parallel( m >= SMP_SMATDVECMULT_THRESHOLD );
+
+   const auto reduce = [&]( size_t first, size_t last )
+   {
+      for( size_t i=first; i<last; ++i )
+      {
+         ET value( zero );
+
+         for( auto element=A.begin(i); element!=A.end(i); ++element )
+            value = add( value, mult( element->value(), x[element->index()] ) );
+
+         y[i] = value;
+      }
+   };
+
+   if( parallel )
+      smpFor( 0UL, m, reduce );
+   else
+      reduce( 0UL, m );
+
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
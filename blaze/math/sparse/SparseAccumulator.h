@@ -0,0 +1,804 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseAccumulator.h
+//  \brief Header file for the sparse accumulator
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSEACCUMULATOR_H_
+#define _BLAZE_MATH_SPARSE_SPARSEACCUMULATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sparse accumulator for row-wise sparse algorithms.
+// \ingroup sparse_matrix
+//
+// The SparseAccumulator class template accumulates the contributions to a single sparse row (or
+// column) of a result, as for instance in row-wise (Gustavson) sparse matrix multiplications. The
+// non-zero elements are accumulated via add() and extracted in ascending order of their indices
+// via extract(), which also resets the accumulator for the next row. Depending on the size of
+// the rows and the expected number of non-zero elements per row, the accumulator works in one
+// of three modes:
+//
+//  - \a denseMode: The values are stored in a dense array of the size of the rows. This mode
+//    provides constant time access and is selected for small rows or a sufficiently high fill.
+//  - \a hashMode: The values are stored in an open addressing hash table, whose memory is
+//    proportional to the number of non-zero elements. This mode is selected for long rows with
+//    a low fill.
+//  - \a sortedMode: The values are stored in a sorted list, which is selected for long rows with
+//    very few non-zero elements. In case the list grows beyond \a sortedMax elements, the
+//    accumulator switches to \a hashMode.
+//
+// In all modes resetting the accumulator takes constant time or time proportional to the number
+// of touched elements. Therefore a single accumulator can be reused for all rows of a result and,
+// via getSparseAccumulator(), across several operations executed by the same thread.
+
+   \code
+   blaze::SparseAccumulator<double>& spa( blaze::getSparseAccumulator<double>() );
+   spa.configure( B.columns(), expectedNonZerosPerRow );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto a=A.begin(i); a!=A.end(i); ++a )
+         for( auto b=B.begin(a->index()); b!=B.end(a->index()); ++b )
+            spa.add( b->index(), a->value() * b->value() );
+      spa.extract( [&]( size_t j, const double& value ) { C.append( i, j, value ); } );
+      C.finalize( i );
+   }
+   \endcode
+
+// Additionally, the accumulator supports masked accumulations: Via enable() an index can be
+// marked as part of a mask. addMasked() then only accumulates values at enabled indices (or, in
+// case of a complemented mask, only at indices that have not been enabled). Enabled indices that
+// have not been accumulated are not part of the extracted row.
+*/
+template< typename Type >  // Data type of the accumulated values
+class SparseAccumulator
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the accumulated values.
+   //**********************************************************************************************
+
+   //**Accumulation modes**************************************************************************
+   //! Storage modes of the sparse accumulator.
+   enum Mode { denseMode, hashMode, sortedMode };
+   //**********************************************************************************************
+
+   //**Mode selection parameters*******************************************************************
+   static constexpr size_t denseSize   = 4096UL;  //!< Maximum row size always using the dense mode.
+   static constexpr size_t denseRatio  = 32UL;    //!< Inverse of the minimum fill for the dense mode.
+   static constexpr size_t sortedLimit = 8UL;     //!< Maximum expected number of elements for the sorted mode.
+   static constexpr size_t sortedMax   = 64UL;    //!< Maximum number of elements in the sorted mode.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SparseAccumulator();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          void   configure( size_t size, size_t nonzeros );
+          void   configure( size_t size, size_t nonzeros, Mode mode );
+   inline Mode   mode    () const noexcept;
+   inline size_t size    () const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline void   clear   () noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Accumulation functions**********************************************************************
+   /*!\name Accumulation functions */
+   //@{
+   template< typename T >
+   inline void add( size_t index, const T& value );
+
+   template< typename T, typename OP >
+   inline void add( size_t index, const T& value, OP op );
+
+   inline void enable( size_t index );
+
+   template< bool Complement, typename T >
+   inline void addMasked( size_t index, const T& value );
+
+   template< typename OP >
+   void extract( OP op );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Element of the sorted list.
+   struct Entry {
+      size_t index;    //!< The index of the element.
+      Type   value;    //!< The accumulated value of the element.
+      bool   touched;  //!< \a true in case a value has been accumulated, \a false if only enabled.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool Masked, bool Complement, typename T, typename OP >
+   inline void accumulate( size_t index, const T& value, OP op );
+
+   inline size_t probe( size_t index ) const noexcept;
+   inline size_t occupy( size_t index );
+          void   reserveValues( size_t n );
+          void   rehash( size_t capacity );
+          void   convertToHash();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Mode   mode_;      //!< The current storage mode.
+   size_t size_;      //!< The size of the accumulated rows.
+   size_t nonzeros_;  //!< The number of accumulated (touched) elements.
+   size_t base_;      //!< The stamp of enabled elements of the current row (touched: base_+1).
+   size_t bits_;      //!< The number of bits of the hash table capacity.
+   size_t min_;       //!< The smallest touched index in the dense mode.
+   size_t max_;       //!< The largest touched index in the dense mode.
+
+   std::vector<size_t>     stamps_;    //!< The stamps of the dense array or hash table slots.
+   std::vector<size_t>     keys_;      //!< The indices stored in the hash table slots.
+   std::unique_ptr<Type[]> values_;    //!< The values of the dense array or hash table slots.
+   size_t                  capacity_;  //!< The capacity of the value array.
+   std::vector<size_t>     used_;      //!< The touched indices (dense) or occupied slots (hash).
+   std::vector<Entry>      list_;      //!< The sorted list of elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseAccumulator.
+//
+// The default constructor creates an empty accumulator for rows of size 0.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline SparseAccumulator<Type>::SparseAccumulator()
+   : mode_    ( denseMode )  // The current storage mode
+   , size_    ( 0UL )        // The size of the accumulated rows
+   , nonzeros_( 0UL )        // The number of accumulated elements
+   , base_    ( 2UL )        // The stamp of enabled elements of the current row
+   , bits_    ( 0UL )        // The number of bits of the hash table capacity
+   , min_     ( std::numeric_limits<size_t>::max() )  // The smallest touched index
+   , max_     ( 0UL )        // The largest touched index
+   , stamps_  ()             // The stamps of the dense array or hash table slots
+   , keys_    ()             // The indices stored in the hash table slots
+   , values_  ()             // The values of the dense array or hash table slots
+   , capacity_( 0UL )        // The capacity of the value array
+   , used_    ()             // The touched indices or occupied slots
+   , list_    ()             // The sorted list of elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Configures the accumulator for rows of the given size.
+//
+// \param size The size of the accumulated rows.
+// \param nonzeros The expected number of non-zero elements per row.
+// \return void
+//
+// This function resets the accumulator and selects the storage mode based on the size of the
+// rows and the expected number of non-zero elements per row (see the class description). Memory
+// allocated by previous configurations is reused.
+*/
+template< typename Type >  // Data type of the accumulated values
+void SparseAccumulator<Type>::configure( size_t size, size_t nonzeros )
+{
+   if( size <= denseSize || nonzeros * denseRatio >= size )
+      configure( size, nonzeros, denseMode );
+   else if( nonzeros <= sortedLimit )
+      configure( size, nonzeros, sortedMode );
+   else
+      configure( size, nonzeros, hashMode );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configures the accumulator for rows of the given size in the given storage mode.
+//
+// \param size The size of the accumulated rows.
+// \param nonzeros The expected number of non-zero elements per row.
+// \param mode The storage mode of the accumulator.
+// \return void
+//
+// This function resets the accumulator and explicitly selects the given storage mode.
+*/
+template< typename Type >  // Data type of the accumulated values
+void SparseAccumulator<Type>::configure( size_t size, size_t nonzeros, Mode mode )
+{
+   clear();
+
+   mode_ = mode;
+   size_ = size;
+
+   if( mode == denseMode )
+   {
+      if( stamps_.size() < size )
+         stamps_.resize( size, 0UL );
+      reserveValues( size );
+   }
+   else if( mode == hashMode )
+   {
+      size_t bits( 4UL );
+      while( ( 1UL << bits ) < 2UL*nonzeros )
+         ++bits;
+
+      if( stamps_.size() < ( 1UL << bits ) || keys_.size() < ( 1UL << bits ) ||
+          capacity_ < ( 1UL << bits ) )
+         rehash( 1UL << bits );
+      else
+         bits_ = bits;
+   }
+   else
+   {
+      list_.reserve( sortedMax+1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current storage mode of the accumulator.
+//
+// \return The current storage mode.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline typename SparseAccumulator<Type>::Mode SparseAccumulator<Type>::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the accumulated rows.
+//
+// \return The size of the accumulated rows.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline size_t SparseAccumulator<Type>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of accumulated elements of the current row.
+//
+// \return The number of accumulated elements.
+//
+// Enabled elements that have not been accumulated are not counted.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline size_t SparseAccumulator<Type>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the accumulator for the next row.
+//
+// \return void
+//
+// This function discards all accumulated and enabled elements of the current row. The stamps
+// of the dense array and the hash table are invalidated in constant time.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline void SparseAccumulator<Type>::clear() noexcept
+{
+   if( base_ >= std::numeric_limits<size_t>::max() - 3UL ) {
+      std::fill( stamps_.begin(), stamps_.end(), 0UL );
+      base_ = 0UL;
+   }
+
+   base_ += 2UL;
+   nonzeros_ = 0UL;
+   min_ = std::numeric_limits<size_t>::max();
+   max_ = 0UL;
+   used_.clear();
+   list_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reserves a value array of at least the given size.
+//
+// \param n The minimum size of the value array.
+// \return void
+//
+// This function does not preserve the current values.
+*/
+template< typename Type >  // Data type of the accumulated values
+void SparseAccumulator<Type>::reserveValues( size_t n )
+{
+   if( capacity_ < n ) {
+      values_.reset( new Type[n] );
+      capacity_ = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the hash table slot of the given index.
+//
+// \param index The index of the element.
+// \return The slot containing the index or the empty slot where the index has to be inserted.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline size_t SparseAccumulator<Type>::probe( size_t index ) const noexcept
+{
+   const size_t mask( ( 1UL << bits_ ) - 1UL );
+
+   // Fibonacci hashing: the upper bits of the product select the slot
+   size_t slot( static_cast<size_t>( ( index * 0x9E3779B97F4A7C15ULL ) >> ( 64UL - bits_ ) ) );
+
+   while( stamps_[slot] >= base_ && keys_[slot] != index ) {
+      slot = ( slot + 1UL ) & mask;
+   }
+
+   return slot;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Occupies a new hash table slot for the given index.
+//
+// \param index The index of the new element.
+// \return The slot of the new element.
+//
+// In case the load factor of the hash table exceeds 1/2, the capacity of the hash table is
+// doubled before the slot is occupied.
+*/
+template< typename Type >  // Data type of the accumulated values
+inline size_t SparseAccumulator<Type>::occupy( size_t index )
+{
+   if( 2UL*( used_.size() + 1UL ) > ( 1UL << bits_ ) ) {
+      rehash( 2UL << bits_ );
+   }
+
+   const size_t slot( probe( index ) );
+
+   BLAZE_INTERNAL_ASSERT( stamps_[slot] < base_, "Invalid hash table slot detected" );
+
+   keys_[slot]   = index;
+   stamps_[slot] = base_;
+   used_.push_back( slot );
+
+   return slot;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rebuilds the hash table with the given capacity.
+//
+// \param capacity The new capacity of the hash table (a power of two).
+// \return void
+//
+// All elements of the current row are moved into the new hash table.
+*/
+template< typename Type >  // Data type of the accumulated values
+void SparseAccumulator<Type>::rehash( size_t capacity )
+{
+   BLAZE_INTERNAL_ASSERT( ( capacity & ( capacity - 1UL ) ) == 0UL, "Invalid hash table capacity" );
+
+   std::vector<size_t>     stamps( std::move( stamps_ ) );
+   std::vector<size_t>     keys  ( std::move( keys_   ) );
+   std::vector<size_t>     used  ( std::move( used_   ) );
+   std::unique_ptr<Type[]> values( std::move( values_ ) );
+
+   bits_ = 0UL;
+   while( ( 1UL << bits_ ) < capacity )
+      ++bits_;
+
+   stamps_.assign( capacity, 0UL );
+   keys_.assign( capacity, 0UL );
+   values_.reset( new Type[capacity] );
+   capacity_ = capacity;
+   used_.clear();
+
+   for( size_t old : used )
+   {
+      const size_t slot( probe( keys[old] ) );
+
+      keys_[slot]   = keys[old];
+      stamps_[slot] = stamps[old];
+      values_[slot] = std::move( values[old] );
+      used_.push_back( slot );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the sorted list of the current row into a hash table.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the accumulated values
+void SparseAccumulator<Type>::convertToHash()
+{
+   std::vector<Entry> list( std::move( list_ ) );
+
+   list_.clear();
+   mode_ = hashMode;
+   rehash( 4UL*sortedMax );
+
+   for( Entry& entry : list ) {
+      const size_t slot( occupy( entry.index ) );
+      values_[slot] = std::move( entry.value );
+      stamps_[slot] = base_ + ( entry.touched ? 1UL : 0UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCUMULATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the accumulation functions.
+//
+// \param index The index of the element.
+// \param value The value to be accumulated.
+// \param op The accumulation operation for elements that already hold a value.
+// \return void
+//
+// In case the element at the given index does not yet hold a value, the given value is stored
+// (provided that the element is admitted by the mask). Otherwise \a op is used to combine the
+// current value of the element with the given value.
+*/
+template< typename Type >  // Data type of the accumulated values
+template< bool Masked      // Masking flag
+        , bool Complement  // Complement flag for the mask
+        , typename T       // Type of the value to be accumulated
+        , typename OP >    // Type of the accumulation operation
+inline void SparseAccumulator<Type>::accumulate( size_t index, const T& value, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid accumulator access index" );
+
+   if( mode_ == denseMode )
+   {
+      size_t& stamp( stamps_[index] );
+
+      if( stamp == base_+1UL ) {
+         op( values_[index], value );
+      }
+      else if( !Masked || ( ( stamp == base_ ) != Complement ) ) {
+         values_[index] = value;
+         stamp = base_+1UL;
+         used_.push_back( index );
+         ++nonzeros_;
+         if( index < min_ ) min_ = index;
+         if( index > max_ ) max_ = index;
+      }
+   }
+   else if( mode_ == hashMode )
+   {
+      size_t slot( probe( index ) );
+
+      if( stamps_[slot] == base_+1UL ) {
+         op( values_[slot], value );
+      }
+      else if( !Masked || ( ( stamps_[slot] == base_ ) != Complement ) ) {
+         if( stamps_[slot] < base_ )
+            slot = occupy( index );
+         values_[slot] = value;
+         stamps_[slot] = base_+1UL;
+         ++nonzeros_;
+      }
+   }
+   else
+   {
+      const auto pos( std::lower_bound( list_.begin(), list_.end(), index,
+         []( const Entry& entry, size_t i ) { return entry.index < i; } ) );
+      const bool found( pos != list_.end() && pos->index == index );
+
+      if( found && pos->touched ) {
+         op( pos->value, value );
+      }
+      else if( !Masked || ( found != Complement ) ) {
+         if( found ) {
+            pos->value   = value;
+            pos->touched = true;
+         }
+         else {
+            list_.insert( pos, Entry{ index, Type( value ), true } );
+         }
+         ++nonzeros_;
+         if( list_.size() > sortedMax )
+            convertToHash();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the given value to the element at the given index.
+//
+// \param index The index of the element.
+// \param value The value to be added.
+// \return void
+*/
+template< typename Type >  // Data type of the accumulated values
+template< typename T >     // Type of the value to be added
+inline void SparseAccumulator<Type>::add( size_t index, const T& value )
+{
+   accumulate<false,false>( index, value, []( Type& a, const T& b ) { a += b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Combines the given value with the element at the given index.
+//
+// \param index The index of the element.
+// \param value The value to be combined with the element.
+// \param op The binary operation for the combination of two values.
+// \return void
+//
+// In case the element does not yet hold a value, \a value is stored. Otherwise the element is
+// set to \a op( element, value ) (as for instance the additive operation of a semiring).
+*/
+template< typename Type >  // Data type of the accumulated values
+template< typename T       // Type of the value to be combined
+        , typename OP >    // Type of the binary operation
+inline void SparseAccumulator<Type>::add( size_t index, const T& value, OP op )
+{
+   accumulate<false,false>( index, value, [&op]( Type& a, const T& b ) { a = op( a, b ); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks the element at the given index as part of the mask of the current row.
+//
+// \param index The index of the element.
+// \return void
+//
+// Enabled elements are only part of the extracted row in case a value is accumulated via
+// add() or addMasked().
+*/
+template< typename Type >  // Data type of the accumulated values
+inline void SparseAccumulator<Type>::enable( size_t index )
+{
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid accumulator access index" );
+
+   if( mode_ == denseMode )
+   {
+      if( stamps_[index] < base_ )
+         stamps_[index] = base_;
+   }
+   else if( mode_ == hashMode )
+   {
+      if( stamps_[probe( index )] < base_ )
+         occupy( index );
+   }
+   else
+   {
+      const auto pos( std::lower_bound( list_.begin(), list_.end(), index,
+         []( const Entry& entry, size_t i ) { return entry.index < i; } ) );
+
+      if( pos == list_.end() || pos->index != index ) {
+         list_.insert( pos, Entry{ index, Type(), false } );
+         if( list_.size() > sortedMax )
+            convertToHash();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked addition of the given value to the element at the given index.
+//
+// \param index The index of the element.
+// \param value The value to be added.
+// \return void
+//
+// In case \a Complement is \a false, the value is only added in case the element has been
+// enabled (see enable()). In case \a Complement is \a true, the value is only added in case the
+// element has not been enabled.
+*/
+template< typename Type >  // Data type of the accumulated values
+template< bool Complement  // Complement flag for the mask
+        , typename T >     // Type of the value to be added
+inline void SparseAccumulator<Type>::addMasked( size_t index, const T& value )
+{
+   accumulate<true,Complement>( index, value, []( Type& a, const T& b ) { a += b; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the accumulated elements of the current row and resets the accumulator.
+//
+// \param op The operation to be called for each accumulated element.
+// \return void
+//
+// This function calls \a op( index, value ) for all accumulated elements of the current row
+// in ascending order of their indices. Afterwards the accumulator is reset for the next row.
+*/
+template< typename Type >  // Data type of the accumulated values
+template< typename OP >    // Type of the extraction operation
+void SparseAccumulator<Type>::extract( OP op )
+{
+   if( mode_ == denseMode )
+   {
+      if( nonzeros_ > 0UL )
+      {
+         const size_t touched( base_+1UL );
+
+         if( ( nonzeros_ + nonzeros_ ) < ( max_ - min_ ) ) {
+            std::sort( used_.begin(), used_.end() );
+            for( size_t index : used_ )
+               op( index, values_[index] );
+         }
+         else {
+            for( size_t index=min_; index<=max_; ++index ) {
+               if( stamps_[index] == touched )
+                  op( index, values_[index] );
+            }
+         }
+      }
+   }
+   else if( mode_ == hashMode )
+   {
+      const size_t touched( base_+1UL );
+
+      const auto last( std::remove_if( used_.begin(), used_.end(),
+         [&]( size_t slot ) { return stamps_[slot] != touched; } ) );
+      std::sort( used_.begin(), last,
+         [&]( size_t a, size_t b ) { return keys_[a] < keys_[b]; } );
+
+      for( auto slot=used_.begin(); slot!=last; ++slot )
+         op( keys_[*slot], values_[*slot] );
+   }
+   else
+   {
+      for( const Entry& entry : list_ ) {
+         if( entry.touched )
+            op( entry.index, entry.value );
+      }
+   }
+
+   clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the sparse accumulator of the calling thread.
+// \ingroup sparse_matrix
+//
+// \return Reference to the thread-local sparse accumulator for the given value type.
+//
+// Each thread owns a single sparse accumulator per value type, which keeps its memory between
+// several operations. Since the accumulator is shared by all operations of the thread, it must
+// be fully extracted (or cleared) before any other operation that uses the accumulator of the
+// same value type is executed (for instance the evaluation of an operand).
+*/
+template< typename Type >  // Data type of the accumulated values
+inline SparseAccumulator<Type>& getSparseAccumulator()
+{
+   thread_local SparseAccumulator<Type> accumulator;
+   return accumulator;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,306 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/ValueEncoding.h
+//  \brief Header file for the value encodings of the EncodedMatrix class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_VALUEENCODING_H_
+#define _BLAZE_MATH_SPARSE_VALUEENCODING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <cstring>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/util/constraints/Builtin.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BFLOAT16
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Storage type for single precision values truncated to 16 bits.
+// \ingroup encoded_matrix
+//
+// The BFloat16 class stores the upper 16 bits of a single precision floating point value (the
+// sign, the complete 8 bit exponent, and 7 bits of the mantissa). It therefore provides the
+// same range as \c float at a precision of roughly 2-3 decimal digits. The class is solely
+// intended as storage type (for instance as encoding of an EncodedMatrix) and does not provide
+// any arithmetic operations. Values are rounded to the nearest representable value on
+// construction and are converted back to \c float on access.
+*/
+class BFloat16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline BFloat16() noexcept : bits_( 0U ) {}
+   explicit inline BFloat16( float value ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline uint16_t bits() const noexcept { return bits_; }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The upper 16 bits of the single precision value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be stored.
+//
+// The value is rounded to the nearest representable value (ties to even). NaN values are
+// preserved as quiet NaNs.
+*/
+inline BFloat16::BFloat16( float value ) noexcept
+   : bits_()  // The upper 16 bits of the single precision value
+{
+   uint32_t bits;
+   std::memcpy( &bits, &value, sizeof( bits ) );
+
+   if( ( bits & 0x7FFFFFFFU ) > 0x7F800000U ) {
+      bits_ = static_cast<uint16_t>( ( bits >> 16 ) | 0x0040U );
+   }
+   else {
+      bits += 0x7FFFU + ( ( bits >> 16 ) & 1U );
+      bits_ = static_cast<uint16_t>( bits >> 16 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to a single precision value.
+//
+// \return The stored value as single precision value.
+*/
+inline BFloat16::operator float() const noexcept
+{
+   const uint32_t bits( static_cast<uint32_t>( bits_ ) << 16 );
+
+   float value;
+   std::memcpy( &value, &bits, sizeof( value ) );
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DICTIONARY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dictionary encoding of the values of an EncodedMatrix.
+// \ingroup encoded_matrix
+//
+// The Dictionary class template selects the dictionary encoding for an EncodedMatrix: every
+// distinct value of the matrix is stored once in a dictionary and the non-zero elements only
+// store the position of their value within the dictionary by means of the unsigned integral
+// type \a IT. Therefore a dictionary with \c uint8_t codes for instance can hold up to 256
+// distinct values.
+*/
+template< typename IT >  // Type of the dictionary codes
+struct Dictionary
+{
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE( IT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS VALUEENCODING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Encoding and decoding of the values of an EncodedMatrix.
+// \ingroup encoded_matrix
+//
+// The ValueEncoding class template converts the values of an EncodedMatrix with element type
+// \a Type from and to the codes stored in the matrix. This default implementation stores each
+// value as an instance of the (lower precision) type \a Encoding and ignores the dictionary.
+*/
+template< typename Type        // Data type of the matrix
+        , typename Encoding >  // Storage type of the values
+struct ValueEncoding
+{
+   //**Type definitions****************************************************************************
+   using Code = Encoding;  //!< Type of the stored codes.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the use of a dictionary.
+   enum : bool { dictionary = false };
+   //**********************************************************************************************
+
+   //**Encode function*****************************************************************************
+   /*!\brief Encoding of a single value.
+   //
+   // \param value The value to be encoded.
+   // \return The according code.
+   */
+   static inline Code encode( const Type& value, const Type* /*dict*/, size_t /*size*/ ) {
+      return Code( value );
+   }
+   //**********************************************************************************************
+
+   //**Decode function*****************************************************************************
+   /*!\brief Decoding of a single code.
+   //
+   // \param code The code to be decoded.
+   // \return The according value.
+   */
+   static inline Type decode( Code code, const Type* /*dict*/ ) noexcept {
+      return Type( code );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the ValueEncoding class template for dictionary encodings.
+// \ingroup encoded_matrix
+//
+// The code of each value is its position within the dictionary of the matrix. Since the values
+// of the dictionary have to be ordered for the lookup, the dictionary encoding is restricted to
+// built-in data types.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the dictionary codes
+struct ValueEncoding< Type, Dictionary<IT> >
+{
+   //**Type definitions****************************************************************************
+   using Code = IT;  //!< Type of the stored codes.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the use of a dictionary.
+   enum : bool { dictionary = true };
+   //**********************************************************************************************
+
+   //**Comparison functions************************************************************************
+   /*!\brief Strict weak ordering of the dictionary values.
+   //
+   // \param a The left-hand side value.
+   // \param b The right-hand side value.
+   // \return \a true if \a a is ordered before \a b, \a false if not.
+   //
+   // In contrast to the less-than operator, all NaN values are considered equivalent and are
+   // ordered after all other values. Therefore this function provides a valid ordering for
+   // all possible values of \a Type.
+   */
+   static inline bool less( const Type& a, const Type& b ) noexcept {
+      return isnan( b ) ? !isnan( a ) : a < b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Equivalence of two dictionary values.
+   //
+   // \param a The left-hand side value.
+   // \param b The right-hand side value.
+   // \return \a true if \a a and \a b are represented by the same dictionary entry.
+   */
+   static inline bool equal( const Type& a, const Type& b ) noexcept {
+      return !less( a, b ) && !less( b, a );
+   }
+   //**********************************************************************************************
+
+   //**Decode function*****************************************************************************
+   /*!\brief Decoding of a single code.
+   //
+   // \param code The code to be decoded.
+   // \param dict Pointer to the first element of the dictionary.
+   // \return The according value.
+   */
+   static inline Type decode( Code code, const Type* dict ) noexcept {
+      return dict[code];
+   }
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
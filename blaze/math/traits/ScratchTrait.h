@@ -0,0 +1,146 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/traits/ScratchTrait.h
+//  \brief Header file for the scratch trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TRAITS_SCRATCHTRAIT_H_
+#define _BLAZE_MATH_TRAITS_SCRATCHTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/Forward.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the type of intermediate results within expression templates.
+// \ingroup math_traits
+//
+// The ScratchTrait class template determines the type that is used for the intermediate
+// evaluation of an operand with result type \a T within an expression template. In case \a T is
+// a DynamicVector or DynamicMatrix with vectorizable element type, the nested \a Type is set to
+// the according ScratchVector or ScratchMatrix, which draw their memory from the scratch arena
+// of the calling thread (see ScratchArena). For all other types, \a Type corresponds to \a T.
+//
+// Note that in case the HPX parallelization is selected, the scratch arena is not used since
+// HPX tasks may be suspended and resumed on a different thread.
+*/
+template< typename T >  // Type of the intermediate result
+struct ScratchTrait
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = T;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the ScratchTrait class template for dynamic vectors.
+// \ingroup math_traits
+*/
+template< typename T    // Data type of the vector
+        , bool TF       // Transpose flag
+        , typename A >  // Type of the allocator
+struct ScratchTrait< DynamicVector<T,TF,A> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsVectorizable<T>, Bool< !BLAZE_HPX_PARALLEL_MODE > >
+                   , ScratchVector<T,TF>
+                   , DynamicVector<T,TF,A> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the ScratchTrait class template for dynamic matrices.
+// \ingroup math_traits
+*/
+template< typename T    // Data type of the matrix
+        , bool SO       // Storage order
+        , typename A >  // Type of the allocator
+struct ScratchTrait< DynamicMatrix<T,SO,A> >
+{
+ public:
+   //**********************************************************************************************
+   using Type = If_< And< IsVectorizable<T>, Bool< !BLAZE_HPX_PARALLEL_MODE > >
+                   , ScratchMatrix<T,SO>
+                   , DynamicMatrix<T,SO,A> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the ScratchTrait type trait.
+// \ingroup math_traits
+//
+// The ScratchTrait_ alias declaration provides a convenient shortcut to access the nested
+// \a Type of the ScratchTrait class template. For instance, given the type \a T the following
+// two type definitions are identical:
+
+   \code
+   using Type1 = typename ScratchTrait<T>::Type;
+   using Type2 = ScratchTrait_<T>;
+   \endcode
+*/
+template< typename T >  // Type of the intermediate result
+using ScratchTrait_ = typename ScratchTrait<T>::Type;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
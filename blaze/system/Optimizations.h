@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/Optimizations.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -56,6 +57,10 @@ namespace blaze {
 constexpr bool usePadding          = BLAZE_USE_PADDING;
 constexpr bool useStreaming        = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool useFirstTouch       = ( BLAZE_NUMA_PLACEMENT == 1 );
+constexpr bool useInterleaving     = ( BLAZE_NUMA_PLACEMENT == 2 );
+
+constexpr size_t scratchArenaLimit = BLAZE_SCRATCH_ARENA_LIMIT;
 /*! \endcond */
 //*************************************************************************************************
 
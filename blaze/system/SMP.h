@@ -149,4 +149,32 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  TBB PARALLEL MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the Intel TBB parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the parallelization based on the Intel Threading
+// Building Blocks (TBB). In case the \c BLAZE_USE_TBB_THREADS command line argument is specified
+// during compilation the Blaze library attempts to parallelize all matrix and vector computations.
+// Note however that the OpenMP-based, the C++11 thread-based, the Boost thread-based, and the HPX
+// parallelizations have priority over the TBB parallelization and will be preferred in case
+// several parallelizations are activated. In case no parallelization is enabled, all computations
+// are performed on a single compute core.
+*/
+#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && defined(BLAZE_USE_TBB_THREADS)
+#define BLAZE_TBB_PARALLEL_MODE 1
+#else
+#define BLAZE_TBB_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
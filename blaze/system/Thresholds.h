@@ -43,6 +43,7 @@
 #include <blaze/system/Debugging.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 
@@ -939,58 +940,441 @@ constexpr size_t SMP_TSMATTSMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATTRANSPOSE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the conversion of a sparse matrix into the opposite
+// storage order can be executed in parallel. In case the number of non-zero elements of the
+// sparse matrix is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of non-zero elements is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_SMATTRANSPOSE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense/sparse matrix conversion threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATSMATCONVERT_USER_THRESHOLD while the
+// Blaze debug mode is active. It specifies when the conversion between a dense and a sparse
+// matrix can be executed in parallel. In case the number of elements of the dense matrix is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATSMATCONVERT_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix reordering threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATREORDER_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the reordering of a sparse matrix can be executed in
+// parallel. In case the number of non-zero elements of the sparse matrix is larger or equal to
+// this threshold, the operation is executed in parallel. If the number of non-zero elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATREORDER_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t SMP_DVECASSIGN_DEFAULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD      : BLAZE_SMP_DVECASSIGN_THRESHOLD      );
+constexpr size_t SMP_DVECSCALARMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DVECSCALARMULT_THRESHOLD  );
+constexpr size_t SMP_DVECDVECADD_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECADD_THRESHOLD     );
+constexpr size_t SMP_DVECDVECSUB_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECSUB_THRESHOLD     );
+constexpr size_t SMP_DVECDVECMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECMULT_THRESHOLD    );
+constexpr size_t SMP_DVECDVECDIV_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD     : BLAZE_SMP_DVECDVECDIV_THRESHOLD     );
+constexpr size_t SMP_DVECDVECOUTER_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECOUTER_THRESHOLD   );
+constexpr size_t SMP_DMATDVECMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDVECMULT_THRESHOLD    );
+constexpr size_t SMP_TDMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDVECDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATSVECMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATSVECMULT_THRESHOLD    );
+constexpr size_t SMP_TDMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSVECDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATDVECMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATDVECMULT_THRESHOLD    );
+constexpr size_t SMP_TSMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDVECSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATSVECMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSVECMULT_THRESHOLD    );
+constexpr size_t SMP_TSMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSVECSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATASSIGN_DEFAULT_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD      : BLAZE_SMP_DMATASSIGN_THRESHOLD      );
+constexpr size_t SMP_DMATSCALARMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATSCALARMULT_THRESHOLD  );
+constexpr size_t SMP_DMATDMATADD_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD     : BLAZE_SMP_DMATDMATADD_THRESHOLD     );
+constexpr size_t SMP_DMATTDMATADD_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATTDMATADD_THRESHOLD    );
+constexpr size_t SMP_DMATDMATSUB_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD     : BLAZE_SMP_DMATDMATSUB_THRESHOLD     );
+constexpr size_t SMP_DMATTDMATSUB_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATTDMATSUB_THRESHOLD    );
+constexpr size_t SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD   );
+constexpr size_t SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD  );
+constexpr size_t SMP_DMATDMATMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATMULT_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_DMATSMATMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_DMATSMATMULT_THRESHOLD    );
+constexpr size_t SMP_DMATTSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TDMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATDMATMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATDMATMULT_THRESHOLD    );
+constexpr size_t SMP_SMATTDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATSMATMULT_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSMATMULT_THRESHOLD    );
+constexpr size_t SMP_SMATTSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_TSMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_SMATTRANSPOSE_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATTRANSPOSE_DEBUG_THRESHOLD   : BLAZE_SMP_SMATTRANSPOSE_THRESHOLD   );
+constexpr size_t SMP_DMATSMATCONVERT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATCONVERT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSMATCONVERT_THRESHOLD );
+constexpr size_t SMP_SMATREORDER_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREORDER_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREORDER_THRESHOLD     );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME SMP THRESHOLDS
+//
+//=================================================================================================
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
+/*!\brief Table of the runtime values of all SMP thresholds.
+// \ingroup config
+//
+// The SMPThresholdTable class template holds the currently active values of all SMP thresholds.
+// The values are initialized with the compile time defaults and can be adapted at runtime via
+// the setSMPThreshold() function or via the calibration functions (see calibrateSMPThresholds()
+// and loadSMPThresholds()). The values are stored in a plain, non-atomic array, which is read
+// by every operation deciding between a serial and a parallel execution. Therefore any change
+// of a threshold concurrent to the execution of an operation, in particular of a parallel
+// operation, constitutes a data race.
+*/
+template< typename T >
+struct SMPThresholdTable
+{
+   static constexpr size_t size = 50UL;  //!< The total number of SMP thresholds.
+
+   static size_t            values  [size];  //!< The current values of the SMP thresholds.
+   static const size_t      defaults[size];  //!< The compile time defaults of the SMP thresholds.
+   static const char* const names   [size];  //!< The names of the SMP thresholds.
+};
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+constexpr size_t SMPThresholdTable<T>::size;
+
+template< typename T >
+size_t SMPThresholdTable<T>::values[SMPThresholdTable<T>::size] = {
+   SMP_DVECASSIGN_DEFAULT_THRESHOLD,
+   SMP_DVECSCALARMULT_DEFAULT_THRESHOLD,
+   SMP_DVECDVECADD_DEFAULT_THRESHOLD,
+   SMP_DVECDVECSUB_DEFAULT_THRESHOLD,
+   SMP_DVECDVECMULT_DEFAULT_THRESHOLD,
+   SMP_DVECDVECDIV_DEFAULT_THRESHOLD,
+   SMP_DVECDVECOUTER_DEFAULT_THRESHOLD,
+   SMP_DMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATASSIGN_DEFAULT_THRESHOLD,
+   SMP_DMATSCALARMULT_DEFAULT_THRESHOLD,
+   SMP_DMATDMATADD_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATADD_DEFAULT_THRESHOLD,
+   SMP_DMATDMATSUB_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATSUB_DEFAULT_THRESHOLD,
+   SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD,
+   SMP_DMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTRANSPOSE_DEFAULT_THRESHOLD,
+   SMP_DMATSMATCONVERT_DEFAULT_THRESHOLD,
+   SMP_SMATREORDER_DEFAULT_THRESHOLD
+};
+
+template< typename T >
+const size_t SMPThresholdTable<T>::defaults[SMPThresholdTable<T>::size] = {
+   SMP_DVECASSIGN_DEFAULT_THRESHOLD,
+   SMP_DVECSCALARMULT_DEFAULT_THRESHOLD,
+   SMP_DVECDVECADD_DEFAULT_THRESHOLD,
+   SMP_DVECDVECSUB_DEFAULT_THRESHOLD,
+   SMP_DVECDVECMULT_DEFAULT_THRESHOLD,
+   SMP_DVECDVECDIV_DEFAULT_THRESHOLD,
+   SMP_DVECDVECOUTER_DEFAULT_THRESHOLD,
+   SMP_DMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATDVECMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATSVECMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATASSIGN_DEFAULT_THRESHOLD,
+   SMP_DMATSCALARMULT_DEFAULT_THRESHOLD,
+   SMP_DMATDMATADD_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATADD_DEFAULT_THRESHOLD,
+   SMP_DMATDMATSUB_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATSUB_DEFAULT_THRESHOLD,
+   SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD,
+   SMP_DMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_DMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATDMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATSMATMULT_DEFAULT_THRESHOLD,
+   SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD,
+   SMP_SMATTRANSPOSE_DEFAULT_THRESHOLD,
+   SMP_DMATSMATCONVERT_DEFAULT_THRESHOLD,
+   SMP_SMATREORDER_DEFAULT_THRESHOLD
+};
+
+template< typename T >
+const char* const SMPThresholdTable<T>::names[SMPThresholdTable<T>::size] = {
+   "SMP_DVECASSIGN_THRESHOLD",
+   "SMP_DVECSCALARMULT_THRESHOLD",
+   "SMP_DVECDVECADD_THRESHOLD",
+   "SMP_DVECDVECSUB_THRESHOLD",
+   "SMP_DVECDVECMULT_THRESHOLD",
+   "SMP_DVECDVECDIV_THRESHOLD",
+   "SMP_DVECDVECOUTER_THRESHOLD",
+   "SMP_DMATDVECMULT_THRESHOLD",
+   "SMP_TDMATDVECMULT_THRESHOLD",
+   "SMP_TDVECDMATMULT_THRESHOLD",
+   "SMP_TDVECTDMATMULT_THRESHOLD",
+   "SMP_DMATSVECMULT_THRESHOLD",
+   "SMP_TDMATSVECMULT_THRESHOLD",
+   "SMP_TSVECDMATMULT_THRESHOLD",
+   "SMP_TSVECTDMATMULT_THRESHOLD",
+   "SMP_SMATDVECMULT_THRESHOLD",
+   "SMP_TSMATDVECMULT_THRESHOLD",
+   "SMP_TDVECSMATMULT_THRESHOLD",
+   "SMP_TDVECTSMATMULT_THRESHOLD",
+   "SMP_SMATSVECMULT_THRESHOLD",
+   "SMP_TSMATSVECMULT_THRESHOLD",
+   "SMP_TSVECSMATMULT_THRESHOLD",
+   "SMP_TSVECTSMATMULT_THRESHOLD",
+   "SMP_DMATASSIGN_THRESHOLD",
+   "SMP_DMATSCALARMULT_THRESHOLD",
+   "SMP_DMATDMATADD_THRESHOLD",
+   "SMP_DMATTDMATADD_THRESHOLD",
+   "SMP_DMATDMATSUB_THRESHOLD",
+   "SMP_DMATTDMATSUB_THRESHOLD",
+   "SMP_DMATDMATSCHUR_THRESHOLD",
+   "SMP_DMATTDMATSCHUR_THRESHOLD",
+   "SMP_DMATDMATMULT_THRESHOLD",
+   "SMP_DMATTDMATMULT_THRESHOLD",
+   "SMP_TDMATDMATMULT_THRESHOLD",
+   "SMP_TDMATTDMATMULT_THRESHOLD",
+   "SMP_DMATSMATMULT_THRESHOLD",
+   "SMP_DMATTSMATMULT_THRESHOLD",
+   "SMP_TDMATSMATMULT_THRESHOLD",
+   "SMP_TDMATTSMATMULT_THRESHOLD",
+   "SMP_SMATDMATMULT_THRESHOLD",
+   "SMP_SMATTDMATMULT_THRESHOLD",
+   "SMP_TSMATDMATMULT_THRESHOLD",
+   "SMP_TSMATTDMATMULT_THRESHOLD",
+   "SMP_SMATSMATMULT_THRESHOLD",
+   "SMP_SMATTSMATMULT_THRESHOLD",
+   "SMP_TSMATSMATMULT_THRESHOLD",
+   "SMP_TSMATTSMATMULT_THRESHOLD",
+   "SMP_SMATTRANSPOSE_THRESHOLD",
+   "SMP_DMATSMATCONVERT_THRESHOLD",
+   "SMP_SMATREORDER_THRESHOLD"
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Handle for a single runtime SMP threshold.
+// \ingroup config
+//
+// The SMPThreshold class template represents the SMP threshold with index \a I within the table
+// of runtime SMP thresholds. It implicitly converts to the currently active value of the
+// threshold and can be used to query and to adapt the threshold:
+
+   \code
+   const size_t threshold( blaze::SMP_DVECDVECADD_THRESHOLD );  // Querying the current value
+
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 50000UL );  // Adapting the value
+   \endcode
+*/
+template< size_t I >  // Index of the SMP threshold
+struct SMPThreshold
+{
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the currently active value of the SMP threshold.
+   //
+   // \return The current value of the SMP threshold.
+   */
+   inline operator size_t() const noexcept {
+      return SMPThresholdTable<int>::values[I];
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr SMPThreshold<0UL > SMP_DVECASSIGN_THRESHOLD{};
+constexpr SMPThreshold<1UL > SMP_DVECSCALARMULT_THRESHOLD{};
+constexpr SMPThreshold<2UL > SMP_DVECDVECADD_THRESHOLD{};
+constexpr SMPThreshold<3UL > SMP_DVECDVECSUB_THRESHOLD{};
+constexpr SMPThreshold<4UL > SMP_DVECDVECMULT_THRESHOLD{};
+constexpr SMPThreshold<5UL > SMP_DVECDVECDIV_THRESHOLD{};
+constexpr SMPThreshold<6UL > SMP_DVECDVECOUTER_THRESHOLD{};
+constexpr SMPThreshold<7UL > SMP_DMATDVECMULT_THRESHOLD{};
+constexpr SMPThreshold<8UL > SMP_TDMATDVECMULT_THRESHOLD{};
+constexpr SMPThreshold<9UL > SMP_TDVECDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<10UL> SMP_TDVECTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<11UL> SMP_DMATSVECMULT_THRESHOLD{};
+constexpr SMPThreshold<12UL> SMP_TDMATSVECMULT_THRESHOLD{};
+constexpr SMPThreshold<13UL> SMP_TSVECDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<14UL> SMP_TSVECTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<15UL> SMP_SMATDVECMULT_THRESHOLD{};
+constexpr SMPThreshold<16UL> SMP_TSMATDVECMULT_THRESHOLD{};
+constexpr SMPThreshold<17UL> SMP_TDVECSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<18UL> SMP_TDVECTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<19UL> SMP_SMATSVECMULT_THRESHOLD{};
+constexpr SMPThreshold<20UL> SMP_TSMATSVECMULT_THRESHOLD{};
+constexpr SMPThreshold<21UL> SMP_TSVECSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<22UL> SMP_TSVECTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<23UL> SMP_DMATASSIGN_THRESHOLD{};
+constexpr SMPThreshold<24UL> SMP_DMATSCALARMULT_THRESHOLD{};
+constexpr SMPThreshold<25UL> SMP_DMATDMATADD_THRESHOLD{};
+constexpr SMPThreshold<26UL> SMP_DMATTDMATADD_THRESHOLD{};
+constexpr SMPThreshold<27UL> SMP_DMATDMATSUB_THRESHOLD{};
+constexpr SMPThreshold<28UL> SMP_DMATTDMATSUB_THRESHOLD{};
+constexpr SMPThreshold<29UL> SMP_DMATDMATSCHUR_THRESHOLD{};
+constexpr SMPThreshold<30UL> SMP_DMATTDMATSCHUR_THRESHOLD{};
+constexpr SMPThreshold<31UL> SMP_DMATDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<32UL> SMP_DMATTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<33UL> SMP_TDMATDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<34UL> SMP_TDMATTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<35UL> SMP_DMATSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<36UL> SMP_DMATTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<37UL> SMP_TDMATSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<38UL> SMP_TDMATTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<39UL> SMP_SMATDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<40UL> SMP_SMATTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<41UL> SMP_TSMATDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<42UL> SMP_TSMATTDMATMULT_THRESHOLD{};
+constexpr SMPThreshold<43UL> SMP_SMATSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<44UL> SMP_SMATTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<45UL> SMP_TSMATSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<46UL> SMP_TSMATTSMATMULT_THRESHOLD{};
+constexpr SMPThreshold<47UL> SMP_SMATTRANSPOSE_THRESHOLD{};
+constexpr SMPThreshold<48UL> SMP_DMATSMATCONVERT_THRESHOLD{};
+constexpr SMPThreshold<49UL> SMP_SMATREORDER_THRESHOLD{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the given SMP threshold.
+// \ingroup config
+//
+// \param threshold The SMP threshold to be adapted.
+// \param value The new value of the SMP threshold.
+// \return void
+//
+// This function sets the runtime value of the given SMP threshold, which is consulted by all
+// subsequent operations in order to decide between a serial and a parallel execution:
+
+   \code
+   blaze::setSMPThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD, 500UL );
+   \endcode
+
+// Note that the SMP thresholds are not synchronized. The function must therefore not be called
+// while any other thread executes a (parallel) operation, since the thresholds are read by all
+// threads without any synchronization. Ideally all thresholds are set once at the beginning of
+// the program before the first parallel operation.
+*/
+template< size_t I >  // Index of the SMP threshold
+inline void setSMPThreshold( SMPThreshold<I> threshold, size_t value ) noexcept
+{
+   UNUSED_PARAMETER( threshold );
+   SMPThresholdTable<int>::values[I] = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting all SMP thresholds to their compile time defaults.
+// \ingroup config
+//
+// \return void
+//
+// Note that this function must not be called while any other thread executes a (parallel)
+// operation, since the SMP thresholds are read without any synchronization.
+*/
+inline void resetSMPThresholds() noexcept
+{
+   for( size_t i=0UL; i<SMPThresholdTable<int>::size; ++i ) {
+      SMPThresholdTable<int>::values[i] = SMPThresholdTable<int>::defaults[i];
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 
@@ -1015,53 +1399,56 @@ BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
 
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_DEFAULT_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_DEFAULT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_DEFAULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRANSPOSE_DEFAULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATCONVERT_DEFAULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATREORDER_DEFAULT_THRESHOLD    >= 0UL );
 
 }
 /*! \endcond */
@@ -42,6 +42,7 @@
 
 #include <blaze/util/Memory.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsAlignedAllocator.h>
 #include <blaze/util/Unused.h>
 
 
@@ -385,6 +386,24 @@ inline bool operator!=( const AlignedAllocator<T1>& lhs, const AlignedAllocator<
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  ISALIGNEDALLOCATOR SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsAlignedAllocator< AlignedAllocator<T> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -43,19 +43,141 @@
 #if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
 #  include <malloc.h>
 #endif
+#if defined(__linux__)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
 #include <cstdlib>
+#include <memory>
 #include <new>
+#include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  NUMA PLACEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for the NUMA placement of a memory range.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \param mode The NUMA memory policy (MPOL_BIND or MPOL_INTERLEAVE).
+// \param nodes The bit mask of the NUMA nodes (0 for all available NUMA nodes).
+// \return \a true in case the memory policy was applied, \a false if not.
+//
+// This function applies the given NUMA memory policy to all memory pages that are entirely
+// contained in the given memory range. Pages that have already been touched are migrated
+// accordingly. On all systems except Linux the function has no effect and returns \a false.
+*/
+inline bool mbind_backend( const void* address, size_t size, int mode,
+                           unsigned long nodes ) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+   constexpr int           memsAllowed( 4 );  // MPOL_F_MEMS_ALLOWED
+   constexpr unsigned long moveFlag   ( 2 );  // MPOL_MF_MOVE
+   constexpr unsigned long maxNodes   ( sizeof(unsigned long)*8UL + 1UL );
+
+   if( nodes == 0UL ) {
+      int policy( 0 );
+      if( syscall( SYS_get_mempolicy, &policy, &nodes, maxNodes, nullptr, memsAllowed ) != 0 )
+         return false;
+   }
+
+   const size_t pagesize( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+   const size_t first   ( reinterpret_cast<size_t>( address ) );
+   const size_t begin   ( ( first + pagesize - 1UL ) & ~( pagesize - 1UL ) );
+   const size_t end     ( ( first + size ) & ~( pagesize - 1UL ) );
+
+   if( begin >= end || nodes == 0UL )
+      return false;
+
+   return syscall( SYS_mbind, begin, end - begin, mode, &nodes, maxNodes, moveFlag ) == 0;
+#else
+   UNUSED_PARAMETER( address, size, mode, nodes );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Interleaves the given memory range among all available NUMA nodes.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \return \a true in case the memory range was interleaved, \a false if not.
+//
+// This function distributes all memory pages that are entirely contained in the given memory
+// range page by page among all NUMA nodes the calling process is allowed to allocate memory
+// on. This evenly spreads the memory bandwidth required for the access of large data structures
+// among all NUMA nodes:
+
+   \code
+   blaze::DynamicVector<double> v( 100000000UL );
+   blaze::interleaveMemory( v.data(), v.capacity()*sizeof(double) );
+   \endcode
+
+// Note that NUMA placement is currently only supported on Linux systems. On all other systems
+// the function has no effect and returns \a false.
+*/
+inline bool interleaveMemory( const void* address, size_t size ) noexcept
+{
+   return mbind_backend( address, size, 3, 0UL );  // MPOL_INTERLEAVE
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given memory range to a single NUMA node.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory range.
+// \param size The size of the memory range in bytes.
+// \param node The index of the NUMA node.
+// \return \a true in case the memory range was bound to the NUMA node, \a false if not.
+//
+// This function places all memory pages that are entirely contained in the given memory range
+// on the given NUMA node. Pages that have already been touched are migrated to the NUMA node:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   blaze::bindMemory( A.data(), A.capacity()*sizeof(double), 1UL );
+   \endcode
+
+// In case the NUMA node does not exist or the calling process is not allowed to allocate memory
+// on the node, the function returns \a false. Note that NUMA placement is currently only
+// supported on Linux systems. On all other systems the function has no effect and returns
+// \a false.
+*/
+inline bool bindMemory( const void* address, size_t size, size_t node ) noexcept
+{
+   if( node >= sizeof(unsigned long)*8UL )
+      return false;
+
+   return mbind_backend( address, size, 2, 1UL << node );  // MPOL_BIND
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  BACKEND ALLOCATION FUNCTIONS
@@ -74,7 +196,8 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. In case interleaved allocation is selected (see BLAZE_NUMA_PLACEMENT), allocations
+// of at least 1 MiB are distributed among all available NUMA nodes.
 */
 inline byte_t* allocate_backend( size_t size, size_t alignment )
 {
@@ -92,6 +215,10 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
       BLAZE_THROW_BAD_ALLOC;
    }
 
+   if( useInterleaving && size >= 1048576UL ) {
+      interleaveMemory( raw, size );
+   }
+
    return reinterpret_cast<byte_t*>( raw );
 }
 /*! \endcond */
@@ -278,6 +405,122 @@ DisableIf_< IsBuiltin<T> > deallocate( T* address )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Array allocation for built-in data types via the given allocator.
+// \ingroup util
+//
+// \param size The number of elements of the given type to allocate.
+// \param alloc The allocator to be used for the allocation.
+// \return Pointer to the first element of the array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates an array of \a size uninitialized elements of the built-in data type
+// \a T via the given allocator. Any alignment guarantees are provided by the allocator. The
+// array has to be deallocated via the according deallocate() function.
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+EnableIf_< IsBuiltin<T>, T* > allocate( size_t size, Alloc& alloc )
+{
+   return std::allocator_traits<Alloc>::allocate( alloc, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Array allocation for user-specific class types via the given allocator.
+// \ingroup util
+//
+// \param size The number of elements of the given type to allocate.
+// \param alloc The allocator to be used for the allocation.
+// \return Pointer to the first element of the array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates an array of \a size elements of the user-specific class type \a T
+// via the given allocator and default constructs all elements. In case any element throws an
+// exception during construction, all elements that have already been constructed are destroyed
+// in reverse order and the allocated memory is deallocated again. The array has to be
+// deallocated via the according deallocate() function.
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+DisableIf_< IsBuiltin<T>, T* > allocate( size_t size, Alloc& alloc )
+{
+   using Traits = std::allocator_traits<Alloc>;
+
+   T* const address( Traits::allocate( alloc, size ) );
+   size_t i( 0UL );
+
+   try {
+      for( ; i<size; ++i )
+         Traits::construct( alloc, address+i );
+   }
+   catch( ... ) {
+      while( i != 0UL )
+         Traits::destroy( alloc, address+(--i) );
+      Traits::deallocate( alloc, address, size );
+      throw;
+   }
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory for built-in data types via the given allocator.
+// \ingroup util
+//
+// \param address The address of the first element of the array to be deallocated.
+// \param size The number of elements of the array.
+// \param alloc The allocator that was used for the allocation.
+// \return void
+//
+// This function deallocates the given memory that was previously allocated via the allocate()
+// function with the same allocator. The given \a size must be equal to the size that was used
+// for the allocation.
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+EnableIf_< IsBuiltin<T> > deallocate( T* address, size_t size, Alloc& alloc ) noexcept
+{
+   if( address == nullptr )
+      return;
+
+   std::allocator_traits<Alloc>::deallocate( alloc, address, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory for user-specific class types via the given allocator.
+// \ingroup util
+//
+// \param address The address of the first element of the array to be deallocated.
+// \param size The number of elements of the array.
+// \param alloc The allocator that was used for the allocation.
+// \return void
+//
+// This function destroys all elements of the given array and deallocates the memory that was
+// previously allocated via the allocate() function with the same allocator. The given \a size
+// must be equal to the size that was used for the allocation.
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+DisableIf_< IsBuiltin<T> > deallocate( T* address, size_t size, Alloc& alloc )
+{
+   using Traits = std::allocator_traits<Alloc>;
+
+   if( address == nullptr )
+      return;
+
+   for( size_t i=0UL; i<size; ++i )
+      Traits::destroy( alloc, address+i );
+   Traits::deallocate( alloc, address, size );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
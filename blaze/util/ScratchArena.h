@@ -0,0 +1,615 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ScratchArena.h
+//  \brief Header file for the ScratchArena class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SCRATCHARENA_H_
+#define _BLAZE_UTIL_SCRATCHARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SCRATCHARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Bump-pointer memory arena for short-lived temporaries.
+// \ingroup util
+//
+// The ScratchArena class provides memory for temporaries whose lifetime is bound to a single
+// scope, as for instance the intermediate results of expression templates. Memory is handed out
+// by simply advancing an offset within a list of large chunks. The memory is returned in strict
+// reverse order of its allocation (LIFO) by resetting the offset to a previously acquired marker:
+
+   \code
+   blaze::ScratchArena& arena( blaze::getScratchArena() );
+
+   const blaze::ScratchArena::Marker marker( arena.mark() );
+   double* tmp = static_cast<double*>( arena.allocate( 100UL*sizeof(double), 32UL ) );
+   // ... Using the temporary memory
+   arena.release( marker );
+   \endcode
+
+// Whenever the arena becomes completely empty, all chunks are merged into a single chunk that
+// is large enough for all previous allocations. Therefore, after a short warm-up phase, a
+// recurring sequence of allocations does not require any call to the system allocator at all.
+// The capacity of the arena is limited to \a maxCapacity bytes (see the BLAZE_SCRATCH_ARENA_LIMIT
+// configuration switch). Requests that would grow the arena beyond this limit are served by
+// the system allocator and are returned to the system when the according marker is released.
+//
+// Note that the arena only provides raw memory, i.e. it neither calls constructors nor
+// destructors. Also note that the arena is not thread-safe. Every thread should use its own
+// arena, which is provided by the getScratchArena() function.
+*/
+class ScratchArena
+   : private NonCopyable
+{
+ private:
+   //**struct Chunk********************************************************************************
+   /*!\brief A single chunk of memory of the arena.
+   */
+   struct Chunk
+   {
+      byte_t* data_;  //!< The first byte of the chunk.
+      size_t  size_;  //!< The size of the chunk in bytes.
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Chunks = std::vector<Chunk>;  //!< Vector of memory chunks.
+   //**********************************************************************************************
+
+ public:
+   //**struct Marker*******************************************************************************
+   /*!\brief Position within the scratch arena.
+   */
+   struct Marker
+   {
+      size_t chunk_;   //!< The index of the current chunk.
+      size_t offset_;  //!< The offset within the current chunk.
+      size_t heap_;    //!< The number of blocks allocated from the system.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The minimum size of a single chunk in bytes.
+   static constexpr size_t minChunkSize = 65536UL;
+
+   //! The alignment of all chunks (and the maximum supported alignment) in bytes.
+   static constexpr size_t chunkAlignment = 64UL;
+
+   //! The maximum total size of all chunks in bytes.
+   static constexpr size_t maxCapacity = scratchArenaLimit;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ScratchArena() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ScratchArena();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t capacity() const noexcept;
+   inline size_t used    () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline Marker mark    () const noexcept;
+   inline void*  allocate( size_t bytes, size_t alignment );
+   inline void   release ( const Marker& marker ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline void* allocateChunk( size_t bytes );
+   inline void* allocateHeap ( size_t bytes );
+   inline void  coalesce() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Chunks chunks_;  //!< The chunks of the arena.
+   size_t chunk_;   //!< The index of the current chunk.
+   size_t offset_;  //!< The offset of the first free byte within the current chunk.
+   Chunks heap_;    //!< The blocks exceeding the capacity limit of the arena.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ScratchArena.
+//
+// The arena is initially empty. The first chunk is acquired with the first allocation.
+*/
+inline ScratchArena::ScratchArena() noexcept
+   : chunks_()       // The chunks of the arena
+   , chunk_ ( 0UL )  // The index of the current chunk
+   , offset_( 0UL )  // The offset of the first free byte within the current chunk
+   , heap_  ()       // The blocks exceeding the capacity limit of the arena
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for ScratchArena.
+//
+// The destructor returns all chunks to the system.
+*/
+inline ScratchArena::~ScratchArena()
+{
+   BLAZE_INTERNAL_ASSERT( chunk_ == 0UL && offset_ == 0UL && heap_.empty(),
+                          "Scratch memory still in use" );
+
+   for( const Chunk& chunk : chunks_ ) {
+      deallocate_backend( chunk.data_ );
+   }
+
+   for( const Chunk& block : heap_ ) {
+      deallocate_backend( block.data_ );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total size of all chunks of the arena.
+//
+// \return The capacity of the arena in bytes.
+//
+// Note that the blocks allocated from the system (i.e. beyond the capacity limit of the arena)
+// are not part of the capacity.
+*/
+inline size_t ScratchArena::capacity() const noexcept
+{
+   size_t capacity( 0UL );
+   for( const Chunk& chunk : chunks_ ) {
+      capacity += chunk.size_;
+   }
+   return capacity;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently in use.
+//
+// \return The number of used bytes including the unused tails of all previous chunks.
+//
+// Note that the number of used bytes includes all blocks allocated from the system.
+*/
+inline size_t ScratchArena::used() const noexcept
+{
+   size_t used( offset_ );
+   for( size_t i=0UL; i<chunk_; ++i ) {
+      used += chunks_[i].size_;
+   }
+   for( const Chunk& block : heap_ ) {
+      used += block.size_;
+   }
+   return used;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current position within the arena.
+//
+// \return The current position within the arena.
+//
+// The returned marker can be passed to the release() function to return all memory that has
+// been allocated after the call to mark().
+*/
+inline ScratchArena::Marker ScratchArena::mark() const noexcept
+{
+   return Marker{ chunk_, offset_, heap_.size() };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates a block of memory from the arena.
+//
+// \param bytes The number of bytes to be allocated.
+// \param alignment The required alignment (a power of two not larger than \a chunkAlignment).
+// \return Pointer to the first byte of the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function returns a properly aligned block of uninitialized memory. In case the current
+// chunk does not provide enough memory, the next chunk is used or a new chunk is acquired from
+// the system. In case the new chunk would exceed the capacity limit of the arena, the memory
+// is directly allocated from the system. Note that the returned pointer is never a null
+// pointer, not even in case zero bytes are requested.
+*/
+inline void* ScratchArena::allocate( size_t bytes, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL && ( alignment & ( alignment - 1UL ) ) == 0UL &&
+                          alignment <= chunkAlignment, "Invalid alignment detected" );
+
+   if( !chunks_.empty() )
+   {
+      const Chunk& chunk( chunks_[chunk_] );
+      const size_t address( reinterpret_cast<std::uintptr_t>( chunk.data_ ) + offset_ );
+      const size_t offset ( offset_ + ( ( alignment - address % alignment ) % alignment ) );
+
+      if( offset <= chunk.size_ && bytes <= chunk.size_ - offset ) {
+         offset_ = offset + bytes;
+         return chunk.data_ + offset;
+      }
+   }
+
+   return allocateChunk( bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all memory allocated after the given marker.
+//
+// \param marker The position to return to.
+// \return void
+//
+// This function resets the arena to the position represented by the given marker. In case all
+// memory has been returned, all chunks are merged into a single chunk. Note that markers have
+// to be released in reverse order of their acquisition, i.e. the given marker must not lie
+// beyond the current position of the arena. Releasing an older marker first would hand out the
+// memory of a still living temporary. In case this precondition is violated, a debug build is
+// aborted by a user assertion.
+*/
+inline void ScratchArena::release( const Marker& marker ) noexcept
+{
+   BLAZE_USER_ASSERT( ( marker.chunk_ < chunk_ ||
+                        ( marker.chunk_ == chunk_ && marker.offset_ <= offset_ ) ) &&
+                      marker.heap_ <= heap_.size(), "Invalid release order detected" );
+
+   while( heap_.size() > marker.heap_ ) {
+      deallocate_backend( heap_.back().data_ );
+      heap_.pop_back();
+   }
+
+   chunk_  = marker.chunk_;
+   offset_ = marker.offset_;
+
+   if( chunk_ == 0UL && offset_ == 0UL && chunks_.size() > 1UL ) {
+      coalesce();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates a block of memory from the next suitable chunk.
+//
+// \param bytes The number of bytes to be allocated.
+// \return Pointer to the first byte of the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function moves to the next chunk of the arena. In case the next chunk is too small, it
+// and all following (unused) chunks are replaced by a new chunk of sufficient size. In case
+// the new chunk would exceed the capacity limit of the arena, the memory is allocated from the
+// system instead.
+*/
+inline void* ScratchArena::allocateChunk( size_t bytes )
+{
+   const size_t next( chunks_.empty() ? 0UL : chunk_+1UL );
+
+   if( next < chunks_.size() && chunks_[next].size_ < bytes )
+   {
+      for( size_t i=next; i<chunks_.size(); ++i ) {
+         deallocate_backend( chunks_[i].data_ );
+      }
+      chunks_.resize( next );
+   }
+
+   if( next == chunks_.size() )
+   {
+      size_t retained( 0UL );
+      for( const Chunk& chunk : chunks_ ) {
+         retained += chunk.size_;
+      }
+
+      if( retained >= maxCapacity || bytes > maxCapacity - retained ) {
+         return allocateHeap( bytes );
+      }
+
+      const size_t previous( chunks_.empty() ? 0UL : chunks_.back().size_ );
+      const size_t size( min( max( bytes, 2UL*previous, size_t( minChunkSize ) ),
+                              maxCapacity - retained ) );
+
+      chunks_.reserve( next+1UL );
+      byte_t* const data( allocate_backend( size, chunkAlignment ) );
+      chunks_.push_back( Chunk{ data, size } );
+   }
+
+   BLAZE_INTERNAL_ASSERT( chunks_[next].size_ >= bytes, "Invalid chunk size detected" );
+
+   chunk_  = next;
+   offset_ = bytes;
+
+   return chunks_[next].data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates a block of memory beyond the capacity limit of the arena.
+//
+// \param bytes The number of bytes to be allocated.
+// \return Pointer to the first byte of the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates the given number of bytes directly from the system. The block is
+// returned to the system as soon as a marker acquired before this allocation is released.
+*/
+inline void* ScratchArena::allocateHeap( size_t bytes )
+{
+   heap_.reserve( heap_.size()+1UL );
+   byte_t* const data( allocate_backend( max( bytes, size_t( 1UL ) ), chunkAlignment ) );
+   heap_.push_back( Chunk{ data, bytes } );
+
+   return data;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merges all chunks of the empty arena into a single chunk.
+//
+// \return void
+//
+// The current chunks are returned to the system before the merged chunk is allocated, which
+// limits the memory consumption during the merge to the capacity limit of the arena. In case
+// the allocation of the merged chunk fails, the arena is left without any chunk.
+*/
+inline void ScratchArena::coalesce() noexcept
+{
+   BLAZE_INTERNAL_ASSERT( chunk_ == 0UL && offset_ == 0UL, "Scratch memory still in use" );
+
+   const size_t size( capacity() );
+
+   for( const Chunk& chunk : chunks_ ) {
+      deallocate_backend( chunk.data_ );
+   }
+
+   chunks_.clear();
+
+   try {
+      chunks_.push_back( Chunk{ allocate_backend( size, chunkAlignment ), size } );
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the scratch arena of the calling thread.
+// \ingroup util
+//
+// \return Reference to the thread-local scratch arena.
+//
+// Every thread (including all threads of the shared-memory parallelization backends) owns a
+// separate scratch arena, which is created on first use and destroyed at the end of the thread.
+*/
+inline ScratchArena& getScratchArena()
+{
+   thread_local ScratchArena arena;
+   return arena;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SCRATCHARRAY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Uninitialized array drawn from the scratch arena of the calling thread.
+// \ingroup util
+//
+// The ScratchArray class template acquires memory for \a n elements of type \a Type from the
+// scratch arena of the calling thread (see getScratchArena()) and returns it on destruction.
+// The memory is aligned according to the alignment restrictions of \a Type. Since the elements
+// are neither constructed nor destroyed, \a Type is restricted to trivially destructible types.
+// Also, a scratch array must be destroyed by the thread that created it and in reverse order of
+// its creation with respect to all other scratch arrays of that thread, which is both guaranteed
+// for all local variables.
+*/
+template< typename Type >  // Data type of the elements
+class ScratchArray
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ScratchArray( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ScratchArray();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type* data() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ScratchArena& arena_;          //!< The scratch arena of the creating thread.
+   ScratchArena::Marker marker_;  //!< The position of the arena before the allocation.
+   Type* data_;                   //!< The first element of the array.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( std::is_trivially_destructible<Type>::value );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The constructor for ScratchArray.
+//
+// \param n The number of elements of the array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type >  // Data type of the elements
+inline ScratchArray<Type>::ScratchArray( size_t n )
+   : arena_ ( getScratchArena() )  // The scratch arena of the creating thread
+   , marker_( arena_.mark() )      // The position of the arena before the allocation
+   , data_  ( static_cast<Type*>( arena_.allocate( n*sizeof(Type), AlignmentOf<Type>::value ) ) )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for ScratchArray.
+*/
+template< typename Type >  // Data type of the elements
+inline ScratchArray<Type>::~ScratchArray()
+{
+   arena_.release( marker_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the array elements.
+//
+// \return Pointer to the first element of the array.
+*/
+template< typename Type >  // Data type of the elements
+inline Type* ScratchArray<Type>::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,10 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -260,7 +262,7 @@ class Thread
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -306,12 +308,13 @@ class Thread
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile bool   terminated_;  //!< Thread termination flag.
-                                 /*!< This flag value is used by the managing thread
-                                      pool to learn whether the thread has terminated
-                                      its execution. */
-   ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
-   ThreadHandle    thread_;      //!< Handle to the thread of execution.
+   std::atomic<bool> terminated_;  //!< Thread termination flag.
+                                   /*!< This flag value is used by the managing thread
+                                        pool to learn whether the thread has terminated
+                                        its execution. */
+   ThreadPoolType*   pool_;        //!< Handle to the managing thread pool.
+   size_t            index_;       //!< Index of the thread within the managing thread pool.
+   ThreadHandle      thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
 
@@ -336,6 +339,7 @@ class Thread
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param index Index of the thread within the managing thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -344,9 +348,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t index )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , index_     ( index   )  // Index of the thread within the managing thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -371,6 +376,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , index_ ( 0UL     )  // Index of the thread within the managing thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -487,7 +493,7 @@ void Thread<TT,MT,LT,CT>::run()
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   while( pool_->executeTask( index_ ) ) {}
 
    // Setting the termination flag
    terminated_ = true;
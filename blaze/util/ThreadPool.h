@@ -40,15 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <vector>
+#include <blaze/util/algorithms/Max.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Spin.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
 
@@ -193,6 +201,94 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_scheduling Task scheduling
+//
+// The thread pool manages one lock-free task queue per hardware thread (or per thread of the
+// pool, if the pool is larger). Scheduled tasks are distributed among these queues in a round
+// robin fashion. Every thread of the pool preferably executes the tasks of its own queue, but
+// steals tasks from the queues of other threads as soon as its own queue runs empty. Thus the
+// scheduling and the execution of tasks does not require any lock as long as there are tasks
+// to be processed; locks are only acquired to put idle threads to sleep and to wake them up
+// again. Additionally, all tasks up to a size of threadpool::Task::storageSize bytes (as for
+// instance the assignment tasks of the SMP thread backend) are stored without dynamic memory
+// allocation.
+//
+// Every thread of the pool has a fixed index, which determines its own task queue. Since the
+// distribution of tasks restarts at the first queue whenever the pool has completed all tasks
+// (see the wait() function), a sequence of tasks scheduled in the same order after every call
+// to wait() is processed by the same threads every time (unless a task is stolen by an idle
+// thread).
+//
+//
+// \section threadpool_affinity Thread affinity
+//
+// By default the threads of the pool are not bound to any CPU and may be migrated by the
+// operating system. Via the setAffinity() function (or the according constructor) it is possible
+// to pin the threads to specific CPUs: the thread with index \a i is pinned to the CPU
+// <tt>cpus[i % cpus.size()]</tt>:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   // Pinning the four threads to the CPUs 0, 2, 4, and 6
+   threadpool.setAffinity( { 0, 2, 4, 6 } );
+
+   // Pinning the four threads according to a compact placement on the available CPUs
+   threadpool.setAffinity( blaze::threadpool::compactOrder( blaze::threadpool::availableCPUs() ) );
+
+   // Removing the affinity of all threads
+   threadpool.setAffinity( {} );
+   \endcode
+
+// Note that thread affinity is currently only supported on Linux systems. On all other systems
+// the affinity settings have no effect.
+//
+//
+// \section threadpool_spinning Spin waiting
+//
+// By default an idle thread of the pool immediately blocks on a condition variable and has to be
+// woken up by the operating system as soon as a new task is scheduled. Similarly, the wait()
+// function immediately blocks until the last task has been completed. For tasks running only a
+// few microseconds the latency of these wake-ups is comparable to the actual work. Therefore it
+// is possible to specify a spin time (in microseconds) via the setSpinTime() function (or the
+// according constructor): idle threads first busy wait for new tasks for the given time before
+// they block, and the wait() function first busy waits for the completion of all tasks. As long
+// as all threads are spinning, neither the scheduling of tasks nor their completion requires
+// any lock or system call:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   // Idle threads and the wait() function spin for up to 100 microseconds before they block
+   threadpool.setSpinTime( 100 );
+   \endcode
+
+// Note that spinning threads occupy their CPU. Therefore spinning is skipped as long as the
+// number of threads of the pool exceeds the number of CPUs available to the process, since in
+// this case the spinning threads would compete with the working threads for the CPUs.
+//
+//
+// \section threadpool_groups Task groups
+//
+// The wait() function waits for the completion of all tasks scheduled on the thread pool. In
+// case several independent operations share the same thread pool, the tasks of each operation
+// can be registered with a task group (see the threadpool::TaskGroup class) in order to wait
+// for the completion of a single operation only:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   blaze::threadpool::TaskGroup group;
+
+   threadpool.schedule( group, function0 );
+   threadpool.schedule( group, function0 );
+
+   threadpool.wait( group );  // Waits only for the two tasks of the group
+   \endcode
+
+// A task group must not be destroyed before all its tasks have been completed.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -319,17 +415,26 @@ class ThreadPool
    //! Type of the thread container.
    using Threads = std::vector< std::unique_ptr<ManagedThread> >;
 
-   using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queue.
+   using Task      = threadpool::Task;       //!< Type of a single task.
+   using TaskGroup = threadpool::TaskGroup;  //!< Type of the completion counter of a task group.
+   using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queues.
    using Mutex     = MT;                     //!< Type of the mutex.
    using Lock      = LT;                     //!< Type of a locking object.
    using Condition = CT;                     //!< Condition variable type.
+
+   //! Type of the task queue container.
+   using TaskQueues = std::vector< std::unique_ptr<TaskQueue> >;
+
+   //! Type of the container for the tasks that do not fit into the task queues.
+   using Overflow = std::deque<Task>;
    //**********************************************************************************************
 
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, const std::vector<size_t>& cpus=std::vector<size_t>(),
+                        size_t spin=0UL );
    //@}
    //**********************************************************************************************
 
@@ -347,6 +452,9 @@ class ThreadPool
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+
+   inline std::vector<size_t> affinity() const;
+   inline size_t              spinTime() const;
    //@}
    //**********************************************************************************************
 
@@ -355,6 +463,9 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable >
+   void schedule( TaskGroup& group, Callable func );
    //@}
    //**********************************************************************************************
 
@@ -363,7 +474,10 @@ class ThreadPool
    //@{
    void resize( size_t n, bool block=false );
    void wait();
+   void wait( const TaskGroup& group );
    void clear();
+   void setAffinity( const std::vector<size_t>& cpus );
+   void setSpinTime( size_t microseconds );
    //@}
    //**********************************************************************************************
 
@@ -372,7 +486,11 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   void pinThread( ManagedThread& thread, bool reset );
+   void pushTask( Task& task );
+   bool acquireTask( Task& task, size_t home );
+   bool executeTask( size_t index );
+   void removeTasks();
    //@}
    //**********************************************************************************************
 
@@ -385,8 +503,24 @@ class ThreadPool
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
    Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+   std::vector<bool> slots_;   //!< The thread indices currently in use.
+   std::vector<size_t> cpus_;  //!< The CPUs the threads are pinned to.
+   TaskQueues queues_;         //!< The lock-free task queues for the scheduled tasks.
+   Overflow overflow_;         //!< Container for the tasks that do not fit into the task queues.
+
+   std::atomic<size_t> queued_;   //!< Number of currently queued tasks.
+   std::atomic<size_t> pending_;  //!< Number of scheduled, but not yet completed tasks.
+   std::atomic<size_t> idle_;     //!< Number of threads currently looking for a task.
+   std::atomic<size_t> next_;     //!< Index of the task queue for the next scheduled task.
+   std::atomic<size_t> waiting_;  //!< Number of threads blocked in the wait() function.
+   std::atomic<size_t> spin_;     //!< Spin time of idle and waiting threads (in microseconds).
+   std::atomic<bool>   oversubscribed_;  //!< Flag for more threads than available CPUs.
+                                         /*!< In case the flag is set, idle and waiting threads
+                                              don't spin, but block immediately. */
+   const size_t capacity_;        //!< Number of CPUs available to the process.
+
    mutable Mutex mutex_;       //!< Synchronization mutex.
+   Mutex overflowMutex_;       //!< Synchronization mutex for the overflow container.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
    //@}
@@ -413,24 +547,47 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param cpus The CPUs the threads are pinned to (see setAffinity()).
+// \param spin The spin time of idle and waiting threads in microseconds (see setSpinTime()).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. The number of task queues is determined by the
+// larger of \a n and the number of hardware threads and remains fixed for the lifetime of the
+// thread pool.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, const std::vector<size_t>& cpus, size_t spin )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
    , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
+   , slots_        ()  // The thread indices currently in use
+   , cpus_     ( cpus )  // The CPUs the threads are pinned to
+   , queues_       ()  // The lock-free task queues for the scheduled tasks
+   , overflow_     ()  // Container for the tasks that do not fit into the task queues
+   , queued_  ( 0UL )  // Number of currently queued tasks
+   , pending_ ( 0UL )  // Number of scheduled, but not yet completed tasks
+   , idle_    ( 0UL )  // Number of threads currently looking for a task
+   , next_    ( 0UL )  // Index of the task queue for the next scheduled task
+   , waiting_ ( 0UL )  // Number of threads blocked in the wait() function
+   , spin_    ( spin )  // Spin time of idle and waiting threads (in microseconds)
+   , oversubscribed_( false )  // Flag for more threads than available CPUs
+   , capacity_( threadpool::availableCPUs().size() )  // Number of CPUs available to the process
    , mutex_        ()  // Synchronization mutex
+   , overflowMutex_()  // Synchronization mutex for the overflow container
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
 {
+   const size_t queues( max( n, static_cast<size_t>( TT::hardware_concurrency() ), 1UL ) );
+
+   queues_.reserve( queues );
+   for( size_t i=0UL; i<queues; ++i ) {
+      queues_.push_back( std::unique_ptr<TaskQueue>( new TaskQueue() ) );
+   }
+
    resize( n );
 }
 //*************************************************************************************************
@@ -459,7 +616,7 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    Lock lock( mutex_ );
 
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   removeTasks();
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -502,8 +659,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -559,6 +715,39 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the CPUs the threads of the thread pool are pinned to.
+//
+// \return The CPUs the threads are pinned to (empty in case the threads are not pinned).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadPool<TT,MT,LT,CT>::affinity() const
+{
+   Lock lock( mutex_ );
+   return cpus_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spin time of idle and waiting threads.
+//
+// \return The spin time in microseconds.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::spinTime() const
+{
+   return spin_.load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -576,7 +765,8 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. The scheduling does not require any lock unless there are idle threads that have to
+// be woken up.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -586,9 +776,47 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   Task task( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++pending_;
+   pushTask( task );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor as part of the given task group.
+//
+// \param group The task group of the function/functor.
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution and registers it with the
+// given task group. The completion of all tasks of the group can be awaited via the according
+// wait() function without waiting for any other scheduled task. The given function/functor must
+// be copyable, must be callable without arguments and must return \c void. The task group must
+// not be destroyed before all its tasks have been completed.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable > // Type of the function/functor
+void ThreadPool<TT,MT,LT,CT>::schedule( TaskGroup& group, Callable func )
+{
+   group.add();
+
+   Task task( [this,&group,func]() mutable
+   {
+      func();
+
+      if( group.complete() && waiting_ > 0UL ) {
+         Lock lock( mutex_ );
+         waitForThread_.notify_all();
+      }
+   } );
+
+   ++pending_;
+   pushTask( task );
 }
 //*************************************************************************************************
 
@@ -658,6 +886,9 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
    {
       Lock lock( mutex_ );
 
+      // Disabling spinning in case of oversubscription
+      oversubscribed_ = ( n > capacity_ );
+
       // Adding new threads to the thread pool
       if( n > expected_ ) {
          for( size_t i=expected_; i<n; ++i )
@@ -692,7 +923,11 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. Afterwards the distribution
+// of tasks restarts at the first task queue, i.e. the next scheduled task is again assigned to
+// the thread with index 0. In case a spin time is specified (see setSpinTime()) and the number
+// of threads doesn't exceed the number of available CPUs, the function busy waits for the
+// completion of the tasks for the given time before it blocks.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -700,11 +935,59 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
-   Lock lock( mutex_ );
+   const size_t spin( oversubscribed_ ? 0UL : spinTime() );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
-      waitForThread_.wait( lock );
+   if( !threadpool::spinWait( spin, [this]() { return pending_ == 0UL; } ) )
+   {
+      Lock lock( mutex_ );
+
+      ++waiting_;
+
+      while( pending_ > 0UL ) {
+         waitForThread_.wait( lock );
+      }
+
+      --waiting_;
    }
+
+   next_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks of the given task group have been completed. In contrast
+// to the wait() function for all scheduled tasks it does not wait for any other task, which
+// allows to wait for a single operation while other operations are still in progress. As the
+// wait() function for all tasks it busy waits for the given spin time before it blocks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( const TaskGroup& group )
+{
+   const size_t spin( oversubscribed_ ? 0UL : spinTime() );
+
+   if( !threadpool::spinWait( spin, [&group]() { return group.isDone(); } ) )
+   {
+      Lock lock( mutex_ );
+
+      ++waiting_;
+
+      while( !group.isDone() ) {
+         waitForThread_.wait( lock );
+      }
+
+      --waiting_;
+   }
+
+   next_ = 0UL;
 }
 //*************************************************************************************************
 
@@ -724,7 +1007,58 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+   removeTasks();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning the threads of the thread pool to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to.
+// \return void
+//
+// This function pins the thread with index \a i to the CPU <tt>cpus[i % cpus.size()]</tt>. The
+// setting also applies to all threads that are added to the thread pool later on. In case
+// \a cpus is empty, the threads are allowed to run on all available CPUs again. Note that
+// thread affinity is currently only supported on Linux systems.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   Lock lock( mutex_ );
+
+   cpus_ = cpus;
+
+   for( auto const& thread : threads_ ) {
+      if( !thread->hasTerminated() )
+         pinThread( *thread, true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the spin time of idle and waiting threads.
+//
+// \param microseconds The spin time in microseconds.
+// \return void
+//
+// This function sets the time idle threads busy wait for new tasks before they block and the
+// time the wait() function busy waits for the completion of all tasks before it blocks. A spin
+// time of 0 (the default) disables spinning. Note that independent of the spin time no thread
+// spins in case the number of threads exceeds the number of CPUs available to the process.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setSpinTime( size_t microseconds )
+{
+   spin_.store( microseconds, std::memory_order_relaxed );
 }
 //*************************************************************************************************
 
@@ -741,6 +1075,8 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// The new thread is assigned the smallest thread index that is currently not in use.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,7 +1084,16 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   const size_t index( std::find( slots_.begin(), slots_.end(), false ) - slots_.begin() );
+
+   if( index == slots_.size() )
+      slots_.push_back( true );
+   else
+      slots_[index] = true;
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, index ) ) );
+   pinThread( *threads_.back(), false );
+
    ++total_;
    ++expected_;
    ++active_;
@@ -756,33 +1101,162 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pinning the given thread according to the current affinity setting.
+//
+// \param thread The thread to be pinned.
+// \param reset \a true in case an existing affinity has to be reset, \a false if not.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pinThread( ManagedThread& thread, bool reset )
+{
+   if( !cpus_.empty() ) {
+      threadpool::pinThread( thread.thread_->native_handle()
+                           , std::vector<size_t>( 1UL, cpus_[thread.index_ % cpus_.size()] ) );
+   }
+   else if( reset ) {
+      threadpool::pinThread( thread.thread_->native_handle(), threadpool::availableCPUs() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a task to one of the task queues.
+//
+// \param task The task to be added.
+// \return void
+//
+// This function moves the given task into the next task queue (in a round robin fashion). In
+// case this queue is full, the task is added to the next queue with free capacity. Only in
+// case all queues are full the task is stored in the (lock protected) overflow container.
+// Afterwards one idle thread is woken up (if any).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pushTask( Task& task )
+{
+   const size_t queues( queues_.size() );
+   const size_t first ( next_.fetch_add( 1UL, std::memory_order_relaxed ) );
+
+   // Counting the task before publishing it guarantees that the counter never drops below the
+   // number of acquirable tasks, since a task can only be acquired once it has been published.
+   ++queued_;
+
+   bool queued( false );
+
+   for( size_t i=0UL; !queued && i<queues; ++i ) {
+      queued = queues_[(first+i)%queues]->push( task );
+   }
+
+   if( !queued ) {
+      Lock lock( overflowMutex_ );
+      overflow_.push_back( std::move( task ) );
+   }
+
+   if( idle_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task.
+//
+// \param task The task to be overwritten with the acquired task.
+// \param home The index of the home queue of the calling thread.
+// \return \a true in case a task was acquired, \a false if no task is available.
+//
+// This function first tries to acquire a task from the given home queue. In case the home queue
+// is empty, the function tries to steal a task from any other task queue. Only if all queues
+// are empty, the overflow container is checked.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::acquireTask( Task& task, size_t home )
+{
+   if( queued_ == 0UL )
+      return false;
+
+   const size_t queues( queues_.size() );
+
+   for( size_t i=0UL; i<queues; ++i ) {
+      if( queues_[(home+i)%queues]->pop( task ) ) {
+         --queued_;
+         return true;
+      }
+   }
+
+   Lock lock( overflowMutex_ );
+
+   if( !overflow_.empty() ) {
+      task = std::move( overflow_.front() );
+      overflow_.pop_front();
+      --queued_;
+      return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
+// \param index The index of the calling thread.
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// In case there is no task available, the thread busy waits for a new task for the specified
+// spin time (see setSpinTime()) and afterwards blocks and waits for a new task to be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t index )
 {
-   threadpool::Task task;
+   const size_t home( index % queues_.size() );
+
+   Task task;
 
    // Acquiring a scheduled task
+   const size_t spin( oversubscribed_ ? 0UL : spinTime() );
+
+   if( !threadpool::spinWait( spin, [&]() { return acquireTask( task, home ); } ) )
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      ++idle_;
+
+      while( !acquireTask( task, home ) )
       {
+         // A counted task that is not yet published will be available shortly. The mutex is
+         // released while waiting for it in order not to block the threads scheduling tasks.
+         if( queued_ != 0UL ) {
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+            continue;
+         }
+
          --active_;
          waitForThread_.notify_all();
 
          if( total_ > expected_ ) {
+            slots_[index] = false;
+            --idle_;
             --total_;
             return false;
          }
@@ -791,17 +1265,66 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
          ++active_;
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      --idle_;
    }
 
+   BLAZE_INTERNAL_ASSERT( task, "Empty task detected" );
+
    // Executing the task
    task();
+   task.reset();
+
+   // Notifying waiting threads about the completion of all tasks
+   if( --pending_ == 0UL && waiting_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
 
    return true;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Removing all queued tasks.
+//
+// \return void
+//
+// This function removes all currently queued tasks from the task queues and the overflow
+// container. It must only be called while holding the synchronization mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::removeTasks()
+{
+   size_t removed( 0UL );
+
+   Task task;
+
+   for( auto const& queue : queues_ ) {
+      while( queue->pop( task ) ) {
+         task.reset();
+         ++removed;
+      }
+   }
+
+   {
+      Lock lock( overflowMutex_ );
+      removed += overflow_.size();
+      overflow_.clear();
+   }
+
+   queued_  -= removed;
+   pending_ -= removed;
+
+   if( pending_ == 0UL ) {
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
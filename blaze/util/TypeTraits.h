@@ -55,6 +55,7 @@
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/HasSize.h>
 #include <blaze/util/typetraits/HaveSameSize.h>
+#include <blaze/util/typetraits/IsAlignedAllocator.h>
 #include <blaze/util/typetraits/IsArithmetic.h>
 #include <blaze/util/typetraits/IsArray.h>
 #include <blaze/util/typetraits/IsAssignable.h>
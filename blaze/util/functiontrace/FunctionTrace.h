@@ -48,6 +48,8 @@
 #  include <boost/thread/thread.hpp>
 #elif BLAZE_HPX_PARALLEL_MODE
 #  include <hpx/include/threads.hpp>
+#elif BLAZE_TBB_PARALLEL_MODE
+#  include <tbb/task_arena.h>
 #endif
 
 #include <iostream>
@@ -154,6 +156,8 @@ inline FunctionTrace::FunctionTrace( const std::string& file, const std::string&
    oss << "[Thread " << boost::this_thread::get_id() << "]";
 #elif BLAZE_HPX_PARALLEL_MODE
    oss << "[Thread " << hpx::this_thread::get_id() << "]";
+#elif BLAZE_TBB_PARALLEL_MODE
+   oss << "[Thread " << tbb::this_task_arena::current_thread_index() << "]";
 #endif
 
    oss << " Entering function '" << function_ << "' in file '" << file_ << "'\n";
@@ -186,6 +190,8 @@ inline FunctionTrace::~FunctionTrace()
    oss << "[Thread " << boost::this_thread::get_id() << "]";
 #elif BLAZE_HPX_PARALLEL_MODE
    oss << "[Thread " << hpx::this_thread::get_id() << "]";
+#elif BLAZE_TBB_PARALLEL_MODE
+   oss << "[Thread " << tbb::this_task_arena::current_thread_index() << "]";
 #endif
 
    oss << " Leaving function '" << function_ << "' in file '" << file_ << "'\n";
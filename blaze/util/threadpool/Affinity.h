@@ -0,0 +1,396 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Thread affinity functionality of the thread pool
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  THREAD AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Thread affinity functions */
+//@{
+inline std::vector<size_t> parseCPUList( const std::string& list );
+inline std::vector<size_t> availableCPUs();
+inline std::vector<size_t> nodeCPUs( size_t node );
+inline std::vector<size_t> compactOrder( std::vector<size_t> cpus );
+inline std::vector<size_t> scatterOrder( std::vector<size_t> cpus );
+
+template< typename Handle >
+inline bool pinThread( Handle handle, const std::vector<size_t>& cpus );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given CPU list into a vector of CPU indices.
+// \ingroup threads
+//
+// \param list The CPU list (as for instance \c "0-3,8,10-11").
+// \return The sorted vector of the unique CPU indices contained in the list.
+// \exception std::invalid_argument Invalid CPU list.
+//
+// This function converts a CPU list in the format used by the Linux kernel (comma-separated
+// single indices or ranges of indices) into a sorted vector of CPU indices. Since threads can
+// only be pinned to CPUs representable in a CPU set (see \c CPU_SETSIZE), all indices beyond
+// this limit are ignored, i.e. ranges are clamped to the limit. In case the given list is
+// malformed or contains an index that does not fit into a \c size_t, a \a std::invalid_argument
+// exception is thrown.
+*/
+inline std::vector<size_t> parseCPUList( const std::string& list )
+{
+#if defined(__linux__)
+   const size_t limit( CPU_SETSIZE );
+#else
+   const size_t limit( 1024UL );
+#endif
+
+   std::vector<size_t> cpus;
+   std::istringstream iss( list );
+   std::string token;
+
+   while( std::getline( iss, token, ',' ) )
+   {
+      token.erase( std::remove_if( token.begin(), token.end(), []( char c ) {
+         return c == ' ' || c == '\t' || c == '\n';
+      } ), token.end() );
+
+      if( token.empty() )
+         continue;
+
+      const size_t dash( token.find( '-' ) );
+      const std::string first( token.substr( 0UL, dash ) );
+      const std::string last ( ( dash == std::string::npos )?( first )
+                                                             :( token.substr( dash+1UL ) ) );
+
+      if( first.empty() || last.empty() ||
+          first.find_first_not_of( "0123456789" ) != std::string::npos ||
+          last.find_first_not_of( "0123456789" ) != std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU list" );
+      }
+
+      size_t begin, end;
+
+      try {
+         begin = std::stoul( first );
+         end   = std::stoul( last  );
+      }
+      catch( std::out_of_range& ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU index" );
+      }
+
+      if( begin > end ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid CPU range" );
+      }
+
+      for( size_t cpu=begin; cpu<=end && cpu<limit; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+   }
+
+   std::sort( cpus.begin(), cpus.end() );
+   cpus.erase( std::unique( cpus.begin(), cpus.end() ), cpus.end() );
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs the calling process is allowed to run on.
+// \ingroup threads
+//
+// \return The sorted vector of the available CPU indices.
+//
+// On Linux systems this function returns the CPUs of the affinity mask of the calling process,
+// which reflects any restriction via \c taskset, \c numactl or a cgroup cpuset. On all other
+// systems it returns the indices \f$[0..N)\f$, where \a N is the number of hardware threads.
+*/
+inline std::vector<size_t> availableCPUs()
+{
+   std::vector<size_t> cpus;
+
+#if defined(__linux__)
+   cpu_set_t mask;
+   CPU_ZERO( &mask );
+
+   if( sched_getaffinity( 0, sizeof( mask ), &mask ) == 0 ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &mask ) )
+            cpus.push_back( cpu );
+      }
+   }
+#endif
+
+   if( cpus.empty() ) {
+      const size_t n( std::max( std::thread::hardware_concurrency(), 1U ) );
+      for( size_t cpu=0UL; cpu<n; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs belonging to the given NUMA node.
+// \ingroup threads
+//
+// \param node The index of the NUMA node.
+// \return The sorted vector of the CPU indices of the NUMA node.
+//
+// This function reads the CPUs of the given NUMA node from the \c sysfs file system. In case
+// the information is not available (as for instance on non-Linux systems or in case the node
+// does not exist), an empty vector is returned.
+*/
+inline std::vector<size_t> nodeCPUs( size_t node )
+{
+   std::ifstream file( "/sys/devices/system/node/node" + std::to_string( node ) + "/cpulist" );
+   std::string list;
+
+   if( !file || !std::getline( file, list ) )
+      return std::vector<size_t>();
+
+   try {
+      return parseCPUList( list );
+   }
+   catch( std::invalid_argument& ) {
+      return std::vector<size_t>();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Topology information about a single CPU.
+// \ingroup threads
+*/
+struct CPUTopology
+{
+   size_t cpu;      //!< The index of the CPU.
+   size_t package;  //!< The index of the physical package (socket) of the CPU.
+   size_t core;     //!< The index of the physical core within the package.
+   size_t thread;   //!< The index of the hardware thread within the core.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the topology of the given CPUs.
+// \ingroup threads
+//
+// \param cpus The sorted vector of CPU indices.
+// \return The topology information about the given CPUs.
+//
+// This function reads the package and core of each CPU from the \c sysfs file system. In case
+// the information is not available, every CPU is treated as a separate core of package 0.
+*/
+inline std::vector<CPUTopology> cpuTopology( const std::vector<size_t>& cpus )
+{
+   const auto read = []( size_t cpu, const char* name, size_t fallback ) {
+      std::ifstream file( "/sys/devices/system/cpu/cpu" + std::to_string( cpu ) +
+                          "/topology/" + name );
+      long value( -1L );
+      return ( file >> value && value >= 0L )?( static_cast<size_t>( value ) ):( fallback );
+   };
+
+   std::vector<CPUTopology> topology;
+   topology.reserve( cpus.size() );
+
+   for( size_t cpu : cpus ) {
+      topology.push_back( CPUTopology{ cpu, read( cpu, "physical_package_id", 0UL ),
+                                       read( cpu, "core_id", cpu ), 0UL } );
+   }
+
+   std::sort( topology.begin(), topology.end(), []( const CPUTopology& a, const CPUTopology& b ) {
+      return std::tie( a.package, a.core, a.cpu ) < std::tie( b.package, b.core, b.cpu );
+   } );
+
+   for( size_t i=1UL; i<topology.size(); ++i ) {
+      if( topology[i].package == topology[i-1UL].package &&
+          topology[i].core    == topology[i-1UL].core ) {
+         topology[i].thread = topology[i-1UL].thread + 1UL;
+      }
+   }
+
+   return topology;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Orders the given CPUs for a compact thread placement.
+// \ingroup threads
+//
+// \param cpus The vector of CPU indices.
+// \return The CPU indices in compact order.
+//
+// This function orders the given CPUs such that consecutive threads are placed as close to
+// each other as possible: all hardware threads of a core are used before the next core of the
+// same package is used, and all cores of a package are used before the next package is used.
+*/
+inline std::vector<size_t> compactOrder( std::vector<size_t> cpus )
+{
+   std::sort( cpus.begin(), cpus.end() );
+
+   const std::vector<CPUTopology> topology( cpuTopology( cpus ) );
+
+   for( size_t i=0UL; i<topology.size(); ++i ) {
+      cpus[i] = topology[i].cpu;
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Orders the given CPUs for a scattered thread placement.
+// \ingroup threads
+//
+// \param cpus The vector of CPU indices.
+// \return The CPU indices in scatter order.
+//
+// This function orders the given CPUs such that consecutive threads are distributed as evenly
+// as possible: consecutive threads are placed on different packages in a round robin fashion,
+// within each package on different cores, and only after all cores are occupied the additional
+// hardware threads of the cores are used.
+*/
+inline std::vector<size_t> scatterOrder( std::vector<size_t> cpus )
+{
+   std::sort( cpus.begin(), cpus.end() );
+
+   std::vector<CPUTopology> topology( cpuTopology( cpus ) );
+
+   // Numbering the cores within each package
+   std::vector< std::tuple<size_t,size_t,size_t,size_t> > keys;
+   keys.reserve( topology.size() );
+
+   size_t rank( 0UL );
+
+   for( size_t i=0UL; i<topology.size(); ++i )
+   {
+      if( i > 0UL && topology[i].package != topology[i-1UL].package )
+         rank = 0UL;
+      else if( i > 0UL && topology[i].core != topology[i-1UL].core )
+         ++rank;
+
+      keys.emplace_back( topology[i].thread, rank, topology[i].package, topology[i].cpu );
+   }
+
+   std::sort( keys.begin(), keys.end() );
+
+   for( size_t i=0UL; i<keys.size(); ++i ) {
+      cpus[i] = std::get<3>( keys[i] );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Restricts the given thread to the given CPUs.
+// \ingroup threads
+//
+// \param handle The native handle of the thread.
+// \param cpus The vector of CPU indices.
+// \return \a true in case the affinity of the thread was changed, \a false if not.
+//
+// This function sets the CPU affinity of the given thread to the given set of CPUs. Currently
+// the function is only supported on Linux systems for POSIX threads (i.e. for \c std::thread
+// and \c boost::thread); on all other systems the function has no effect and returns \a false.
+*/
+template< typename Handle >  // Type of the native thread handle
+inline bool pinThread( Handle handle, const std::vector<size_t>& cpus )
+{
+#if defined(__linux__)
+   cpu_set_t mask;
+   CPU_ZERO( &mask );
+
+   for( size_t cpu : cpus ) {
+      if( cpu < CPU_SETSIZE )
+         CPU_SET( cpu, &mask );
+   }
+
+   return CPU_COUNT( &mask ) > 0 &&
+          pthread_setaffinity_np( handle, sizeof( mask ), &mask ) == 0;
+#else
+   UNUSED_PARAMETER( handle, cpus );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Spin.h
+//  \brief Spin waiting functionality of the thread pool
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_SPIN_H_
+#define _BLAZE_UTIL_THREADPOOL_SPIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <thread>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  SPIN WAITING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Spin waiting functions */
+//@{
+inline void pause() noexcept;
+
+template< typename Predicate >
+inline bool spinWait( size_t microseconds, Predicate pred );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Hint to the processor that the calling thread is busy waiting.
+// \ingroup threads
+//
+// \return void
+//
+// On x86 processors this function executes the \c pause instruction, which reduces the power
+// consumption of a busy waiting loop and avoids the memory order violation on leaving the loop.
+// On all other processors the function has no effect.
+*/
+inline void pause() noexcept
+{
+#if BLAZE_SSE_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Busy waiting until the given predicate is satisfied or the given time has elapsed.
+// \ingroup threads
+//
+// \param microseconds The maximum spin time in microseconds.
+// \param pred The predicate to be satisfied.
+// \return \a true in case the predicate was satisfied, \a false in case the time has elapsed.
+//
+// This function repeatedly evaluates the given predicate without giving up the CPU until either
+// the predicate returns \a true or the given time has elapsed. In contrast to blocking on a
+// condition variable, this allows to react within a fraction of a microsecond to an event,
+// at the cost of occupying the CPU during the spin time. Every 64 unsuccessful evaluations
+// the calling thread yields the CPU to other threads that are ready to run, which limits the
+// cost of spinning in case there are more threads than CPUs. In case \a microseconds is 0,
+// the predicate is evaluated exactly once.
+*/
+template< typename Predicate >  // Type of the predicate
+inline bool spinWait( size_t microseconds, Predicate pred )
+{
+   if( pred() )
+      return true;
+
+   if( microseconds == 0UL )
+      return false;
+
+   using Clock = std::chrono::steady_clock;
+
+   const Clock::time_point end( Clock::now() + std::chrono::microseconds( microseconds ) );
+
+   for( size_t count=1UL; ; ++count )
+   {
+      pause();
+
+      if( pred() )
+         return true;
+
+      if( count % 64UL == 0UL ) {
+         if( Clock::now() >= end )
+            return false;
+         std::this_thread::yield();
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,18 @@
 // Includes
 //*************************************************************************************************
 
-#include <functional>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -49,15 +60,393 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*!\brief Handle for a single, executable task.
 // \ingroup threads
+//
+// The Task class represents a single task scheduled for execution by a thread pool. It can hold
+// any copyable or movable function/functor that can be called without arguments. In contrast to
+// \c std::function, the Task class stores all callables of up to \a storageSize bytes (as for
+// instance the assignment functors of the thread backend) in an internal buffer and therefore
+// does not require a dynamic memory allocation per scheduled task. Only larger or over-aligned
+// callables are stored on the heap. Task objects can be moved, but not copied.
+*/
+class Task
+   : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Size of the internal buffer for the stored callable (in bytes).
+   static constexpr size_t storageSize = 256UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Task() noexcept;
+
+   template< typename Callable
+           , typename = DisableIf_< IsSame< Decay_<Callable>, Task > > >
+   explicit inline Task( Callable&& func );
+
+   inline Task( Task&& task ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   inline Task& operator=( Task&& task ) noexcept;
+   inline void  operator()();
+
+   explicit inline operator bool() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the internal buffer for the stored callable.
+   using Storage = std::aligned_storage< storageSize, alignof( std::max_align_t ) >::type;
+
+   //! Type of the function for the execution of the stored callable.
+   using Invoker = void (*)( Task& );
+
+   //! Type of the function for moving (\a to != nullptr) or destroying the stored callable.
+   using Manager = void (*)( Task& from, Task* to );
+   //**********************************************************************************************
+
+   //**Helper structure IsLocal********************************************************************
+   /*!\brief Auxiliary helper struct to decide on the storage of a callable of type \a F.
+   */
+   template< typename F >
+   struct IsLocal {
+      enum : bool { value = sizeof( F ) <= storageSize &&
+                            alignof( F ) <= alignof( std::max_align_t ) };
+   };
+   //**********************************************************************************************
+
+   //**Storage management functions****************************************************************
+   /*!\name Storage management functions */
+   //@{
+   template< typename F, typename Callable > inline void construct( Callable&& func, TrueType  );
+   template< typename F, typename Callable > inline void construct( Callable&& func, FalseType );
+
+   template< typename F > static inline void invokeLocal ( Task& task );
+   template< typename F > static inline void invokeRemote( Task& task );
+   template< typename F > static inline void manageLocal ( Task& from, Task* to ) noexcept;
+   template< typename F > static inline void manageRemote( Task& from, Task* to ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Storage storage_;  //!< Internal buffer for the stored callable.
+   Invoker invoke_;   //!< The execution function of the stored callable.
+   Manager manage_;   //!< The move/destruction function of the stored callable.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Task.
+//
+// The default constructor creates an empty task that cannot be executed.
+*/
+inline Task::Task() noexcept
+   : storage_()           // Internal buffer for the stored callable
+   , invoke_ ( nullptr )  // The execution function of the stored callable
+   , manage_ ( nullptr )  // The move/destruction function of the stored callable
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a task executing the given function/functor.
+//
+// \param func The given function/functor.
+//
+// The given function/functor must be callable without arguments. In case it fits into the
+// internal buffer, it is stored without any dynamic memory allocation.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename >         // Type restriction on the function/functor
+inline Task::Task( Callable&& func )
+   : storage_()           // Internal buffer for the stored callable
+   , invoke_ ( nullptr )  // The execution function of the stored callable
+   , manage_ ( nullptr )  // The move/destruction function of the stored callable
+{
+   using F = Decay_<Callable>;
+
+   construct<F>( std::forward<Callable>( func ), BoolConstant< IsLocal<F>::value >() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for Task.
+//
+// \param task The task to be moved into this instance.
+*/
+inline Task::Task( Task&& task ) noexcept
+   : storage_()                // Internal buffer for the stored callable
+   , invoke_ ( task.invoke_ )  // The execution function of the stored callable
+   , manage_ ( task.manage_ )  // The move/destruction function of the stored callable
+{
+   if( manage_ != nullptr ) {
+      manage_( task, this );
+      task.invoke_ = nullptr;
+      task.manage_ = nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Task.
+*/
+inline Task::~Task()
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for Task.
+//
+// \param task The task to be moved into this instance.
+// \return Reference to the assigned task.
+*/
+inline Task& Task::operator=( Task&& task ) noexcept
+{
+   if( &task != this )
+   {
+      reset();
+
+      if( task.manage_ != nullptr ) {
+         task.manage_( task, this );
+         invoke_ = task.invoke_;
+         manage_ = task.manage_;
+         task.invoke_ = nullptr;
+         task.manage_ = nullptr;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the stored function/functor.
+//
+// \return void
+*/
+inline void Task::operator()()
+{
+   BLAZE_USER_ASSERT( invoke_ != nullptr, "Execution of empty task detected" );
+   invoke_( *this );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task contains a function/functor.
+//
+// \return \a true in case the task contains a function/functor, \a false if it is empty.
+*/
+inline Task::operator bool() const noexcept
+{
+   return invoke_ != nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destroys the stored function/functor and resets the task to the empty state.
+//
+// \return void
+*/
+inline void Task::reset() noexcept
+{
+   if( manage_ != nullptr ) {
+      manage_( *this, nullptr );
+      invoke_ = nullptr;
+      manage_ = nullptr;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STORAGE MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stores the given function/functor in the internal buffer.
+//
+// \param func The given function/functor.
+// \return void
 */
-using Task = std::function<void(void)>;
+template< typename F           // Type of the stored function/functor
+        , typename Callable >  // Type of the given function/functor
+inline void Task::construct( Callable&& func, TrueType )
+{
+   ::new ( &storage_ ) F( std::forward<Callable>( func ) );
+   invoke_ = &Task::invokeLocal<F>;
+   manage_ = &Task::manageLocal<F>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores the given function/functor on the heap.
+//
+// \param func The given function/functor.
+// \return void
+*/
+template< typename F           // Type of the stored function/functor
+        , typename Callable >  // Type of the given function/functor
+inline void Task::construct( Callable&& func, FalseType )
+{
+   ::new ( &storage_ ) F*( new F( std::forward<Callable>( func ) ) );
+   invoke_ = &Task::invokeRemote<F>;
+   manage_ = &Task::manageRemote<F>;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes a function/functor stored in the internal buffer.
+//
+// \param task The task containing the function/functor.
+// \return void
+*/
+template< typename F >  // Type of the stored function/functor
+inline void Task::invokeLocal( Task& task )
+{
+   ( *reinterpret_cast<F*>( &task.storage_ ) )();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes a function/functor stored on the heap.
+//
+// \param task The task containing the function/functor.
+// \return void
+*/
+template< typename F >  // Type of the stored function/functor
+inline void Task::invokeRemote( Task& task )
+{
+   ( **reinterpret_cast<F**>( &task.storage_ ) )();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves or destroys a function/functor stored in the internal buffer.
+//
+// \param from The task containing the function/functor.
+// \param to The target task for the function/functor (\c nullptr for a destruction).
+// \return void
+//
+// In case \a to is not \c nullptr the function/functor is moved to the target task. In any case
+// the function/functor in the task \a from is destroyed.
+*/
+template< typename F >  // Type of the stored function/functor
+inline void Task::manageLocal( Task& from, Task* to ) noexcept
+{
+   F* func( reinterpret_cast<F*>( &from.storage_ ) );
+
+   if( to != nullptr ) {
+      ::new ( &to->storage_ ) F( std::move( *func ) );
+   }
+
+   func->~F();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves or destroys a function/functor stored on the heap.
+//
+// \param from The task containing the function/functor.
+// \param to The target task for the function/functor (\c nullptr for a destruction).
+// \return void
+//
+// In case \a to is not \c nullptr only the ownership of the function/functor is transferred to
+// the target task, otherwise the function/functor is destroyed.
+*/
+template< typename F >  // Type of the stored function/functor
+inline void Task::manageRemote( Task& from, Task* to ) noexcept
+{
+   F* func( *reinterpret_cast<F**>( &from.storage_ ) );
+
+   if( to != nullptr ) {
+      ::new ( &to->storage_ ) F*( func );
+   }
+   else {
+      delete func;
+   }
+}
 //*************************************************************************************************
 
 } // namespace threadpool
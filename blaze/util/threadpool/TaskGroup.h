@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Header file for the completion counter of a group of tasks
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Completion counter for a group of tasks.
+// \ingroup threads
+//
+// The TaskGroup class counts the pending tasks of a single operation scheduled on a thread pool
+// (see ThreadPool::schedule()). In contrast to the ThreadPool::wait() function, which waits for
+// all tasks scheduled on the thread pool, waiting for a task group only waits for the tasks of
+// the according operation. A task group must not be destroyed before all its tasks have been
+// completed.
+*/
+class TaskGroup
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isDone  () const noexcept;
+   inline void add     () noexcept;
+   inline bool complete() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> pending_;  //!< Number of scheduled, but not yet completed tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for TaskGroup.
+*/
+inline TaskGroup::TaskGroup() noexcept
+   : pending_( 0UL )  // Number of scheduled, but not yet completed tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks of the group have been completed.
+//
+// \return \a true in case all tasks have been completed, \a false if not.
+*/
+inline bool TaskGroup::isDone() const noexcept
+{
+   return pending_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Registers a new task of the group.
+//
+// \return void
+*/
+inline void TaskGroup::add() noexcept
+{
+   ++pending_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marks a task of the group as completed.
+//
+// \return \a true in case the last pending task of the group has been completed, \a false if not.
+*/
+inline bool TaskGroup::complete() noexcept
+{
+   return --pending_ == 0UL;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
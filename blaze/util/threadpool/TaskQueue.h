@@ -40,8 +40,13 @@
 // Includes
 //*************************************************************************************************
 
-#include <deque>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -58,25 +63,32 @@ namespace threadpool {
 /*!\brief Task queue for the thread pool.
 // \ingroup threads
 //
-// The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// The TaskQueue class represents a bounded, lock-free FIFO queue for tasks that can be used
+// concurrently by an arbitrary number of producing and consuming threads. The tasks are stored
+// in a ring buffer of cells that is allocated once during the construction of the queue. Every
+// cell is guarded by a sequence number, which allows producers and consumers to claim a cell
+// via a single compare-and-swap operation on the according position of the queue. Therefore
+// neither a push() nor a pop() operation requires a lock or a dynamic memory allocation. In
+// case the queue is full, push() fails and returns \a false; in case the queue is empty, pop()
+// fails and returns \a false.
 */
 class TaskQueue
+   : private NonCopyable
 {
- private:
+ public:
    //**Type definitions****************************************************************************
-   using Tasks = std::deque<Task>;  //!< FIFO container for tasks.
+   using SizeType = size_t;  //!< Size type of the task queue.
    //**********************************************************************************************
 
- public:
-   //**Type definitions****************************************************************************
-   using SizeType = Tasks::size_type;  //!< Size type of the task queue.
+   //**Compilation flags***************************************************************************
+   //! The default number of tasks a task queue can hold.
+   static constexpr size_t defaultCapacity = 64UL;
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline TaskQueue();
+   explicit inline TaskQueue( size_t capacity=defaultCapacity );
    //@}
    //**********************************************************************************************
 
@@ -90,33 +102,51 @@ class TaskQueue
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline SizeType maxSize()  const;
-   inline SizeType size()     const;
-   inline bool     isEmpty()  const;
+   inline SizeType maxSize()  const noexcept;
+   inline SizeType size()     const noexcept;
+   inline bool     isEmpty()  const noexcept;
    //@}
    //**********************************************************************************************
 
    //**Element functions***************************************************************************
    /*!\name Element functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
+   inline bool push ( Task& task );
+   inline bool pop  ( Task& task );
    inline void clear();
    //@}
    //**********************************************************************************************
 
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief A single cell of the ring buffer.
+   */
+   struct Cell {
+      std::atomic<size_t> sequence_;  //!< The sequence number of the cell.
+      Task task_;                     //!< The task stored in the cell.
+   };
+
+   //! Padding between the members accessed by producers and consumers, respectively.
+   using Padding = char[64];
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline void swap( TaskQueue& tq ) noexcept;
+   static inline size_t computeMask( size_t capacity ) noexcept;
    //@}
    //**********************************************************************************************
 
- private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Tasks tasks_;  //!< FIFO container for the contained tasks.
+   const size_t mask_;              //!< Bit mask for the mapping of positions to cells.
+   std::unique_ptr<Cell[]> cells_;  //!< The ring buffer of the task queue.
+   Padding pad1_;                   //!< Padding in front of the producer position.
+   std::atomic<size_t> tail_;       //!< The position of the next push operation.
+   Padding pad2_;                   //!< Padding between the producer and consumer position.
+   std::atomic<size_t> head_;       //!< The position of the next pop operation.
+   Padding pad3_;                   //!< Padding behind the consumer position.
    //@}
    //**********************************************************************************************
 };
@@ -132,11 +162,25 @@ class TaskQueue
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Default constructor for TaskQueue.
+/*!\brief Constructor for TaskQueue.
+//
+// \param capacity The minimum number of tasks the queue can hold.
+//
+// The capacity of the queue is rounded up to the next power of two (but at least 2).
 */
-inline TaskQueue::TaskQueue()
-   : tasks_()  // FIFO container for the contained tasks
-{}
+inline TaskQueue::TaskQueue( size_t capacity )
+   : mask_ ( computeMask( capacity ) )  // Bit mask for the mapping of positions to cells
+   , cells_( new Cell[mask_+1UL] )      // The ring buffer of the task queue
+   , pad1_ ()                           // Padding in front of the producer position
+   , tail_ ( 0UL )                      // The position of the next push operation
+   , pad2_ ()                           // Padding between the producer and consumer position
+   , head_ ( 0UL )                      // The position of the next pop operation
+   , pad3_ ()                           // Padding behind the consumer position
+{
+   for( size_t i=0UL; i<=mask_; ++i ) {
+      cells_[i].sequence_.store( i, std::memory_order_relaxed );
+   }
+}
 //*************************************************************************************************
 
 
@@ -150,10 +194,8 @@ inline TaskQueue::TaskQueue()
 
 //*************************************************************************************************
 /*!\brief Destructor for the TaskQueue class.
-//
-// The destructor destroys any remaining task in the task queue.
 */
-TaskQueue::~TaskQueue()
+inline TaskQueue::~TaskQueue()
 {
    clear();
 }
@@ -171,11 +213,11 @@ TaskQueue::~TaskQueue()
 //*************************************************************************************************
 /*!\brief Returns the maximum possible size of a task queue.
 //
-// \return The maximum possible size.
+// \return The maximum number of tasks the queue can hold.
 */
-inline TaskQueue::SizeType TaskQueue::maxSize() const
+inline TaskQueue::SizeType TaskQueue::maxSize() const noexcept
 {
-   return tasks_.max_size();
+   return mask_ + 1UL;
 }
 //*************************************************************************************************
 
@@ -183,13 +225,16 @@ inline TaskQueue::SizeType TaskQueue::maxSize() const
 //*************************************************************************************************
 /*!\brief Returns the current size of the task queue.
 //
-// \return The current size.
+// \return The current number of tasks in the queue.
 //
-// This function returns the number of the currently contained tasks.
+// Note that in case the queue is concurrently accessed by other threads, the returned value
+// is only a snapshot that may be outdated immediately.
 */
-inline TaskQueue::SizeType TaskQueue::size() const
+inline TaskQueue::SizeType TaskQueue::size() const noexcept
 {
-   return tasks_.size();
+   const size_t head( head_.load( std::memory_order_acquire ) );
+   const size_t tail( tail_.load( std::memory_order_acquire ) );
+   return ( tail > head )?( tail - head ):( 0UL );
 }
 //*************************************************************************************************
 
@@ -197,11 +242,11 @@ inline TaskQueue::SizeType TaskQueue::size() const
 //*************************************************************************************************
 /*!\brief Returns \a true if the task queue has no elements.
 //
-// \return \a true if the task queue is empty, \a false if it is not.
+// \return \a true in case the queue is empty, \a false if not.
 */
-inline bool TaskQueue::isEmpty() const
+inline bool TaskQueue::isEmpty() const noexcept
 {
-   return tasks_.empty();
+   return size() == 0UL;
 }
 //*************************************************************************************************
 
@@ -217,28 +262,68 @@ inline bool TaskQueue::isEmpty() const
 //*************************************************************************************************
 /*!\brief Adding a task to the end of the task queue.
 //
-// \param task The task to be added to the end of the task queue.
-// \return void
+// \param task The task to be added to the queue.
+// \return \a true in case the task was added, \a false in case the queue is full.
 //
-// This function adds the given task to the end of the task queue. It runs in constant time.
+// In case the task is successfully added, it is moved into the queue and \a task is left
+// empty. Otherwise \a task remains unchanged.
 */
-inline void TaskQueue::push( Task task )
+inline bool TaskQueue::push( Task& task )
 {
-   tasks_.push_back( task );
+   size_t pos( tail_.load( std::memory_order_relaxed ) );
+
+   while( true )
+   {
+      Cell& cell( cells_[pos & mask_] );
+      const size_t sequence( cell.sequence_.load( std::memory_order_acquire ) );
+
+      if( sequence == pos ) {
+         if( tail_.compare_exchange_weak( pos, pos+1UL, std::memory_order_relaxed ) ) {
+            cell.task_ = std::move( task );
+            cell.sequence_.store( pos+1UL, std::memory_order_release );
+            return true;
+         }
+      }
+      else if( sequence < pos ) {
+         return false;
+      }
+      else {
+         pos = tail_.load( std::memory_order_relaxed );
+      }
+   }
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Returns the task from the front of the task queue.
+/*!\brief Removing the task from the front of the task queue.
 //
-// \return The first task in the task queue.
+// \param task The task to be overwritten with the front task.
+// \return \a true in case a task was removed, \a false in case the queue is empty.
 */
-inline Task TaskQueue::pop()
+inline bool TaskQueue::pop( Task& task )
 {
-   const Task task( tasks_.front() );
-   tasks_.pop_front();
-   return task;
+   size_t pos( head_.load( std::memory_order_relaxed ) );
+
+   while( true )
+   {
+      Cell& cell( cells_[pos & mask_] );
+      const size_t sequence( cell.sequence_.load( std::memory_order_acquire ) );
+
+      if( sequence == pos+1UL ) {
+         if( head_.compare_exchange_weak( pos, pos+1UL, std::memory_order_relaxed ) ) {
+            task = std::move( cell.task_ );
+            cell.sequence_.store( pos+mask_+1UL, std::memory_order_release );
+            return true;
+         }
+      }
+      else if( sequence < pos+1UL ) {
+         return false;
+      }
+      else {
+         pos = head_.load( std::memory_order_relaxed );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -250,60 +335,35 @@ inline Task TaskQueue::pop()
 */
 inline void TaskQueue::clear()
 {
-   tasks_.clear();
-}
-//*************************************************************************************************
-
-
-
+   Task task;
 
-//=================================================================================================
-//
-//  UTILITY FUNCTIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
-//
-// \param tq The task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
-*/
-inline void TaskQueue::swap( TaskQueue& tq ) noexcept
-{
-   tasks_.swap( tq.tasks_ );
+   while( pop( task ) ) {
+      task.reset();
+   }
 }
 //*************************************************************************************************
 
 
 
 
+
 //=================================================================================================
 //
-//  GLOBAL OPERATORS
+//  UTILITY FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\name TaskQueue operators */
-//@{
-inline void swap( TaskQueue& a, TaskQueue& b ) noexcept;
-//@}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Computes the bit mask for a ring buffer of (at least) the given capacity.
 //
-// \param a The first task queue to be swapped.
-// \param b The second task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
+// \param capacity The requested capacity of the ring buffer.
+// \return The bit mask for the next power of two (but at least 2).
 */
-inline void swap( TaskQueue& a, TaskQueue& b ) noexcept
+inline size_t TaskQueue::computeMask( size_t capacity ) noexcept
 {
-   a.swap( b );
+   size_t n( 2UL );
+   while( n < capacity ) n <<= 1;
+   return n - 1UL;
 }
 //*************************************************************************************************
 
@@ -311,5 +371,4 @@ inline void swap( TaskQueue& a, TaskQueue& b ) noexcept
 
 } // namespace blaze
 
-
 #endif
@@ -0,0 +1,82 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/typetraits/IsAlignedAllocator.h
+//  \brief Header file for the IsAlignedAllocator type trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TYPETRAITS_ISALIGNEDALLOCATOR_H_
+#define _BLAZE_UTIL_TYPETRAITS_ISALIGNEDALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/IntegralConstant.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for allocators providing SIMD aligned memory.
+// \ingroup type_traits
+//
+// This type trait tests whether or not the given allocator type is guaranteed to return memory
+// that is aligned according to the alignment restrictions of its value type (see
+// blaze::AlignmentOf). In case the allocator provides aligned memory, the \a value member
+// constant is set to \a true, the nested type definition \a Type is \a TrueType, and the class
+// derives from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType,
+// and the class derives from \a FalseType. By default, only blaze::AlignedAllocator is
+// considered to provide aligned memory. For all other allocators the trait can be specialized
+// accordingly:
+
+   \code
+   blaze::IsAlignedAllocator< blaze::AlignedAllocator<double> >::value  // Evaluates to 'true'
+   blaze::IsAlignedAllocator< blaze::AlignedAllocator<int> >::Type      // Results in TrueType
+   blaze::IsAlignedAllocator< std::allocator<double> >::value           // Evaluates to 'false'
+   blaze::IsAlignedAllocator< std::allocator<int> >                     // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsAlignedAllocator
+   : public FalseType
+{};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
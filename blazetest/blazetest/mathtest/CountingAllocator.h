@@ -0,0 +1,213 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/CountingAllocator.h
+//  \brief Header file for the CountingAllocator class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COUNTINGALLOCATOR_H_
+#define _BLAZETEST_MATHTEST_COUNTINGALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <type_traits>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/typetraits/IsAlignedAllocator.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation statistics of a CountingAllocator.
+*/
+struct AllocationCounter
+{
+   size_t allocations  { 0UL };  //!< The total number of allocations.
+   size_t deallocations{ 0UL };  //!< The total number of deallocations.
+   size_t elements     { 0UL };  //!< The number of currently allocated elements.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stateful allocator for the test of allocator-aware containers.
+//
+// The CountingAllocator class template forwards all allocations to the blaze::AlignedAllocator
+// and records the number of allocations and deallocations in the given AllocationCounter. Two
+// counting allocators compare equal if they refer to the same counter. The \a Propagate flag
+// specifies whether the allocator is propagated on move assignment and swap.
+*/
+template< typename Type            // Type of the allocated values
+        , bool Propagate = true >  // Propagation on move assignment and swap
+class CountingAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using value_type = Type;  //!< Type of the allocated values.
+
+   //! Propagation of the allocator on move assignment.
+   using propagate_on_container_move_assignment = std::integral_constant<bool,Propagate>;
+
+   //! Propagation of the allocator on swap.
+   using propagate_on_container_swap = std::integral_constant<bool,Propagate>;
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the CountingAllocator rebind mechanism.
+   */
+   template< typename Type2 >
+   struct rebind
+   {
+      using other = CountingAllocator<Type2,Propagate>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit CountingAllocator( AllocationCounter& counter ) noexcept
+      : counter_( &counter )  // The allocation statistics
+   {}
+
+   template< typename Type2 >
+   CountingAllocator( const CountingAllocator<Type2,Propagate>& alloc ) noexcept
+      : counter_( alloc.counter() )  // The allocation statistics
+   {}
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   AllocationCounter* counter() const noexcept { return counter_; }
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   Type* allocate( size_t n ) {
+      Type* const ptr( blaze::AlignedAllocator<Type>().allocate( n ) );
+      ++counter_->allocations;
+      counter_->elements += n;
+      return ptr;
+   }
+
+   void deallocate( Type* ptr, size_t n ) noexcept {
+      blaze::AlignedAllocator<Type>().deallocate( ptr, n );
+      ++counter_->deallocations;
+      counter_->elements -= n;
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   AllocationCounter* counter_;  //!< The allocation statistics.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two CountingAllocator objects.
+//
+// \param lhs The left-hand side allocator.
+// \param rhs The right-hand side allocator.
+// \return \a true if both allocators refer to the same counter, \a false if not.
+*/
+template< typename T1, typename T2, bool P >
+bool operator==( const CountingAllocator<T1,P>& lhs, const CountingAllocator<T2,P>& rhs ) noexcept
+{
+   return lhs.counter() == rhs.counter();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two CountingAllocator objects.
+//
+// \param lhs The left-hand side allocator.
+// \param rhs The right-hand side allocator.
+// \return \a true if the allocators refer to different counters, \a false if not.
+*/
+template< typename T1, typename T2, bool P >
+bool operator!=( const CountingAllocator<T1,P>& lhs, const CountingAllocator<T2,P>& rhs ) noexcept
+{
+   return lhs.counter() != rhs.counter();
+}
+//*************************************************************************************************
+
+} // namespace blazetest
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ISALIGNEDALLOCATOR SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool P >
+struct IsAlignedAllocator< blazetest::CountingAllocator<T,P> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/ThrowingElement.h
+//  \brief Header file for the ThrowingElement class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_THROWINGELEMENT_H_
+#define _BLAZETEST_MATHTEST_THROWINGELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Element type for the test of the exception safety of containers.
+//
+// The ThrowingElement class keeps track of the number of its currently alive instances and
+// throws a \a std::runtime_error exception on a copy assignment once the number of remaining
+// copies (see setCopies()) is exhausted. This allows to check that a container, whose element
+// initialization fails, destroys all its elements again.
+*/
+class ThrowingElement
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThrowingElement( int value = 0 ) : value_( value ) { ++alive(); }
+   ThrowingElement( const ThrowingElement& e ) : value_( e.value_ ) { ++alive(); }
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~ThrowingElement() { --alive(); }
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ThrowingElement& operator=( const ThrowingElement& e ) {
+      if( copies() == 0UL ) {
+         throw std::runtime_error( "Copy assignment failed" );
+      }
+      --copies();
+      value_ = e.value_;
+      return *this;
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   int value() const noexcept { return value_; }
+
+   static int  instances() noexcept { return alive(); }
+   static void setCopies( size_t copies ) noexcept { ThrowingElement::copies() = copies; }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static int& alive() noexcept {
+      static int count( 0 );
+      return count;
+   }
+
+   static size_t& copies() noexcept {
+      static size_t count( static_cast<size_t>( -1 ) );
+      return count;
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   int value_;  //!< The value of the element.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two ThrowingElement objects.
+//
+// \param lhs The left-hand side element.
+// \param rhs The right-hand side element.
+// \return \a true if both elements have the same value, \a false if not.
+*/
+inline bool operator==( const ThrowingElement& lhs, const ThrowingElement& rhs ) noexcept
+{
+   return lhs.value() == rhs.value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two ThrowingElement objects.
+//
+// \param lhs The left-hand side element.
+// \param rhs The right-hand side element.
+// \return \a true if the elements have different values, \a false if not.
+*/
+inline bool operator!=( const ThrowingElement& lhs, const ThrowingElement& rhs ) noexcept
+{
+   return lhs.value() != rhs.value();
+}
+//*************************************************************************************************
+
+} // namespace blazetest
+
+#endif
@@ -90,34 +90,36 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testConstructors();
-   void testAssignment  ();
-   void testAddAssign   ();
-   void testSubAssign   ();
-   void testSchurAssign ();
-   void testMultAssign  ();
-   void testScaling     ();
-   void testFunctionCall();
-   void testAt          ();
-   void testIterator    ();
-   void testNonZeros    ();
-   void testReset       ();
-   void testClear       ();
-   void testResize      ();
-   void testReserve     ();
-   void testTrim        ();
-   void testShrinkToFit ();
-   void testSwap        ();
-   void testSet         ();
-   void testInsert      ();
-   void testAppend      ();
-   void testErase       ();
-   void testFind        ();
-   void testLowerBound  ();
-   void testUpperBound  ();
-   void testTranspose   ();
-   void testCTranspose  ();
-   void testIsDefault   ();
+   void testConstructors  ();
+   void testAssignment    ();
+   void testAddAssign     ();
+   void testSubAssign     ();
+   void testSchurAssign   ();
+   void testMultAssign    ();
+   void testScaling       ();
+   void testFunctionCall  ();
+   void testAt            ();
+   void testIterator      ();
+   void testNonZeros      ();
+   void testReset         ();
+   void testClear         ();
+   void testResize        ();
+   void testReserve       ();
+   void testTrim          ();
+   void testShrinkToFit   ();
+   void testSwap          ();
+   void testSet           ();
+   void testInsert        ();
+   void testAppend        ();
+   void testBufferedInsert();
+   void testErase         ();
+   void testFind          ();
+   void testLowerBound    ();
+   void testUpperBound    ();
+   void testTranspose     ();
+   void testCTranspose    ();
+   void testConversion    ();
+   void testIsDefault     ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
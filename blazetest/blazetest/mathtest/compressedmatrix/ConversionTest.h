@@ -0,0 +1,378 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/ConversionTest.h
+//  \brief Header file for the CompressedMatrix dense/sparse conversion test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_CONVERSIONTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_CONVERSIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense/sparse conversion test of the CompressedMatrix class.
+//
+// This class represents a test suite for the conversion between dense matrices and compressed
+// matrices. It tests the assignment of dense matrix computations to compressed matrices, which
+// must evaluate every element of the computation exactly once, the assignment of dynamic
+// matrices to compressed matrices, and the assignment of compressed matrices to dynamic
+// matrices for several matrix sizes, including sizes above the according SMP threshold.
+*/
+class ConversionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ConversionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Unary operation counting the number of its invocations.
+   struct Counter
+   {
+      explicit inline Counter( std::atomic<size_t>& calls ) : calls_( &calls ) {}
+      inline int operator()( int a ) const { ++*calls_; return a; }
+      std::atomic<size_t>* calls_;
+   };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO1, bool SO2 >
+   void testDenseComputation( size_t m, size_t n );
+
+   template< bool SO1, bool SO2 >
+   void testDenseToSparse( size_t m, size_t n );
+
+   template< bool SO1, bool SO2 >
+   void testSparseToDense( size_t m, size_t n, size_t nonzeros );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of a dense matrix computation to a compressed matrix.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns a dense matrix computation with storage order \a SO2 to a compressed
+// matrix with storage order \a SO1 and checks both the result and that every element of the
+// computation has been evaluated exactly once. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the compressed matrix
+        , bool SO2 >  // Storage order of the dense matrix
+void ConversionTest::testDenseComputation( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<int,SO2> A( m, n, 0 );
+
+   for( size_t l=0UL; l<( m*n ) / 3UL; ++l ) {
+      A( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<int>( 1, 10 );
+   }
+
+   {
+      test_ = "Construction from a dense matrix computation";
+
+      std::atomic<size_t> calls( 0UL );
+      const blaze::CompressedMatrix<int,SO1> S( blaze::map( A, Counter( calls ) ) );
+
+      checkResult( S, A );
+
+      if( calls != m*n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of element evaluations\n"
+             << " Details:\n"
+             << "   Number of evaluations = " << calls << "\n"
+             << "   Expected number of evaluations = " << m*n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Assignment of a dense matrix computation";
+
+      blaze::CompressedMatrix<int,SO1> S( 2UL, 3UL );
+      S(0,1) = 5;
+
+      std::atomic<size_t> calls( 0UL );
+      S = blaze::map( A, Counter( calls ) );
+
+      checkResult( S, A );
+
+      if( calls != m*n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of element evaluations\n"
+             << " Details:\n"
+             << "   Number of evaluations = " << calls << "\n"
+             << "   Expected number of evaluations = " << m*n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Assignment of a dense matrix addition";
+
+      blaze::DynamicMatrix<int,SO2> B( m, n );
+      blaze::randomize( B, -2, 2 );
+
+      const blaze::CompressedMatrix<int,SO1> S( A + B );
+
+      checkResult( S, blaze::DynamicMatrix<int,SO2>( A + B ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of a dynamic matrix to a compressed matrix.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns a dynamic matrix with storage order \a SO2 to a compressed matrix with
+// storage order \a SO1. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO1    // Storage order of the compressed matrix
+        , bool SO2 >  // Storage order of the dynamic matrix
+void ConversionTest::testDenseToSparse( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<int,SO2> A( m, n, 0 );
+
+   for( size_t l=0UL; l<( m*n ) / 3UL; ++l ) {
+      A( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<int>( 1, 10 );
+   }
+
+   {
+      test_ = "Construction from a dynamic matrix";
+
+      const blaze::CompressedMatrix<int,SO1> S( A );
+
+      checkResult( S, A );
+   }
+
+   {
+      test_ = "Assignment of a dynamic matrix";
+
+      blaze::CompressedMatrix<int,SO1> S( 2UL, 3UL );
+      S(0,1) = 5;
+
+      S = A;
+
+      checkResult( S, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of a compressed matrix to a dynamic matrix.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param nonzeros The number of random insertions into the compressed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fills a compressed matrix with storage order \a SO1 via buffered insertions,
+// flushes the buffer, and assigns it to a dynamic matrix with storage order \a SO2. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the compressed matrix
+        , bool SO2 >  // Storage order of the dynamic matrix
+void ConversionTest::testSparseToDense( size_t m, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<int,SO1> S( m, n );
+
+   for( size_t l=0UL; l<nonzeros; ++l ) {
+      S.bufferedInsert( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ),
+                        blaze::rand<int>( 1, 10 ) );
+   }
+
+   S.flush();
+
+   blaze::DynamicMatrix<int,SO2> ref( m, n, 0 );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         ref(i,j) = S(i,j);
+      }
+   }
+
+   {
+      test_ = "Construction from a compressed matrix";
+
+      const blaze::DynamicMatrix<int,SO2> D( S );
+
+      checkResult( D, ref );
+   }
+
+   {
+      test_ = "Assignment of a compressed matrix";
+
+      blaze::DynamicMatrix<int,SO2> D( m, n );
+      blaze::randomize( D );
+      D = S;
+
+      checkResult( D, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a conversion.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ConversionTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense/sparse conversion of the CompressedMatrix class.
+//
+// \return void
+*/
+void runTest()
+{
+   ConversionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix dense/sparse conversion test.
+*/
+#define RUN_COMPRESSEDMATRIX_CONVERSION_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
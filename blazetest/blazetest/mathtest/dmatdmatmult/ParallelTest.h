@@ -0,0 +1,416 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/ParallelTest.h
+//  \brief Header file for the parallel dense matrix/dense matrix multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel dense matrix/dense matrix multiplication test.
+//
+// This class represents a test suite for the load-balanced parallel multiplication of dense
+// matrices with triangular operands. It tests the thread partitions of products with lower
+// and upper operands and compares the results of the parallel assignments with the results
+// of the according serial multiplication of general dense matrices.
+*/
+class ParallelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using LT = blaze::LowerMatrix< blaze::DynamicMatrix<int,blaze::rowMajor> >;  //!< Lower matrix type.
+   using UT = blaze::UpperMatrix< blaze::DynamicMatrix<int,blaze::rowMajor> >;  //!< Upper matrix type.
+   using DT = blaze::DynamicMatrix<int,blaze::rowMajor>;                       //!< Dense matrix type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPartition();
+
+   template< typename MT1, typename MT2 >
+   void testMult( size_t n );
+
+   template< typename CF >
+   void checkPartition( const blaze::ThreadPartition& partition, size_t size, size_t alignment,
+                        CF cost, size_t threads ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+
+   template< typename MT >
+   void initialize( MT& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the thread partitions of products with triangular operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the partitions of the rows of products with a lower or upper left-hand
+// side operand and of the columns of products with a lower or upper right-hand side operand.
+// Since the restructured blocks of the product only exclude the structurally zero part of the
+// triangular operand outside of the block, the cost of a block of rows \f$ [b,e) \f$ of a
+// lower left-hand side operand is proportional to \f$ (e-b) \cdot e \f$. The maximum cost of
+// all blocks is required to be smaller than the maximum cost of a uniform partition. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testPartition()
+{
+   const size_t threads( 8UL );
+
+   const auto leading = []( size_t b, size_t e ) { return ( e - b ) * e; };
+
+   const DT L( 1000UL, 60UL, 0 );
+   const DT R( 60UL, 1000UL, 0 );
+
+   {
+      test_ = "Row partition of a lower matrix/dense matrix multiplication";
+
+      LT A( 1000UL );
+      const auto partition( blaze::createThreadPartition( threads, A * L, 4UL ) );
+      checkPartition( partition.first, A.rows(), 4UL, leading, threads );
+   }
+
+   {
+      test_ = "Row partition of an upper matrix/dense matrix multiplication";
+
+      UT A( 1000UL );
+      const size_t N( A.columns() );
+      const auto trailing = [N]( size_t b, size_t e ) { return ( e - b ) * ( N - b ); };
+      const auto partition( blaze::createThreadPartition( threads, A * L, 1UL ) );
+      checkPartition( partition.first, A.rows(), 1UL, trailing, threads );
+   }
+
+   {
+      test_ = "Column partition of a dense matrix/lower matrix multiplication";
+
+      LT B( 1000UL );
+      const size_t M( B.rows() );
+      const auto trailing = [M]( size_t b, size_t e ) { return ( e - b ) * ( M - b ); };
+      const auto partition( blaze::createThreadPartition( threads, R * B, 1UL ) );
+      checkPartition( partition.second, B.columns(), 1UL, trailing, threads );
+   }
+
+   {
+      test_ = "Column partition of a dense matrix/upper matrix multiplication";
+
+      UT B( 1000UL );
+      const auto partition( blaze::createThreadPartition( threads, R * B, 4UL ) );
+      checkPartition( partition.second, B.columns(), 4UL, leading, threads );
+   }
+
+   {
+      test_ = "Partition of a lower matrix/dense vector multiplication";
+
+      LT A( 1000UL );
+      const blaze::DynamicVector<int,blaze::columnVector> x( A.columns(), 0 );
+      const blaze::ThreadPartition partition( blaze::createThreadPartition( threads, A * x, 4UL ) );
+      checkPartition( partition, A.rows(), 4UL, leading, threads );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel dense matrix/dense matrix multiplication for the given size.
+//
+// \param n The number of rows and columns of both matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the assignment, the addition assignment, and the
+// subtraction assignment of the product of the given matrix types to a dense matrix with the
+// results of the according serial multiplication of general dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+void ParallelTest::testMult( size_t n )
+{
+   MT1 A( n, n );
+   MT2 B( n, n );
+
+   initialize( A );
+   initialize( B );
+
+   DT ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = DT( A ) * DT( B );
+   }
+
+   DT init( n, n );
+   blaze::randomize( init, -10, 10 );
+
+   {
+      test_ = "Assignment (C=A*B)";
+
+      DT C( init );
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = "Addition assignment (C+=A*B)";
+
+      DT C( init );
+      C += A * B;
+
+      checkResult( C, DT( init + ref ) );
+   }
+
+   {
+      test_ = "Subtraction assignment (C-=A*B)";
+
+      DT C( init );
+      C -= A * B;
+
+      checkResult( C, DT( init - ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a thread partition.
+//
+// \param partition The partition to be checked.
+// \param size The size of the partitioned index range.
+// \param alignment The alignment of the block boundaries.
+// \param cost The cost of a block of indices.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Invalid partition detected.
+*/
+template< typename CF >  // Type of the cost function
+void ParallelTest::checkPartition( const blaze::ThreadPartition& partition, size_t size,
+                                   size_t alignment, CF cost, size_t threads ) const
+{
+   bool valid( partition.size() >= 2UL && partition.size() <= threads+1UL &&
+               partition.front() == 0UL && partition.back() == size );
+
+   for( size_t b=1UL; valid && b<partition.size(); ++b ) {
+      valid = partition[b-1UL] < partition[b] &&
+              ( partition[b] % alignment == 0UL || partition[b] == size );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid partition\n"
+          << " Details:\n"
+          << "   Number of boundaries = " << partition.size() << "\n"
+          << "   Last boundary = " << partition.back() << " (expected " << size << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::ThreadPartition uniform( blaze::createUniformPartition( size, threads, alignment ) );
+
+   size_t maxCost( 0UL ), maxUniformCost( 0UL );
+
+   for( size_t b=1UL; b<partition.size(); ++b ) {
+      maxCost = blaze::max( maxCost, cost( partition[b-1UL], partition[b] ) );
+   }
+
+   for( size_t b=1UL; b<uniform.size(); ++b ) {
+      maxUniformCost = blaze::max( maxUniformCost, cost( uniform[b-1UL], uniform[b] ) );
+   }
+
+   if( 4UL*maxCost >= 3UL*maxUniformCost ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unbalanced partition\n"
+          << " Details:\n"
+          << "   Maximum block cost = " << maxCost << "\n"
+          << "   Maximum block cost of the uniform partition = " << maxUniformCost << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the structurally non-zero elements of the given matrix.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+void ParallelTest::initialize( MT& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( ( !blaze::IsLower<MT>::value || j <= i ) && ( !blaze::IsUpper<MT>::value || j >= i ) ) {
+            A(i,j) = blaze::rand<int>( -10, 10 );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel dense matrix/dense matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel dense matrix/dense matrix multiplication test.
+*/
+#define RUN_DMATDMATMULT_PARALLEL_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/ThreadTest.h
+//  \brief Header file for the SMP thread configuration test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_THREADTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_THREADTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP thread configuration test.
+//
+// This class represents a test suite for the configuration of the threads of the shared memory
+// parallelization, in particular of the TBB-based parallelization. It tests the setNumThreads(),
+// setTaskArena(), and resetTaskArena() functions, the smpFor() loop, and the results of parallel
+// operations for varying numbers of threads.
+*/
+class ThreadTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThreadTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testNumThreads();
+   void testTaskArena();
+   void testParallelFor();
+   void testMultiplication();
+   void testConfiguration();
+
+   void checkNumThreads( size_t expected ) const;
+   void checkMultiplication() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the setNumThreads() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that setNumThreads() adapts the number of threads reported by the
+// getNumThreads() function and that it rejects an invalid number of threads. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThreadTest::testNumThreads()
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE || BLAZE_TBB_PARALLEL_MODE
+   test_ = "setNumThreads() function";
+
+   const size_t threads( blaze::getNumThreads() );
+
+   blaze::setNumThreads( 2UL );
+   checkNumThreads( 2UL );
+
+   blaze::setNumThreads( 1UL );
+   checkNumThreads( 1UL );
+
+   try {
+      blaze::setNumThreads( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkNumThreads( 1UL );
+
+   blaze::setNumThreads( threads );
+   checkNumThreads( threads );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setTaskArena() and resetTaskArena() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the interaction of an externally supplied TBB task arena with the task
+// arena created by the setNumThreads() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ThreadTest::testTaskArena()
+{
+#if BLAZE_TBB_PARALLEL_MODE
+   test_ = "setTaskArena() and resetTaskArena() functions";
+
+   const size_t threads( blaze::getNumThreads() );
+
+   tbb::task_arena arena( 3 );
+
+   blaze::setTaskArena( arena );
+   checkNumThreads( 3UL );
+   checkMultiplication();
+
+   blaze::setNumThreads( 2UL );
+   checkNumThreads( 2UL );
+   checkMultiplication();
+
+   blaze::setTaskArena( arena );
+   checkNumThreads( 3UL );
+
+   blaze::resetTaskArena();
+   checkNumThreads( threads );
+
+   blaze::setNumThreads( 1UL );
+   checkNumThreads( 1UL );
+
+   blaze::resetTaskArena();
+   checkNumThreads( threads );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP parallel for loop.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the smpFor() function calls the given operation exactly once for
+// every index of the iteration range, at most once per thread, and exactly once in case only a
+// single thread is available or a serial section is active. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ThreadTest::testParallelFor()
+{
+   const size_t threads( blaze::getNumThreads() );
+   const size_t N( 100000UL );
+
+   const auto run = [N]( size_t& blocks ) -> std::vector<int>
+   {
+      std::vector<int> hits( N, 0 );
+      std::atomic<size_t> calls( 0UL );
+
+      blaze::smpFor( 0UL, N, [&hits,&calls]( size_t first, size_t last ) {
+         ++calls;
+         for( size_t i=first; i<last; ++i )
+            ++hits[i];
+      } );
+
+      blocks = calls;
+      return hits;
+   };
+
+   const auto check = [this]( const std::vector<int>& hits, size_t blocks, size_t maxBlocks )
+   {
+      if( std::count( hits.begin(), hits.end(), 1 ) != static_cast<std::ptrdiff_t>( hits.size() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid coverage of the iteration range\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blocks == 0UL || blocks > maxBlocks ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of blocks\n"
+             << " Details:\n"
+             << "   Number of blocks = " << blocks << "\n"
+             << "   Maximum number of blocks = " << maxBlocks << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   {
+      test_ = "smpFor() with the default number of threads";
+
+      size_t blocks( 0UL );
+      const std::vector<int> hits( run( blocks ) );
+      check( hits, blocks, threads );
+   }
+
+   {
+      test_ = "smpFor() with a single thread";
+
+      blaze::setNumThreads( 1UL );
+
+      size_t blocks( 0UL );
+      const std::vector<int> hits( run( blocks ) );
+      check( hits, blocks, 1UL );
+
+      blaze::setNumThreads( threads );
+   }
+
+   {
+      test_ = "smpFor() within a serial section";
+
+      size_t blocks( 0UL );
+      std::vector<int> hits;
+
+      BLAZE_SERIAL_SECTION {
+         hits = run( blocks );
+      }
+
+      check( hits, blocks, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a parallel multiplication with varying numbers of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a dense matrix/dense matrix multiplication with one, two, and the default
+// number of threads. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThreadTest::testMultiplication()
+{
+   const size_t threads( blaze::getNumThreads() );
+
+   test_ = "Multiplication with a single thread";
+   blaze::setNumThreads( 1UL );
+   checkMultiplication();
+
+   test_ = "Multiplication with two threads";
+   blaze::setNumThreads( 2UL );
+   checkMultiplication();
+
+   test_ = "Multiplication with the default number of threads";
+   blaze::setNumThreads( threads );
+   checkMultiplication();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity and spin time configuration functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the setThreadAffinity() and setThreadSpinTime() functions are
+// available for the TBB-based parallelization and that they don't affect the results of parallel
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThreadTest::testConfiguration()
+{
+#if BLAZE_TBB_PARALLEL_MODE
+   test_ = "Thread affinity and spin time configuration";
+
+   blaze::setThreadAffinity( blaze::compactAffinity );
+   blaze::setThreadAffinity( blaze::scatterAffinity, 0UL );
+   blaze::setThreadAffinity( std::vector<size_t>{ 0UL } );
+   blaze::setThreadSpinTime( 0UL );
+
+   checkMultiplication();
+
+   blaze::shutDownThreads();
+
+   checkMultiplication();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of threads.
+//
+// \param expected The expected number of threads.
+// \return void
+// \exception std::runtime_error Invalid number of threads detected.
+*/
+inline void ThreadTest::checkNumThreads( size_t expected ) const
+{
+   if( blaze::getNumThreads() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Number of threads = " << blaze::getNumThreads() << "\n"
+          << "   Expected number of threads = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a parallel multiplication against a serial reference.
+//
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+inline void ThreadTest::checkMultiplication() const
+{
+   blaze::DynamicMatrix<int> A( 97UL, 83UL ), B( 83UL, 101UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<int>( ( i*7UL + j*3UL ) % 11UL ) - 5;
+
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<B.columns(); ++j )
+         B(i,j) = static_cast<int>( ( i*5UL + j*2UL ) % 13UL ) - 6;
+
+   blaze::DynamicMatrix<int> ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * B;
+   }
+
+   const blaze::DynamicMatrix<int> C( A * B );
+
+   if( C != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Number of threads = " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP thread configuration.
+//
+// \return void
+*/
+void runTest()
+{
+   ThreadTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP thread configuration test.
+*/
+#define RUN_DMATDMATMULT_THREAD_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,488 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdvecmult/AsyncTest.h
+//  \brief Header file for the asynchronous assignment test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDVECMULT_ASYNCTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDVECMULT_ASYNCTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/AsyncAssign.h>
+#include <blaze/math/smp/AsyncHandle.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdvecmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the asynchronous assignment test.
+//
+// This class represents a test suite for the asyncAssign() function and the AsyncHandle class.
+// It tests the completion and the results of asynchronous dense vector and dense matrix
+// assignments, the waiting of the handle on destruction and move assignment, and the
+// propagation of exceptions.
+*/
+class AsyncTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AsyncTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDefaultHandle();
+   void testVectorAssign();
+   void testMatrixAssign();
+   void testDestructor();
+   void testMoveAssignment();
+   void testSynchronousAssign();
+   void testException();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+
+   void checkReady( const blaze::AsyncHandle& handle ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a default constructed AsyncHandle.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a default constructed handle represents an already completed
+// operation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void AsyncTest::testDefaultHandle()
+{
+   test_ = "Default constructed handle";
+
+   blaze::AsyncHandle handle;
+
+   checkReady( handle );
+   handle.wait();
+   checkReady( handle );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of a dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of a dense matrix/dense vector multiplication
+// that is large enough to be executed in parallel, and of a small multiplication, which is
+// executed synchronously. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void AsyncTest::testVectorAssign()
+{
+   for( size_t m : { 7UL, 1000UL } )
+   {
+      test_ = "Asynchronous assignment of a dense matrix/dense vector multiplication";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( m, 400UL );
+      blaze::DynamicVector<int,blaze::columnVector> x( 400UL ), y( 3UL, 1 ), ref;
+
+      blaze::randomize( A, -10, 10 );
+      blaze::randomize( x, -10, 10 );
+
+      BLAZE_SERIAL_SECTION {
+         ref = A * x;
+      }
+
+      blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );
+      handle.wait();
+
+      checkReady( handle );
+      checkResult( y, ref );
+   }
+
+   {
+      test_ = "Asynchronous assignment within a serial section";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( 1000UL, 400UL );
+      blaze::DynamicVector<int,blaze::columnVector> x( 400UL ), y, ref;
+
+      blaze::randomize( A, -10, 10 );
+      blaze::randomize( x, -10, 10 );
+
+      BLAZE_SERIAL_SECTION {
+         ref = A * x;
+
+         blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );
+         checkReady( handle );
+      }
+
+      checkResult( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of a dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of a dense matrix/dense matrix multiplication
+// to a row-major and a column-major dense matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void AsyncTest::testMatrixAssign()
+{
+   test_ = "Asynchronous assignment of a dense matrix/dense matrix multiplication";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 150UL, 120UL ), B( 120UL, 130UL ), C1;
+   blaze::DynamicMatrix<int,blaze::columnMajor> C2( 2UL, 2UL, 1 );
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref;
+
+   blaze::randomize( A, -10, 10 );
+   blaze::randomize( B, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * B;
+   }
+
+   blaze::AsyncHandle handle1( blaze::asyncAssign( C1, A * B ) );
+   blaze::AsyncHandle handle2( blaze::asyncAssign( C2, A * B ) );
+
+   handle1.wait();
+   handle2.wait();
+
+   checkReady( handle1 );
+   checkReady( handle2 );
+   checkResult( C1, ref );
+   checkResult( C2, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AsyncHandle destructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the destructor of an AsyncHandle waits for the completion of the
+// asynchronous assignment. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void AsyncTest::testDestructor()
+{
+   test_ = "AsyncHandle destructor";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 1000UL, 400UL );
+   blaze::DynamicVector<int,blaze::columnVector> x( 400UL ), y, ref;
+
+   blaze::randomize( A, -10, 10 );
+   blaze::randomize( x, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * x;
+   }
+
+   {
+      blaze::AsyncHandle handle( blaze::asyncAssign( y, A * x ) );
+   }
+
+   checkResult( y, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AsyncHandle move operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the move constructor takes over the pending operation and that the
+// move assignment operator waits for the completion of the operation currently represented by
+// the handle. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void AsyncTest::testMoveAssignment()
+{
+   test_ = "AsyncHandle move operations";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 1000UL, 400UL );
+   blaze::DynamicVector<int,blaze::columnVector> x1( 400UL ), x2( 400UL ), y1, y2, ref1, ref2;
+
+   blaze::randomize( A, -10, 10 );
+   blaze::randomize( x1, -10, 10 );
+   blaze::randomize( x2, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      ref1 = A * x1;
+      ref2 = A * x2;
+   }
+
+   blaze::AsyncHandle handle1( blaze::asyncAssign( y1, A * x1 ) );
+   blaze::AsyncHandle handle2( std::move( handle1 ) );
+
+   handle2 = blaze::asyncAssign( y2, A * x2 );
+
+   checkResult( y1, ref1 );
+
+   handle2.wait();
+
+   checkResult( y2, ref2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a synchronous assignment during an asynchronous assignment.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a synchronous SMP assignment, which is started while an asynchronous
+// assignment is in progress, only waits for its own tasks and that both assignments compute the
+// correct result. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void AsyncTest::testSynchronousAssign()
+{
+   test_ = "Synchronous assignment during an asynchronous assignment";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 1000UL, 400UL );
+   blaze::DynamicVector<int,blaze::columnVector> x1( 400UL ), x2( 400UL ), y1, y2, ref1, ref2;
+
+   blaze::randomize( A, -10, 10 );
+   blaze::randomize( x1, -10, 10 );
+   blaze::randomize( x2, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      ref1 = A * x1;
+      ref2 = A * x2;
+   }
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      blaze::AsyncHandle handle( blaze::asyncAssign( y1, A * x1 ) );
+
+      y2 = A * x2;
+      checkResult( y2, ref2 );
+
+      handle.wait();
+      checkResult( y1, ref1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during an asynchronous assignment is either
+// thrown by asyncAssign() (in case the assignment is performed synchronously) or rethrown by
+// the wait() function of the handle. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+inline void AsyncTest::testException()
+{
+   test_ = "Propagation of exceptions";
+
+   blaze::DynamicVector<int,blaze::columnVector> x( 100000UL, 1 ), y;
+   x[54321UL] = -1;
+
+   const auto op = []( int value ) {
+      if( value < 0 ) throw std::range_error( "Negative value detected" );
+      return 2*value;
+   };
+
+   bool caught( false );
+
+   try {
+      blaze::AsyncHandle handle( blaze::asyncAssign( y, blaze::map( x, op ) ) );
+      handle.wait();
+   }
+   catch( std::range_error& ) {
+      caught = true;
+   }
+
+   if( !caught ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exception has not been propagated\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void AsyncTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given handle represents a completed operation.
+//
+// \param handle The handle to be checked.
+// \return void
+// \exception std::runtime_error Pending operation detected.
+*/
+inline void AsyncTest::checkReady( const blaze::AsyncHandle& handle ) const
+{
+   if( !handle.isReady() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Pending operation detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the asynchronous assignment.
+//
+// \return void
+*/
+void runTest()
+{
+   AsyncTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the asynchronous assignment test.
+*/
+#define RUN_DMATDVECMULT_ASYNC_TEST \
+   blazetest::mathtest::dmatdvecmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdvecmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
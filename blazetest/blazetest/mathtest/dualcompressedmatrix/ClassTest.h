@@ -0,0 +1,561 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dualcompressedmatrix/ClassTest.h
+//  \brief Header file for the DualCompressedMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DUALCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_DUALCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DualCompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dualcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the DualCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::DualCompressedMatrix class template. It
+// performs a series of conversions, lookups and transpositions as well as a series of operations
+// with dense and sparse matrices and vectors, which are compared to the according operations
+// with a compressed matrix holding the same elements.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testConversion();
+
+   template< bool SO >
+   void testLookup();
+
+   template< bool SO >
+   void testTranspose();
+
+   template< typename Type, bool SO >
+   void testOperations();
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected ) const;
+
+   template< typename Type, bool SO >
+   void checkIntact( const blaze::DualCompressedMatrix<Type,SO>& D ) const;
+
+   template< typename Type, bool SO >
+   void setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the construction, conversion, and assignment of dual compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion of row-major and column-major dense and sparse matrices
+// into a DualCompressedMatrix as well as the copy and move operations and the reset() and
+// clear() functions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testConversion()
+{
+   test_ = "Conversion from a row-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 31UL, 17UL );
+
+      const blaze::DualCompressedMatrix<int,SO> D( A );
+
+      checkIntact( D );
+      checkResult( D, A );
+   }
+
+   test_ = "Conversion from a column-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> A;
+      setupRandom( A, 17UL, 31UL );
+
+      const blaze::DualCompressedMatrix<int,SO> D( A );
+
+      checkIntact( D );
+      checkResult( D, A );
+   }
+
+   test_ = "Conversion from a dense matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 23UL, 29UL );
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> M( A );
+      const blaze::DualCompressedMatrix<int,SO> D( M );
+
+      checkIntact( D );
+      checkResult( D, A );
+   }
+
+   test_ = "Copy and move operations";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 19UL, 13UL );
+
+      blaze::DualCompressedMatrix<int,SO> D1( A );
+      blaze::DualCompressedMatrix<int,SO> D2( D1 );
+      blaze::DualCompressedMatrix<int,SO> D3( std::move( D1 ) );
+      blaze::DualCompressedMatrix<int,SO> D4( 3UL, 3UL );
+
+      D4 = D2;
+      D1 = std::move( D2 );
+
+      checkIntact( D1 );
+      checkIntact( D2 );
+      checkIntact( D3 );
+      checkIntact( D4 );
+      checkResult( D1, A );
+      checkResult( D3, A );
+      checkResult( D4, A );
+   }
+
+   test_ = "Assignment of a sparse matrix expression";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 11UL, 7UL );
+
+      blaze::DualCompressedMatrix<int,SO> D( A );
+      D = trans( 2 * D );
+
+      checkIntact( D );
+      checkResult( D, blaze::CompressedMatrix<int,blaze::rowMajor>( trans( 2 * A ) ) );
+   }
+
+   test_ = "Reset and clear";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 9UL, 14UL );
+
+      blaze::DualCompressedMatrix<int,SO> D( A );
+      reset( D );
+
+      checkIntact( D );
+      checkResult( D, blaze::CompressedMatrix<int,SO>( 9UL, 14UL ) );
+
+      D = A;
+      clear( D );
+
+      checkIntact( D );
+
+      if( !isDefault( D ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Clear operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the find(), lowerBound(), and upperBound() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the lookup functions of the DualCompressedMatrix class
+// template and its transpose with the results of the according functions of a compressed matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testLookup()
+{
+   test_ = "Lookup functions";
+
+   blaze::CompressedMatrix<int,SO> A;
+   setupRandom( A, 13UL, 21UL );
+
+   const blaze::DualCompressedMatrix<int,SO> D( A );
+   const blaze::CompressedMatrix<int,SO> B( trans( A ) );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const size_t k( SO ? j : i );
+         const size_t l( SO ? i : j );
+
+         if( D.find      ( i, j ) - D.begin(k) != A.find      ( i, j ) - A.begin(k) ||
+             D.lowerBound( i, j ) - D.begin(k) != A.lowerBound( i, j ) - A.begin(k) ||
+             D.upperBound( i, j ) - D.begin(k) != A.upperBound( i, j ) - A.begin(k) ||
+             trans( D ).find      ( j, i ) - trans( D ).begin(l) != B.find      ( j, i ) - B.begin(l) ||
+             trans( D ).lowerBound( j, i ) - trans( D ).begin(l) != B.lowerBound( j, i ) - B.begin(l) ||
+             trans( D ).upperBound( j, i ) - trans( D ).begin(l) != B.upperBound( j, i ) - B.begin(l) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Lookup of element (" << i << "," << j << ")\n"
+                << "   Dual compressed matrix:\n" << D << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose of a dual compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the transpose of a DualCompressedMatrix, which keeps the storage order
+// of the matrix, and its evaluation into dense and sparse matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testTranspose()
+{
+   test_ = "Transpose";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 27UL, 14UL );
+
+      const blaze::DualCompressedMatrix<int,SO> D( A );
+
+      checkResult( trans( D ), trans( A ) );
+      checkResult( blaze::CompressedMatrix<int,SO>( trans( D ) ), trans( A ) );
+      checkResult( blaze::CompressedMatrix<int,!SO>( trans( D ) ), trans( A ) );
+      checkResult( blaze::DynamicMatrix<int,blaze::rowMajor>( trans( D ) ), trans( A ) );
+      checkResult( trans( trans( D ) ), A );
+
+      const blaze::CompressedMatrix<int,SO> B( trans( A ) );
+
+      for( size_t i=0UL; i<( SO ? B.columns() : B.rows() ); ++i ) {
+         if( trans( D ).nonZeros(i) != B.nonZeros(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of non-zero elements\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Row/column index = " << i << "\n"
+                << "   Number of non-zeros = " << trans( D ).nonZeros(i) << "\n"
+                << "   Expected number of non-zeros = " << B.nonZeros(i) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   test_ = "Views on the transpose";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 27UL, 14UL );
+
+      const blaze::DualCompressedMatrix<int,SO> D( A );
+
+      checkResult( row( trans( D ), 5UL ), row( trans( A ), 5UL ) );
+      checkResult( column( trans( D ), 7UL ), column( trans( A ), 7UL ) );
+      checkResult( submatrix( trans( D ), 3UL, 4UL, 8UL, 11UL ),
+                   submatrix( trans( A ), 3UL, 4UL, 8UL, 11UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the operations with dense and sparse matrices and vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of various operations with a DualCompressedMatrix and
+// its transpose with the results of the according operations with a compressed matrix. All
+// values are small integral values, such that the results are computed exactly independent of
+// the order of the summation. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type, bool SO >
+void ClassTest::testOperations()
+{
+   blaze::CompressedMatrix<Type,SO> A;
+   setupRandom( A, 73UL, 51UL );
+
+   const blaze::DualCompressedMatrix<Type,SO> D( A );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( 51UL ), y( 73UL );
+   blaze::DynamicVector<Type,blaze::rowVector> z( 73UL ), w( 51UL );
+   blaze::DynamicMatrix<Type,blaze::columnMajor> M( 51UL, 12UL );
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = Type( blaze::rand<int>( -5, 5 ) );
+      w[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t i=0UL; i<y.size(); ++i ) {
+      y[i] = Type( blaze::rand<int>( -5, 5 ) );
+      z[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t j=0UL; j<M.columns(); ++j ) {
+      for( size_t i=0UL; i<M.rows(); ++i ) {
+         M(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+
+   test_ = "Dual matrix/dense vector multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::columnVector>( D * x ),
+                blaze::DynamicVector<Type,blaze::columnVector>( A * x ) );
+
+   test_ = "Transpose dual matrix/dense vector multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::columnVector>( trans( D ) * y ),
+                blaze::DynamicVector<Type,blaze::columnVector>( trans( A ) * y ) );
+
+   test_ = "Dense vector/dual matrix multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::rowVector>( z * D ),
+                blaze::DynamicVector<Type,blaze::rowVector>( z * A ) );
+
+   test_ = "Dense vector/transpose dual matrix multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::rowVector>( w * trans( D ) ),
+                blaze::DynamicVector<Type,blaze::rowVector>( w * trans( A ) ) );
+
+   test_ = "Dual matrix/dense vector multiplication with addition assignment";
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> r1( y ), r2( y );
+      r1 += D * x;
+      r2 += A * x;
+      checkResult( r1, r2 );
+   }
+
+   test_ = "Dense vector/dual matrix multiplication with subtraction assignment";
+   {
+      blaze::DynamicVector<Type,blaze::rowVector> r1( w ), r2( w );
+      r1 -= z * D;
+      r2 -= z * A;
+      checkResult( r1, r2 );
+   }
+
+   test_ = "Dual matrix/dense matrix multiplication";
+   checkResult( blaze::DynamicMatrix<Type,blaze::rowMajor>( D * M ),
+                blaze::DynamicMatrix<Type,blaze::rowMajor>( A * M ) );
+
+   test_ = "Transpose dual matrix/dual matrix multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( trans( D ) * D ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( trans( A ) * A ) );
+
+   test_ = "Dual matrix/sparse matrix addition";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( D + A ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A * Type(2) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2 >  // Type of the expected result
+void ClassTest::checkResult( const MT1& result, const MT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants of the given dual compressed matrix.
+//
+// \param D The dual compressed matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type, bool SO >
+void ClassTest::checkIntact( const blaze::DualCompressedMatrix<Type,SO>& D ) const
+{
+   if( !isIntact( D ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+          << "   Dual compressed matrix:\n" << D << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a random sparse matrix with small integral values.
+//
+// \param A The matrix to be set up.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The matrix contains roughly 20% non-zero elements with values in the range \f$[1..9]\f$.
+*/
+template< typename Type, bool SO >
+void ClassTest::setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const
+{
+   A.resize( m, n, false );
+   A.reset();
+
+   for( size_t k=0UL; k<(m*n)/5UL; ++k ) {
+      A(blaze::rand<size_t>( 0UL, m-1UL ),blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the DualCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DualCompressedMatrix class test.
+*/
+#define RUN_DUALCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::dualcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dualcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,445 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dvecdvecadd/ThresholdTest.h
+//  \brief Header file for the runtime SMP threshold test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DVECDVECADD_THRESHOLDTEST_H_
+#define _BLAZETEST_MATHTEST_DVECDVECADD_THRESHOLDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Calibration.h>
+#include <blaze/system/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecdvecadd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the runtime SMP threshold test.
+//
+// This class represents a test suite for the runtime SMP thresholds. It tests the setting and
+// resetting of individual thresholds, the effect of a threshold on the decision between serial
+// and parallel execution, and the persistence of (calibrated) thresholds via the
+// saveSMPThresholds() and loadSMPThresholds() functions.
+*/
+class ThresholdTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThresholdTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Table = blaze::SMPThresholdTable<int>;  //!< Table of the runtime SMP thresholds.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDefaults();
+   void testSetThreshold();
+   void testReset();
+   void testSaveLoad();
+   void testInvalidFile();
+   void testCalibration();
+
+   void checkThreshold( size_t value, size_t expected ) const;
+   void checkThresholds( const std::vector<size_t>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string file_;  //!< The name of the temporary threshold file.
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the initial values of the runtime SMP thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all runtime SMP thresholds are initialized with their compile time
+// defaults. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::testDefaults()
+{
+   test_ = "Initial values of the SMP thresholds";
+
+   checkThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, blaze::SMP_DVECDVECADD_DEFAULT_THRESHOLD );
+   checkThreshold( blaze::SMP_DMATDMATMULT_THRESHOLD, blaze::SMP_DMATDMATMULT_DEFAULT_THRESHOLD );
+   checkThresholds( std::vector<size_t>( Table::defaults, Table::defaults + Table::size ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setSMPThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that setSMPThreshold() adapts exactly the given threshold and that the
+// new value is consulted by the SMP assignment checks of the according operation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::testSetThreshold()
+{
+   test_ = "setSMPThreshold() function";
+
+   const blaze::DynamicVector<int,blaze::columnVector> a( 1000UL, 1 ), b( 1000UL, 2 );
+
+   blaze::setSMPThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 100000UL );
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 100000UL );
+
+   checkThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 100000UL );
+   checkThreshold( blaze::SMP_DVECDVECSUB_THRESHOLD, blaze::SMP_DVECDVECSUB_DEFAULT_THRESHOLD );
+
+   if( ( a + b ).canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Raised SMP threshold is not consulted\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setSMPThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 100UL );
+
+   checkThreshold( blaze::SMP_DVECDVECADD_THRESHOLD, 100UL );
+
+   if( !( a + b ).canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lowered SMP threshold is not consulted\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::DynamicVector<int,blaze::columnVector> c( a + b );
+
+   if( c != blaze::DynamicVector<int,blaze::columnVector>( 1000UL, 3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition failed\n"
+          << " Details:\n"
+          << "   Result:\n" << c << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resetSMPThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that resetSMPThresholds() restores the compile time defaults of all SMP
+// thresholds. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::testReset()
+{
+   test_ = "resetSMPThresholds() function";
+
+   blaze::setSMPThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 1UL );
+   blaze::setSMPThreshold( blaze::SMP_DMATDVECMULT_THRESHOLD, 2UL );
+   blaze::setSMPThreshold( blaze::SMP_DMATSMATCONVERT_THRESHOLD, 3UL );
+   blaze::setSMPThreshold( blaze::SMP_SMATREORDER_THRESHOLD, 4UL );
+
+   blaze::resetSMPThresholds();
+
+   checkThresholds( std::vector<size_t>( Table::defaults, Table::defaults + Table::size ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the saveSMPThresholds() and loadSMPThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a set of SMP thresholds written via saveSMPThresholds() is restored
+// by loadSMPThresholds(). In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void ThresholdTest::testSaveLoad()
+{
+   test_ = "Round-trip of saveSMPThresholds() and loadSMPThresholds()";
+
+   blaze::setSMPThreshold( blaze::SMP_DVECASSIGN_THRESHOLD, 12345UL );
+   blaze::setSMPThreshold( blaze::SMP_TDMATDVECMULT_THRESHOLD, 0UL );
+   blaze::setSMPThreshold( blaze::SMP_DMATSMATCONVERT_THRESHOLD, std::numeric_limits<size_t>::max() );
+   blaze::setSMPThreshold( blaze::SMP_SMATREORDER_THRESHOLD, 7UL );
+
+   const std::vector<size_t> expected( Table::values, Table::values + Table::size );
+
+   blaze::saveSMPThresholds( file_ );
+   blaze::resetSMPThresholds();
+
+   if( !blaze::loadSMPThresholds( file_ ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold file could not be read\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkThresholds( expected );
+
+   blaze::resetSMPThresholds();
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of loadSMPThresholds() with missing and invalid files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that loadSMPThresholds() doesn't change any threshold in case the given
+// file doesn't exist or contains an invalid line. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::testInvalidFile()
+{
+   const std::vector<size_t> expected( Table::defaults, Table::defaults + Table::size );
+
+   test_ = "loadSMPThresholds() with a missing file";
+
+   std::remove( file_.c_str() );
+
+   if( blaze::loadSMPThresholds( file_ ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a missing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkThresholds( expected );
+
+   test_ = "loadSMPThresholds() with an invalid file";
+
+   {
+      std::ofstream file( file_.c_str() );
+      file << Table::names[0] << " 42\n"
+           << "SMP_UNKNOWN_THRESHOLD 17\n";
+   }
+
+   try {
+      blaze::loadSMPThresholds( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an invalid file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ) != "Invalid SMP threshold file" )
+         throw;
+   }
+
+   checkThresholds( expected );
+
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the calibration of the SMP thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the thresholds determined by calibrateSMPThresholds() are restored
+// by a round-trip via saveSMPThresholds() and loadSMPThresholds(). In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::testCalibration()
+{
+   test_ = "Round-trip of calibrated SMP thresholds";
+
+   blaze::calibrateSMPThresholds();
+
+   const std::vector<size_t> expected( Table::values, Table::values + Table::size );
+
+   blaze::saveSMPThresholds( file_ );
+   blaze::resetSMPThresholds();
+   blaze::loadSMPThresholds( file_ );
+
+   checkThresholds( expected );
+
+   blaze::resetSMPThresholds();
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the value of a single SMP threshold.
+//
+// \param value The current value of the SMP threshold.
+// \param expected The expected value of the SMP threshold.
+// \return void
+// \exception std::runtime_error Invalid threshold detected.
+*/
+inline void ThresholdTest::checkThreshold( size_t value, size_t expected ) const
+{
+   if( value != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid SMP threshold\n"
+          << " Details:\n"
+          << "   Value = " << value << "\n"
+          << "   Expected value = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of all SMP thresholds.
+//
+// \param expected The expected values of all SMP thresholds.
+// \return void
+// \exception std::runtime_error Invalid threshold detected.
+*/
+inline void ThresholdTest::checkThresholds( const std::vector<size_t>& expected ) const
+{
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      if( Table::values[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid SMP threshold\n"
+             << " Details:\n"
+             << "   Threshold = " << Table::names[i] << "\n"
+             << "   Value = " << Table::values[i] << "\n"
+             << "   Expected value = " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime SMP threshold.
+//
+// \return void
+*/
+void runTest()
+{
+   ThresholdTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime SMP threshold test.
+*/
+#define RUN_DVECDVECADD_THRESHOLD_TEST \
+   blazetest::mathtest::dvecdvecadd::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dvecdvecadd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
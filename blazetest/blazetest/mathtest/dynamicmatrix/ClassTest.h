@@ -54,6 +54,7 @@
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/constraints/SameType.h>
+#include <blazetest/mathtest/CountingAllocator.h>
 #include <blazetest/system/Types.h>
 
 
@@ -118,6 +119,7 @@ class ClassTest
    void testTranspose   ();
    void testCTranspose  ();
    void testIsDefault   ();
+   void testAllocator   ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
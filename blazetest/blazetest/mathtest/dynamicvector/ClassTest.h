@@ -53,6 +53,7 @@
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
+#include <blazetest/mathtest/CountingAllocator.h>
 #include <blazetest/system/Types.h>
 
 
@@ -116,6 +117,7 @@ class ClassTest
    void testShrinkToFit ();
    void testSwap        ();
    void testIsDefault   ();
+   void testAllocator   ();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
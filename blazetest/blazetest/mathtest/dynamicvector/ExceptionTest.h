@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dynamicvector/ExceptionTest.h
+//  \brief Header file for the DynamicVector exception safety test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DYNAMICVECTOR_EXCEPTIONTEST_H_
+#define _BLAZETEST_MATHTEST_DYNAMICVECTOR_EXCEPTIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/CountingAllocator.h>
+#include <blazetest/mathtest/ThrowingElement.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamicvector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the exception safety test of the DynamicVector class template.
+//
+// This class represents a test suite for the exception safety of the DynamicVector class template. It
+// checks that all elements are destroyed and all memory is released in case the initialization
+// of an element throws an exception.
+*/
+class ExceptionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ExceptionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testInitConstructor();
+   void testAllocatorConstructor();
+   void checkInstances( int expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the homogeneous initialization constructor of the DynamicVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the homogeneous initialization constructor destroys all elements
+// and releases its memory in case the initialization of an element throws an exception. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExceptionTest::testInitConstructor()
+{
+   {
+      test_ = "DynamicVector homogeneous initialization constructor (successful initialization)";
+
+      const ThrowingElement init( 3 );
+      ThrowingElement::setCopies( 5UL );
+
+      {
+         blaze::DynamicVector<ThrowingElement> v( 5UL, init );
+         checkInstances( 5+1 );
+      }
+
+      checkInstances( 1 );
+   }
+
+   {
+      test_ = "DynamicVector homogeneous initialization constructor (failing initialization)";
+
+      const ThrowingElement init( 3 );
+      ThrowingElement::setCopies( 3UL );
+
+      try {
+         blaze::DynamicVector<ThrowingElement> v( 5UL, init );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failing element initialization not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Copy assignment failed" ) throw;
+      }
+
+      checkInstances( 1 );
+   }
+
+   ThrowingElement::setCopies( static_cast<size_t>( -1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the homogeneous initialization constructor with a custom allocator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the homogeneous initialization constructor with a custom allocator. It
+// checks the initialized values and that all memory is returned to the allocator, also in case
+// the initialization of an element throws an exception. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExceptionTest::testAllocatorConstructor()
+{
+   {
+      test_ = "DynamicVector homogeneous initialization constructor with allocator";
+
+      AllocationCounter counter;
+      CountingAllocator<int> alloc( counter );
+
+      {
+         blaze::DynamicVector<int,blaze::columnVector,CountingAllocator<int> > v( 1000UL, 2, alloc );
+
+      for( size_t i=0UL; i<v.size(); ++i ) {
+         if( v[i] != 2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Initialization failed\n"
+                << " Details:\n"
+                << "   Result:\n" << v << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      }
+
+      if( counter.allocations != 1UL || counter.deallocations != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of allocations\n"
+             << " Details:\n"
+             << "   Allocations   = " << counter.allocations << " (expected 1)\n"
+             << "   Deallocations = " << counter.deallocations << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicVector homogeneous initialization constructor with allocator (failing initialization)";
+
+      AllocationCounter counter;
+      CountingAllocator<ThrowingElement> alloc( counter );
+
+      const ThrowingElement init( 3 );
+      ThrowingElement::setCopies( 3UL );
+
+      try {
+         blaze::DynamicVector<ThrowingElement,blaze::columnVector,CountingAllocator<ThrowingElement> > v( 5UL, init, alloc );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failing element initialization not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Copy assignment failed" ) throw;
+      }
+
+      checkInstances( 1 );
+
+      if( counter.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory leak detected\n"
+             << " Details:\n"
+             << "   Number of allocated elements = " << counter.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   ThrowingElement::setCopies( static_cast<size_t>( -1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of alive elements.
+//
+// \param expected The expected number of alive elements.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+*/
+void ExceptionTest::checkInstances( int expected ) const
+{
+   if( ThrowingElement::instances() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of alive elements\n"
+          << " Details:\n"
+          << "   Number of alive elements = " << ThrowingElement::instances() << "\n"
+          << "   Expected number of alive elements = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the DynamicVector exception safety.
+//
+// \return void
+*/
+void runTest()
+{
+   ExceptionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DynamicVector exception safety test.
+*/
+#define RUN_DYNAMICVECTOR_EXCEPTION_TEST \
+   blazetest::mathtest::dynamicvector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dynamicvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,526 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/ellmatrix/ClassTest.h
+//  \brief Header file for the EllMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ELLMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_ELLMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/EllMatrix.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace ellmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the EllMatrix class template.
+//
+// This class represents a test suite for the blaze::EllMatrix class template. It performs a
+// series of conversions from compressed matrices and of matrix/vector multiplications for
+// matrices with irregular row lengths.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testConversion();
+
+   template< typename Type >
+   void testMultiplication();
+
+   template< typename Type >
+   void testNonFinite();
+
+   void testExceptions();
+
+   template< typename Type >
+   void checkElements( const blaze::EllMatrix<Type>& E,
+                       const blaze::CompressedMatrix<Type,blaze::rowMajor>& A ) const;
+
+   template< typename Type >
+   void checkProduct( const blaze::EllMatrix<Type>& E,
+                      const blaze::CompressedMatrix<Type,blaze::rowMajor>& A ) const;
+
+   template< typename Type >
+   void setupIrregular( blaze::CompressedMatrix<Type,blaze::rowMajor>& A, size_t m, size_t n ) const;
+
+   template< typename Type >
+   void setupVector( blaze::DynamicVector<Type,blaze::columnVector>& x ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion from compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion of row-major and column-major compressed matrices with
+// irregular row lengths into an EllMatrix, both with automatically selected and with explicitly
+// given slab widths. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testConversion()
+{
+   test_ = "Conversion with automatic slab width";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      setupIrregular( A, 203UL, 97UL );
+
+      const blaze::EllMatrix<Type> E( A );
+
+      checkElements( E, A );
+
+      if( E.width() == 0UL || E.width() > 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid slab width\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Slab width = " << E.width() << "\n"
+             << "   Expected slab width = [1..8]\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Conversion with explicit slab width";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      setupIrregular( A, 67UL, 45UL );
+
+      checkElements( blaze::EllMatrix<Type>( A, 0UL  ), A );
+      checkElements( blaze::EllMatrix<Type>( A, 3UL  ), A );
+      checkElements( blaze::EllMatrix<Type>( A, 64UL ), A );
+   }
+
+   test_ = "Conversion of a column-major matrix";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      setupIrregular( A, 51UL, 60UL );
+
+      const blaze::CompressedMatrix<Type,blaze::columnMajor> B( A );
+
+      checkElements( blaze::EllMatrix<Type>( B ), A );
+   }
+
+   test_ = "Conversion of an empty matrix";
+
+   {
+      const blaze::CompressedMatrix<Type,blaze::rowMajor> A( 0UL, 5UL );
+
+      checkElements( blaze::EllMatrix<Type>( A ), A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of an EllMatrix with dense vectors for both small and
+// large matrices (i.e. for both the serial and the parallel execution) and for several slab
+// widths. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testMultiplication()
+{
+   test_ = "Multiplication with automatic slab width";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+
+      setupIrregular( A, 37UL, 29UL );
+      checkProduct( blaze::EllMatrix<Type>( A ), A );
+
+      setupIrregular( A, 2011UL, 523UL );
+      checkProduct( blaze::EllMatrix<Type>( A ), A );
+   }
+
+   test_ = "Multiplication with explicit slab width";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      setupIrregular( A, 1201UL, 300UL );
+
+      checkProduct( blaze::EllMatrix<Type>( A, 0UL   ), A );
+      checkProduct( blaze::EllMatrix<Type>( A, 5UL   ), A );
+      checkProduct( blaze::EllMatrix<Type>( A, 300UL ), A );
+   }
+
+   test_ = "Multiplication with reused target vector";
+
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      setupIrregular( A, 130UL, 70UL );
+
+      const blaze::EllMatrix<Type> E( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( 70UL ), y( 3UL );
+      setupVector( x );
+
+      E.multiply( x, y );
+      E.multiply( x, y );
+
+      const blaze::DynamicVector<Type,blaze::columnVector> ref( A * x );
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with non-finite vector elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the padded elements of the ELLPACK slab don't propagate non-finite
+// vector elements (NaN and infinity) to rows without a corresponding non-zero element and don't
+// turn infinite results into NaN. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testNonFinite()
+{
+   test_ = "Multiplication with non-finite vector elements";
+
+   const size_t m( 37UL );
+   const size_t n( 8UL );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      switch( i % 4UL ) {
+         case 0UL: break;
+         case 1UL: A(i,3) = Type( 2 ); break;
+         case 2UL: A(i,1) = Type( 1 ); A(i,3) = Type( 1 ); A(i,5) = Type( 1 ); break;
+         case 3UL: A(i,0) = Type( 1 ); A(i,2) = Type( 1 ); break;
+      }
+   }
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n, Type( 1 ) );
+   x[0] = std::numeric_limits<Type>::quiet_NaN();
+   x[5] = std::numeric_limits<Type>::infinity();
+
+   for( size_t width : { 0UL, 1UL, 2UL, 3UL, 4UL } )
+   {
+      const blaze::EllMatrix<Type> E( A, width );
+      const blaze::DynamicVector<Type,blaze::columnVector> y( E * x );
+
+      for( size_t i=0UL; i<m; ++i )
+      {
+         const bool valid( ( i % 4UL == 0UL ) ? ( y[i] == Type( 0 ) ) :
+                           ( i % 4UL == 1UL ) ? ( y[i] == Type( 2 ) ) :
+                           ( i % 4UL == 2UL ) ? ( y[i] == std::numeric_limits<Type>::infinity() ) :
+                                                ( blaze::isnan( y[i] ) ) );
+
+         if( !valid ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Slab width = " << E.width() << "\n"
+                << "   Row = " << i << "\n"
+                << "   Result:\n" << y << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given EllMatrix.
+//
+// \param E The EllMatrix to be checked.
+// \param A The original compressed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size, the number of non-zero elements, the number of overflow
+// elements and all elements of the given EllMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::checkElements( const blaze::EllMatrix<Type>& E,
+                               const blaze::CompressedMatrix<Type,blaze::rowMajor>& A ) const
+{
+   size_t overflow( 0UL );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      if( A.nonZeros(i) > E.width() )
+         overflow += A.nonZeros(i) - E.width();
+   }
+
+   if( E.rows() != A.rows() || E.columns() != A.columns() ||
+       E.nonZeros() != A.nonZeros() || E.overflow() != overflow ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix properties\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Slab width = " << E.width() << "\n"
+          << "   Size = " << E.rows() << "x" << E.columns() << "\n"
+          << "   Expected size = " << A.rows() << "x" << A.columns() << "\n"
+          << "   Number of non-zeros = " << E.nonZeros() << "\n"
+          << "   Expected number of non-zeros = " << A.nonZeros() << "\n"
+          << "   Number of overflow elements = " << E.overflow() << "\n"
+          << "   Expected number of overflow elements = " << overflow << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( E(i,j) != A(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Slab width = " << E.width() << "\n"
+                << "   Element (" << i << "," << j << ") = " << E(i,j) << "\n"
+                << "   Expected element = " << A(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the product of the given EllMatrix with a random dense vector.
+//
+// \param E The EllMatrix to be checked.
+// \param A The original compressed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void ClassTest::checkProduct( const blaze::EllMatrix<Type>& E,
+                              const blaze::CompressedMatrix<Type,blaze::rowMajor>& A ) const
+{
+   blaze::DynamicVector<Type,blaze::columnVector> x( A.columns() );
+   setupVector( x );
+
+   const blaze::DynamicVector<Type,blaze::columnVector> y  ( E * x );
+   const blaze::DynamicVector<Type,blaze::columnVector> ref( A * x );
+
+   if( y != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Size = " << E.rows() << "x" << E.columns() << "\n"
+          << "   Slab width = " << E.width() << "\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a random matrix with irregular row lengths.
+//
+// \param A The matrix to be set up.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// Most rows of the matrix contain up to 8 non-zero elements, every 16th row contains up to
+// 64 non-zero elements and some rows are empty. All elements are small integral values, such
+// that products are computed exactly independent of the order of the summation.
+*/
+template< typename Type >
+void ClassTest::setupIrregular( blaze::CompressedMatrix<Type,blaze::rowMajor>& A,
+                                size_t m, size_t n ) const
+{
+   A.resize( m, n, false );
+   A.reset();
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t length( ( i % 16UL == 5UL )?( blaze::rand<size_t>( 9UL, 64UL ) )
+                                              :( blaze::rand<size_t>( 0UL, 8UL ) ) );
+
+      for( size_t k=0UL; k<length; ++k ) {
+         A(i,blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Setup of a random dense vector with small integral values.
+//
+// \param x The vector to be set up.
+// \return void
+*/
+template< typename Type >
+void ClassTest::setupVector( blaze::DynamicVector<Type,blaze::columnVector>& x ) const
+{
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the EllMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the EllMatrix class test.
+*/
+#define RUN_ELLMATRIX_CLASS_TEST \
+   blazetest::mathtest::ellmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace ellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,867 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/encodedmatrix/ClassTest.h
+//  \brief Header file for the EncodedMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_ENCODEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_ENCODEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/EncodedMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace encodedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the EncodedMatrix class template.
+//
+// This class represents a test suite for the blaze::EncodedMatrix class template. It performs
+// a series of conversions, lookups and transpositions as well as a series of operations with
+// dense and sparse matrices and vectors for all kinds of value encodings, which are compared
+// to the according operations with a compressed matrix holding the same values.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Encoding, bool SO >
+   void testConversion();
+
+   template< typename Encoding >
+   void testRounding();
+
+   void testDictionary();
+
+   void testAppend();
+
+   template< bool SO >
+   void testLookup();
+
+   template< typename Encoding, bool SO >
+   void testTranspose();
+
+   template< typename Type, typename Encoding, bool SO >
+   void testOperations();
+
+   template< typename MT1, typename MT2 >
+   void checkElements( const MT1& E, const MT2& A ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected ) const;
+
+   template< typename Type, bool SO >
+   void setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion from dense and sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion of row-major and column-major dense and sparse matrices
+// into an EncodedMatrix. All values are small integral values, which are represented exactly
+// by all encodings. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+void ClassTest::testConversion()
+{
+   using EMT = blaze::EncodedMatrix<double,Encoding,SO>;
+
+   test_ = "Conversion from a row-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      setupRandom( A, 31UL, 17UL );
+
+      checkElements( EMT( A ), A );
+   }
+
+   test_ = "Conversion from a column-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> A;
+      setupRandom( A, 17UL, 31UL );
+
+      checkElements( EMT( A ), A );
+   }
+
+   test_ = "Conversion from a compressed matrix with explicit zeros";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+      A(0,1) = 2.0;
+      A(1,0) = 0.0;
+      A(1,3) = 5.0;
+      A(2,2) = 0.0;
+
+      const EMT E( A );
+
+      checkElements( E, A );
+
+      if( E.nonZeros() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros = " << E.nonZeros() << "\n"
+             << "   Expected number of non-zeros = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Conversion from a dense matrix";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      setupRandom( A, 23UL, 29UL );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> D1( A );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> D2( A );
+
+      checkElements( EMT( D1 ), A );
+      checkElements( EMT( D2 ), A );
+   }
+
+   test_ = "Conversion from a sparse matrix expression";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      setupRandom( A, 19UL, 13UL );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( 2.0 * A );
+      const blaze::CompressedMatrix<double,blaze::columnMajor> C( trans( A ) );
+
+      checkElements( EMT( 2.0 * A ), B );
+      checkElements( EMT( trans( A ) ), C );
+   }
+
+   test_ = "Assignment of a sparse matrix";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      setupRandom( A, 11UL, 7UL );
+
+      EMT E( 3UL, 3UL );
+      E = A;
+
+      checkElements( E, A );
+
+      E = blaze::CompressedMatrix<double,blaze::rowMajor>( 5UL, 6UL );
+
+      checkElements( E, blaze::CompressedMatrix<double,blaze::rowMajor>( 5UL, 6UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rounding of values by reduced precision encodings.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that each value of a reduced precision encoded matrix corresponds to
+// the value rounded to the encoding, and that values that are rounded to zero are not stored.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Encoding >  // Encoding of the values
+void ClassTest::testRounding()
+{
+   test_ = "Rounding of values";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 2UL, 3UL );
+   A(0,0) = 1.0 / 3.0;
+   A(0,2) = -7.1;
+   A(1,1) = 1E-300;
+   A(1,2) = 12345.678;
+
+   const blaze::EncodedMatrix<double,Encoding,blaze::rowMajor> E( A );
+
+   if( E.nonZeros() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Encoding type:\n"
+          << "     " << typeid( Encoding ).name() << "\n"
+          << "   Number of non-zeros = " << E.nonZeros() << "\n"
+          << "   Expected number of non-zeros = 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         const double expected( Encoding( float( A(i,j) ) ) );
+         if( E(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Encoding type:\n"
+                << "     " << typeid( Encoding ).name() << "\n"
+                << "   Element (" << i << "," << j << ") = " << E(i,j) << "\n"
+                << "   Expected element = " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dictionary encoding.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup of the dictionary of a dictionary encoded matrix, the exact
+// representation of arbitrary values, the handling of explicit zeros and NaN values, and the
+// detection of too many distinct values. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+inline void ClassTest::testDictionary()
+{
+   using blaze::Dictionary;
+
+   test_ = "Dictionary setup";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 4UL, 5UL );
+      A(0,0) = 1.0 / 3.0;
+      A(0,4) = -2.5;
+      A(1,2) = 1.0 / 3.0;
+      A(2,1) = 1E-300;
+      A(3,3) = -2.5;
+
+      const blaze::EncodedMatrix<double,Dictionary<uint8_t>,blaze::columnMajor> E( A );
+
+      checkElements( E, A );
+
+      if( E.distinctValues() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of distinct values\n"
+             << " Details:\n"
+             << "   Number of distinct values = " << E.distinctValues() << "\n"
+             << "   Expected number of distinct values = 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Dictionary with explicit zeros";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL, 4UL );
+      A.insert( 0UL, 1UL, 2.0 );
+      A.insert( 1UL, 0UL, 0.0 );
+      A.insert( 1UL, 3UL, 5.0 );
+      A.insert( 2UL, 2UL, -0.0 );
+
+      const blaze::EncodedMatrix<double,Dictionary<uint8_t>,blaze::rowMajor> E( A );
+
+      checkElements( E, A );
+
+      if( E.nonZeros() != 2UL || E.distinctValues() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Explicit zeros have been encoded\n"
+             << " Details:\n"
+             << "   Number of non-zeros = " << E.nonZeros() << " (expected 2)\n"
+             << "   Number of distinct values = " << E.distinctValues() << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Dictionary with NaN values";
+
+   {
+      const double nan( std::numeric_limits<double>::quiet_NaN() );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL, 6UL );
+      A.insert( 0UL, 0UL, 3.0 );
+      A.insert( 0UL, 2UL, nan );
+      A.insert( 1UL, 1UL, -1.0 );
+      A.insert( 1UL, 3UL, 3.0 );
+      A.insert( 2UL, 0UL, -nan );
+      A.insert( 2UL, 3UL, 1.0 );
+
+      const blaze::EncodedMatrix<double,Dictionary<uint8_t>,blaze::columnMajor> E( A );
+
+      checkElements( E, A );
+
+      if( E.nonZeros() != 6UL || E.distinctValues() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid encoding of NaN values\n"
+             << " Details:\n"
+             << "   Number of non-zeros = " << E.nonZeros() << " (expected 6)\n"
+             << "   Number of distinct values = " << E.distinctValues() << " (expected 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Dictionary overflow";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 100UL );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = double( i*A.columns() + j + 1UL );
+         }
+      }
+
+      try {
+         const blaze::EncodedMatrix<double,Dictionary<uint8_t>,blaze::rowMajor> E( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Encoding of 300 distinct values succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << E << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      const blaze::EncodedMatrix<double,Dictionary<uint16_t>,blaze::rowMajor> E( A );
+
+      checkElements( E, A );
+   }
+
+   test_ = "Dictionary append";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,1) = 5.0;
+      A(1,0) = 2.0;
+      A(1,2) = 5.0;
+      A(2,1) = 1.0;
+
+      blaze::EncodedMatrix<double,Dictionary<uint8_t>,blaze::rowMajor> E( 3UL, 3UL );
+      E.append( 0UL, 1UL, 5.0 );
+      E.finalize( 0UL );
+      E.append( 1UL, 0UL, 2.0 );
+      E.append( 1UL, 2UL, 5.0 );
+      E.finalize( 1UL );
+      E.append( 2UL, 0UL, 0.0, true );
+      E.append( 2UL, 1UL, 1.0 );
+      E.finalize( 2UL );
+
+      checkElements( E, A );
+
+      if( E.distinctValues() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of distinct values\n"
+             << " Details:\n"
+             << "   Number of distinct values = " << E.distinctValues() << "\n"
+             << "   Expected number of distinct values = 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Dictionary append of unordered values";
+
+   {
+      const double nan( std::numeric_limits<double>::quiet_NaN() );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 20UL, 50UL, 1000UL );
+      blaze::EncodedMatrix<double,Dictionary<uint16_t>,blaze::rowMajor> E( 20UL, 50UL );
+      E.reserve( 1000UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            const double value( ( j == 7UL ) ? nan : double( ( i*A.columns()+j ) * 7919UL % 997UL ) );
+            A.append( i, j, value );
+            E.append( i, j, value );
+         }
+         A.finalize( i );
+         E.finalize( i );
+      }
+
+      checkElements( E, A );
+
+      if( E.distinctValues() != 978UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of distinct values\n"
+             << " Details:\n"
+             << "   Number of distinct values = " << E.distinctValues() << "\n"
+             << "   Expected number of distinct values = 978\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the low-level append() and finalize() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup of row-major and column-major encoded matrices via the
+// reserve(), append(), and finalize() functions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::testAppend()
+{
+   test_ = "Row-major append";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 4UL, 3UL );
+      A(0,1) = 1.0;
+      A(1,1) = 2.0;
+      A(1,2) = 3.0;
+      A(3,0) = 4.0;
+
+      blaze::EncodedMatrix<double,float,blaze::rowMajor> E( 4UL, 3UL );
+      E.reserve( 4UL );
+      E.append( 0UL, 1UL, 1.0 );
+      E.finalize( 0UL );
+      E.append( 1UL, 1UL, 2.0 );
+      E.append( 1UL, 2UL, 3.0 );
+      E.finalize( 1UL );
+      E.append( 2UL, 2UL, 1E-300, true );
+      E.finalize( 2UL );
+      E.append( 3UL, 0UL, 4.0 );
+      E.finalize( 3UL );
+
+      checkElements( E, A );
+   }
+
+   test_ = "Column-major append";
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> A( 3UL, 4UL );
+      A(1,0) = 1.0;
+      A(1,1) = 2.0;
+      A(2,1) = 3.0;
+      A(0,3) = 4.0;
+
+      blaze::EncodedMatrix<double,blaze::BFloat16,blaze::columnMajor> E( 3UL, 4UL );
+      E.reserve( 4UL );
+      E.append( 1UL, 0UL, 1.0 );
+      E.finalize( 0UL );
+      E.append( 1UL, 1UL, 2.0 );
+      E.append( 2UL, 1UL, 3.0 );
+      E.finalize( 1UL );
+      E.finalize( 2UL );
+      E.append( 0UL, 3UL, 4.0 );
+      E.finalize( 3UL );
+
+      checkElements( E, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the find(), lowerBound(), and upperBound() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the lookup functions of the EncodedMatrix class
+// template with the results of the according functions of a compressed matrix. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testLookup()
+{
+   test_ = "Lookup functions";
+
+   blaze::CompressedMatrix<double,SO> A;
+   setupRandom( A, 13UL, 21UL );
+
+   const blaze::EncodedMatrix<double,float,SO> E( A );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const size_t k( SO ? j : i );
+
+         if( E.find      ( i, j ) - E.begin(k) != A.find      ( i, j ) - A.begin(k) ||
+             E.lowerBound( i, j ) - E.begin(k) != A.lowerBound( i, j ) - A.begin(k) ||
+             E.upperBound( i, j ) - E.begin(k) != A.upperBound( i, j ) - A.begin(k) ||
+             ( E.find( i, j ) != E.end(k) && E.find( i, j )->value() != A(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Lookup of element (" << i << "," << j << ")\n"
+                << "   Encoded matrix:\n" << E << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose() and ctranspose() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the in-place transpose of an EncodedMatrix. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+void ClassTest::testTranspose()
+{
+   test_ = "Transpose";
+
+   {
+      blaze::CompressedMatrix<double,SO> A;
+      setupRandom( A, 27UL, 14UL );
+
+      blaze::EncodedMatrix<double,Encoding,SO> E( A );
+      E.transpose();
+
+      checkElements( E, blaze::CompressedMatrix<double,SO>( trans( A ) ) );
+
+      if( !isIntact( E ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n"
+             << " Details:\n"
+             << "   Transposed matrix:\n" << E << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Conjugate transpose";
+
+   {
+      blaze::CompressedMatrix<double,SO> A;
+      setupRandom( A, 9UL, 16UL );
+
+      blaze::EncodedMatrix<double,Encoding,SO> E( A );
+      E.ctranspose();
+
+      checkElements( E, blaze::CompressedMatrix<double,SO>( trans( A ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the operations with dense and sparse matrices and vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of various operations with an EncodedMatrix with the
+// results of the according operations with a compressed matrix holding the same values. All
+// values are small integral values, such that they are represented exactly by all encodings
+// and all results are computed exactly independent of the order of the summation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type      // Data type of the matrix
+        , typename Encoding  // Encoding of the values
+        , bool SO >          // Storage order
+void ClassTest::testOperations()
+{
+   blaze::CompressedMatrix<Type,SO> A;
+   setupRandom( A, 73UL, 51UL );
+
+   const blaze::EncodedMatrix<Type,Encoding,SO> E( A );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> B;
+   setupRandom( B, 73UL, 51UL );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( 51UL );
+   blaze::DynamicVector<Type,blaze::rowVector> z( 73UL );
+   blaze::DynamicMatrix<Type,blaze::columnMajor> D( 51UL, 12UL );
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t i=0UL; i<z.size(); ++i ) {
+      z[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t j=0UL; j<D.columns(); ++j ) {
+      for( size_t i=0UL; i<D.rows(); ++i ) {
+         D(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+
+   test_ = "Encoded matrix/dense vector multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::columnVector>( E * x ),
+                blaze::DynamicVector<Type,blaze::columnVector>( A * x ) );
+
+   test_ = "Dense vector/encoded matrix multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::rowVector>( z * E ),
+                blaze::DynamicVector<Type,blaze::rowVector>( z * A ) );
+
+   test_ = "Encoded matrix/dense matrix multiplication";
+   checkResult( blaze::DynamicMatrix<Type,blaze::rowMajor>( E * D ),
+                blaze::DynamicMatrix<Type,blaze::rowMajor>( A * D ) );
+
+   test_ = "Encoded matrix/sparse matrix multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( E * trans( B ) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A * trans( B ) ) );
+
+   test_ = "Encoded matrix/encoded matrix multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( E * trans( E ) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A * trans( A ) ) );
+
+   test_ = "Encoded matrix/sparse matrix addition";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( E + B ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A + B ) );
+
+   test_ = "Sparse matrix/encoded matrix subtraction";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( B - E ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( B - A ) );
+
+   test_ = "Encoded matrix/sparse matrix Schur product";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( E % B ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A % B ) );
+
+   test_ = "Encoded matrix/scalar multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( E * Type(3) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( A * Type(3) ) );
+
+   test_ = "Encoded matrix assignment to a dense matrix";
+   checkResult( blaze::DynamicMatrix<Type,blaze::columnMajor>( E ),
+                blaze::DynamicMatrix<Type,blaze::columnMajor>( A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given EncodedMatrix.
+//
+// \param E The EncodedMatrix to be checked.
+// \param A The original matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size and all elements of the given EncodedMatrix. Each element of
+// the encoded matrix is expected to be equal to the according element of the original matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the encoded matrix
+        , typename MT2 >  // Type of the original matrix
+void ClassTest::checkElements( const MT1& E, const MT2& A ) const
+{
+   if( E.rows() != A.rows() || E.columns() != A.columns() || !isIntact( E ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix properties\n"
+          << " Details:\n"
+          << "   Encoded matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Size = " << E.rows() << "x" << E.columns() << "\n"
+          << "   Expected size = " << A.rows() << "x" << A.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( E(i,j) != A(i,j) && !( blaze::isnan( E(i,j) ) && blaze::isnan( A(i,j) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Encoded matrix type:\n"
+                << "     " << typeid( MT1 ).name() << "\n"
+                << "   Element (" << i << "," << j << ") = " << E(i,j) << "\n"
+                << "   Original element = " << A(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2 >  // Type of the expected result
+void ClassTest::checkResult( const MT1& result, const MT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a random sparse matrix with small integral values.
+//
+// \param A The matrix to be set up.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The matrix contains roughly 20% non-zero elements with values in the range \f$[1..9]\f$.
+*/
+template< typename Type, bool SO >
+void ClassTest::setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const
+{
+   A.resize( m, n, false );
+   A.reset();
+
+   for( size_t k=0UL; k<(m*n)/5UL; ++k ) {
+      A(blaze::rand<size_t>( 0UL, m-1UL ),blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the EncodedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the EncodedMatrix class test.
+*/
+#define RUN_ENCODEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::encodedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace encodedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
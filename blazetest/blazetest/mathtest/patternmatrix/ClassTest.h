@@ -0,0 +1,611 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/patternmatrix/ClassTest.h
+//  \brief Header file for the PatternMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_PATTERNMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PATTERNMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PatternMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace patternmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PatternMatrix class template.
+//
+// This class represents a test suite for the blaze::PatternMatrix class template. It performs
+// a series of conversions, lookups and transpositions as well as a series of operations with
+// dense and sparse matrices and vectors, which are compared to the according operations with
+// a compressed matrix holding the same non-zero pattern.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testConversion();
+
+   void testAppend();
+
+   template< bool SO >
+   void testLookup();
+
+   template< bool SO >
+   void testTranspose();
+
+   template< typename Type, bool SO >
+   void testOperations();
+
+   template< typename MT1, typename MT2 >
+   void checkElements( const MT1& P, const MT2& A ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected ) const;
+
+   template< typename Type, bool SO >
+   void setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion from dense and sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion of row-major and column-major dense and sparse matrices
+// into a PatternMatrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO >
+void ClassTest::testConversion()
+{
+   test_ = "Conversion from a row-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 31UL, 17UL );
+
+      checkElements( blaze::PatternMatrix<int,SO>( A ), A );
+   }
+
+   test_ = "Conversion from a column-major compressed matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> A;
+      setupRandom( A, 17UL, 31UL );
+
+      checkElements( blaze::PatternMatrix<int,SO>( A ), A );
+   }
+
+   test_ = "Conversion from a compressed matrix with explicit zeros";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+      A(0,1) = 2;
+      A(1,0) = 0;
+      A(1,3) = 5;
+      A(2,2) = 0;
+
+      const blaze::PatternMatrix<int,SO> P( A );
+
+      checkElements( P, A );
+
+      if( P.nonZeros() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros = " << P.nonZeros() << "\n"
+             << "   Expected number of non-zeros = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Conversion from a dense matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 23UL, 29UL );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> D1( A );
+      const blaze::DynamicMatrix<int,blaze::columnMajor> D2( A );
+
+      checkElements( blaze::PatternMatrix<int,SO>( D1 ), A );
+      checkElements( blaze::PatternMatrix<int,SO>( D2 ), A );
+   }
+
+   test_ = "Conversion from a sparse matrix expression";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 19UL, 13UL );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> B( 2 * A );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> C( trans( A ) );
+
+      checkElements( blaze::PatternMatrix<int,SO>( 2 * A ), B );
+      checkElements( blaze::PatternMatrix<int,SO>( trans( A ) ), C );
+   }
+
+   test_ = "Assignment of a sparse matrix";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A;
+      setupRandom( A, 11UL, 7UL );
+
+      blaze::PatternMatrix<int,SO> P( 3UL, 3UL );
+      P = A;
+
+      checkElements( P, A );
+
+      P = blaze::CompressedMatrix<int,blaze::rowMajor>( 5UL, 6UL );
+
+      checkElements( P, blaze::CompressedMatrix<int,blaze::rowMajor>( 5UL, 6UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the low-level append() and finalize() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup of row-major and column-major pattern matrices via the
+// reserve(), append(), and finalize() functions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::testAppend()
+{
+   test_ = "Row-major append";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 4UL, 3UL );
+      A(0,1) = 1;
+      A(1,1) = 1;
+      A(1,2) = 1;
+      A(3,0) = 1;
+
+      blaze::PatternMatrix<int,blaze::rowMajor> P( 4UL, 3UL );
+      P.reserve( 4UL );
+      P.append( 0UL, 1UL );
+      P.finalize( 0UL );
+      P.append( 1UL, 1UL );
+      P.append( 1UL, 2UL );
+      P.finalize( 1UL );
+      P.finalize( 2UL );
+      P.append( 3UL, 0UL );
+      P.finalize( 3UL );
+
+      checkElements( P, A );
+   }
+
+   test_ = "Column-major append";
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 3UL, 4UL );
+      A(1,0) = 1;
+      A(1,1) = 1;
+      A(2,1) = 1;
+      A(0,3) = 1;
+
+      blaze::PatternMatrix<int,blaze::columnMajor> P( 3UL, 4UL );
+      P.reserve( 4UL );
+      P.append( 1UL, 0UL );
+      P.finalize( 0UL );
+      P.append( 1UL, 1UL );
+      P.append( 2UL, 1UL );
+      P.finalize( 1UL );
+      P.finalize( 2UL );
+      P.append( 0UL, 3UL );
+      P.finalize( 3UL );
+
+      checkElements( P, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the find(), lowerBound(), and upperBound() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the lookup functions of the PatternMatrix class
+// template with the results of the according functions of a compressed matrix. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testLookup()
+{
+   test_ = "Lookup functions";
+
+   blaze::CompressedMatrix<int,SO> A;
+   setupRandom( A, 13UL, 21UL );
+
+   const blaze::PatternMatrix<int,SO> P( A );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const size_t k( SO ? j : i );
+
+         if( P.find      ( i, j ) - P.begin(k) != A.find      ( i, j ) - A.begin(k) ||
+             P.lowerBound( i, j ) - P.begin(k) != A.lowerBound( i, j ) - A.begin(k) ||
+             P.upperBound( i, j ) - P.begin(k) != A.upperBound( i, j ) - A.begin(k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Lookup of element (" << i << "," << j << ")\n"
+                << "   Pattern matrix:\n" << P << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose() and ctranspose() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the in-place transpose of a PatternMatrix. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void ClassTest::testTranspose()
+{
+   test_ = "Transpose";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 27UL, 14UL );
+
+      blaze::PatternMatrix<int,SO> P( A );
+      P.transpose();
+
+      checkElements( P, blaze::CompressedMatrix<int,SO>( trans( A ) ) );
+
+      if( !isIntact( P ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n"
+             << " Details:\n"
+             << "   Transposed matrix:\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Conjugate transpose";
+
+   {
+      blaze::CompressedMatrix<int,SO> A;
+      setupRandom( A, 9UL, 16UL );
+
+      blaze::PatternMatrix<int,SO> P( A );
+      P.ctranspose();
+
+      checkElements( P, blaze::CompressedMatrix<int,SO>( trans( A ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the operations with dense and sparse matrices and vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of various operations with a PatternMatrix with the
+// results of the according operations with a compressed matrix holding the same pattern of
+// unit values. All values are small integral values, such that the results are computed
+// exactly independent of the order of the summation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO >
+void ClassTest::testOperations()
+{
+   blaze::CompressedMatrix<Type,SO> A;
+   setupRandom( A, 73UL, 51UL );
+
+   const blaze::PatternMatrix<Type,SO> P( A );
+   const blaze::CompressedMatrix<Type,SO> ones( map( A, []( Type ){ return Type(1); } ) );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> B;
+   setupRandom( B, 73UL, 51UL );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( 51UL );
+   blaze::DynamicVector<Type,blaze::rowVector> z( 73UL );
+   blaze::DynamicMatrix<Type,blaze::columnMajor> D( 51UL, 12UL );
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t i=0UL; i<z.size(); ++i ) {
+      z[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+   for( size_t j=0UL; j<D.columns(); ++j ) {
+      for( size_t i=0UL; i<D.rows(); ++i ) {
+         D(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+
+   test_ = "Pattern matrix/dense vector multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::columnVector>( P * x ),
+                blaze::DynamicVector<Type,blaze::columnVector>( ones * x ) );
+
+   test_ = "Dense vector/pattern matrix multiplication";
+   checkResult( blaze::DynamicVector<Type,blaze::rowVector>( z * P ),
+                blaze::DynamicVector<Type,blaze::rowVector>( z * ones ) );
+
+   test_ = "Pattern matrix/dense matrix multiplication";
+   checkResult( blaze::DynamicMatrix<Type,blaze::rowMajor>( P * D ),
+                blaze::DynamicMatrix<Type,blaze::rowMajor>( ones * D ) );
+
+   test_ = "Pattern matrix/sparse matrix multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( P * trans( B ) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( ones * trans( B ) ) );
+
+   test_ = "Pattern matrix/pattern matrix multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( P * trans( P ) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( ones * trans( ones ) ) );
+
+   test_ = "Pattern matrix/sparse matrix addition";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( P + B ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( ones + B ) );
+
+   test_ = "Sparse matrix/pattern matrix subtraction";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( B - P ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( B - ones ) );
+
+   test_ = "Pattern matrix/sparse matrix Schur product";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( P % B ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( ones % B ) );
+
+   test_ = "Pattern matrix/scalar multiplication";
+   checkResult( blaze::CompressedMatrix<Type,blaze::rowMajor>( P * Type(3) ),
+                blaze::CompressedMatrix<Type,blaze::rowMajor>( ones * Type(3) ) );
+
+   test_ = "Pattern matrix assignment to a dense matrix";
+   checkResult( blaze::DynamicMatrix<Type,blaze::columnMajor>( P ),
+                blaze::DynamicMatrix<Type,blaze::columnMajor>( ones ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given PatternMatrix.
+//
+// \param P The PatternMatrix to be checked.
+// \param A The original matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size and all elements of the given PatternMatrix. Each non-zero
+// element of the original matrix is expected to be 1 in the pattern matrix. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the pattern matrix
+        , typename MT2 >  // Type of the original matrix
+void ClassTest::checkElements( const MT1& P, const MT2& A ) const
+{
+   if( P.rows() != A.rows() || P.columns() != A.columns() || !isIntact( P ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix properties\n"
+          << " Details:\n"
+          << "   Pattern matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Size = " << P.rows() << "x" << P.columns() << "\n"
+          << "   Expected size = " << A.rows() << "x" << A.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( P(i,j) != ( A(i,j) != 0 ? 1 : 0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Pattern matrix type:\n"
+                << "     " << typeid( MT1 ).name() << "\n"
+                << "   Element (" << i << "," << j << ") = " << P(i,j) << "\n"
+                << "   Original element = " << A(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2 >  // Type of the expected result
+void ClassTest::checkResult( const MT1& result, const MT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a random sparse matrix with small integral values.
+//
+// \param A The matrix to be set up.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The matrix contains roughly 20% non-zero elements with values in the range \f$[1..9]\f$.
+*/
+template< typename Type, bool SO >
+void ClassTest::setupRandom( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n ) const
+{
+   A.resize( m, n, false );
+   A.reset();
+
+   for( size_t k=0UL; k<(m*n)/5UL; ++k ) {
+      A(blaze::rand<size_t>( 0UL, m-1UL ),blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PatternMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PatternMatrix class test.
+*/
+#define RUN_PATTERNMATRIX_CLASS_TEST \
+   blazetest::mathtest::patternmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace patternmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
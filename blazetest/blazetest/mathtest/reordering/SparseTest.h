@@ -0,0 +1,368 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/reordering/SparseTest.h
+//  \brief Header file for the sparse matrix reordering test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_REORDERING_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_REORDERING_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse matrix reordering tests.
+//
+// This class represents a test suite for the sparse matrix reordering functionality. It
+// performs a series of reverse Cuthill-McKee reorderings and symmetric permutations on both
+// row-major and column-major compressed matrices.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testRCM();
+
+   template< typename Type >
+   void testPermute();
+
+   void testVector();
+   void testExceptions();
+
+   void checkPermutation( const std::vector<size_t>& perm, size_t n ) const;
+
+   template< typename Type >
+   size_t bandwidth( const Type& A ) const;
+
+   template< typename Type >
+   void setupGrid( Type& A, size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reverse Cuthill-McKee ordering for a matrix of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reverse Cuthill-McKee ordering for a randomly numbered 2D grid
+// Laplacian of the given type. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void SparseTest::testRCM()
+{
+   test_ = "Reverse Cuthill-McKee ordering";
+
+   const size_t k( 12UL );
+
+   Type A;
+   setupGrid( A, k );
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+
+   checkPermutation( perm, A.rows() );
+
+   const Type B( blaze::permute( A, perm ) );
+
+   if( bandwidth( B ) > k ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Insufficient bandwidth reduction\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Original bandwidth = " << bandwidth( A ) << "\n"
+          << "   Reordered bandwidth = " << bandwidth( B ) << "\n"
+          << "   Expected bandwidth <= " << k << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the symmetric permutation of a matrix of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symmetric permutation of a randomly initialized matrix of the given
+// type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTest::testPermute()
+{
+   test_ = "Symmetric permutation";
+
+   const size_t n( blaze::rand<size_t>( 5UL, 20UL ) );
+
+   Type A( n, n );
+   randomize( A, blaze::rand<size_t>( 0UL, n*n ) );
+
+   std::vector<size_t> perm( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      perm[i] = i;
+   }
+   std::random_shuffle( perm.begin(), perm.end() );
+
+   const Type B( blaze::permute( A, perm ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( B(i,j) != A(perm[i],perm[j]) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Permutation failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Result:\n" << B << "\n"
+                << "   Original matrix:\n" << A << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( B.nonZeros() != A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of non-zeros = " << B.nonZeros() << "\n"
+          << "   Expected number of non-zeros = " << A.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given permutation.
+//
+// \param perm The permutation to be checked.
+// \param n The expected size of the permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given vector represents a valid permutation of the indices
+// \f$ [0..n) \f$. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SparseTest::checkPermutation( const std::vector<size_t>& perm, size_t n ) const
+{
+   std::vector<size_t> sorted( perm );
+   std::sort( sorted.begin(), sorted.end() );
+
+   for( size_t i=0UL; i<sorted.size(); ++i ) {
+      if( sorted.size() != n || sorted[i] != i ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation detected\n"
+             << " Details:\n"
+             << "   Size of the permutation = " << perm.size() << "\n"
+             << "   Expected size = " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+//
+// \param A The given sparse matrix.
+// \return The bandwidth of the matrix.
+*/
+template< typename Type >
+size_t SparseTest::bandwidth( const Type& A ) const
+{
+   size_t bw( 0UL );
+
+   for( size_t i=0UL; i<( blaze::IsRowMajorMatrix<Type>::value ? A.rows() : A.columns() ); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         bw = std::max( bw, ( element->index() > i )?( element->index() - i ):( i - element->index() ) );
+      }
+   }
+
+   return bw;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of a randomly numbered 2D grid Laplacian.
+//
+// \param A The matrix to be set up.
+// \param k The number of grid points per dimension.
+// \return void
+*/
+template< typename Type >
+void SparseTest::setupGrid( Type& A, size_t k ) const
+{
+   const size_t n( k*k );
+
+   std::vector<size_t> ids( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      ids[i] = i;
+   }
+   std::random_shuffle( ids.begin(), ids.end() );
+
+   A.resize( n, n, false );
+   A.reset();
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j )
+      {
+         const size_t node( ids[i*k+j] );
+         A(node,node) = 4;
+
+         if( i+1UL < k ) {
+            A(node,ids[(i+1UL)*k+j]) = -1;
+            A(ids[(i+1UL)*k+j],node) = -1;
+         }
+         if( j+1UL < k ) {
+            A(node,ids[i*k+j+1UL]) = -1;
+            A(ids[i*k+j+1UL],node) = -1;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix reordering.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix reordering test.
+*/
+#define RUN_SPARSE_REORDERING_TEST \
+   blazetest::mathtest::reordering::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
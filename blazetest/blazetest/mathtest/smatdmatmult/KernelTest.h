@@ -0,0 +1,506 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatdmatmult/KernelTest.h
+//  \brief Header file for the sparse matrix/dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATDMATMULT_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_SMATDMATMULT_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/Submatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the sparse matrix/dense matrix multiplication kernel.
+//
+// This class represents a test suite for the register-blocked vectorized kernel of the
+// multiplication of a row-major sparse matrix and a row-major dense matrix. It compares the
+// results of the assignment, addition assignment, and subtraction assignment for padded,
+// unpadded, and submatrix targets and for declared symmetric and triangular products with a
+// scalar reference implementation.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using SMT = blaze::CompressedMatrix<double,blaze::rowMajor>;  //!< Sparse matrix operand type.
+   using DMT = blaze::DynamicMatrix<double,blaze::rowMajor>;     //!< Dense matrix type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testGeneral();
+   void testUnpadded();
+   void testSubmatrix();
+   void testDeclarations();
+
+   template< typename MT >
+   void checkProduct( MT& C, const SMT& A, const DMT& B );
+
+   template< typename MT >
+   void checkResult( const MT& result, const DMT& expected, const std::string& operation ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static SMT createSparse( size_t m, size_t n, size_t shift );
+   static DMT createDense ( size_t m, size_t n, size_t shift );
+   static DMT multiply    ( const SMT& A, const DMT& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the register-blocked kernel with padded operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of a
+// row-major sparse matrix/row-major dense matrix multiplication to a padded row-major dense
+// matrix for a range of column numbers, which covers blocks of four SIMD vectors, single SIMD
+// vectors, and the scalar remainder. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+inline void KernelTest::testGeneral()
+{
+   const size_t simdsize( blaze::SIMDTrait<double>::size );
+
+   for( size_t n : { 1UL, 3UL, simdsize*4UL-1UL, simdsize*4UL, simdsize*4UL+1UL, 37UL, 67UL } )
+   {
+      test_ = "Padded target with " + std::to_string( n ) + " columns";
+
+      const SMT A( createSparse( 23UL, 19UL, n ) );
+      const DMT B( createDense( 19UL, n, n ) );
+
+      DMT C( 23UL, n );
+      checkProduct( C, A, B );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the register-blocked kernel with unpadded operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication with unpadded target and dense operands, which
+// requires the scalar remainder loop of the kernel. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void KernelTest::testUnpadded()
+{
+   using UnpaddedType = blaze::CustomMatrix<double,blaze::unaligned,blaze::unpadded,blaze::rowMajor>;
+
+   for( size_t n : { 5UL, 19UL, 42UL } )
+   {
+      test_ = "Unpadded operands with " + std::to_string( n ) + " columns";
+
+      const SMT A( createSparse( 17UL, 13UL, n ) );
+      const DMT B( createDense( 13UL, n, n ) );
+
+      std::vector<double> memoryB( 13UL*n+1UL ), memoryC( 17UL*n+1UL );
+      UnpaddedType Bu( memoryB.data()+1UL, 13UL, n );
+      UnpaddedType Cu( memoryC.data()+1UL, 17UL, n );
+      Bu = B;
+
+      const DMT expected( multiply( A, B ) );
+
+      Cu = A * Bu;
+      checkResult( Cu, expected, "assignment" );
+
+      Cu += A * Bu;
+      checkResult( Cu, expected * 2.0, "addition assignment" );
+
+      Cu -= A * Bu;
+      checkResult( Cu, expected, "subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the register-blocked kernel with a submatrix target.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication with an unaligned submatrix as target, as it is for
+// instance used for the blocks of a parallel assignment. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void KernelTest::testSubmatrix()
+{
+   test_ = "Unaligned submatrix target";
+
+   const SMT A( createSparse( 21UL, 11UL, 3UL ) );
+   const DMT B( createDense( 11UL, 45UL, 7UL ) );
+
+   DMT D( 25UL, 50UL, -1.0 );
+   auto C( blaze::submatrix( D, 3UL, 1UL, 21UL, 45UL ) );
+
+   checkProduct( C, A, B );
+
+   for( size_t i=0UL; i<D.rows(); ++i ) {
+      for( size_t j=0UL; j<D.columns(); ++j ) {
+         if( ( i < 3UL || i >= 24UL || j < 1UL || j >= 46UL ) && D(i,j) != -1.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element outside of the submatrix modified\n"
+                << " Details:\n"
+                << "   Position = (" << i << "," << j << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the register-blocked kernel for declared symmetric and triangular products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplications declared as symmetric, lower, and upper via the
+// declsym(), decllow(), and declupp() functions, for which the kernel restricts the computed
+// range of each row. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void KernelTest::testDeclarations()
+{
+   const size_t n( 29UL );
+
+   {
+      test_ = "Symmetric product";
+
+      SMT A( n, n );
+      DMT B( n, n, 0.0 );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( ( i*j + i + j ) % 5UL == 0UL ) {
+               A(i,j) = static_cast<double>( i + j + 1UL );
+               B(i,j) = static_cast<double>( i + j + 1UL );
+            }
+         }
+      }
+
+      const DMT expected( multiply( A, B ) );
+
+      DMT C( n, n );
+
+      C = blaze::declsym( A * B );
+      checkResult( C, expected, "assignment" );
+   }
+
+   {
+      test_ = "Lower product";
+
+      SMT L( createSparse( n, n, 1UL ) );
+      DMT M( createDense( n, n, 2UL ) );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i+1UL; j<n; ++j ) {
+            L.erase( i, j );
+            M(i,j) = 0.0;
+         }
+      }
+
+      const DMT expected( multiply( L, M ) );
+
+      DMT C( n, n, 7.0 );
+
+      C = blaze::decllow( L * M );
+      checkResult( C, expected, "assignment" );
+
+      C += blaze::decllow( L * M );
+      checkResult( C, expected * 2.0, "addition assignment" );
+
+      C -= blaze::decllow( L * M );
+      checkResult( C, expected, "subtraction assignment" );
+   }
+
+   {
+      test_ = "Upper product";
+
+      SMT U( createSparse( n, n, 4UL ) );
+      DMT M( createDense( n, n, 5UL ) );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j ) {
+            U.erase( i, j );
+            M(i,j) = 0.0;
+         }
+      }
+
+      const DMT expected( multiply( U, M ) );
+
+      DMT C( n, n, 7.0 );
+
+      C = blaze::declupp( U * M );
+      checkResult( C, expected, "assignment" );
+
+      C += blaze::declupp( U * M );
+      checkResult( C, expected * 2.0, "addition assignment" );
+
+      C -= blaze::declupp( U * M );
+      checkResult( C, expected, "subtraction assignment" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the assignment, addition assignment, and subtraction assignment of a product.
+//
+// \param C The target matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename MT >  // Type of the target matrix
+void KernelTest::checkProduct( MT& C, const SMT& A, const DMT& B )
+{
+   const DMT expected( multiply( A, B ) );
+
+   C = A * B;
+   checkResult( C, expected, "assignment" );
+
+   C += A * B;
+   checkResult( C, expected * 2.0, "addition assignment" );
+
+   C -= A * B;
+   checkResult( C, expected, "subtraction assignment" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a multiplication.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param operation The name of the performed operation.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename MT >  // Type of the result matrix
+void KernelTest::checkResult( const MT& result, const DMT& expected, const std::string& operation ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed " << operation << "\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a sparse matrix with a varying number of non-zero elements per row.
+//
+// \param m The number of rows.
+// \param n The number of columns.
+// \param shift Offset for the variation of the pattern and the values.
+// \return The sparse matrix, which contains empty rows as well as completely filled rows.
+*/
+inline KernelTest::SMT KernelTest::createSparse( size_t m, size_t n, size_t shift )
+{
+   SMT A( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( ( i + shift ) % 7UL == 3UL ) continue;
+      for( size_t j=0UL; j<n; ++j ) {
+         if( ( i + shift ) % 7UL == 5UL || ( i*3UL + j*5UL + shift ) % 4UL == 0UL )
+            A(i,j) = static_cast<double>( ( i*7UL + j + shift ) % 9UL ) - 4.0;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a dense matrix with small integral values.
+//
+// \param m The number of rows.
+// \param n The number of columns.
+// \param shift Offset for the variation of the values.
+// \return The dense matrix.
+*/
+inline KernelTest::DMT KernelTest::createDense( size_t m, size_t n, size_t shift )
+{
+   DMT B( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B(i,j) = static_cast<double>( ( i*5UL + j*3UL + shift ) % 11UL ) - 5.0;
+      }
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reference implementation of the sparse matrix/dense matrix multiplication.
+//
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \return The product of the two matrices.
+*/
+inline KernelTest::DMT KernelTest::multiply( const SMT& A, const DMT& B )
+{
+   DMT C( A.rows(), B.columns(), 0.0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            C(i,j) += element->value() * B(element->index(),j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix/dense matrix multiplication kernel.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix/dense matrix multiplication kernel test.
+*/
+#define RUN_SMATDMATMULT_KERNEL_TEST \
+   blazetest::mathtest::smatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
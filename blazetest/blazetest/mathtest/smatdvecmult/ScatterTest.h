@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatdvecmult/ScatterTest.h
+//  \brief Header file for the transpose sparse matrix/dense vector multiplication scatter test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATDVECMULT_SCATTERTEST_H_
+#define _BLAZETEST_MATHTEST_SMATDVECMULT_SCATTERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatdvecmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the transpose sparse matrix/dense vector multiplication scatter test.
+//
+// This class represents a test suite for the parallel multiplication of a column-major sparse matrix and a dense vector
+// with private accumulators. It compares the results of the assignment, the addition assignment
+// and the subtraction assignment with the results of the according dense operation for several
+// matrix sizes, including sizes above the SMP threshold of the operation.
+*/
+class ScatterTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ScatterTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testScatter( size_t m, size_t n, size_t nonzeros );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, size_t m, size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the transpose sparse matrix/dense vector multiplication for the given matrix size.
+//
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \param nonzeros The number of random insertions into the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fills a sparse matrix via buffered insertions, flushes the buffer, and compares
+// the results of the sparse operation with the results of the according dense operation. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ScatterTest::testScatter( size_t m, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<int,blaze::columnMajor> A( m, n );
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      A.bufferedInsert( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ),
+                        blaze::rand<int>( -10, 10 ) );
+   }
+
+   A.flush();
+
+   const blaze::DynamicMatrix<int,blaze::columnMajor> D( A );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( n );
+   blaze::DynamicVector<int,blaze::columnVector> init( m );
+   blaze::randomize( x, -10, 10 );
+   blaze::randomize( init, -10, 10 );
+
+   {
+      test_ = "Assignment (y=A*x)";
+
+      blaze::DynamicVector<int,blaze::columnVector> y( init );
+      y = A * x;
+
+      checkResult( y, blaze::DynamicVector<int,blaze::columnVector>( D * x ), m, n );
+   }
+
+   {
+      test_ = "Addition assignment (y+=A*x)";
+
+      blaze::DynamicVector<int,blaze::columnVector> y( init );
+      y += A * x;
+
+      checkResult( y, blaze::DynamicVector<int,blaze::columnVector>( init + D * x ), m, n );
+   }
+
+   {
+      test_ = "Subtraction assignment (y-=A*x)";
+
+      blaze::DynamicVector<int,blaze::columnVector> y( init );
+      y -= A * x;
+
+      checkResult( y, blaze::DynamicVector<int,blaze::columnVector>( init - D * x ), m, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a multiplication.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ScatterTest::checkResult( const T1& result, const T2& expected, size_t m, size_t n ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Matrix size: " << m << "x" << n << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the transpose sparse matrix/dense vector multiplication with private accumulators.
+//
+// \return void
+*/
+void runTest()
+{
+   ScatterTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the transpose sparse matrix/dense vector multiplication scatter test.
+*/
+#define RUN_SMATDVECMULT_SCATTER_TEST \
+   blazetest::mathtest::smatdvecmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdvecmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
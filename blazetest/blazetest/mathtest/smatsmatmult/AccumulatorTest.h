@@ -0,0 +1,433 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/AccumulatorTest.h
+//  \brief Header file for the sparse accumulator test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_ACCUMULATORTEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_ACCUMULATORTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/sparse/SparseAccumulator.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse accumulator test.
+//
+// This class represents a test suite for the SparseAccumulator class template, which is used
+// by the row-wise sparse matrix multiplication kernels. It compares the accumulated rows in all
+// storage modes with reference results and tests the sparse matrix multiplications for long
+// rows, which use the hash and sorted modes of the accumulator.
+*/
+class AccumulatorTest
+{
+ public:
+   //**Type definitions****************************************************************************
+   using SPA = blaze::SparseAccumulator<int>;  //!< Type of the tested sparse accumulator.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AccumulatorTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Row = std::vector< std::pair<size_t,int> >;  //!< Type of an extracted row.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAccumulation( SPA::Mode mode, size_t size );
+   void testModeSelection();
+   void testCombination();
+
+   template< bool SO >
+   void testLongRows();
+
+   void checkRow( SPA& spa, const std::map<size_t,int>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the accumulation in the given storage mode.
+//
+// \param mode The storage mode of the accumulator.
+// \param size The size of the accumulated rows.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function accumulates several random rows (with and without a mask) in the given storage
+// mode and compares the extracted rows with the according reference results. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void AccumulatorTest::testAccumulation( SPA::Mode mode, size_t size )
+{
+   std::ostringstream label;
+   label << "Accumulation in mode " << mode << " for rows of size " << size;
+   test_ = label.str();
+
+   SPA spa;
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      const size_t nonzeros( blaze::rand<size_t>( 1UL, 2UL*SPA::sortedMax ) );
+
+      spa.configure( size, nonzeros, mode );
+
+      for( size_t row=0UL; row<3UL; ++row )
+      {
+         // Unmasked accumulation
+         {
+            std::map<size_t,int> expected;
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               const size_t index( blaze::rand<size_t>( 0UL, std::min( size, 2UL*nonzeros ) - 1UL ) );
+               const int value( blaze::rand<int>( 1, 9 ) );
+               spa.add( index, value );
+               expected[index] += value;
+            }
+
+            checkRow( spa, expected );
+         }
+
+         // Masked and complemented masked accumulation
+         for( size_t complement=0UL; complement<2UL; ++complement )
+         {
+            std::set<size_t> mask;
+            std::map<size_t,int> expected;
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               const size_t index( blaze::rand<size_t>( 0UL, std::min( size, 2UL*nonzeros ) - 1UL ) );
+               spa.enable( index );
+               mask.insert( index );
+            }
+
+            for( size_t k=0UL; k<nonzeros; ++k )
+            {
+               const size_t index( blaze::rand<size_t>( 0UL, std::min( size, 2UL*nonzeros ) - 1UL ) );
+               const int value( blaze::rand<int>( 1, 9 ) );
+
+               if( complement ) {
+                  spa.addMasked<true>( index, value );
+                  if( mask.find( index ) == mask.end() )
+                     expected[index] += value;
+               }
+               else {
+                  spa.addMasked<false>( index, value );
+                  if( mask.find( index ) != mask.end() )
+                     expected[index] += value;
+               }
+            }
+
+            checkRow( spa, expected );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the automatic selection of the storage mode.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the selection of the storage mode based on the size of the rows and the
+// expected number of non-zero elements per row. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void AccumulatorTest::testModeSelection()
+{
+   test_ = "Selection of the storage mode";
+
+   SPA spa;
+
+   const auto check = [&]( size_t size, size_t nonzeros, SPA::Mode expected )
+   {
+      spa.configure( size, nonzeros );
+
+      if( spa.mode() != expected || spa.size() != size || spa.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage mode\n"
+             << " Details:\n"
+             << "   Size of the rows: " << size << "\n"
+             << "   Expected number of non-zero elements: " << nonzeros << "\n"
+             << "   Selected mode: " << spa.mode() << "\n"
+             << "   Expected mode: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   check( 100UL, 1UL, SPA::denseMode );
+   check( SPA::denseSize, 1UL, SPA::denseMode );
+   check( 100000UL, 10000UL, SPA::denseMode );
+   check( 100000UL, 1000UL, SPA::hashMode );
+   check( 100000UL, SPA::sortedLimit, SPA::sortedMode );
+
+   // Growing a sorted list beyond its limit
+   test_ = "Conversion of the sorted mode into the hash mode";
+
+   std::map<size_t,int> expected;
+
+   for( size_t k=0UL; k<=SPA::sortedMax; ++k ) {
+      spa.add( 1000UL*k, 1 );
+      expected[1000UL*k] = 1;
+   }
+
+   if( spa.mode() != SPA::hashMode ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sorted list has not been converted\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkRow( spa, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the combination of values via a custom binary operation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the accumulation via a custom binary operation (as for instance the
+// additive operation of a semiring) in all storage modes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void AccumulatorTest::testCombination()
+{
+   test_ = "Combination via a custom binary operation";
+
+   const auto maxOp = []( int a, int b ) { return ( a < b )?( b ):( a ); };
+
+   SPA spa;
+
+   for( SPA::Mode mode : { SPA::denseMode, SPA::hashMode, SPA::sortedMode } )
+   {
+      spa.configure( 100000UL, 4UL, mode );
+
+      spa.add( 7UL, 3, maxOp );
+      spa.add( 99999UL, -2, maxOp );
+      spa.add( 7UL, 8, maxOp );
+      spa.add( 7UL, 5, maxOp );
+      spa.add( 99999UL, -5, maxOp );
+
+      checkRow( spa, { { 7UL, 8 }, { 99999UL, -2 } } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse matrix multiplication for long rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of two sparse matrices of the given storage order,
+// whose result has very long and very sparse rows (or columns), which are accumulated in the
+// sorted or hash mode of the accumulator. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >  // Storage order of the sparse matrices
+void AccumulatorTest::testLongRows()
+{
+   test_ = ( SO ? "Column-major multiplication with long columns"
+                : "Row-major multiplication with long rows" );
+
+   const size_t n( 20000UL );
+
+   for( size_t fill : { 2UL, 40UL } )
+   {
+      blaze::CompressedMatrix<int,SO> A( SO ? n : 10UL, 10UL );
+      blaze::CompressedMatrix<int,SO> B( 10UL, SO ? 10UL : n );
+
+      randomize( A, SO ? fill*10UL : 20UL );
+      randomize( B, SO ? 20UL : fill*10UL );
+
+      const blaze::CompressedMatrix<int,SO> C( A * B );
+      const blaze::DynamicMatrix<int,SO> D( blaze::DynamicMatrix<int,SO>( A ) *
+                                            blaze::DynamicMatrix<int,SO>( B ) );
+
+      if( C != D || !isIntact( C ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of the sparse matrix multiplication\n"
+             << " Details:\n"
+             << "   Number of non-zero elements: " << C.nonZeros() << "\n"
+             << "   Expected number of non-zero elements: " << nonZeros( D ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accumulated row.
+//
+// \param spa The sparse accumulator.
+// \param expected The expected accumulated row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function extracts the accumulated row of the given accumulator and compares it with the
+// given expected row. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void AccumulatorTest::checkRow( SPA& spa, const std::map<size_t,int>& expected ) const
+{
+   const size_t nonzeros( spa.nonZeros() );
+
+   Row row;
+   spa.extract( [&row]( size_t index, const int& value ) { row.emplace_back( index, value ); } );
+
+   if( nonzeros != expected.size() || row != Row( expected.begin(), expected.end() ) ||
+       spa.nonZeros() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid accumulated row\n"
+          << " Details:\n"
+          << "   Storage mode: " << spa.mode() << "\n"
+          << "   Result:\n    ";
+      for( const auto& element : row )
+         oss << " (" << element.first << "," << element.second << ")";
+      oss << "\n   Expected result:\n    ";
+      for( const auto& element : expected )
+         oss << " (" << element.first << "," << element.second << ")";
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse accumulator.
+//
+// \return void
+*/
+void runTest()
+{
+   AccumulatorTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse accumulator test.
+*/
+#define RUN_SMATSMATMULT_ACCUMULATOR_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
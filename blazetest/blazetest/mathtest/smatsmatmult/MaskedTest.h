@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/MaskedTest.h
+//  \brief Header file for the masked sparse matrix/sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_MASKEDTEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_MASKEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the masked sparse matrix/sparse matrix multiplication test.
+//
+// This class represents a test suite for the masked multiplication of two sparse matrices. It
+// compares the results of the maskedMult() and complementMaskedMult() functions for several
+// combinations of storage orders with the result of the according full multiplication.
+*/
+class MaskedTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MaskedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT1, typename MT2, typename MT3 >
+   void testMaskedMult();
+
+   void testTriangles();
+   void testExceptions();
+
+   template< typename MT1, typename MT2, typename MT3, typename MT4 >
+   void checkResult( const MT1& result, const MT2& lhs, const MT3& rhs, const MT4& mask,
+                     bool complement ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the masked multiplication for the given matrix types.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the masked multiplication and the multiplication with complemented mask
+// for randomly initialized matrices of the given types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the mask matrix
+void MaskedTest::testMaskedMult()
+{
+   const size_t m( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t k( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t n( blaze::rand<size_t>( 5UL, 20UL ) );
+
+   MT1 A( m, k );
+   MT2 B( k, n );
+   MT3 M( m, n );
+
+   randomize( A, blaze::rand<size_t>( 0UL, m*k/2UL ) );
+   randomize( B, blaze::rand<size_t>( 0UL, k*n/2UL ) );
+   randomize( M, blaze::rand<size_t>( 0UL, m*n ) );
+
+   test_ = "Masked multiplication";
+   checkResult( blaze::maskedMult( A, B, M ), A, B, M, false );
+
+   test_ = "Masked multiplication with transpose right-hand side operand";
+   checkResult( blaze::maskedMult( A, trans( trans( B ) ), M ), A, B, M, false );
+
+   test_ = "Multiplication with complemented mask";
+   checkResult( blaze::complementMaskedMult( A, B, M ), A, B, M, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the masked multiplication for counting the triangles of a graph.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function counts the triangles of a complete graph with 6 vertices by means of the masked
+// multiplication \f$ C \langle L \rangle = L \cdot L^T \f$. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void MaskedTest::testTriangles()
+{
+   test_ = "Triangle counting";
+
+   const size_t n( 6UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> L( n, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         L(i,j) = 1;
+      }
+   }
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> C( blaze::maskedMult( L, trans( L ), L ) );
+
+   int triangles( 0 );
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( auto element=C.begin(i); element!=C.end(i); ++element ) {
+         triangles += element->value();
+      }
+   }
+
+   if( triangles != 20 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of triangles\n"
+          << " Details:\n"
+          << "   Result: " << triangles << "\n"
+          << "   Expected result: 20\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the exceptions of the masked multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the masked multiplication throws a \a std::invalid_argument
+// exception for operands with non-matching sizes.
+*/
+inline void MaskedTest::testExceptions()
+{
+   test_ = "Masked multiplication with non-matching sizes";
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+   const blaze::CompressedMatrix<int,blaze::rowMajor> B( 4UL, 5UL );
+   const blaze::CompressedMatrix<int,blaze::rowMajor> M( 3UL, 4UL );
+
+   try {
+      blaze::maskedMult( A, A, M );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Masked multiplication with non-matching operands succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::complementMaskedMult( A, B, M );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Masked multiplication with non-matching mask succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a masked multiplication.
+//
+// \param result The result of the masked multiplication.
+// \param lhs The left-hand side operand of the multiplication.
+// \param rhs The right-hand side operand of the multiplication.
+// \param mask The mask of the multiplication.
+// \param complement \a true in case the mask is complemented, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result with the according elements of the full product of
+// the given operands. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , typename MT4 >  // Type of the mask matrix
+void MaskedTest::checkResult( const MT1& result, const MT2& lhs, const MT3& rhs, const MT4& mask,
+                              bool complement ) const
+{
+   const blaze::DynamicMatrix<int,blaze::rowMajor> product( lhs * rhs );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> pattern( mask );
+
+   for( size_t i=0UL; i<result.rows(); ++i )
+   {
+      for( size_t j=0UL; j<result.columns(); ++j )
+      {
+         const bool selected( ( mask.find( i, j ) != mask.end( blaze::IsRowMajorMatrix<MT4>::value ? i : j ) ) != complement );
+
+         if( result(i,j) != ( selected ? product(i,j) : 0 ) ||
+             ( !selected && result.find( i, j ) != result.end( i ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result of the masked multiplication\n"
+                << " Details:\n"
+                << "   Left-hand side matrix type:\n"
+                << "     " << typeid( MT2 ).name() << "\n"
+                << "   Right-hand side matrix type:\n"
+                << "     " << typeid( MT3 ).name() << "\n"
+                << "   Mask type:\n"
+                << "     " << typeid( MT4 ).name() << "\n"
+                << "   Complemented mask: " << complement << "\n"
+                << "   Result:\n" << result << "\n"
+                << "   Full product:\n" << product << "\n"
+                << "   Mask:\n" << pattern << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the masked sparse matrix/sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   MaskedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the masked sparse matrix/sparse matrix multiplication test.
+*/
+#define RUN_SMATSMATMULT_MASKED_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/ParallelTest.h
+//  \brief Header file for the parallel sparse matrix/sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the parallel sparse matrix/sparse matrix multiplication test.
+//
+// This class represents a test suite for the row-partitioned parallel multiplication of two
+// row-major sparse matrices into a dense matrix. It compares the results of the assignment, the
+// addition assignment and the subtraction assignment to row-major and column-major dense
+// matrices with the results of the according dense multiplication for several matrix sizes,
+// including sizes above the SMP threshold of the operation.
+*/
+class ParallelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testMult( size_t m, size_t k, size_t n, size_t nonzeros );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sparse matrix/sparse matrix multiplication for the given sizes.
+//
+// \param m The number of rows of the left-hand side sparse matrix.
+// \param k The number of columns of the left-hand side sparse matrix.
+// \param n The number of columns of the right-hand side sparse matrix.
+// \param nonzeros The number of random insertions into each sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fills two row-major sparse matrices via buffered insertions, flushes the
+// buffers, and compares the results of the sparse multiplication into a dense matrix with
+// storage order \a SO with the results of the according dense multiplication. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the target matrix
+void ParallelTest::testMult( size_t m, size_t k, size_t n, size_t nonzeros )
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( m, k );
+   blaze::CompressedMatrix<int,blaze::rowMajor> B( k, n );
+
+   for( size_t l=0UL; l<nonzeros; ++l ) {
+      A.bufferedInsert( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, k-1UL ),
+                        blaze::rand<int>( -10, 10 ) );
+      B.bufferedInsert( blaze::rand<size_t>( 0UL, k-1UL ), blaze::rand<size_t>( 0UL, n-1UL ),
+                        blaze::rand<int>( -10, 10 ) );
+   }
+
+   A.flush();
+   B.flush();
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> DA( A );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> DB( B );
+   const blaze::DynamicMatrix<int,SO> ref( DA * DB );
+
+   blaze::DynamicMatrix<int,SO> init( m, n );
+   blaze::randomize( init, -10, 10 );
+
+   {
+      test_ = "Assignment (C=A*B)";
+
+      blaze::DynamicMatrix<int,SO> C( init );
+      C = A * B;
+
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = "Addition assignment (C+=A*B)";
+
+      blaze::DynamicMatrix<int,SO> C( init );
+      C += A * B;
+
+      checkResult( C, blaze::DynamicMatrix<int,SO>( init + ref ) );
+   }
+
+   {
+      test_ = "Subtraction assignment (C-=A*B)";
+
+      blaze::DynamicMatrix<int,SO> C( init );
+      C -= A * B;
+
+      checkResult( C, blaze::DynamicMatrix<int,SO>( init - ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a multiplication.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ParallelTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Storage order of the result: " << ( blaze::IsRowMajorMatrix<T1>::value ? "row-major" : "column-major" ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel sparse matrix/sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel sparse matrix/sparse matrix multiplication test.
+*/
+#define RUN_SMATSMATMULT_PARALLEL_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,421 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/SemiringTest.h
+//  \brief Header file for the semiring sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_SEMIRINGTEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_SEMIRINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functors.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the semiring sparse matrix multiplication test.
+//
+// This class represents a test suite for the multiplication of sparse matrices over semirings.
+// It compares the results of the semiringMult() functions for the arithmetic, tropical and
+// boolean semirings with the according reference results.
+*/
+class SemiringTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SemiringTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   void testArithmetic();
+
+   void testShortestPath();
+   void testReachability();
+   void testMaxTimes();
+   void testExceptions();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication over the arithmetic (+,*) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the semiring multiplication over the arithmetic semiring for randomly
+// initialized matrices of the given types with the according default multiplication. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void SemiringTest::testArithmetic()
+{
+   const size_t m( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t k( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t n( blaze::rand<size_t>( 5UL, 20UL ) );
+
+   MT1 A( m, k );
+   MT2 B( k, n );
+   blaze::DynamicVector<int,blaze::columnVector> x( k );
+
+   randomize( A, blaze::rand<size_t>( 0UL, m*k/2UL ) );
+   randomize( B, blaze::rand<size_t>( 0UL, k*n/2UL ) );
+   randomize( x );
+
+   test_ = "Semiring matrix/matrix multiplication over the arithmetic semiring";
+   checkResult( blaze::semiringMult( A, B, blaze::Add(), blaze::Mult() ),
+                blaze::DynamicMatrix<int,blaze::rowMajor>( A * B ) );
+
+   test_ = "Semiring matrix/vector multiplication over the arithmetic semiring";
+   checkResult( blaze::semiringMult( A, x, blaze::Add(), blaze::Mult(), 0 ),
+                blaze::DynamicVector<int,blaze::columnVector>( A * x ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication over the tropical (min,+) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the shortest paths of a weighted path graph with 5 vertices by means
+// of the (min,+) semiring. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void SemiringTest::testShortestPath()
+{
+   const size_t n( 5UL );
+   const int inf( 1000 );
+
+   // Weighted edges 0->1 (1), 1->2 (2), 2->3 (3), 3->4 (4), and the shortcut 0->2 (5)
+   blaze::CompressedMatrix<int,blaze::rowMajor> W( n, n );
+   for( size_t i=0UL; i<n; ++i )
+      W.set( i, i, 0 );
+   W(0,1) = 1;
+   W(1,2) = 2;
+   W(2,3) = 3;
+   W(3,4) = 4;
+   W(0,2) = 5;
+
+   test_ = "Shortest paths via the (min,+) semiring";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> D( W );
+   for( size_t step=1UL; step<n; ++step )
+      D = blaze::semiringMult( D, W, blaze::Min(), blaze::Add() );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> expected( n, n, inf );
+   for( size_t i=0UL; i<n; ++i ) {
+      int dist( 0 );
+      for( size_t j=i; j<n; ++j ) {
+         expected(i,j) = dist;
+         dist += static_cast<int>( j+1UL );
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( D.find( i, j ) == D.end( i ) ) D(i,j) = inf;
+      }
+   }
+
+   checkResult( D, expected );
+
+   test_ = "Shortest path vector via the (min,+) semiring";
+
+   blaze::DynamicVector<int,blaze::columnVector> d( n, inf );
+   d[4] = 0;
+   for( size_t step=1UL; step<n; ++step )
+      d = blaze::semiringMult( W, d, blaze::Min(), blaze::Add(), inf );
+
+   checkResult( d, blaze::DynamicVector<int,blaze::columnVector>( column( expected, 4UL ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication over the boolean (or,and) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the reachability of the vertices of a directed cycle with 6 vertices
+// by means of the (or,and) semiring. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+inline void SemiringTest::testReachability()
+{
+   const size_t n( 6UL );
+
+   blaze::CompressedMatrix<bool,blaze::columnMajor> A( n, n );
+   for( size_t i=0UL; i<n; ++i )
+      A( i, (i+1UL)%n ) = true;
+
+   test_ = "Reachability via the (or,and) semiring";
+
+   blaze::DynamicVector<bool,blaze::columnVector> x( n, false );
+   x[0] = true;
+
+   for( size_t step=1UL; step<=3UL; ++step ) {
+      x = blaze::semiringMult( A, x, blaze::LogicalOr(), blaze::LogicalAnd(), false );
+      blaze::DynamicVector<bool,blaze::columnVector> expected( n, false );
+      expected[n-step] = true;
+      checkResult( x, expected );
+   }
+
+   test_ = "Cycle power via the (or,and) semiring";
+
+   blaze::CompressedMatrix<bool,blaze::rowMajor> R( A );
+   for( size_t step=1UL; step<n; ++step )
+      R = blaze::semiringMult( R, A, blaze::LogicalOr(), blaze::LogicalAnd() );
+
+   blaze::DynamicMatrix<bool,blaze::rowMajor> expected( n, n, false );
+   for( size_t i=0UL; i<n; ++i )
+      expected(i,i) = true;
+
+   checkResult( R, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication over the (max,*) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the semiring multiplication over the (max,*) semiring for randomly
+// initialized matrices with a reference result that is computed element by element. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SemiringTest::testMaxTimes()
+{
+   test_ = "Semiring matrix/matrix multiplication over the (max,*) semiring";
+
+   const size_t m( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t k( blaze::rand<size_t>( 5UL, 20UL ) );
+   const size_t n( blaze::rand<size_t>( 5UL, 20UL ) );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( m, k );
+   blaze::CompressedMatrix<int,blaze::columnMajor> B( k, n );
+
+   randomize( A, blaze::rand<size_t>( 0UL, m*k/2UL ), -10, 10 );
+   randomize( B, blaze::rand<size_t>( 0UL, k*n/2UL ), -10, 10 );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> expected( m, n, 0 );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         bool found( false );
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            const auto pos( B.find( element->index(), j ) );
+            if( pos == B.end(j) ) continue;
+            const int value( element->value() * pos->value() );
+            expected(i,j) = ( found ? blaze::max( expected(i,j), value ) : value );
+            found = true;
+         }
+      }
+   }
+
+   checkResult( blaze::semiringMult( A, B, blaze::Max(), blaze::Mult() ), expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the exceptions of the semiring multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the semiring multiplication throws a \a std::invalid_argument
+// exception for operands with non-matching sizes.
+*/
+inline void SemiringTest::testExceptions()
+{
+   test_ = "Semiring multiplication with non-matching sizes";
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+   const blaze::DynamicVector<int,blaze::columnVector> x( 3UL );
+
+   try {
+      blaze::semiringMult( A, A, blaze::Min(), blaze::Add() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Semiring matrix/matrix multiplication with non-matching operands succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::semiringMult( A, x, blaze::Min(), blaze::Add(), 0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Semiring matrix/vector multiplication with non-matching operands succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a semiring multiplication.
+//
+// \param result The result of the semiring multiplication.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result with the given expected result. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void SemiringTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the semiring multiplication\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the semiring sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   SemiringTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the semiring sparse matrix multiplication test.
+*/
+#define RUN_SMATSMATMULT_SEMIRING_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
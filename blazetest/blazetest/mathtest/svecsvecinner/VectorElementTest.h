@@ -0,0 +1,251 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/svecsvecinner/VectorElementTest.h
+//  \brief Header file for the sparse vector/sparse vector inner product with vector elements test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SVECSVECINNER_VECTORELEMENTTEST_H_
+#define _BLAZETEST_MATHTEST_SVECSVECINNER_VECTORELEMENTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace svecsvecinner {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse vector inner product test with vector elements.
+//
+// This class represents a test suite for the inner product of two sparse vectors with dense
+// vector elements.
+*/
+class VectorElementTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit VectorElementTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVectorElements();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse vector inner product with vector elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product of two sparse vectors, whose elements are dense
+// vectors. Since a default constructed vector element has a size of 0, the result has to be
+// initialized with the first product of matching elements instead of being accumulated into
+// a default value. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void VectorElementTest::testVectorElements()
+{
+   using blaze::rowVector;
+   using blaze::columnVector;
+
+   using VT = blaze::DynamicVector<int,columnVector>;
+
+   {
+      test_ = "Inner product with several matching elements";
+
+      blaze::CompressedVector<VT,rowVector> a( 4UL );
+      a[1] = VT{ 1, 2 };
+      a[3] = VT{ 3, 4 };
+
+      blaze::CompressedVector<VT,columnVector> b( 4UL );
+      b[0] = VT{ 9, 9 };
+      b[1] = VT{ 2, 2 };
+      b[3] = VT{ 2, 3 };
+
+      const VT result( a * b );
+
+      checkResult( result, VT{ 8, 16 } );
+   }
+
+   {
+      test_ = "Inner product with a single matching element";
+
+      blaze::CompressedVector<VT,rowVector> a( 4UL );
+      a[0] = VT{ 1, 2 };
+      a[2] = VT{ 3, 4 };
+
+      blaze::CompressedVector<VT,columnVector> b( 4UL );
+      b[2] = VT{ 5, 6 };
+
+      const VT result( a * b );
+
+      checkResult( result, VT{ 15, 24 } );
+   }
+
+   {
+      test_ = "Inner product with highly different numbers of non-zero elements";
+
+      blaze::CompressedVector<VT,rowVector> a( 1000UL );
+      blaze::CompressedVector<VT,columnVector> b( 1000UL );
+
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         a[i] = VT{ 1, 1 };
+      }
+      b[100] = VT{ 1, 2 };
+      b[900] = VT{ 3, 4 };
+
+      const VT result( a * b );
+
+      checkResult( result, VT{ 4, 6 } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an inner product.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void VectorElementTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse vector/sparse vector inner product with vector elements.
+//
+// \return void
+*/
+void runTest()
+{
+   VectorElementTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse vector/sparse vector inner product with vector elements test.
+*/
+#define RUN_SVECSVECINNER_VECTORELEMENT_TEST \
+   blazetest::mathtest::svecsvecinner::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace svecsvecinner
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
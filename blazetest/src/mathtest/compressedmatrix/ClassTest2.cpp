@@ -39,6 +39,9 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/compressedmatrix/ClassTest.h>
@@ -79,12 +82,14 @@ ClassTest::ClassTest()
    testSet();
    testInsert();
    testAppend();
+   testBufferedInsert();
    testErase();
    testFind();
    testLowerBound();
    testUpperBound();
    testTranspose();
    testCTranspose();
+   testConversion();
    testIsDefault();
 }
 //*************************************************************************************************
@@ -4181,6 +4186,438 @@ void ClassTest::testAppend()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c bufferedInsert() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c bufferedInsert() and \c flush() member functions of
+// the CompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testBufferedInsert()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::bufferedInsert()";
+
+      // Buffered insertion with in-place merge
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, std::vector<size_t>{ 2UL, 2UL, 3UL } );
+         mat(0,1) = 1;
+         mat(2,2) = 2;
+
+         mat.bufferedInsert( 2UL, 3UL, 3 );
+         mat.bufferedInsert( 0UL, 0UL, 4 );
+         mat.bufferedInsert( 2UL, 0UL, 5 );
+         mat.bufferedInsert( 1UL, 2UL, 6 );
+         mat.flush();
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 7UL );
+         checkNonZeros( mat, 6UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 1UL );
+         checkNonZeros( mat, 2UL, 3UL );
+
+         if( mat(0,0) != 4 || mat(0,1) != 1 || mat(1,2) != 6 ||
+             mat(2,0) != 5 || mat(2,2) != 2 || mat(2,3) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 4 1 0 0 )\n( 0 0 6 0 )\n( 5 0 2 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion with reallocation, duplicate and existing elements
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+         mat(1,1) = 1;
+
+         mat.bufferedInsert( 2UL, 3UL, 2 );
+         mat.bufferedInsert( 1UL, 1UL, 3 );
+         mat.bufferedInsert( 0UL, 2UL, 4 );
+         mat.bufferedInsert( 2UL, 3UL, 5 );
+         mat.bufferedInsert( 1UL, 0UL, 6 );
+         mat.flush();
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 2UL );
+         checkNonZeros( mat, 2UL, 1UL );
+
+         if( mat(0,2) != 4 || mat(1,0) != 6 || mat(1,1) != 3 || mat(2,3) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 4 0 )\n( 6 3 0 0 )\n( 0 0 0 5 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion in random order
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 20UL, 30UL );
+         blaze::CompressedMatrix<int,blaze::rowMajor> ref( 20UL, 30UL );
+
+         for( size_t k=0UL; k<200UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 19UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 29UL ) );
+            const int value( blaze::rand<int>( 1, 100 ) );
+            mat.bufferedInsert( i, j, value );
+            ref.set( i, j, value );
+            if( k % 50UL == 49UL )
+               mat.flush();
+         }
+
+         mat.flush();
+
+         if( mat != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by a (parallel) matrix/vector multiplication
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 300UL, 200UL );
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 300UL, 200UL, 0 );
+
+         for( size_t k=0UL; k<3000UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 299UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 199UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            mat.bufferedInsert( i, j, value );
+            ref(i,j) = value;
+         }
+
+         mat.flush();
+
+         const blaze::DynamicVector<int,blaze::columnVector> x( 200UL, 2 );
+         const blaze::DynamicVector<int,blaze::rowVector> y( 300UL, 3 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> result1( mat * x );
+         const blaze::DynamicVector<int,blaze::rowVector> result2( y * mat );
+
+         if( result1 != ref * x || result2 != y * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication after buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << result1 << "\n"
+                << "   Expected result (A*x):\n" << ( ref * x ) << "\n"
+                << "   Result (y*A):\n" << result2 << "\n"
+                << "   Expected result (y*A):\n" << ( y * ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by read accesses without explicit flush
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+         mat.bufferedInsert( 2UL, 1UL, 3 );
+         mat.bufferedInsert( 0UL, 2UL, 2 );
+         mat.bufferedInsert( 1UL, 1UL, 4 );
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor>& cmat( mat );
+         const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3 };
+         const blaze::DynamicVector<int,blaze::columnVector> y( cmat * x );
+
+         if( y[0] != 6 || y[1] != 8 || y[2] != 6 ||
+             cmat.nonZeros() != 3UL || cmat(1,1) != 4 || !cmat.isFlushed() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Read access without explicit flush failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << y << "\n"
+                << "   Expected result (A*x):\n( 6 8 6 )\n"
+                << "   Number of non-zeros = " << cmat.nonZeros() << "\n"
+                << "   Element (1,1) = " << cmat(1,1) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by a (parallel) multiplication without explicit flush
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 300UL, 200UL );
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat2( 300UL, 200UL );
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 300UL, 200UL, 0 );
+
+         for( size_t k=0UL; k<3000UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 299UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 199UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            mat1.bufferedInsert( i, j, value );
+            mat2.bufferedInsert( i, j, value );
+            ref(i,j) = value;
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> x( 200UL, 2 );
+         const blaze::DynamicVector<int,blaze::rowVector> y( 300UL, 3 );
+         const blaze::DynamicVector<int,blaze::columnVector> result1( mat1 * x );
+         const blaze::DynamicVector<int,blaze::rowVector> result2( y * mat2 );
+
+         if( result1 != ref * x || result2 != y * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication without explicit flush failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << result1 << "\n"
+                << "   Expected result (A*x):\n" << ( ref * x ) << "\n"
+                << "   Result (y*A):\n" << result2 << "\n"
+                << "   Expected result (y*A):\n" << ( y * ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by a (parallel) sparse matrix multiplication without explicit flush
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> A( 60UL, 40UL );
+         blaze::CompressedMatrix<int,blaze::rowMajor> B( 40UL, 50UL );
+         blaze::DynamicMatrix<int,blaze::rowMajor> refA( 60UL, 40UL, 0 );
+         blaze::DynamicMatrix<int,blaze::rowMajor> refB( 40UL, 50UL, 0 );
+
+         for( size_t k=0UL; k<300UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 59UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 39UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            A.bufferedInsert( i, j, value );
+            refA(i,j) = value;
+         }
+
+         for( size_t k=0UL; k<300UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 39UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 49UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            B.bufferedInsert( i, j, value );
+            refB(i,j) = value;
+         }
+
+         const blaze::DynamicMatrix<int,blaze::rowMajor> result( A * B );
+
+         if( result != refA * refB ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sparse matrix multiplication without explicit flush failed\n"
+                << " Details:\n"
+                << "   Result (A*B):\n" << result << "\n"
+                << "   Expected result (A*B):\n" << ( refA * refB ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::bufferedInsert()";
+
+      // Buffered insertion with in-place merge
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 3UL, std::vector<size_t>{ 2UL, 2UL, 3UL } );
+         mat(1,0) = 1;
+         mat(2,2) = 2;
+
+         mat.bufferedInsert( 3UL, 2UL, 3 );
+         mat.bufferedInsert( 0UL, 0UL, 4 );
+         mat.bufferedInsert( 0UL, 2UL, 5 );
+         mat.bufferedInsert( 2UL, 1UL, 6 );
+         mat.flush();
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 3UL );
+         checkCapacity( mat, 7UL );
+         checkNonZeros( mat, 6UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 1UL );
+         checkNonZeros( mat, 2UL, 3UL );
+
+         if( mat(0,0) != 4 || mat(1,0) != 1 || mat(2,1) != 6 ||
+             mat(0,2) != 5 || mat(2,2) != 2 || mat(3,2) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 4 0 5 )\n( 1 0 0 )\n( 0 6 2 )\n( 0 0 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion with reallocation, duplicate and existing elements
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+         mat(1,1) = 1;
+
+         mat.bufferedInsert( 3UL, 2UL, 2 );
+         mat.bufferedInsert( 1UL, 1UL, 3 );
+         mat.bufferedInsert( 2UL, 0UL, 4 );
+         mat.bufferedInsert( 3UL, 2UL, 5 );
+         mat.bufferedInsert( 0UL, 1UL, 6 );
+         mat.flush();
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 2UL );
+         checkNonZeros( mat, 2UL, 1UL );
+
+         if( mat(2,0) != 4 || mat(0,1) != 6 || mat(1,1) != 3 || mat(3,2) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 6 0 )\n( 0 3 0 )\n( 4 0 0 )\n( 0 0 5 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion in random order
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 30UL, 20UL );
+         blaze::CompressedMatrix<int,blaze::columnMajor> ref( 30UL, 20UL );
+
+         for( size_t k=0UL; k<200UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 29UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 19UL ) );
+            const int value( blaze::rand<int>( 1, 100 ) );
+            mat.bufferedInsert( i, j, value );
+            ref.set( i, j, value );
+            if( k % 50UL == 49UL )
+               mat.flush();
+         }
+
+         mat.flush();
+
+         if( mat != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by a (parallel) matrix/vector multiplication
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 300UL, 200UL );
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 300UL, 200UL, 0 );
+
+         for( size_t k=0UL; k<3000UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 299UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 199UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            mat.bufferedInsert( i, j, value );
+            ref(i,j) = value;
+         }
+
+         mat.flush();
+
+         const blaze::DynamicVector<int,blaze::columnVector> x( 200UL, 2 );
+         const blaze::DynamicVector<int,blaze::rowVector> y( 300UL, 3 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> result1( mat * x );
+         const blaze::DynamicVector<int,blaze::rowVector> result2( y * mat );
+
+         if( result1 != ref * x || result2 != y * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication after buffered insertion failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << result1 << "\n"
+                << "   Expected result (A*x):\n" << ( ref * x ) << "\n"
+                << "   Result (y*A):\n" << result2 << "\n"
+                << "   Expected result (y*A):\n" << ( y * ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by read accesses without explicit flush
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+         mat.bufferedInsert( 2UL, 1UL, 3 );
+         mat.bufferedInsert( 0UL, 2UL, 2 );
+         mat.bufferedInsert( 1UL, 1UL, 4 );
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor>& cmat( mat );
+         const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3 };
+         const blaze::DynamicVector<int,blaze::columnVector> y( cmat * x );
+
+         if( y[0] != 6 || y[1] != 8 || y[2] != 6 ||
+             cmat.nonZeros() != 3UL || cmat(1,1) != 4 || !cmat.isFlushed() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Read access without explicit flush failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << y << "\n"
+                << "   Expected result (A*x):\n( 6 8 6 )\n"
+                << "   Number of non-zeros = " << cmat.nonZeros() << "\n"
+                << "   Element (1,1) = " << cmat(1,1) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Buffered insertion followed by a (parallel) multiplication without explicit flush
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 300UL, 200UL );
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat2( 300UL, 200UL );
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 300UL, 200UL, 0 );
+
+         for( size_t k=0UL; k<3000UL; ++k ) {
+            const size_t i( blaze::rand<size_t>( 0UL, 299UL ) );
+            const size_t j( blaze::rand<size_t>( 0UL, 199UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            mat1.bufferedInsert( i, j, value );
+            mat2.bufferedInsert( i, j, value );
+            ref(i,j) = value;
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> x( 200UL, 2 );
+         const blaze::DynamicVector<int,blaze::rowVector> y( 300UL, 3 );
+         const blaze::DynamicVector<int,blaze::columnVector> result1( mat1 * x );
+         const blaze::DynamicVector<int,blaze::rowVector> result2( y * mat2 );
+
+         if( result1 != ref * x || result2 != y * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication without explicit flush failed\n"
+                << " Details:\n"
+                << "   Result (A*x):\n" << result1 << "\n"
+                << "   Expected result (A*x):\n" << ( ref * x ) << "\n"
+                << "   Result (y*A):\n" << result2 << "\n"
+                << "   Expected result (y*A):\n" << ( y * ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c erase() member function of the CompressedMatrix class template.
 //
@@ -7005,6 +7442,117 @@ void ClassTest::testCTranspose()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the storage order conversion of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conversion of large compressed matrices into the opposite
+// storage order, which is executed in parallel in case the number of non-zero elements exceeds
+// the according SMP threshold. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testConversion()
+{
+   const size_t m( 700UL );
+   const size_t n( 600UL );
+   const size_t nonzeros( 120000UL );
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major/column-major CompressedMatrix conversion";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> tmat( m, n );
+      randomize( tmat, nonzeros );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat( tmat );
+
+      checkRows    ( mat, m );
+      checkColumns ( mat, n );
+      checkNonZeros( mat, tmat.nonZeros() );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref( tmat );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator element=mat.begin(i); element!=mat.end(i); ++element ) {
+            if( ( element != mat.begin(i) && (element-1)->index() >= element->index() ) ||
+                element->value() != ref(i,element->index()) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Conversion failed\n"
+                   << " Details:\n"
+                   << "   Invalid element in row " << i << " at column " << element->index() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      test_ = "Row-major CompressedMatrix transpose via transpose()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> trans( mat );
+      transpose( trans );
+
+      if( trans != blaze::trans( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major/row-major CompressedMatrix conversion";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( m, n );
+      randomize( mat, nonzeros );
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> tmat( mat );
+
+      checkRows    ( tmat, m );
+      checkColumns ( tmat, n );
+      checkNonZeros( tmat, mat.nonZeros() );
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> ref( mat );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator element=tmat.begin(j); element!=tmat.end(j); ++element ) {
+            if( ( element != tmat.begin(j) && (element-1)->index() >= element->index() ) ||
+                element->value() != ref(element->index(),j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Conversion failed\n"
+                   << " Details:\n"
+                   << "   Invalid element in column " << j << " at row " << element->index() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      test_ = "Column-major CompressedMatrix transpose via transpose()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> trans( tmat );
+      transpose( trans );
+
+      if( trans != blaze::trans( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c isDefault() function with the CompressedMatrix class template.
 //
@@ -0,0 +1,124 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/ConversionTest.cpp
+//  \brief Source file for the CompressedMatrix dense/sparse conversion test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compressedmatrix/ConversionTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ConversionTest test.
+//
+// \exception std::runtime_error Error during the conversion detected.
+*/
+ConversionTest::ConversionTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testDenseComputation<rowMajor,rowMajor>      (   0UL,   0UL );
+   testDenseComputation<rowMajor,rowMajor>      (   5UL,   7UL );
+   testDenseComputation<rowMajor,rowMajor>      ( 300UL, 200UL );
+   testDenseComputation<rowMajor,columnMajor>   ( 300UL, 200UL );
+   testDenseComputation<columnMajor,rowMajor>   ( 300UL, 200UL );
+   testDenseComputation<columnMajor,columnMajor>(   5UL,   7UL );
+   testDenseComputation<columnMajor,columnMajor>( 300UL, 200UL );
+
+   testDenseToSparse<rowMajor,rowMajor>      (   1UL,   8UL );
+   testDenseToSparse<rowMajor,rowMajor>      (   5UL,  37UL );
+   testDenseToSparse<rowMajor,rowMajor>      ( 300UL, 200UL );
+   testDenseToSparse<rowMajor,columnMajor>   ( 300UL, 200UL );
+   testDenseToSparse<columnMajor,rowMajor>   ( 300UL, 200UL );
+   testDenseToSparse<columnMajor,columnMajor>(   8UL,   1UL );
+   testDenseToSparse<columnMajor,columnMajor>(  37UL,   5UL );
+   testDenseToSparse<columnMajor,columnMajor>( 300UL, 200UL );
+
+   testSparseToDense<rowMajor,rowMajor>      (   5UL,   7UL,   10UL );
+   testSparseToDense<rowMajor,rowMajor>      ( 300UL, 200UL, 3000UL );
+   testSparseToDense<rowMajor,columnMajor>   ( 300UL, 200UL, 3000UL );
+   testSparseToDense<columnMajor,rowMajor>   ( 300UL, 200UL, 3000UL );
+   testSparseToDense<columnMajor,columnMajor>( 300UL, 200UL, 3000UL );
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix conversion test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_CONVERSION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix conversion test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -45,6 +45,9 @@
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/UpperMatrix.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/policies/Deallocate.h>
@@ -90,6 +93,7 @@ ClassTest::ClassTest()
    testTranspose();
    testCTranspose();
    testIsDefault();
+   testAllocator();
 }
 //*************************************************************************************************
 
@@ -6294,6 +6298,518 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the allocator support of the DynamicMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of DynamicMatrix instances with a custom, stateful allocator.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   using AllocatorType   = CountingAllocator<int>;
+   using RowMajorType    = blaze::DynamicMatrix<int,blaze::rowMajor,AllocatorType>;
+   using ColumnMajorType = blaze::DynamicMatrix<int,blaze::columnMajor,AllocatorType>;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix allocator construction";
+
+      AllocationCounter counter;
+
+      {
+         RowMajorType mat( 3UL, 4UL, 2, AllocatorType( counter ) );
+
+         checkRows    ( mat,  3UL );
+         checkColumns ( mat,  4UL );
+         checkCapacity( mat, 12UL );
+         checkNonZeros( mat, 12UL );
+
+         if( counter.allocations != 1UL || mat.getAllocator() != AllocatorType( counter ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not used\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter.allocations << "\n"
+                << "   Expected number of allocations = 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( !blaze::checkAlignment( mat.data( i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid alignment in row " << i << " detected\n"
+                   << " Details:\n"
+                   << "   Expected alignment: " << blaze::AlignmentOf<int>::value << "\n"
+                   << "   Deviation         : " << ( reinterpret_cast<size_t>( mat.data( i ) ) % blaze::AlignmentOf<int>::value ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         mat.resize( 10UL, 12UL, true );
+
+         checkRows   ( mat, 10UL );
+         checkColumns( mat, 12UL );
+
+         if( counter.allocations != 2UL || counter.deallocations != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Reallocation not performed via the allocator\n"
+                << " Details:\n"
+                << "   Number of allocations   = " << counter.allocations << "\n"
+                << "   Number of deallocations = " << counter.deallocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter.deallocations != 2UL || counter.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the allocator\n"
+             << " Details:\n"
+             << "   Number of deallocations = " << counter.deallocations << "\n"
+             << "   Expected number of deallocations = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicMatrix allocator propagation";
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         RowMajorType mat1( 2UL, 3UL, 1, AllocatorType( counter1 ) );
+         RowMajorType mat2( mat1 );
+
+         if( mat2.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on copy construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         RowMajorType mat3( std::move( mat2 ) );
+
+         if( mat3.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on move construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         RowMajorType mat4( 1UL, 1UL, 0, AllocatorType( counter2 ) );
+         mat4 = mat3;
+
+         if( mat4.getAllocator() != AllocatorType( counter2 ) || mat4 != mat3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator changed on copy assignment\n"
+                << " Details:\n"
+                << "   Result:\n" << mat4 << "\n"
+                << "   Expected result:\n" << mat3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         swap( mat3, mat4 );
+
+         if( mat3.getAllocator() != AllocatorType( counter2 ) ||
+             mat4.getAllocator() != AllocatorType( counter1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocators not exchanged on swap\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 2UL, 3UL, 2 );
+         mat3 += ref;
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> res( mat3 - ref );
+
+         if( mat3(0,0) != 3 || mat3(1,2) != 3 || res != ( ref / 2 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Arithmetic operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ( ref / 2 ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicMatrix non-propagating allocator";
+
+      using FixedAllocatorType = CountingAllocator<int,false>;
+      using FixedMatrixType    = blaze::DynamicMatrix<int,blaze::rowMajor,FixedAllocatorType>;
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         FixedMatrixType mat1( 2UL, 3UL, 1, FixedAllocatorType( counter1 ) );
+         FixedMatrixType mat2( 1UL, 1UL, 0, FixedAllocatorType( counter2 ) );
+
+         mat2 = std::move( mat1 );
+
+         if( mat2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             mat2.rows() != 2UL || mat2.columns() != 3UL || mat2(0,0) != 1 || mat2(1,2) != 1 ||
+             counter2.allocations != 2UL || counter1.elements == 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with different allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n"
+                << "   Number of allocations (second allocator) = " << counter2.allocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         FixedMatrixType mat3( 3UL, 2UL, 5, FixedAllocatorType( counter1 ) );
+         swap( mat2, mat3 );
+
+         if( mat2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             mat3.getAllocator() != FixedAllocatorType( counter1 ) ||
+             mat2.rows() != 3UL || mat2.columns() != 2UL || mat2(0,0) != 5 || mat2(2,1) != 5 ||
+             mat3.rows() != 2UL || mat3.columns() != 3UL || mat3(0,0) != 1 || mat3(1,2) != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Swap with different allocators failed\n"
+                << " Details:\n"
+                << "   Result (first matrix):\n" << mat2 << "\n"
+                << "   Result (second matrix):\n" << mat3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const size_t allocations( counter1.allocations );
+
+         FixedMatrixType mat4( 1UL, 2UL, 7, FixedAllocatorType( counter1 ) );
+         mat4 = std::move( mat3 );
+
+         if( mat4.rows() != 2UL || mat4(0,0) != 1 || counter1.allocations != allocations+1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with equal allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat4 << "\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = " << allocations+1UL << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix allocator construction";
+
+      AllocationCounter counter;
+
+      {
+         ColumnMajorType mat( 3UL, 4UL, 2, AllocatorType( counter ) );
+
+         checkRows    ( mat,  3UL );
+         checkColumns ( mat,  4UL );
+         checkCapacity( mat, 12UL );
+         checkNonZeros( mat, 12UL );
+
+         if( counter.allocations != 1UL || mat.getAllocator() != AllocatorType( counter ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not used\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter.allocations << "\n"
+                << "   Expected number of allocations = 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<mat.columns(); ++i ) {
+            if( !blaze::checkAlignment( mat.data( i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid alignment in column " << i << " detected\n"
+                   << " Details:\n"
+                   << "   Expected alignment: " << blaze::AlignmentOf<int>::value << "\n"
+                   << "   Deviation         : " << ( reinterpret_cast<size_t>( mat.data( i ) ) % blaze::AlignmentOf<int>::value ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         mat.resize( 10UL, 12UL, true );
+
+         checkRows   ( mat, 10UL );
+         checkColumns( mat, 12UL );
+
+         if( counter.allocations != 2UL || counter.deallocations != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Reallocation not performed via the allocator\n"
+                << " Details:\n"
+                << "   Number of allocations   = " << counter.allocations << "\n"
+                << "   Number of deallocations = " << counter.deallocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter.deallocations != 2UL || counter.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the allocator\n"
+             << " Details:\n"
+             << "   Number of deallocations = " << counter.deallocations << "\n"
+             << "   Expected number of deallocations = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicMatrix allocator propagation";
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         ColumnMajorType mat1( 2UL, 3UL, 1, AllocatorType( counter1 ) );
+         ColumnMajorType mat2( mat1 );
+
+         if( mat2.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on copy construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ColumnMajorType mat3( std::move( mat2 ) );
+
+         if( mat3.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on move construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ColumnMajorType mat4( 1UL, 1UL, 0, AllocatorType( counter2 ) );
+         mat4 = mat3;
+
+         if( mat4.getAllocator() != AllocatorType( counter2 ) || mat4 != mat3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator changed on copy assignment\n"
+                << " Details:\n"
+                << "   Result:\n" << mat4 << "\n"
+                << "   Expected result:\n" << mat3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         swap( mat3, mat4 );
+
+         if( mat3.getAllocator() != AllocatorType( counter2 ) ||
+             mat4.getAllocator() != AllocatorType( counter1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocators not exchanged on swap\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( 2UL, 3UL, 2 );
+         mat3 += ref;
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> res( mat3 - ref );
+
+         if( mat3(0,0) != 3 || mat3(1,2) != 3 || res != ( ref / 2 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Arithmetic operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ( ref / 2 ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicMatrix non-propagating allocator";
+
+      using FixedAllocatorType = CountingAllocator<int,false>;
+      using FixedMatrixType    = blaze::DynamicMatrix<int,blaze::columnMajor,FixedAllocatorType>;
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         FixedMatrixType mat1( 2UL, 3UL, 1, FixedAllocatorType( counter1 ) );
+         FixedMatrixType mat2( 1UL, 1UL, 0, FixedAllocatorType( counter2 ) );
+
+         mat2 = std::move( mat1 );
+
+         if( mat2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             mat2.rows() != 2UL || mat2.columns() != 3UL || mat2(0,0) != 1 || mat2(1,2) != 1 ||
+             counter2.allocations != 2UL || counter1.elements == 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with different allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat2 << "\n"
+                << "   Number of allocations (second allocator) = " << counter2.allocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         FixedMatrixType mat3( 3UL, 2UL, 5, FixedAllocatorType( counter1 ) );
+         swap( mat2, mat3 );
+
+         if( mat2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             mat3.getAllocator() != FixedAllocatorType( counter1 ) ||
+             mat2.rows() != 3UL || mat2.columns() != 2UL || mat2(0,0) != 5 || mat2(2,1) != 5 ||
+             mat3.rows() != 2UL || mat3.columns() != 3UL || mat3(0,0) != 1 || mat3(1,2) != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Swap with different allocators failed\n"
+                << " Details:\n"
+                << "   Result (first matrix):\n" << mat2 << "\n"
+                << "   Result (second matrix):\n" << mat3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const size_t allocations( counter1.allocations );
+
+         FixedMatrixType mat4( 1UL, 2UL, 7, FixedAllocatorType( counter1 ) );
+         mat4 = std::move( mat3 );
+
+         if( mat4.rows() != 2UL || mat4(0,0) != 1 || counter1.allocations != allocations+1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with equal allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat4 << "\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = " << allocations+1UL << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   //=====================================================================================
+   // Allocator without alignment guarantees
+   //=====================================================================================
+
+   {
+      test_ = "DynamicMatrix with std::allocator";
+
+      using RowMatrixType = blaze::DynamicMatrix<double,blaze::rowMajor,std::allocator<double> >;
+      using ColMatrixType = blaze::DynamicMatrix<double,blaze::columnMajor,std::allocator<double> >;
+
+      if( blaze::IsAligned<RowMatrixType>::value || blaze::IsPadded<RowMatrixType>::value ||
+          blaze::IsAligned<ColMatrixType>::value || blaze::IsPadded<ColMatrixType>::value ||
+          RowMatrixType( 2UL, 8UL ).isAligned() || ColMatrixType( 8UL, 2UL ).isAligned() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix without aligned allocator considered aligned or padded\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t n : { 1UL, 7UL, 16UL, 33UL } )
+      {
+         RowMatrixType A( n, n );
+         ColMatrixType B( n, n );
+         blaze::DynamicMatrix<double,blaze::rowMajor> refA( n, n );
+         blaze::DynamicMatrix<double,blaze::columnMajor> refB( n, n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               A(i,j) = refA(i,j) = static_cast<double>( i + 2UL*j );
+               B(i,j) = refB(i,j) = static_cast<double>( 3UL*i + j );
+            }
+         }
+
+         const RowMatrixType C( A + B );
+         const ColMatrixType D( A * B );
+         const blaze::DynamicMatrix<double,blaze::rowMajor> refC( refA + refB );
+         const blaze::DynamicMatrix<double,blaze::columnMajor> refD( refA * refB );
+
+         if( C != refC || D != refD ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Arithmetic operation failed\n"
+                << " Details:\n"
+                << "   Result (addition):\n" << C << "\n"
+                << "   Expected result (addition):\n" << refC << "\n"
+                << "   Result (multiplication):\n" << D << "\n"
+                << "   Expected result (multiplication):\n" << refD << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace dynamicmatrix
 
 } // namespace mathtest
@@ -43,6 +43,9 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/shims/Equal.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
@@ -114,6 +117,7 @@ ClassTest::ClassTest()
    testShrinkToFit();
    testSwap();
    testIsDefault();
+   testAllocator();
 }
 //*************************************************************************************************
 
@@ -2941,6 +2945,316 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the allocator support of the DynamicVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of DynamicVector instances with a custom, stateful allocator.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   using AllocatorType = CountingAllocator<int>;
+   using VectorType    = blaze::DynamicVector<int,blaze::rowVector,AllocatorType>;
+
+   //=====================================================================================
+   // Construction and destruction
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector allocator construction";
+
+      AllocationCounter counter;
+
+      {
+         VectorType vec( 5UL, 2, AllocatorType( counter ) );
+
+         checkSize    ( vec, 5UL );
+         checkCapacity( vec, 5UL );
+         checkNonZeros( vec, 5UL );
+
+         if( counter.allocations != 1UL || vec.getAllocator() != AllocatorType( counter ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not used\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter.allocations << "\n"
+                << "   Expected number of allocations = 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( !blaze::checkAlignment( vec.data() ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid alignment detected\n"
+                << " Details:\n"
+                << "   Expected alignment: " << blaze::AlignmentOf<int>::value << "\n"
+                << "   Deviation         : " << ( reinterpret_cast<size_t>( vec.data() ) % blaze::AlignmentOf<int>::value ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter.deallocations != 1UL || counter.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the allocator\n"
+             << " Details:\n"
+             << "   Number of deallocations = " << counter.deallocations << "\n"
+             << "   Expected number of deallocations = 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy, move, and swap
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector allocator propagation";
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         VectorType vec1( 4UL, 1, AllocatorType( counter1 ) );
+         VectorType vec2( vec1 );
+
+         if( vec2.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on copy construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         VectorType vec3( std::move( vec2 ) );
+
+         if( vec3.getAllocator() != AllocatorType( counter1 ) || counter1.allocations != 2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator not propagated on move construction\n"
+                << " Details:\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = 2\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         VectorType vec4( 2UL, 0, AllocatorType( counter2 ) );
+         vec4 = vec3;
+
+         if( vec4.getAllocator() != AllocatorType( counter2 ) || vec4 != vec3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocator changed on copy assignment\n"
+                << " Details:\n"
+                << "   Result:\n" << vec4 << "\n"
+                << "   Expected result:\n" << vec3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         swap( vec3, vec4 );
+
+         if( vec3.getAllocator() != AllocatorType( counter2 ) ||
+             vec4.getAllocator() != AllocatorType( counter1 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocators not exchanged on swap\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   {
+      test_ = "DynamicVector non-propagating allocator";
+
+      using FixedAllocatorType = CountingAllocator<int,false>;
+      using FixedVectorType    = blaze::DynamicVector<int,blaze::rowVector,FixedAllocatorType>;
+
+      AllocationCounter counter1;
+      AllocationCounter counter2;
+
+      {
+         FixedVectorType vec1( 20UL, 1, FixedAllocatorType( counter1 ) );
+         FixedVectorType vec2( 2UL, 0, FixedAllocatorType( counter2 ) );
+
+         vec2 = std::move( vec1 );
+
+         if( vec2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             vec2.size() != 20UL || vec2[0] != 1 || vec2[19] != 1 ||
+             counter2.allocations != 2UL || counter1.elements == 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with different allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << vec2 << "\n"
+                << "   Number of allocations (second allocator) = " << counter2.allocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         FixedVectorType vec3( 3UL, 5, FixedAllocatorType( counter1 ) );
+         swap( vec2, vec3 );
+
+         if( vec2.getAllocator() != FixedAllocatorType( counter2 ) ||
+             vec3.getAllocator() != FixedAllocatorType( counter1 ) ||
+             vec2.size() != 3UL || vec2[0] != 5 || vec2[2] != 5 ||
+             vec3.size() != 20UL || vec3[0] != 1 || vec3[19] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Swap with different allocators failed\n"
+                << " Details:\n"
+                << "   Result (first vector):\n" << vec2 << "\n"
+                << "   Result (second vector):\n" << vec3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const size_t allocations( counter1.allocations );
+
+         FixedVectorType vec4( 2UL, 7, FixedAllocatorType( counter1 ) );
+         vec4 = std::move( vec3 );
+
+         if( vec4.size() != 20UL || vec4[0] != 1 || counter1.allocations != allocations+1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Move assignment with equal allocators failed\n"
+                << " Details:\n"
+                << "   Result:\n" << vec4 << "\n"
+                << "   Number of allocations = " << counter1.allocations << "\n"
+                << "   Expected number of allocations = " << allocations+1UL << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter1.elements != 0UL || counter2.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory not released via the owning allocator\n"
+             << " Details:\n"
+             << "   Outstanding elements (first allocator)  = " << counter1.elements << "\n"
+             << "   Outstanding elements (second allocator) = " << counter2.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Resize and arithmetic
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector allocator resize and arithmetic";
+
+      AllocationCounter counter;
+
+      {
+         VectorType vec( 3UL, 1, AllocatorType( counter ) );
+         vec.resize( 100UL, true );
+
+         checkSize    ( vec, 100UL );
+         checkCapacity( vec, 100UL );
+
+         if( counter.allocations != 2UL || counter.deallocations != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Reallocation not performed via the allocator\n"
+                << " Details:\n"
+                << "   Number of allocations   = " << counter.allocations << "\n"
+                << "   Number of deallocations = " << counter.deallocations << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::DynamicVector<int,blaze::rowVector> ref( 100UL, 2 );
+         vec = 2;
+         vec += ref;
+
+         blaze::DynamicVector<int,blaze::rowVector> res( vec - ref );
+
+         if( vec[0] != 4 || vec[99] != 4 || res != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Arithmetic operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counter.elements != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory leak detected\n"
+             << " Details:\n"
+             << "   Outstanding elements = " << counter.elements << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Allocator without alignment guarantees
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector with std::allocator";
+
+      using StdVectorType = blaze::DynamicVector<double,blaze::columnVector,std::allocator<double> >;
+
+      if( blaze::IsAligned<StdVectorType>::value || blaze::IsPadded<StdVectorType>::value ||
+          StdVectorType( 5UL ).isAligned() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vector without aligned allocator considered aligned or padded\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t n : { 1UL, 7UL, 16UL, 33UL, 200000UL } )
+      {
+         StdVectorType v( n ), w( n );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            v[i] = static_cast<double>( i );
+            w[i] = 2.0 * i;
+         }
+
+         StdVectorType c( v + w );
+         c = c + v * 2.0;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( c[i] != 5.0 * i ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Arithmetic operation failed\n"
+                   << " Details:\n"
+                   << "   Size    = " << n << "\n"
+                   << "   Index   = " << i << "\n"
+                   << "   Result  = " << c[i] << "\n"
+                   << "   Expected result = " << 5.0 * i << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace dynamicvector
 
 } // namespace mathtest
@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/encodedmatrix/ClassTest.cpp
+//  \brief Source file for the EncodedMatrix class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/encodedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace encodedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the EncodedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   using blaze::BFloat16;
+   using blaze::Dictionary;
+
+   testConversion<float,blaze::rowMajor>();
+   testConversion<float,blaze::columnMajor>();
+   testConversion<BFloat16,blaze::rowMajor>();
+   testConversion<BFloat16,blaze::columnMajor>();
+   testConversion<Dictionary<uint8_t>,blaze::rowMajor>();
+   testConversion<Dictionary<uint8_t>,blaze::columnMajor>();
+
+   testRounding<float>();
+   testRounding<BFloat16>();
+
+   testDictionary();
+
+   testAppend();
+
+   testLookup<blaze::rowMajor>();
+   testLookup<blaze::columnMajor>();
+
+   testTranspose<float,blaze::rowMajor>();
+   testTranspose<BFloat16,blaze::columnMajor>();
+   testTranspose<Dictionary<uint8_t>,blaze::rowMajor>();
+   testTranspose<Dictionary<uint16_t>,blaze::columnMajor>();
+
+   testOperations<double,float,blaze::rowMajor>();
+   testOperations<double,float,blaze::columnMajor>();
+   testOperations<double,BFloat16,blaze::rowMajor>();
+   testOperations<float,BFloat16,blaze::columnMajor>();
+   testOperations<double,Dictionary<uint8_t>,blaze::rowMajor>();
+   testOperations<int,Dictionary<uint8_t>,blaze::columnMajor>();
+}
+//*************************************************************************************************
+
+} // namespace encodedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running EncodedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_ENCODEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during EncodedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,213 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/reordering/SparseTest.cpp
+//  \brief Source file for the sparse matrix reordering test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/reordering/SparseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reordering {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseTest test.
+//
+// \exception std::runtime_error Error during reordering detected.
+*/
+SparseTest::SparseTest()
+{
+   testRCM< blaze::CompressedMatrix<int,blaze::rowMajor> >();
+   testRCM< blaze::CompressedMatrix<int,blaze::columnMajor> >();
+   testRCM< blaze::CompressedMatrix<double,blaze::rowMajor> >();
+   testRCM< blaze::CompressedMatrix<double,blaze::columnMajor> >();
+
+   testPermute< blaze::CompressedMatrix<int,blaze::rowMajor> >();
+   testPermute< blaze::CompressedMatrix<int,blaze::columnMajor> >();
+   testPermute< blaze::CompressedMatrix<double,blaze::rowMajor> >();
+   testPermute< blaze::CompressedMatrix<double,blaze::columnMajor> >();
+
+   testVector();
+   testExceptions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the permutation of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the permutation of dense vectors in combination with a permuted sparse
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testVector()
+{
+   test_ = "Dense vector permutation";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A;
+   setupGrid( A, 8UL );
+
+   blaze::DynamicVector<int,blaze::columnVector> x( A.columns() );
+   randomize( x );
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> B( blaze::permute( A, perm ) );
+   const blaze::DynamicVector<int,blaze::columnVector> z( blaze::permute( x, perm ) );
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      if( z[i] != x[perm[i]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vector permutation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Original vector:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::DynamicVector<int,blaze::columnVector> y1( A * x );
+   const blaze::DynamicVector<int,blaze::columnVector> y2( blaze::unpermute( B * z, perm ) );
+
+   if( y1 != y2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with permuted operands failed\n"
+          << " Details:\n"
+          << "   Result:\n" << y2 << "\n"
+          << "   Expected result:\n" << y1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the reordering functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the reordering functions reject non-square matrices and permutations
+// of invalid size. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseTest::testExceptions()
+{
+   test_ = "Reordering of a non-square matrix";
+
+   try {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+      blaze::rcm( A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reordering of a non-square matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   test_ = "Permutation with invalid permutation size";
+
+   try {
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 3UL );
+      blaze::permute( A, std::vector<size_t>( 2UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Permutation with invalid permutation size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace reordering
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix reordering test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSE_REORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix reordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
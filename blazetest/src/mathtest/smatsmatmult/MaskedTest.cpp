@@ -0,0 +1,121 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smatsmatmult/MaskedTest.cpp
+//  \brief Source file for the masked sparse matrix/sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blazetest/mathtest/smatsmatmult/MaskedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MaskedTest test.
+//
+// \exception std::runtime_error Error during the masked multiplication detected.
+*/
+MaskedTest::MaskedTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   for( size_t rep=0UL; rep<5UL; ++rep )
+   {
+      testMaskedMult< blaze::CompressedMatrix<int,rowMajor>
+                    , blaze::CompressedMatrix<int,rowMajor>
+                    , blaze::CompressedMatrix<int,rowMajor> >();
+      testMaskedMult< blaze::CompressedMatrix<int,rowMajor>
+                    , blaze::CompressedMatrix<int,columnMajor>
+                    , blaze::CompressedMatrix<int,rowMajor> >();
+      testMaskedMult< blaze::CompressedMatrix<int,columnMajor>
+                    , blaze::CompressedMatrix<int,rowMajor>
+                    , blaze::CompressedMatrix<int,columnMajor> >();
+      testMaskedMult< blaze::CompressedMatrix<int,columnMajor>
+                    , blaze::CompressedMatrix<int,columnMajor>
+                    , blaze::CompressedMatrix<int,columnMajor> >();
+   }
+
+   testTriangles();
+   testExceptions();
+}
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running masked sparse matrix/sparse matrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_SMATSMATMULT_MASKED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during masked sparse matrix/sparse matrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,392 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/scratcharena/ClassTest.cpp
+//  \brief Source file for the ScratchArena class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blazetest/utiltest/scratcharena/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace scratcharena {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ScratchArena class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocate();
+   testRelease();
+   testCoalesce();
+   testLimit();
+   testScratchArray();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ScratchArena::allocate() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocate() function of the ScratchArena class. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocate()
+{
+   using blaze::ScratchArena;
+
+   test_ = "ScratchArena::allocate()";
+
+   const size_t chunkSize( ScratchArena::minChunkSize );
+
+   ScratchArena arena;
+   checkValue( arena.capacity(), 0UL );
+   checkValue( arena.used(), 0UL );
+
+   const ScratchArena::Marker marker( arena.mark() );
+
+   // Allocation of zero bytes
+   void* const ptr1( arena.allocate( 0UL, 8UL ) );
+   checkValue( ptr1 != nullptr, true );
+   checkValue( arena.capacity(), chunkSize );
+
+   // Aligned allocations within the same chunk
+   char* const ptr2( static_cast<char*>( arena.allocate( 3UL, 1UL ) ) );
+   char* const ptr3( static_cast<char*>( arena.allocate( 100UL, 32UL ) ) );
+   char* const ptr4( static_cast<char*>( arena.allocate( 8UL, 64UL ) ) );
+   checkAlignment( ptr3, 32UL );
+   checkAlignment( ptr4, 64UL );
+   checkValue( ptr2 + 3UL <= ptr3, true );
+   checkValue( ptr3 + 100UL <= ptr4, true );
+   checkValue( arena.capacity(), chunkSize );
+
+   // Allocation exceeding the current chunk
+   char* const ptr5( static_cast<char*>( arena.allocate( chunkSize, 64UL ) ) );
+   checkAlignment( ptr5, 64UL );
+   checkValue( arena.capacity(), 3UL*chunkSize );
+   checkValue( arena.used(), 2UL*chunkSize );
+
+   for( size_t i=0UL; i<chunkSize; ++i ) {
+      ptr5[i] = 1;
+   }
+
+   arena.release( marker );
+   checkValue( arena.used(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ScratchArena::mark() and ScratchArena::release() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mark() and release() functions of the ScratchArena
+// class. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRelease()
+{
+   using blaze::ScratchArena;
+
+   test_ = "ScratchArena::release()";
+
+   ScratchArena arena;
+
+   const ScratchArena::Marker marker1( arena.mark() );
+   void* const ptr1( arena.allocate( 128UL, 16UL ) );
+
+   const ScratchArena::Marker marker2( arena.mark() );
+   void* const ptr2( arena.allocate( 256UL, 16UL ) );
+   checkValue( arena.used(), 384UL );
+
+   // Returning the most recent allocation
+   arena.release( marker2 );
+   checkValue( arena.used(), 128UL );
+   checkValue( arena.allocate( 256UL, 16UL ), ptr2 );
+
+   // Returning both allocations
+   arena.release( marker1 );
+   checkValue( arena.used(), 0UL );
+   checkValue( arena.allocate( 128UL, 16UL ), ptr1 );
+
+   // Releasing the current position
+   const ScratchArena::Marker marker3( arena.mark() );
+   arena.release( marker3 );
+   checkValue( arena.used(), 128UL );
+
+   arena.release( marker1 );
+   checkValue( arena.used(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the merging of the chunks of an empty scratch arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all chunks of a completely released scratch arena are merged into
+// a single chunk, which is able to serve the same sequence of allocations without acquiring
+// further memory. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCoalesce()
+{
+   using blaze::ScratchArena;
+
+   test_ = "ScratchArena chunk merging";
+
+   const size_t chunkSize( ScratchArena::minChunkSize );
+   const size_t bytes( chunkSize / 2UL + 64UL );
+
+   ScratchArena arena;
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      const ScratchArena::Marker marker( arena.mark() );
+
+      for( size_t j=0UL; j<4UL; ++j ) {
+         arena.allocate( bytes, 64UL );
+      }
+
+      // The first pass requires two chunks, all further passes fit into the merged chunk
+      if( i == 0UL ) {
+         checkValue( arena.used(), chunkSize + 3UL*bytes );
+      }
+      else {
+         checkValue( arena.used(), 4UL*bytes );
+      }
+
+      arena.release( marker );
+      checkValue( arena.used(), 0UL );
+      checkValue( arena.capacity(), 3UL*chunkSize );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the capacity limit of the scratch arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that requests exceeding the capacity limit of the scratch arena are
+// served by the system allocator and are returned on release without affecting the chunks of
+// the arena. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLimit()
+{
+   using blaze::ScratchArena;
+
+   test_ = "ScratchArena capacity limit";
+
+   const size_t chunkSize( ScratchArena::minChunkSize );
+   const size_t bytes( ScratchArena::maxCapacity );
+
+   ScratchArena arena;
+
+   const ScratchArena::Marker marker1( arena.mark() );
+   arena.allocate( 128UL, 16UL );
+   checkValue( arena.capacity(), chunkSize );
+
+   // Allocation exceeding the capacity limit
+   char* const ptr1( static_cast<char*>( arena.allocate( bytes, 64UL ) ) );
+   checkAlignment( ptr1, 64UL );
+   checkValue( arena.capacity(), chunkSize );
+   checkValue( arena.used(), 128UL + bytes );
+
+   ptr1[0UL] = 1;
+   ptr1[bytes-1UL] = 1;
+
+   // Nested allocation within the current chunk
+   const ScratchArena::Marker marker2( arena.mark() );
+   char* const ptr2( static_cast<char*>( arena.allocate( 256UL, 16UL ) ) );
+   checkValue( ptr2 + 256UL <= ptr1 || ptr1 + bytes <= ptr2, true );
+   checkValue( arena.used(), 384UL + bytes );
+
+   // Releasing the nested allocation keeps the block beyond the capacity limit
+   arena.release( marker2 );
+   checkValue( arena.used(), 128UL + bytes );
+
+   // Releasing all allocations
+   arena.release( marker1 );
+   checkValue( arena.used(), 0UL );
+   checkValue( arena.capacity(), chunkSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ScratchArray class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ScratchArray class template, which draws its memory
+// from the scratch arena of the calling thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScratchArray()
+{
+   using blaze::ScratchArray;
+   using blaze::getScratchArena;
+
+   test_ = "ScratchArray";
+
+   const size_t used( getScratchArena().used() );
+
+   {
+      ScratchArray<double> array1( 10UL );
+      checkAlignment( array1.data(), blaze::AlignmentOf<double>::value );
+
+      for( size_t i=0UL; i<10UL; ++i ) {
+         array1.data()[i] = 1.0;
+      }
+
+      {
+         ScratchArray<float> array2( 7UL );
+         checkAlignment( array2.data(), blaze::AlignmentOf<float>::value );
+         checkValue( static_cast<void*>( array2.data() ) >= static_cast<void*>( array1.data() + 10UL ), true );
+         checkValue( getScratchArena().used() > used, true );
+      }
+
+      ScratchArray<float> array3( 7UL );
+      checkValue( static_cast<void*>( array3.data() ) >= static_cast<void*>( array1.data() + 10UL ), true );
+   }
+
+   checkValue( getScratchArena().used(), used );
+
+   // Every thread uses a separate scratch arena
+   const blaze::ScratchArena* arena( nullptr );
+   std::thread thread( [&arena]() { arena = &getScratchArena(); } );
+   thread.join();
+   checkValue( arena != &getScratchArena(), true );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the alignment of the given address.
+//
+// \param ptr The address to be checked.
+// \param alignment The expected minimum alignment.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkAlignment( const void* ptr, size_t alignment ) const
+{
+   if( reinterpret_cast<std::uintptr_t>( ptr ) % alignment != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n"
+          << " Details:\n"
+          << "   Address           : " << ptr << "\n"
+          << "   Expected alignment: " << alignment << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace scratcharena
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ScratchArena class test..." << std::endl;
+
+   try
+   {
+      RUN_SCRATCHARENA_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ScratchArena class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,642 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/threadpool/TaskQueue.h>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testTask();
+   testTaskQueue();
+   testSchedule();
+   testTaskGroup();
+   testResize();
+   testClear();
+   testAffinity();
+   testSpinning();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Task class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Task class for small functors stored in the internal
+// buffer and for large functors stored on the heap. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTask()
+{
+   using blaze::threadpool::Task;
+
+   //=====================================================================================
+   // Small functor
+   //=====================================================================================
+
+   {
+      test_ = "Task with small functor";
+
+      int counter( 0 );
+
+      Task task1( [&counter]() { ++counter; } );
+      task1();
+      checkValue( counter, 1 );
+
+      Task task2( std::move( task1 ) );
+      checkValue( static_cast<bool>( task1 ), false );
+      task2();
+      checkValue( counter, 2 );
+
+      Task task3;
+      checkValue( static_cast<bool>( task3 ), false );
+      task3 = std::move( task2 );
+      task3();
+      checkValue( counter, 3 );
+
+      task3.reset();
+      checkValue( static_cast<bool>( task3 ), false );
+   }
+
+
+   //=====================================================================================
+   // Large functor
+   //=====================================================================================
+
+   {
+      test_ = "Task with large functor";
+
+      struct Large {
+         void operator()() { *counter_ += data_[0] + data_[Task::storageSize]; }
+         int  data_[Task::storageSize+1UL];
+         int* counter_;
+      };
+
+      int counter( 0 );
+
+      Large large;
+      large.data_[0] = 1;
+      large.data_[Task::storageSize] = 2;
+      large.counter_ = &counter;
+
+      Task task1( large );
+      task1();
+      checkValue( counter, 3 );
+
+      Task task2( std::move( task1 ) );
+      task2();
+      checkValue( counter, 6 );
+   }
+
+
+   //=====================================================================================
+   // Destruction of the stored functor
+   //=====================================================================================
+
+   {
+      test_ = "Task destruction";
+
+      std::shared_ptr<int> ptr( std::make_shared<int>( 0 ) );
+
+      {
+         Task task( [ptr]() { ++*ptr; } );
+         checkValue( ptr.use_count(), 2L );
+         task();
+      }
+
+      checkValue( ptr.use_count(), 1L );
+      checkValue( *ptr, 1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TaskQueue class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the TaskQueue class. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTaskQueue()
+{
+   using blaze::threadpool::Task;
+   using blaze::threadpool::TaskQueue;
+
+   test_ = "TaskQueue push and pop";
+
+   TaskQueue queue( 5UL );
+   checkValue( queue.maxSize(), 8UL );
+   checkValue( queue.isEmpty(), true );
+
+   int counter( 0 );
+
+   for( int i=1; i<=8; ++i ) {
+      Task task( [&counter,i]() { counter = 10*counter + i; } );
+      checkValue( queue.push( task ), true );
+      checkValue( static_cast<bool>( task ), false );
+   }
+
+   checkValue( queue.size(), 8UL );
+
+   Task overflow( []() {} );
+   checkValue( queue.push( overflow ), false );
+   checkValue( static_cast<bool>( overflow ), true );
+
+   Task task;
+   for( size_t i=0UL; i<4UL; ++i ) {
+      checkValue( queue.pop( task ), true );
+      task();
+   }
+
+   checkValue( counter, 1234 );
+   checkValue( queue.size(), 4UL );
+
+   queue.clear();
+   checkValue( queue.isEmpty(), true );
+   checkValue( queue.pop( task ), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the task scheduling of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the schedule() and wait() functions of the ThreadPool class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "ThreadPool::schedule()";
+
+   ThreadPool pool( 3UL );
+   checkValue( pool.size(), 3UL );
+
+   std::atomic<size_t> counter( 0UL );
+
+   for( size_t i=1UL; i<=10UL; ++i )
+   {
+      // More tasks than the task queues can hold
+      for( size_t j=0UL; j<10000UL; ++j ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+
+      // Tasks with arguments
+      pool.schedule( []( std::atomic<size_t>& c, size_t a, size_t b ) { c += a+b; }
+                   , std::ref( counter ), 4UL, 6UL );
+
+      pool.wait();
+
+      checkValue( counter.load(), i*10010UL );
+      checkValue( pool.isEmpty(), true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the task groups of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the schedule() and wait() functions of the ThreadPool class
+// template for task groups. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testTaskGroup()
+{
+   test_ = "ThreadPool::wait() for a task group";
+
+   ThreadPool pool( 2UL );
+
+   std::atomic<bool> release( false );
+   std::atomic<bool> finished( false );
+   std::atomic<size_t> counter( 0UL );
+
+   // Task outside of the group, which is blocked until the task group has been completed
+   pool.schedule( [&release,&finished]() {
+      while( !release ) {
+         std::this_thread::yield();
+      }
+      finished = true;
+   } );
+
+   blaze::threadpool::TaskGroup group;
+
+   for( size_t j=0UL; j<1000UL; ++j ) {
+      pool.schedule( group, [&counter]() { ++counter; } );
+   }
+
+   pool.wait( group );
+
+   checkValue( group.isDone(), true );
+   checkValue( counter.load(), 1000UL );
+   checkValue( finished.load(), false );
+
+   release = true;
+   pool.wait();
+
+   checkValue( finished.load(), true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() function of the ThreadPool class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "ThreadPool::resize()";
+
+   ThreadPool pool( 2UL );
+
+   std::atomic<size_t> counter( 0UL );
+
+   for( size_t j=0UL; j<1000UL; ++j ) {
+      pool.schedule( [&counter]() { ++counter; } );
+   }
+
+   pool.resize( 5UL, true );
+   checkValue( pool.size(), 5UL );
+
+   for( size_t j=0UL; j<1000UL; ++j ) {
+      pool.schedule( [&counter]() { ++counter; } );
+   }
+
+   pool.resize( 1UL, true );
+   checkValue( pool.size(), 1UL );
+
+   pool.wait();
+   checkValue( counter.load(), 2000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() function of the ThreadPool class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "ThreadPool::clear()";
+
+   ThreadPool pool( 2UL );
+
+   std::atomic<size_t> counter( 0UL );
+
+   for( size_t j=0UL; j<1000UL; ++j ) {
+      pool.schedule( [&counter]() {
+         std::this_thread::sleep_for( std::chrono::microseconds( 10 ) );
+         ++counter;
+      } );
+   }
+
+   pool.clear();
+   pool.wait();
+
+   checkValue( pool.isEmpty(), true );
+
+   const size_t executed( counter.load() );
+
+   if( executed == 1000UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the thread pool failed\n"
+          << " Details:\n"
+          << "   Number of executed tasks: " << executed << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pool.wait();
+   checkValue( counter.load(), executed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the affinity functionality of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parsing of CPU lists and of the affinity() and
+// setAffinity() functions of the ThreadPool class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffinity()
+{
+   using blaze::threadpool::availableCPUs;
+   using blaze::threadpool::compactOrder;
+   using blaze::threadpool::parseCPUList;
+   using blaze::threadpool::scatterOrder;
+
+
+   //=====================================================================================
+   // CPU lists
+   //=====================================================================================
+
+   {
+      test_ = "parseCPUList()";
+
+      const std::vector<size_t> cpus( parseCPUList( "0-2,5, 7" ) );
+
+      checkValue( cpus.size(), 5UL );
+      checkValue( cpus[0], 0UL );
+      checkValue( cpus[1], 1UL );
+      checkValue( cpus[2], 2UL );
+      checkValue( cpus[3], 5UL );
+      checkValue( cpus[4], 7UL );
+
+      try {
+         parseCPUList( "3-1" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an invalid CPU list succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         parseCPUList( "0,123456789012345678901234567890" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parsing an out-of-range CPU index succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "parseCPUList() with huge CPU ranges";
+
+      const std::vector<size_t> cpus( parseCPUList( "2-99999999999" ) );
+
+      checkValue( cpus.empty(), false );
+      checkValue( cpus.front(), 2UL );
+      checkValue( cpus.back() < 99999999999UL, true );
+      checkValue( cpus.size(), cpus.back() - 1UL );
+
+      checkValue( parseCPUList( "99999999999" ).empty(), true );
+   }
+
+
+   //=====================================================================================
+   // Affinity policies
+   //=====================================================================================
+
+   {
+      test_ = "compactOrder() and scatterOrder()";
+
+      std::vector<size_t> cpus( availableCPUs() );
+      checkValue( cpus.empty(), false );
+
+      std::vector<size_t> compact( compactOrder( cpus ) );
+      std::vector<size_t> scatter( scatterOrder( cpus ) );
+
+      std::sort( cpus.begin(), cpus.end() );
+      std::sort( compact.begin(), compact.end() );
+      std::sort( scatter.begin(), scatter.end() );
+
+      checkValue( compact == cpus, true );
+      checkValue( scatter == cpus, true );
+   }
+
+
+   //=====================================================================================
+   // ThreadPool::setAffinity()
+   //=====================================================================================
+
+   {
+      test_ = "ThreadPool::setAffinity()";
+
+      const std::vector<size_t> cpus( 1UL, availableCPUs().front() );
+
+      ThreadPool pool( 3UL );
+      pool.setAffinity( cpus );
+      checkValue( pool.affinity() == cpus, true );
+
+      std::atomic<size_t> counter( 0UL );
+
+      for( size_t j=0UL; j<1000UL; ++j ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+
+      pool.resize( 5UL );
+      checkValue( pool.size(), 5UL );
+
+      pool.wait();
+      checkValue( counter.load(), 1000UL );
+
+      pool.setAffinity( std::vector<size_t>() );
+      checkValue( pool.affinity().empty(), true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the spin waiting functionality of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the spinTime() and setSpinTime() functions of the ThreadPool
+// class template and of the task scheduling with spinning threads. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpinning()
+{
+   test_ = "ThreadPool::setSpinTime()";
+
+   ThreadPool pool( 3UL, std::vector<size_t>(), 50UL );
+   checkValue( pool.spinTime(), 50UL );
+
+   std::atomic<size_t> counter( 0UL );
+
+   for( size_t i=1UL; i<=1000UL; ++i )
+   {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+
+      pool.wait();
+      checkValue( counter.load(), i*3UL );
+
+      // Switching between spinning and blocking threads
+      if( i % 100UL == 0UL ) {
+         pool.setSpinTime( pool.spinTime() == 0UL ? 50UL : 0UL );
+      }
+   }
+
+   pool.resize( 1UL, true );
+   checkValue( pool.size(), 1UL );
+
+   pool.schedule( [&counter]() { ++counter; } );
+   pool.wait();
+   checkValue( counter.load(), 3001UL );
+
+
+   //=====================================================================================
+   // Oversubscription
+   //=====================================================================================
+
+   {
+      test_ = "ThreadPool spinning with more threads than CPUs";
+
+      const size_t cpus( blaze::threadpool::availableCPUs().size() );
+
+      ThreadPool oversubscribed( cpus+1UL, std::vector<size_t>(), 1000000UL );
+      checkValue( oversubscribed.spinTime(), 1000000UL );
+
+      for( size_t i=0UL; i<=cpus; ++i ) {
+         oversubscribed.schedule( [&counter]() { ++counter; } );
+      }
+
+      oversubscribed.wait();
+      checkValue( counter.load(), 3002UL + cpus );
+
+      // Idle threads must block instead of spinning
+      const std::clock_t start( std::clock() );
+      std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+      const double seconds( static_cast<double>( std::clock() - start ) / CLOCKS_PER_SEC );
+
+      if( seconds > 0.1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Idle threads are spinning\n"
+             << " Details:\n"
+             << "   Consumed CPU time = " << seconds << "s\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************